@@ -0,0 +1,47 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_interface/arrow_array_schema_proxy.hpp"
+#include "sparrow/layout/array_factory.hpp"
+#include "sparrow/primitive_array.hpp"
+
+namespace sparrow::benchmark
+{
+    // Wraps the same small int32 array in a new wrapper at each iteration, from
+    // several threads at once. The proxy views the structures without owning them,
+    // so the loop measures the registry dispatch rather than the buffer copies.
+    static void BM_ArrayFactory(::benchmark::State& state)
+    {
+        auto [array, schema] = extract_arrow_structures(
+            primitive_array<std::int32_t>(std::vector<std::int32_t>(16, 1))
+        );
+        for (auto _ : state)
+        {
+            auto wrapper = array_factory(arrow_proxy(&array, &schema));
+            ::benchmark::DoNotOptimize(wrapper);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+        array.release(&array);
+        schema.release(&schema);
+    }
+
+    BENCHMARK(BM_ArrayFactory)->ThreadRange(1, 8)->UseRealTime();
+}
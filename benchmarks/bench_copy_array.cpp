@@ -0,0 +1,83 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/builder.hpp"
+#include "sparrow/struct_array.hpp"
+
+namespace sparrow::benchmark
+{
+    // A struct array of 200 columns, alternating integers and strings, like a wide record batch
+    std::pair<ArrowArray, ArrowSchema> make_wide_struct(std::size_t row_count)
+    {
+        constexpr std::size_t column_count = 200;
+        std::vector<array> children;
+        children.reserve(column_count);
+        for (std::size_t i = 0; i < column_count; ++i)
+        {
+            if (i % 2 == 0)
+            {
+                children.emplace_back(build(std::vector<std::int64_t>(row_count, static_cast<std::int64_t>(i))));
+            }
+            else
+            {
+                children.emplace_back(build(std::vector<std::string>(row_count, "value " + std::to_string(i))));
+            }
+        }
+        return extract_arrow_structures(struct_array(std::move(children)));
+    }
+
+    static void BM_CopyArray(::benchmark::State& state)
+    {
+        auto [array, schema] = make_wide_struct(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            ArrowArray copy = copy_array(array, schema);
+            ::benchmark::DoNotOptimize(copy);
+            copy.release(&copy);
+        }
+        array.release(&array);
+        schema.release(&schema);
+    }
+
+    // range(1) is the maximum number of threads
+    static void BM_ParallelCopyArray(::benchmark::State& state)
+    {
+        auto [array, schema] = make_wide_struct(static_cast<std::size_t>(state.range(0)));
+        const auto max_threads = static_cast<std::size_t>(state.range(1));
+        for (auto _ : state)
+        {
+            ArrowArray copy = parallel_copy_array(array, schema, max_threads);
+            ::benchmark::DoNotOptimize(copy);
+            copy.release(&copy);
+        }
+        array.release(&array);
+        schema.release(&schema);
+    }
+
+    BENCHMARK(BM_CopyArray)->Arg(10000)->Arg(100000)->UseRealTime()->Unit(::benchmark::kMillisecond);
+    BENCHMARK(BM_ParallelCopyArray)
+        ->ArgsProduct({{10000, 100000}, {2, 4, 8}})
+        ->ArgNames({"rows", "threads"})
+        ->UseRealTime()
+        ->Unit(::benchmark::kMillisecond);
+}  // namespace sparrow::benchmark
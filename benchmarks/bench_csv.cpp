@@ -0,0 +1,73 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "sparrow/csv/reader.hpp"
+
+namespace sparrow::benchmark
+{
+    std::string make_csv(std::size_t row_count)
+    {
+        std::string csv = "id,price,name,day,at\n";
+        for (std::size_t i = 0; i < row_count; ++i)
+        {
+            csv += std::to_string(i) + ',' + std::to_string(static_cast<double>(i) * 0.25) + ",\"name "
+                   + std::to_string(i % 1000) + "\",2024-03-" + std::to_string(10 + i % 19)
+                   + ",2024-03-01T12:30:" + std::to_string(10 + i % 50) + ".250Z\n";
+        }
+        return csv;
+    }
+
+    // range(1) is the number of parsing threads; the "bytes_per_core" counter gives the
+    // throughput of a single thread, to be compared across thread counts
+    static void BM_CSV_Read(::benchmark::State& state)
+    {
+        const std::string csv = make_csv(static_cast<std::size_t>(state.range(0)));
+        const auto thread_count = static_cast<std::size_t>(state.range(1));
+        const csv::read_options options{.max_threads = thread_count};
+        for (auto _ : state)
+        {
+            auto batches = csv::read_csv(csv, options);
+            ::benchmark::DoNotOptimize(batches);
+        }
+        const auto bytes = static_cast<double>(state.iterations()) * static_cast<double>(csv.size());
+        state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+        state.counters["bytes_per_core"] = ::benchmark::Counter(
+            bytes / static_cast<double>(thread_count),
+            ::benchmark::Counter::kIsRate,
+            ::benchmark::Counter::kIs1024
+        );
+    }
+
+    static void BM_CSV_InferSchema(::benchmark::State& state)
+    {
+        const std::string csv = make_csv(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto schema = csv::infer_schema(csv);
+            ::benchmark::DoNotOptimize(schema);
+        }
+    }
+
+    BENCHMARK(BM_CSV_Read)
+        ->ArgsProduct({{1000000}, {1, 2, 4, 8}})
+        ->ArgNames({"rows", "threads"})
+        ->UseRealTime()
+        ->Unit(::benchmark::kMillisecond);
+    BENCHMARK(BM_CSV_InferSchema)->Arg(100000)->Unit(::benchmark::kMicrosecond);
+}  // namespace sparrow::benchmark
@@ -21,6 +21,7 @@
 #include <benchmark/benchmark.h>
 
 #include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp"
 
 namespace sparrow::benchmark
 {
@@ -535,6 +536,194 @@ namespace sparrow::benchmark
         state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
     }
 
+    // Benchmark: bit-by-bit AND, the baseline of the bitwise operations
+    template <typename T>
+    static void BM_DynamicBitset_BitwiseAndLoop(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        dynamic_bitset<T> lhs(get_bool_data(size), typename dynamic_bitset<T>::default_allocator());
+        const dynamic_bitset<T> rhs(get_bool_data(size, LOW_TRUE_PROBABILITY), typename dynamic_bitset<T>::default_allocator());
+
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                lhs.set(i, lhs.test(i) && rhs.test(i));
+            }
+            ::benchmark::DoNotOptimize(lhs.data());
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Helper for the bitwise operations between bitsets with the same offset
+    template <typename T, typename F>
+    static void run_bitwise_benchmark(::benchmark::State& state, F&& op)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        dynamic_bitset<T> lhs(get_bool_data(size), typename dynamic_bitset<T>::default_allocator());
+        const dynamic_bitset<T> rhs(get_bool_data(size, LOW_TRUE_PROBABILITY), typename dynamic_bitset<T>::default_allocator());
+
+        for (auto _ : state)
+        {
+            op(lhs, rhs);
+            ::benchmark::DoNotOptimize(lhs.data());
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: bitwise_and() operation
+    template <typename T>
+    static void BM_DynamicBitset_BitwiseAnd(::benchmark::State& state)
+    {
+        run_bitwise_benchmark<T>(
+            state,
+            [](auto& lhs, const auto& rhs)
+            {
+                lhs.bitwise_and(rhs);
+            }
+        );
+    }
+
+    // Benchmark: bitwise_or() operation
+    template <typename T>
+    static void BM_DynamicBitset_BitwiseOr(::benchmark::State& state)
+    {
+        run_bitwise_benchmark<T>(
+            state,
+            [](auto& lhs, const auto& rhs)
+            {
+                lhs.bitwise_or(rhs);
+            }
+        );
+    }
+
+    // Benchmark: bitwise_xor() operation
+    template <typename T>
+    static void BM_DynamicBitset_BitwiseXor(::benchmark::State& state)
+    {
+        run_bitwise_benchmark<T>(
+            state,
+            [](auto& lhs, const auto& rhs)
+            {
+                lhs.bitwise_xor(rhs);
+            }
+        );
+    }
+
+    // Benchmark: bitwise_and_not() operation
+    template <typename T>
+    static void BM_DynamicBitset_BitwiseAndNot(::benchmark::State& state)
+    {
+        run_bitwise_benchmark<T>(
+            state,
+            [](auto& lhs, const auto& rhs)
+            {
+                lhs.bitwise_and_not(rhs);
+            }
+        );
+    }
+
+    // Benchmark: bitwise_and() between a bitset and a view with an unaligned offset
+    template <typename T>
+    static void BM_DynamicBitset_BitwiseAndUnaligned(::benchmark::State& state)
+    {
+        constexpr size_t rhs_offset = 3;
+        const size_t size = static_cast<size_t>(state.range(0));
+        dynamic_bitset<T> lhs(get_bool_data(size), typename dynamic_bitset<T>::default_allocator());
+        dynamic_bitset<T> rhs_storage(
+            get_bool_data(size + rhs_offset, LOW_TRUE_PROBABILITY),
+            typename dynamic_bitset<T>::default_allocator()
+        );
+        const dynamic_bitset_view<T> rhs(rhs_storage.data(), size, rhs_offset);
+
+        for (auto _ : state)
+        {
+            lhs.bitwise_and(rhs);
+            ::benchmark::DoNotOptimize(lhs.data());
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: erasing a range near the front by moving the tail bit by bit, as a baseline for erase()
+    template <typename T>
+    static void BM_DynamicBitset_EraseRangeLoop(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        const auto& data = get_bool_data(size);
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            dynamic_bitset<T> bitset(data, typename dynamic_bitset<T>::default_allocator());
+            state.ResumeTiming();
+
+            const size_t first = 3;
+            const size_t last = first + INSERT_ERASE_COUNT;
+            for (size_t i = last; i < bitset.size(); ++i)
+            {
+                bitset.set(i - INSERT_ERASE_COUNT, bitset.test(i));
+            }
+            bitset.resize(bitset.size() - INSERT_ERASE_COUNT);
+
+            ::benchmark::DoNotOptimize(bitset);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: erasing a range near the front, which moves the whole tail
+    template <typename T>
+    static void BM_DynamicBitset_EraseRange(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        const auto& data = get_bool_data(size);
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            dynamic_bitset<T> bitset(data, typename dynamic_bitset<T>::default_allocator());
+            state.ResumeTiming();
+
+            const auto first = bitset.cbegin() + 3;
+            bitset.erase(first, first + static_cast<std::ptrdiff_t>(INSERT_ERASE_COUNT));
+
+            ::benchmark::DoNotOptimize(bitset);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: inserting a range near the front, which moves the whole tail
+    template <typename T>
+    static void BM_DynamicBitset_InsertRange(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        const auto& data = get_bool_data(size);
+        const auto& values = get_bool_data(INSERT_ERASE_COUNT, LOW_TRUE_PROBABILITY);
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            dynamic_bitset<T> bitset(data, typename dynamic_bitset<T>::default_allocator());
+            state.ResumeTiming();
+
+            bitset.insert(bitset.cbegin() + 3, values.begin(), values.end());
+
+            ::benchmark::DoNotOptimize(bitset);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
     constexpr size_t range_min = 10000;
     constexpr size_t range_max = 1000000;
     constexpr size_t range_multiplier = 100;
@@ -596,6 +785,18 @@ namespace sparrow::benchmark
         ->Range(range_min, range_max)                                  \
         ->Unit(::benchmark::kMicrosecond)                              \
         ->UseManualTime();                                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_EraseRangeLoop, TYPE)          \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_EraseRange, TYPE)              \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_InsertRange, TYPE)             \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
     BENCHMARK_TEMPLATE(BM_DynamicBitset_Resize, TYPE)                  \
         ->RangeMultiplier(range_multiplier)                            \
         ->Range(range_min, range_max)                                  \
@@ -611,7 +812,31 @@ namespace sparrow::benchmark
     BENCHMARK_TEMPLATE(BM_DynamicBitset_CountNonNull, TYPE)            \
         ->RangeMultiplier(range_multiplier)                            \
         ->Range(range_min, range_max)                                  \
-        ->Unit(::benchmark::kNanosecond);
+        ->Unit(::benchmark::kNanosecond);                              \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_BitwiseAndLoop, TYPE)          \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_BitwiseAnd, TYPE)              \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_BitwiseOr, TYPE)               \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_BitwiseXor, TYPE)              \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_BitwiseAndNot, TYPE)           \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);                             \
+    BENCHMARK_TEMPLATE(BM_DynamicBitset_BitwiseAndUnaligned, TYPE)     \
+        ->RangeMultiplier(range_multiplier)                            \
+        ->Range(range_min, range_max)                                  \
+        ->Unit(::benchmark::kMicrosecond);
 
     // Register benchmarks for different block types
     REGISTER_DYNAMIC_BITSET_BENCHMARKS(std::uint8_t)
@@ -0,0 +1,159 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "sparrow/builder.hpp"
+#include "sparrow/ipc/memory_mapped_file.hpp"
+#include "sparrow/ipc/reader.hpp"
+#include "sparrow/ipc/writer.hpp"
+#include "sparrow/record_batch.hpp"
+
+namespace sparrow::benchmark
+{
+    record_batch make_ipc_batch(std::size_t row_count)
+    {
+        std::vector<std::int64_t> ints(row_count);
+        std::vector<double> doubles(row_count);
+        std::vector<std::string> strings(row_count);
+        for (std::size_t i = 0; i < row_count; ++i)
+        {
+            ints[i] = static_cast<std::int64_t>(i);
+            doubles[i] = static_cast<double>(i) * 0.5;
+            strings[i] = std::to_string(i);
+        }
+        return record_batch(
+            std::vector<std::string>{"ints", "doubles", "strings"},
+            std::vector<array>{array(build(ints)), array(build(doubles)), array(build(strings))}
+        );
+    }
+
+    std::vector<std::uint8_t>
+    write_ipc_stream(const record_batch& batch, std::optional<ipc::compression_codec> compression = std::nullopt)
+    {
+        std::ostringstream out;
+        ipc::stream_writer writer(out, ipc::write_options{.compression = compression});
+        writer.write(batch);
+        writer.close();
+        const std::string str = out.str();
+        return {str.begin(), str.end()};
+    }
+
+    static void BM_IPC_WriteStream(::benchmark::State& state)
+    {
+        const auto batch = make_ipc_batch(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto bytes = write_ipc_stream(batch);
+            ::benchmark::DoNotOptimize(bytes);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // The read side does not copy the buffers: its cost does not depend on the number of rows
+    static void BM_IPC_ReadStream(::benchmark::State& state)
+    {
+        const auto bytes = write_ipc_stream(make_ipc_batch(static_cast<std::size_t>(state.range(0))));
+        for (auto _ : state)
+        {
+            ipc::stream_reader reader(bytes);
+            auto batch = reader.next();
+            ::benchmark::DoNotOptimize(batch);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Reads 3 columns of a file of 200 columns: with lazy columns, the cost depends
+    // on the number of columns read only
+    static void BM_IPC_ReadMappedColumns(::benchmark::State& state)
+    {
+        constexpr std::size_t column_count = 200;
+        const auto row_count = static_cast<std::size_t>(state.range(0));
+        std::vector<std::string> names;
+        std::vector<array> columns;
+        for (std::size_t i = 0; i < column_count; ++i)
+        {
+            names.push_back("c" + std::to_string(i));
+            columns.emplace_back(build(std::vector<std::int64_t>(row_count, static_cast<std::int64_t>(i))));
+        }
+        const auto path = std::filesystem::temp_directory_path() / "sparrow_bench_ipc.arrow";
+        {
+            std::ofstream out(path, std::ios::binary);
+            ipc::file_writer writer(out);
+            writer.write(record_batch(names, std::move(columns)));
+            writer.close();
+        }
+
+        const bool lazy = state.range(1) != 0;
+        for (auto _ : state)
+        {
+            auto reader = ipc::open_mapped_file(path, ipc::read_options{.lazy_columns = lazy});
+            const auto batch = reader.get_record_batch(0);
+            for (const std::size_t i : {std::size_t(3), std::size_t(100), std::size_t(197)})
+            {
+                const auto& column = batch.get_column(i);
+                ::benchmark::DoNotOptimize(column[row_count - 1]);
+            }
+        }
+        std::filesystem::remove(path);
+    }
+
+    // Round trip of a compressed stream, range(1) is the codec: -1 for none,
+    // 0 for LZ4 frame, 1 for ZSTD
+    static void BM_IPC_CompressedRoundTrip(::benchmark::State& state)
+    {
+        std::optional<ipc::compression_codec> compression;
+        if (state.range(1) >= 0)
+        {
+            compression = static_cast<ipc::compression_codec>(state.range(1));
+            if (!ipc::is_codec_available(*compression))
+            {
+                state.SkipWithError("codec not available");
+                return;
+            }
+        }
+        const auto batch = make_ipc_batch(static_cast<std::size_t>(state.range(0)));
+        const auto uncompressed_size = write_ipc_stream(batch).size();
+        std::size_t size = 0;
+        for (auto _ : state)
+        {
+            const auto bytes = write_ipc_stream(batch, compression);
+            ipc::stream_reader reader(bytes);
+            auto read = reader.next();
+            ::benchmark::DoNotOptimize(read);
+            size = bytes.size();
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * uncompressed_size));
+        state.counters["ratio"] = static_cast<double>(uncompressed_size) / static_cast<double>(size);
+    }
+
+    BENCHMARK(BM_IPC_WriteStream)->RangeMultiplier(100)->Range(100, 1000000)->Unit(::benchmark::kMicrosecond);
+    BENCHMARK(BM_IPC_ReadStream)->RangeMultiplier(100)->Range(100, 1000000)->Unit(::benchmark::kMicrosecond);
+    BENCHMARK(BM_IPC_ReadMappedColumns)
+        ->ArgsProduct({{1000, 100000}, {0, 1}})
+        ->ArgNames({"rows", "lazy"})
+        ->Unit(::benchmark::kMicrosecond);
+    BENCHMARK(BM_IPC_CompressedRoundTrip)
+        ->ArgsProduct({{1000000}, {-1, 0, 1}})
+        ->ArgNames({"rows", "codec"})
+        ->Unit(::benchmark::kMillisecond);
+}  // namespace sparrow::benchmark
@@ -0,0 +1,105 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "sparrow/array.hpp"
+#include "sparrow/buffer/memory_resource.hpp"
+#include "sparrow/builder.hpp"
+
+namespace sparrow::benchmark
+{
+    using row_type = std::tuple<std::int64_t, double, std::string>;
+
+    // A batch of small nested columns: each row is a list of structs
+    std::vector<std::vector<row_type>> make_batch_data(std::size_t row_count)
+    {
+        std::vector<std::vector<row_type>> data(row_count);
+        for (std::size_t i = 0; i < row_count; ++i)
+        {
+            for (std::size_t j = 0; j < i % 4; ++j)
+            {
+                data[i].emplace_back(static_cast<std::int64_t>(i), static_cast<double>(j), std::to_string(i));
+            }
+        }
+        return data;
+    }
+
+    constexpr std::size_t columns_per_batch = 16;
+
+    // The columns of a batch are kept alive until the whole batch is built, as in a
+    // record_batch, so that the default allocator cannot simply reuse the block freed
+    // by the previous column.
+    template <class... Resource>
+    void build_batch(std::vector<array>& batch, const std::vector<std::vector<row_type>>& data, Resource&... resource)
+    {
+        for (std::size_t c = 0; c < columns_per_batch; ++c)
+        {
+            batch.emplace_back(build(resource..., data));
+        }
+        ::benchmark::DoNotOptimize(batch.data());
+        ::benchmark::ClobberMemory();
+    }
+
+    static void BM_BuildBatch_DefaultAllocator(::benchmark::State& state)
+    {
+        const auto data = make_batch_data(static_cast<std::size_t>(state.range(0)));
+        std::vector<array> batch;
+        batch.reserve(columns_per_batch);
+        for (auto _ : state)
+        {
+            build_batch(batch, data);
+            batch.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(columns_per_batch));
+    }
+
+    static void BM_BuildBatch_Arena(::benchmark::State& state)
+    {
+        const auto data = make_batch_data(static_cast<std::size_t>(state.range(0)));
+        arena_memory_resource arena;
+        std::vector<array> batch;
+        batch.reserve(columns_per_batch);
+        for (auto _ : state)
+        {
+            build_batch(batch, data, arena);
+            batch.clear();
+            arena.reset();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(columns_per_batch));
+    }
+
+    static void BM_BuildBatch_Pool(::benchmark::State& state)
+    {
+        const auto data = make_batch_data(static_cast<std::size_t>(state.range(0)));
+        pool_memory_resource pool;
+        std::vector<array> batch;
+        batch.reserve(columns_per_batch);
+        for (auto _ : state)
+        {
+            build_batch(batch, data, pool);
+            batch.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(columns_per_batch));
+    }
+
+    BENCHMARK(BM_BuildBatch_DefaultAllocator)->RangeMultiplier(10)->Range(10, 10000)->Unit(::benchmark::kMicrosecond);
+    BENCHMARK(BM_BuildBatch_Arena)->RangeMultiplier(10)->Range(10, 10000)->Unit(::benchmark::kMicrosecond);
+    BENCHMARK(BM_BuildBatch_Pool)->RangeMultiplier(10)->Range(10, 10000)->Unit(::benchmark::kMicrosecond);
+}  // namespace sparrow::benchmark
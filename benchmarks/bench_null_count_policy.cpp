@@ -176,6 +176,44 @@ namespace sparrow::benchmark
         state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
     }
 
+    // Benchmark: count_non_null starting at a bit offset
+    static void BM_CountNonNull_Offset(::benchmark::State& state)
+    {
+        const size_t bit_size = static_cast<size_t>(state.range(0));
+        const size_t offset = static_cast<size_t>(state.range(1));
+        const size_t byte_count = (offset + bit_size + 7) / 8;
+
+        auto data = generate_byte_data(byte_count, 0.5);
+
+        for (auto _ : state)
+        {
+            auto count = count_non_null(data.data(), bit_size, byte_count, offset);
+            ::benchmark::DoNotOptimize(count);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * bit_size));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * byte_count));
+    }
+
+    // Benchmark: count_set_bits over a range starting at a bit offset
+    static void BM_CountSetBits_Offset(::benchmark::State& state)
+    {
+        const size_t bit_size = static_cast<size_t>(state.range(0));
+        const size_t offset = static_cast<size_t>(state.range(1));
+        const size_t byte_count = (offset + bit_size + 7) / 8;
+
+        auto data = generate_byte_data(byte_count, 0.5);
+
+        for (auto _ : state)
+        {
+            auto count = count_set_bits(data.data(), offset, bit_size);
+            ::benchmark::DoNotOptimize(count);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * bit_size));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * byte_count));
+    }
+
     // Benchmark: initialize_null_count (which uses count_non_null internally)
     static void BM_InitializeNullCount(::benchmark::State& state)
     {
@@ -254,6 +292,14 @@ namespace sparrow::benchmark
         ->Range(range_min, range_max)
         ->Unit(::benchmark::kNanosecond);
 
+    BENCHMARK(BM_CountNonNull_Offset)
+        ->ArgsProduct({{64, 1000, 100000, 10000000}, {0, 3, 8, 61}})
+        ->Unit(::benchmark::kNanosecond);
+
+    BENCHMARK(BM_CountSetBits_Offset)
+        ->ArgsProduct({{64, 1000, 100000, 10000000}, {0, 3, 8, 61}})
+        ->Unit(::benchmark::kNanosecond);
+
     BENCHMARK(BM_InitializeNullCount)
         ->RangeMultiplier(range_multiplier)
         ->Range(range_min, range_max)
@@ -18,6 +18,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include "sparrow/compute/aggregate.hpp"
+#include "sparrow/compute/arithmetic.hpp"
+#include "sparrow/compute/comparison.hpp"
 #include "sparrow/primitive_array.hpp"
 #include "sparrow/utils/nullable.hpp"
 
@@ -274,6 +277,120 @@ namespace sparrow::benchmark
         state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
     }
 
+    // Benchmark: Naive sum with nulls, the baseline of BM_PrimitiveArray_ComputeSum
+    template <typename T>
+    static void BM_PrimitiveArray_NaiveSum(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        std::mt19937 gen(42);
+        auto data = generate_nullable_data(generate_sequential_data<T>(size), 0.1, gen);
+        primitive_array<T> array(data);
+
+        for (auto _ : state)
+        {
+            compute::sum_type_t<T> sum{};
+            for (const auto& element : array)
+            {
+                if (element.has_value())
+                {
+                    sum += static_cast<compute::sum_type_t<T>>(element.value());
+                }
+            }
+            ::benchmark::DoNotOptimize(sum);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: Sum with nulls using the compute kernel
+    template <typename T>
+    static void BM_PrimitiveArray_ComputeSum(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        std::mt19937 gen(42);
+        auto data = generate_nullable_data(generate_sequential_data<T>(size), 0.1, gen);
+        primitive_array<T> array(data);
+
+        for (auto _ : state)
+        {
+            auto sum = compute::sum(array);
+            ::benchmark::DoNotOptimize(sum);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: Naive element-wise comparison, the baseline of BM_PrimitiveArray_ComputeLess
+    template <typename T>
+    static void BM_PrimitiveArray_NaiveLess(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        auto data = generate_sequential_data<T>(size);
+        std::vector<T> reversed(data.rbegin(), data.rend());
+        primitive_array<T> lhs(data);
+        primitive_array<T> rhs(reversed);
+
+        for (auto _ : state)
+        {
+            std::vector<nullable<bool>> res;
+            res.reserve(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                const auto l = lhs[i];
+                const auto r = rhs[i];
+                res.push_back(
+                    l.has_value() && r.has_value() ? nullable<bool>(l.value() < r.value()) : nullable<bool>()
+                );
+            }
+            primitive_array<bool> result(res);
+            ::benchmark::DoNotOptimize(result);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: Element-wise comparison using the compute kernel
+    template <typename T>
+    static void BM_PrimitiveArray_ComputeLess(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        auto data = generate_sequential_data<T>(size);
+        std::vector<T> reversed(data.rbegin(), data.rend());
+        primitive_array<T> lhs(data);
+        primitive_array<T> rhs(reversed);
+
+        for (auto _ : state)
+        {
+            auto result = compute::less(lhs, rhs);
+            ::benchmark::DoNotOptimize(result);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
+    // Benchmark: Element-wise addition using the compute kernel
+    template <typename T>
+    static void BM_PrimitiveArray_ComputeAdd(::benchmark::State& state)
+    {
+        const size_t size = static_cast<size_t>(state.range(0));
+        auto data = generate_sequential_data<T>(size);
+        primitive_array<T> lhs(data);
+        primitive_array<T> rhs(data);
+
+        for (auto _ : state)
+        {
+            auto result = compute::add(lhs, rhs);
+            ::benchmark::DoNotOptimize(result);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * size));
+    }
+
 // Macro to register all benchmarks for a specific type
 #define REGISTER_PRIMITIVE_BENCHMARKS(TYPE)                         \
     BENCHMARK_TEMPLATE(BM_PrimitiveArray_ConstructFromVector, TYPE) \
@@ -306,6 +423,22 @@ namespace sparrow::benchmark
         ->Unit(::benchmark::kMicrosecond)                           \
         ->UseManualTime();                                          \
     BENCHMARK_TEMPLATE(BM_PrimitiveArray_Copy, TYPE)                \
+        ->RangeMultiplier(10)                                       \
+        ->Range(100, 100000)                                        \
+        ->Unit(::benchmark::kMicrosecond);                          \
+    BENCHMARK_TEMPLATE(BM_PrimitiveArray_NaiveSum, TYPE)            \
+        ->RangeMultiplier(10)                                       \
+        ->Range(100, 100000)                                        \
+        ->Unit(::benchmark::kMicrosecond);                          \
+    BENCHMARK_TEMPLATE(BM_PrimitiveArray_ComputeSum, TYPE)          \
+        ->RangeMultiplier(10)                                       \
+        ->Range(100, 100000)                                        \
+        ->Unit(::benchmark::kMicrosecond);                          \
+    BENCHMARK_TEMPLATE(BM_PrimitiveArray_NaiveLess, TYPE)           \
+        ->RangeMultiplier(10)                                       \
+        ->Range(100, 100000)                                        \
+        ->Unit(::benchmark::kMicrosecond);                          \
+    BENCHMARK_TEMPLATE(BM_PrimitiveArray_ComputeLess, TYPE)         \
         ->RangeMultiplier(10)                                       \
         ->Range(100, 100000)                                        \
         ->Unit(::benchmark::kMicrosecond);
@@ -321,4 +454,19 @@ namespace sparrow::benchmark
 
 #undef REGISTER_PRIMITIVE_BENCHMARKS
 
+#define REGISTER_ARITHMETIC_BENCHMARKS(TYPE)                \
+    BENCHMARK_TEMPLATE(BM_PrimitiveArray_ComputeAdd, TYPE) \
+        ->RangeMultiplier(10)                              \
+        ->Range(100, 100000)                               \
+        ->Unit(::benchmark::kMicrosecond);
+
+    REGISTER_ARITHMETIC_BENCHMARKS(std::uint8_t)
+    REGISTER_ARITHMETIC_BENCHMARKS(std::uint16_t)
+    REGISTER_ARITHMETIC_BENCHMARKS(std::uint32_t)
+    REGISTER_ARITHMETIC_BENCHMARKS(std::uint64_t)
+    REGISTER_ARITHMETIC_BENCHMARKS(float)
+    REGISTER_ARITHMETIC_BENCHMARKS(double)
+
+#undef REGISTER_ARITHMETIC_BENCHMARKS
+
 }  // namespace sparrow::benchmark
@@ -0,0 +1,85 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "sparrow/array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/primitive_array.hpp"
+
+namespace sparrow::benchmark
+{
+    namespace
+    {
+        array make_int32_array(std::size_t size)
+        {
+            std::vector<std::int32_t> values(size);
+            std::iota(values.begin(), values.end(), 0);
+            return array(primitive_array<std::int32_t>(std::move(values)));
+        }
+    }
+
+    // Sums the elements through array::operator[], which dispatches on the layout
+    // and builds a variant for each element.
+    static void BM_ArraySumDynamic(::benchmark::State& state)
+    {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const array ar = make_int32_array(size);
+        for (auto _ : state)
+        {
+            std::int64_t sum = 0;
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                const auto& value = std::get<nullable<const std::int32_t&>>(ar[i]);
+                if (value.has_value())
+                {
+                    sum += value.get();
+                }
+            }
+            ::benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+
+    // Sums the elements through a typed_view resolved once before the loop.
+    static void BM_ArraySumTypedView(::benchmark::State& state)
+    {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const array ar = make_int32_array(size);
+        for (auto _ : state)
+        {
+            const auto view = make_typed_view<primitive_array<std::int32_t>>(ar);
+            std::int64_t sum = 0;
+            for (const auto& value : view)
+            {
+                if (value.has_value())
+                {
+                    sum += value.get();
+                }
+            }
+            ::benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * size));
+    }
+
+    BENCHMARK(BM_ArraySumDynamic)->Arg(1000)->Arg(100000);
+    BENCHMARK(BM_ArraySumTypedView)->Arg(1000)->Arg(100000);
+}
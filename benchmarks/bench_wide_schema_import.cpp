@@ -0,0 +1,65 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_interface/arrow_array_schema_proxy.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/struct_array.hpp"
+
+namespace sparrow::benchmark
+{
+    // A struct array of column_count int32 columns of a few rows, like an imported wide table
+    std::pair<ArrowArray, ArrowSchema> make_wide_schema(std::size_t column_count)
+    {
+        std::vector<array> children;
+        children.reserve(column_count);
+        for (std::size_t i = 0; i < column_count; ++i)
+        {
+            children.emplace_back(primitive_array<std::int32_t>(std::vector<std::int32_t>(16, static_cast<std::int32_t>(i))));
+        }
+        return extract_arrow_structures(struct_array(std::move(children)));
+    }
+
+    // Imports the structures as an external producer would hand them over, and reads
+    // the buffers of 10 columns. range(0) is the number of columns.
+    static void BM_ImportWideSchema(::benchmark::State& state)
+    {
+        const auto column_count = static_cast<std::size_t>(state.range(0));
+        auto [array, schema] = make_wide_schema(column_count);
+        const ArrowArray* array_ptr = &array;
+        const ArrowSchema* schema_ptr = &schema;
+        constexpr std::size_t read_column_count = 10;
+        const std::size_t stride = column_count / read_column_count;
+        for (auto _ : state)
+        {
+            const arrow_proxy proxy(array_ptr, schema_ptr);
+            for (std::size_t i = 0; i < read_column_count; ++i)
+            {
+                const auto& buffers = proxy.children()[i * stride].buffers();
+                ::benchmark::DoNotOptimize(buffers[1].data());
+            }
+        }
+        array.release(&array);
+        schema.release(&schema);
+    }
+
+    BENCHMARK(BM_ImportWideSchema)->Arg(100)->Arg(1000)->Arg(5000)->Unit(::benchmark::kMicrosecond);
+}
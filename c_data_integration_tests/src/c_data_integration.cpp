@@ -15,17 +15,14 @@
 #include "sparrow/c_data_integration/c_data_integration.hpp"
 
 #include <cstdint>
-#include <fstream>
 #include <string>
 #include <utility>
 
-#include <nlohmann/json.hpp>
-
 #include <sparrow/array.hpp>
 #include <sparrow/record_batch.hpp>
 
 #include "sparrow/json_reader/comparison.hpp"
-#include "sparrow/json_reader/json_parser.hpp"
+#include "sparrow/json_reader/streaming_parser.hpp"
 
 
 static std::string global_error;
@@ -34,10 +31,7 @@ const char* external_CDataIntegration_ExportSchemaFromJson(const char* json_path
 {
     try
     {
-        std::ifstream json_file(json_path);
-        std::istream& json_stream = json_file;
-        const nlohmann::json data = nlohmann::json::parse(json_stream);
-        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json(data, 0);
+        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json_file(json_path, 0);
         sparrow::struct_array struct_array = record_batch.extract_struct_array();
         auto [array, schema] = sparrow::extract_arrow_structures(std::move(struct_array));
         array.release(&array);
@@ -59,10 +53,7 @@ const char* external_CDataIntegration_ImportSchemaAndCompareToJson(const char* j
     }
     try
     {
-        std::ifstream json_file(json_path);
-        std::istream& json_stream = json_file;
-        const nlohmann::json data = nlohmann::json::parse(json_stream);
-        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json(data, 0);
+        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json_file(json_path, 0);
 
         sparrow::struct_array struct_array = record_batch.extract_struct_array();
         auto [array_from_json, schema_from_json] = sparrow::extract_arrow_structures(std::move(struct_array));
@@ -91,11 +82,8 @@ const char* external_CDataIntegration_ExportBatchFromJson(const char* json_path,
 {
     try
     {
-        std::ifstream json_file(json_path);
-        std::istream& json_stream = json_file;
-        const nlohmann::json data = nlohmann::json::parse(json_stream);
-        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json(
-            data,
+        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json_file(
+            json_path,
             static_cast<size_t>(num_batch)
         );
         sparrow::struct_array struct_array = record_batch.extract_struct_array();
@@ -120,11 +108,8 @@ external_CDataIntegration_ImportBatchAndCompareToJson(const char* json_path, int
     }
     try
     {
-        std::ifstream json_file(json_path);
-        std::istream& json_stream = json_file;
-        const nlohmann::json data = nlohmann::json::parse(json_stream);
-        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json(
-            data,
+        sparrow::record_batch record_batch = sparrow::json_reader::build_record_batch_from_json_file(
+            json_path,
             static_cast<size_t>(num_batch)
         );
         sparrow::struct_array struct_array = record_batch.extract_struct_array();
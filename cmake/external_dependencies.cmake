@@ -87,6 +87,29 @@ if(CREATE_JSON_READER_TARGET)
             message(STATUS "\t✅ Fetched nlohmann_json ${NLOHMANN_JSON_VERSION}")
         endif()
     endif()
+
+    if(NOT FETCH_DEPENDENCIES_WITH_CMAKE STREQUAL "ON")
+        find_package(simdjson ${FIND_PACKAGE_OPTIONS})
+        if(simdjson_FOUND)
+            message(STATUS "📦 simdjson found here: ${simdjson_DIR}")
+        endif()
+    endif()
+    if(FETCH_DEPENDENCIES_WITH_CMAKE STREQUAL "ON" OR FETCH_DEPENDENCIES_WITH_CMAKE STREQUAL "MISSING")
+        if(NOT simdjson_FOUND)
+            set(SIMDJSON_VERSION "v3.13.0")
+            message(STATUS "📦 Fetching simdjson ${SIMDJSON_VERSION}")
+            FetchContent_Declare(
+                simdjson
+                GIT_SHALLOW TRUE
+                GIT_REPOSITORY https://github.com/simdjson/simdjson.git
+                GIT_TAG ${SIMDJSON_VERSION}
+                GIT_PROGRESS TRUE
+                SYSTEM
+                EXCLUDE_FROM_ALL)
+            FetchContent_MakeAvailable(simdjson)
+            message(STATUS "\t✅ Fetched simdjson ${SIMDJSON_VERSION}")
+        endif()
+    endif()
 endif()
 
 if(BUILD_BENCHMARKS)
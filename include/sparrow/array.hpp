@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <stdexcept>
+
 #include "sparrow/array_api.hpp"
 #include "sparrow/layout/array_registry.hpp"
 
@@ -44,6 +46,24 @@ namespace sparrow
         return sparrow::visit(std::forward<F>(func), *p_array);
     }
 
+    template <layout A>
+    bool holds_layout(const array& ar) noexcept
+    {
+        const array_wrapper* wrapper = detail::array_access::get_array_wrapper(ar);
+        return wrapper != nullptr && holds_layout<A>(*wrapper);
+    }
+
+    template <layout A>
+    typed_view<A> make_typed_view(const array& ar)
+    {
+        const array_wrapper* wrapper = detail::array_access::get_array_wrapper(ar);
+        if (wrapper == nullptr)
+        {
+            throw std::invalid_argument("make_typed_view: the array does not hold any layout");
+        }
+        return make_typed_view<A>(*wrapper);
+    }
+
     template <layout_or_array A>
     bool owns_arrow_array(const A& a)
     {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <ranges>
+#include <span>
 
 #include "sparrow/c_interface.hpp"
 #include "sparrow/config/config.hpp"
@@ -22,6 +23,7 @@
 #include "sparrow/layout/array_wrapper.hpp"
 #include "sparrow/layout/layout_concept.hpp"
 #include "sparrow/layout/nested_value_types.hpp"
+#include "sparrow/layout/typed_view.hpp"
 #include "sparrow/null_array.hpp"
 #include "sparrow/types/data_traits.hpp"
 #include "sparrow/utils/memory.hpp"
@@ -312,6 +314,16 @@ namespace sparrow
          */
         [[nodiscard]] SPARROW_API array slice_view(size_type start, size_type end) const;
 
+        /**
+         * Creates a compacted copy of the array: the returned \ref array has an offset of 0
+         * and its buffers only hold its elements. Validity bitmaps are byte-aligned, offsets
+         * are rebased, the variadic buffers of binary views are repacked and the unreferenced
+         * dictionary entries are pruned. This is useful before serializing a sliced array.
+         *
+         * @return A compacted copy of the array.
+         */
+        [[nodiscard]] SPARROW_API array compact() const;
+
     private:
 
         /**
@@ -351,6 +363,50 @@ namespace sparrow
     SPARROW_API
     bool operator==(const array& lhs, const array& rhs);
 
+    /**
+     * Concatenates arrays of the same layout into a single contiguous \ref array.
+     * The buffers of the result are allocated once with their final size, and the
+     * result is compacted like array::compact() does. Dictionary-encoded arrays whose
+     * dictionaries differ get a merged dictionary, and their indices are remapped.
+     *
+     * @param arrays The arrays to concatenate, in order.
+     * @return A new \ref array holding the elements of all the \p arrays.
+     * @throws std::invalid_argument if \p arrays is empty or if the arrays do not have
+     *         the same data type, including the types of their children.
+     * @throws std::overflow_error if the offsets or the dictionary indices of the result
+     *         cannot hold its size.
+     */
+    [[nodiscard]] SPARROW_API array concatenate(std::span<const array> arrays);
+
+    /**
+     * Concatenates the arrays pointed to by \p arrays, see the overload above. This
+     * avoids copying arrays gathered from several containers, such as the columns of
+     * record batches.
+     */
+    [[nodiscard]] SPARROW_API array concatenate(std::span<const array* const> arrays);
+
+    /**
+     * Returns \c true if the given \ref array holds a layout of type \c A.
+     *
+     * @tparam A The layout type.
+     * @param ar The \ref array to check.
+     */
+    template <layout A>
+    [[nodiscard]] bool holds_layout(const array& ar) noexcept;
+
+    /**
+     * Builds a typed view over the elements of the layout held by the given \ref array.
+     * The layout is resolved once, so that accessing the elements through the view does
+     * not dispatch on the type of the layout.
+     *
+     * @tparam A The layout type held by \p ar.
+     * @param ar The \ref array to view. It must outlive the returned view.
+     * @return A typed view over the elements of \p ar.
+     * @throws std::invalid_argument if \p ar does not hold a layout of type \c A.
+     */
+    template <layout A>
+    [[nodiscard]] typed_view<A> make_typed_view(const array& ar);
+
     template <class A>
     concept layout_or_array = layout<A> or std::same_as<A, array>;
 
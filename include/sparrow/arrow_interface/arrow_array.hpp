@@ -16,7 +16,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory_resource>
 #include <ranges>
+#include <span>
 #include <type_traits>
 
 #if defined(__cpp_lib_format)
@@ -202,6 +204,146 @@ namespace sparrow
         return target;
     }
 
+    /**
+     * Fill the target ArrowArray with a deep copy of the source ArrowArray, like copy_array,
+     * the buffers of the copy and of its children being allocated from \p resource, which
+     * must outlive the copy.
+     * @param source_array The source ArrowArray to copy from.
+     * @param source_schema The schema of the source ArrowArray.
+     * @param target The target ArrowArray to copy to.
+     * @param resource The memory resource the buffers are allocated from.
+     */
+    SPARROW_API void copy_array(
+        const ArrowArray& source_array,
+        const ArrowSchema& source_schema,
+        ArrowArray& target,
+        std::pmr::memory_resource& resource
+    );
+
+    /**
+     * Create a deep copy of the source ArrowArray whose buffers are allocated from
+     * \p resource, see the overload above.
+     */
+    [[nodiscard]] inline ArrowArray
+    copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema, std::pmr::memory_resource& resource)
+    {
+        ArrowArray target{};
+        copy_array(source_array, source_schema, target, resource);
+        return target;
+    }
+
+    /**
+     * Fill the target ArrowArray with a deep copy of the source ArrowArray, like copy_array,
+     * using several threads. The arrays of the tree and their buffers are allocated first;
+     * the buffers are then copied concurrently, the large ones being split into chunks of
+     * 1 MiB, so that wide struct arrays and large buffers are not bound by the memory
+     * bandwidth of a single core.
+     * @param source_array The source ArrowArray to copy from.
+     * @param source_schema The schema of the source ArrowArray.
+     * @param target The target ArrowArray to copy to.
+     * @param max_threads The maximum number of threads, the calling one included;
+     *                    0 for one per hardware thread.
+     */
+    SPARROW_API void parallel_copy_array(
+        const ArrowArray& source_array,
+        const ArrowSchema& source_schema,
+        ArrowArray& target,
+        std::size_t max_threads = 0
+    );
+
+    /**
+     * Create a deep copy of the source ArrowArray using several threads, see the overload above.
+     */
+    [[nodiscard]] inline ArrowArray
+    parallel_copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema, std::size_t max_threads = 0)
+    {
+        ArrowArray target{};
+        parallel_copy_array(source_array, source_schema, target, max_threads);
+        return target;
+    }
+
+    /**
+     * Fill the target ArrowArray with a shallow copy of the source ArrowArray.
+     * When the source has been allocated by sparrow, the buffers are shared with
+     * the source and are only copied when one of the arrays is modified
+     * (copy-on-write). Otherwise, the buffers are deep copied.
+     * The children and the dictionary are copied recursively with the same rules.
+     * @param source_array The source ArrowArray to copy from.
+     * @param source_schema The schema of the source ArrowArray.
+     * @param target The target ArrowArray to copy to.
+     */
+    SPARROW_API void
+    shallow_copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema, ArrowArray& target);
+
+    /**
+     * Create a shallow copy of the source ArrowArray, see the overload above.
+     */
+    [[nodiscard]] inline ArrowArray
+    shallow_copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema)
+    {
+        ArrowArray target{};
+        shallow_copy_array(source_array, source_schema, target);
+        return target;
+    }
+
+    /**
+     * Fill the target ArrowArray with a compacted deep copy of the source ArrowArray.
+     * The target has an offset of 0 and its buffers only hold the elements in the
+     * [offset, offset + length) range of the source: validity bitmaps are re-aligned,
+     * offsets are rebased, children are sliced, the variadic buffers of binary views are
+     * repacked into a single buffer, and the dictionary entries that are not referenced
+     * are pruned when the dictionary layout allows it.
+     * This is the concatenation of the single source array, see concatenate_arrays().
+     * @param source_array The source ArrowArray to compact.
+     * @param source_schema The schema of the source ArrowArray.
+     * @param target The target ArrowArray to fill.
+     */
+    SPARROW_API void
+    compact_array(const ArrowArray& source_array, const ArrowSchema& source_schema, ArrowArray& target);
+
+    /**
+     * Create a compacted deep copy of the source ArrowArray, see the overload above.
+     */
+    [[nodiscard]] inline ArrowArray compact_array(const ArrowArray& source_array, const ArrowSchema& source_schema)
+    {
+        ArrowArray target{};
+        compact_array(source_array, source_schema, target);
+        return target;
+    }
+
+    /**
+     * Fill the target ArrowArray with the concatenation of the source arrays, which
+     * must all have the layout described by source_schema.
+     * The result is compacted like compact_array() does: its offset is 0, its buffers
+     * are allocated once with their final size, and the out-of-line data of the binary
+     * views is gathered into a single buffer. When the source arrays have different
+     * dictionaries, they are merged into a single one whose duplicate entries are
+     * removed (for the layouts made of flat buffers), and the indices are remapped;
+     * when they share the same dictionary, its unreferenced entries are pruned.
+     * @param source_arrays The arrays to concatenate, in order.
+     * @param source_schema The schema shared by the source arrays.
+     * @param target The target ArrowArray to fill.
+     * @throws std::invalid_argument if source_arrays is empty.
+     * @throws std::overflow_error if the offsets or the dictionary indices of the
+     *         result cannot hold its size.
+     */
+    SPARROW_API void concatenate_arrays(
+        std::span<const ArrowArray* const> source_arrays,
+        const ArrowSchema& source_schema,
+        ArrowArray& target
+    );
+
+    /**
+     * Create the concatenation of the source arrays, see the overload above.
+     */
+    [[nodiscard]] inline ArrowArray
+    concatenate_arrays(std::span<const ArrowArray* const> source_arrays, const ArrowSchema& source_schema)
+    {
+        ArrowArray target{};
+        concatenate_arrays(source_arrays, source_schema, target);
+        return target;
+    }
+
     /**
      * Moves the content of source into a stack-allocated array, and
      * reset the source to an empty ArrowArray.
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "sparrow/arrow_interface/arrow_array_schema_utils.hpp"
@@ -26,11 +28,29 @@
 namespace sparrow
 {
 
+    /**
+     * Counter increased each time buffers may become shared between private data
+     * (see arrow_array_private_data::share_buffers and set_buffers_offsets), or an
+     * array is inserted into a tree. arrow_proxy::unshare_buffers skips walking a
+     * tree when the counter has not changed since its last walk.
+     */
+    [[nodiscard]] SPARROW_API std::uint64_t buffers_sharing_epoch() noexcept;
+    SPARROW_API void increase_buffers_sharing_epoch() noexcept;
+
     /**
      * Private data for ArrowArray.
      *
      * Holds and own buffers, children, and dictionary.
      * It is used in the Sparrow library.
+     *
+     * The buffers are reference counted so that several private data can
+     * share them (see shallow_copy_array). The sharing is copy-on-write:
+     * the mutating methods of this class call unshare_buffers before
+     * modifying the buffers; code writing through buffers() must do the same.
+     *
+     * The pointers exposed to the ArrowArray can start after the beginning of
+     * the buffers (see set_buffers_offsets). This allows a slice to share the
+     * buffers of its parent while exporting only the sliced range.
      */
 
     class arrow_array_private_data : public children_ownership,
@@ -40,83 +60,220 @@ namespace sparrow
 
         using BufferType = std::vector<buffer<std::uint8_t>>;
 
+        using shared_buffers_type = std::shared_ptr<BufferType>;
+
         template <std::ranges::input_range CHILDREN_OWNERSHIP>
             requires std::is_same_v<std::ranges::range_value_t<CHILDREN_OWNERSHIP>, bool>
-        explicit constexpr arrow_array_private_data(
+        explicit arrow_array_private_data(
             BufferType buffers,
             const CHILDREN_OWNERSHIP& children_ownership,
             bool dictionary_ownership
         );
 
-        [[nodiscard]] constexpr BufferType& buffers() noexcept;
-        [[nodiscard]] constexpr const BufferType& buffers() const noexcept;
+        template <std::ranges::input_range CHILDREN_OWNERSHIP>
+            requires std::is_same_v<std::ranges::range_value_t<CHILDREN_OWNERSHIP>, bool>
+        explicit arrow_array_private_data(
+            shared_buffers_type buffers,
+            const CHILDREN_OWNERSHIP& children_ownership,
+            bool dictionary_ownership
+        );
+
+        [[nodiscard]] BufferType& buffers() noexcept;
+        [[nodiscard]] const BufferType& buffers() const noexcept;
+
+        /**
+         * Returns a new reference on the buffers, to be shared with another
+         * private data.
+         */
+        [[nodiscard]] shared_buffers_type share_buffers() const noexcept;
 
-        SPARROW_CONSTEXPR_GCC_11 void resize_buffers(std::size_t size);
+        /**
+         * @return true if the buffers are referenced by another private data.
+         */
+        [[nodiscard]] bool has_shared_buffers() const noexcept;
+
+        /**
+         * Copies the buffers if they are shared with another private data,
+         * so that this private data becomes their unique owner.
+         *
+         * @return true if the buffers have been copied.
+         */
+        bool unshare_buffers();
+
+        /**
+         * Replaces all the buffers, the previous ones are released if they
+         * are not shared with another private data.
+         */
+        void set_buffers(BufferType buffers);
+
+        /**
+         * Sets the offsets, in bytes, of the pointers exposed to the ArrowArray
+         * relative to the beginning of the buffers. The offsets are added to the
+         * current ones. Empty buffers are never offset.
+         */
+        void set_buffers_offsets(const std::vector<std::size_t>& offsets);
+
+        /**
+         * @return the offsets, in bytes, of the pointers exposed to the ArrowArray
+         * relative to the beginning of the buffers. Empty if no pointer is offset.
+         */
+        [[nodiscard]] const std::vector<std::size_t>& buffers_offsets() const noexcept;
+
+        void resize_buffers(std::size_t size);
         void set_buffer(std::size_t index, buffer<std::uint8_t>&& buffer);
         void set_buffer(std::size_t index, const buffer_view<std::uint8_t>& buffer);
-        SPARROW_CONSTEXPR_GCC_11 void resize_buffer(std::size_t index, std::size_t size, std::uint8_t value);
-        SPARROW_CONSTEXPR_GCC_11 void update_buffers_ptrs();
+        void resize_buffer(std::size_t index, std::size_t size, std::uint8_t value);
+        void update_buffers_ptrs();
 
         template <class T>
         [[nodiscard]] constexpr const T** buffers_ptrs() noexcept;
 
     private:
 
-        BufferType m_buffers;
+        void update_buffer_ptr(std::size_t index);
+
+        shared_buffers_type m_buffers;
+        std::vector<std::size_t> m_buffers_offsets;
         std::vector<std::uint8_t*> m_buffers_pointers;
     };
 
     template <std::ranges::input_range CHILDREN_OWNERSHIP>
         requires std::is_same_v<std::ranges::range_value_t<CHILDREN_OWNERSHIP>, bool>
-    constexpr arrow_array_private_data::arrow_array_private_data(
+    arrow_array_private_data::arrow_array_private_data(
         BufferType buffers,
         const CHILDREN_OWNERSHIP& children_ownership_range,
         bool dictionary_ownership_value
+    )
+        : arrow_array_private_data(
+              std::make_shared<BufferType>(std::move(buffers)),
+              children_ownership_range,
+              dictionary_ownership_value
+          )
+    {
+    }
+
+    template <std::ranges::input_range CHILDREN_OWNERSHIP>
+        requires std::is_same_v<std::ranges::range_value_t<CHILDREN_OWNERSHIP>, bool>
+    arrow_array_private_data::arrow_array_private_data(
+        shared_buffers_type buffers,
+        const CHILDREN_OWNERSHIP& children_ownership_range,
+        bool dictionary_ownership_value
     )
         : children_ownership(children_ownership_range)
         , dictionary_ownership(dictionary_ownership_value)
         , m_buffers(std::move(buffers))
-        , m_buffers_pointers(to_raw_ptr_vec<std::uint8_t>(m_buffers))
+        , m_buffers_pointers(to_raw_ptr_vec<std::uint8_t>(*m_buffers))
     {
+        SPARROW_ASSERT_TRUE(m_buffers != nullptr);
     }
 
-    [[nodiscard]] constexpr std::vector<buffer<std::uint8_t>>& arrow_array_private_data::buffers() noexcept
+    [[nodiscard]] inline std::vector<buffer<std::uint8_t>>& arrow_array_private_data::buffers() noexcept
     {
-        return m_buffers;
+        return *m_buffers;
     }
 
-    [[nodiscard]] constexpr const std::vector<buffer<std::uint8_t>>&
+    [[nodiscard]] inline const std::vector<buffer<std::uint8_t>>&
     arrow_array_private_data::buffers() const noexcept
     {
+        return *m_buffers;
+    }
+
+    [[nodiscard]] inline auto arrow_array_private_data::share_buffers() const noexcept -> shared_buffers_type
+    {
+        increase_buffers_sharing_epoch();
         return m_buffers;
     }
 
-    SPARROW_CONSTEXPR_GCC_11 void arrow_array_private_data::resize_buffers(std::size_t size)
+    [[nodiscard]] inline bool arrow_array_private_data::has_shared_buffers() const noexcept
     {
-        m_buffers.resize(size);
+        return m_buffers.use_count() > 1;
+    }
+
+    inline bool arrow_array_private_data::unshare_buffers()
+    {
+        if (!has_shared_buffers())
+        {
+            return false;
+        }
+        m_buffers = std::make_shared<BufferType>(*m_buffers);
+        // Update the pointers in place, the ArrowArray refers to the storage of m_buffers_pointers
+        for (std::size_t i = 0; i < m_buffers_pointers.size(); ++i)
+        {
+            update_buffer_ptr(i);
+        }
+        return true;
+    }
+
+    inline void arrow_array_private_data::set_buffers(BufferType buffers)
+    {
+        m_buffers = std::make_shared<BufferType>(std::move(buffers));
+        m_buffers_offsets.clear();
+        update_buffers_ptrs();
+    }
+
+    inline void arrow_array_private_data::set_buffers_offsets(const std::vector<std::size_t>& offsets)
+    {
+        SPARROW_ASSERT_TRUE(offsets.size() == m_buffers->size());
+        increase_buffers_sharing_epoch();
+        m_buffers_offsets.resize(offsets.size(), 0);
+        for (std::size_t i = 0; i < offsets.size(); ++i)
+        {
+            if (!(*m_buffers)[i].empty())
+            {
+                m_buffers_offsets[i] += offsets[i];
+                SPARROW_ASSERT_TRUE(m_buffers_offsets[i] <= (*m_buffers)[i].size());
+            }
+        }
+        update_buffers_ptrs();
+    }
+
+    [[nodiscard]] inline const std::vector<std::size_t>& arrow_array_private_data::buffers_offsets() const noexcept
+    {
+        return m_buffers_offsets;
+    }
+
+    inline void arrow_array_private_data::resize_buffers(std::size_t size)
+    {
+        unshare_buffers();
+        m_buffers->resize(size);
+        if (!m_buffers_offsets.empty())
+        {
+            m_buffers_offsets.resize(size, 0);
+        }
         update_buffers_ptrs();
     }
 
     inline void arrow_array_private_data::set_buffer(std::size_t index, buffer<std::uint8_t>&& buffer)
     {
-        SPARROW_ASSERT_TRUE(index < m_buffers.size());
-        m_buffers[index] = std::move(buffer);
-        m_buffers_pointers[index] = m_buffers[index].data();
+        SPARROW_ASSERT_TRUE(index < m_buffers->size());
+        unshare_buffers();
+        (*m_buffers)[index] = std::move(buffer);
+        if (!m_buffers_offsets.empty())
+        {
+            m_buffers_offsets[index] = 0;
+        }
+        update_buffer_ptr(index);
     }
 
     inline void arrow_array_private_data::set_buffer(std::size_t index, const buffer_view<std::uint8_t>& buffer)
     {
-        SPARROW_ASSERT_TRUE(index < m_buffers.size());
-        m_buffers[index] = buffer;
-        m_buffers_pointers[index] = m_buffers[index].data();
+        SPARROW_ASSERT_TRUE(index < m_buffers->size());
+        unshare_buffers();
+        (*m_buffers)[index] = buffer;
+        if (!m_buffers_offsets.empty())
+        {
+            m_buffers_offsets[index] = 0;
+        }
+        update_buffer_ptr(index);
     }
 
-    SPARROW_CONSTEXPR_GCC_11 void
+    inline void
     arrow_array_private_data::resize_buffer(std::size_t index, std::size_t size, std::uint8_t value)
     {
-        SPARROW_ASSERT_TRUE(index < m_buffers.size());
-        m_buffers[index].resize(size, value);
-        m_buffers_pointers[index] = m_buffers[index].data();
+        SPARROW_ASSERT_TRUE(index < m_buffers->size());
+        unshare_buffers();
+        (*m_buffers)[index].resize(size, value);
+        update_buffer_ptr(index);
     }
 
     template <class T>
@@ -125,8 +282,22 @@ namespace sparrow
         return const_cast<const T**>(reinterpret_cast<T**>(m_buffers_pointers.data()));
     }
 
-    SPARROW_CONSTEXPR_GCC_11 void arrow_array_private_data::update_buffers_ptrs()
+    inline void arrow_array_private_data::update_buffers_ptrs()
+    {
+        m_buffers_pointers = to_raw_ptr_vec<std::uint8_t>(*m_buffers);
+        for (std::size_t i = 0; i < m_buffers_offsets.size(); ++i)
+        {
+            update_buffer_ptr(i);
+        }
+    }
+
+    inline void arrow_array_private_data::update_buffer_ptr(std::size_t index)
     {
-        m_buffers_pointers = to_raw_ptr_vec<std::uint8_t>(m_buffers);
+        std::uint8_t* ptr = (*m_buffers)[index].data();
+        if (ptr != nullptr && !m_buffers_offsets.empty())
+        {
+            ptr += m_buffers_offsets[index];
+        }
+        m_buffers_pointers[index] = ptr;
     }
 }
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <iterator>
+#include <mutex>
 #include <optional>
 #include <ranges>
 #include <string>
@@ -111,8 +113,9 @@ namespace sparrow
     {
     public:
 
-        using bitmap_type = non_owning_dynamic_bitset<uint8_t>;
-        using const_bitmap_type = dynamic_bitset_view<const uint8_t>;
+        // The null count of the bitmaps is only computed when it is queried
+        using bitmap_type = non_owning_dynamic_bitset<uint8_t, lazy_null_count<>>;
+        using const_bitmap_type = dynamic_bitset_view<const uint8_t, lazy_null_count<>>;
 
         /**
          * @brief Constructs an arrow_proxy taking ownership of both ArrowArray and ArrowSchema.
@@ -330,6 +333,17 @@ namespace sparrow
          */
         [[nodiscard]] SPARROW_API std::optional<key_value_view> metadata() const;
 
+        /**
+         * @brief Gets the name of the extension type, the value of the
+         * "ARROW:extension:name" metadata.
+         *
+         * For a schema created by sparrow, the name is read from the index of the
+         * metadata kept in its private data, without parsing the metadata.
+         *
+         * @return The extension name, or nullopt if the metadata does not have one
+         */
+        [[nodiscard]] SPARROW_API std::optional<std::string_view> extension_name() const;
+
         /**
          * @brief Sets the metadata key-value pairs.
          *
@@ -353,11 +367,11 @@ namespace sparrow
             auto private_data = get_schema_private_data();
             if (!metadata.has_value())
             {
-                private_data->metadata() = std::nullopt;
+                private_data->set_metadata(std::nullopt);
             }
             else
             {
-                private_data->metadata() = get_metadata_from_key_values(*metadata);
+                private_data->set_metadata(get_metadata_from_key_values(*metadata));
             }
             schema().metadata = private_data->metadata_ptr();
         }
@@ -416,10 +430,13 @@ namespace sparrow
         /**
          * @brief Gets the number of null values in the array.
          *
-         * @return Number of null values (-1 if unknown)
+         * When the null count of the ArrowArray is unknown (-1), it is computed from
+         * the validity bitmap on the first call and cached; the ArrowArray keeps -1,
+         * as allowed by the C data interface.
+         *
+         * @return Number of null values (-1 if unknown and the array has no validity bitmap)
          *
          * @post Returns value consistent with validity bitmap
-         * @post -1 indicates null count should be computed
          */
         [[nodiscard]] SPARROW_API int64_t null_count() const;
 
@@ -771,6 +788,9 @@ namespace sparrow
          * associated with this arrow array schema proxy. The children represent nested
          * or structured data elements within the schema.
          *
+         * The child proxies are built on the first call, a proxy of a wide struct that
+         * is never traversed does not build them.
+         *
          * @return const std::vector<arrow_proxy>& A constant reference to the vector
          *         containing the child arrow proxies.
          */
@@ -931,12 +951,18 @@ namespace sparrow
 
         /**
          * Slices the array to keep only the elements between the given \p start and \p end.
-         * A copy of the \ref array is modified. The data is not modified, only the ArrowArray.offset and
-         * ArrowArray.length are updated. If \p end is greater than the size of the buffers, the following
-         * elements will be invalid.
-         *
-         * @param start The index of the first element to keep. Must be less than \p end.
-         * @param end The index of the first element to discard. Must be less than the size of the buffers.
+         * The returned proxy owns its ArrowArray and shares the buffers of this proxy, which stay
+         * alive as long as one of them references them; no data is copied.
+         * When the layout allows it (the offset does not apply to the children and the validity
+         * bitmap starts on a byte boundary), the buffers exported through the ArrowArray start at
+         * the first element of the slice and ArrowArray.offset is 0. Otherwise, only the
+         * ArrowArray.offset and ArrowArray.length are updated.
+         * The validity bitmap is not scanned: unless it follows from the null count of this
+         * proxy, the null count of the slice is exported as -1 and computed when it is queried.
+         *
+         * @param start The index of the first element to keep, relative to the current offset.
+         * Must be less than \p end.
+         * @param end The index of the first element to discard, relative to the current offset.
          */
         [[nodiscard]] SPARROW_API arrow_proxy slice(size_t start, size_t end) const;
 
@@ -944,18 +970,45 @@ namespace sparrow
          * Slices the array to keep only the elements between the given \p start and \p end.
          * A view of the \ref array is returned. The data is not modified, only the ArrowArray.offset and
          * ArrowArray.length are updated. If \p end is greater than the size of the buffers, the following
-         * elements will be invalid.
+         * elements will be invalid. Like \ref slice, the null count is left unknown (-1) when it does not
+         * follow from the null count of this proxy.
          *
          * @param start The index of the first element to keep. Must be less than \p end.
          * @param end The index of the first element to discard. Must be less than the size of the buffers.
          */
         [[nodiscard]] SPARROW_API arrow_proxy slice_view(size_t start, size_t end) const;
 
+        /**
+         * Creates a deep copy of the array with an offset of 0 and minimal buffers: only the
+         * elements in the [offset, offset + length) range are kept, see \ref compact_array.
+         * The returned proxy owns its ArrowArray and ArrowSchema.
+         */
+        [[nodiscard]] SPARROW_API arrow_proxy compact() const;
+
         /**
          * Refresh the buffers views. This method should be called after modifying the buffers of the array.
          */
         SPARROW_API void update_buffers();
 
+        /**
+         * @brief Gives this proxy exclusive ownership of its buffers.
+         *
+         * Copies of a proxy share their buffers until one of them is modified
+         * (copy-on-write). This method deep copies the buffers that are still shared
+         * with another proxy, recursively on the children and the dictionary, and
+         * refreshes the buffer and bitmap views accordingly. It is called by all the
+         * mutating methods of the proxy, and must be called before writing through
+         * the views returned by buffers() or bitmap(). The walk is skipped when no
+         * buffer can have become shared since the previous call (see
+         * buffers_sharing_epoch), so that calling it on every access is cheap.
+         *
+         * @return true if at least one buffer has been copied, false otherwise
+         *
+         * @post The buffers of this proxy are not shared with any other proxy
+         * @post Views previously obtained from buffers() or bitmap() are invalidated if true is returned
+         */
+        SPARROW_API bool unshare_buffers();
+
         /**
          * Check if the array is const.
          */
@@ -974,21 +1027,40 @@ namespace sparrow
 
         std::variant<ArrowArray*, ArrowArray> m_array;
         std::variant<ArrowSchema*, ArrowSchema> m_schema;
-        std::vector<sparrow::buffer_view<uint8_t>> m_buffers;
-        std::vector<arrow_proxy> m_children;
+        // The buffer views and the children proxies are built on first access, so that
+        // importing a wide or deeply nested array does not build a proxy for every
+        // descendant. The first build is synchronized, so that a const proxy can be
+        // read from several threads: the flags are checked without locking, and the
+        // views are built under m_materialize_mutex.
+        mutable std::vector<sparrow::buffer_view<uint8_t>> m_buffers;
+        mutable std::vector<arrow_proxy> m_children;
         std::unique_ptr<arrow_proxy> m_dictionary;
         bool m_array_is_immutable = false;
         bool m_schema_is_immutable = false;
         bool m_is_dictionary_immutable = false;
-        std::vector<bool> m_children_array_immutable;
-        std::vector<bool> m_children_schema_immutable;
+        mutable std::atomic<bool> m_buffers_materialized = false;
+        mutable std::atomic<bool> m_children_materialized = false;
+        mutable std::mutex m_materialize_mutex;
+        // Immutability of each child, as a combination of child_immutability values. It
+        // stays empty as long as the children have the immutability of this proxy, which
+        // is the case of all imported arrays.
+        std::vector<std::uint8_t> m_children_immutability;
         std::optional<bitmap_type> m_null_bitmap;
         std::optional<const_bitmap_type> m_const_bitmap;
+        // Value of buffers_sharing_epoch() when unshare_buffers last walked the tree,
+        // 0 if it has never walked it.
+        std::uint64_t m_unshared_epoch = 0;
 
         struct impl_tag
         {
         };
 
+        enum child_immutability : std::uint8_t
+        {
+            child_array_immutable = 1,
+            child_schema_immutable = 2
+        };
+
         // Build an empty proxy. Convenient for resizing vector of children
         arrow_proxy();
 
@@ -1000,13 +1072,18 @@ namespace sparrow
         [[nodiscard]] bool empty() const;
         SPARROW_API void resize_children(size_t children_count);
 
-        void update_children();
+        void materialize_buffers() const;
+        void materialize_children() const;
+        [[nodiscard]] arrow_proxy make_child(size_t index) const;
+        [[nodiscard]] std::uint8_t get_child_immutability(size_t index) const;
+        void set_child_immutability(size_t index, std::uint8_t immutability);
         void update_dictionary();
         void update_null_count();
         void reset();
         void remove_dictionary();
         void remove_child(size_t index);
         void create_bitmap_view(std::optional<size_t> null_count = std::nullopt);
+        void trim_buffers();
 
         [[nodiscard]] bool array_created_with_sparrow() const;
         [[nodiscard]] SPARROW_API bool schema_created_with_sparrow() const;
@@ -1087,6 +1164,7 @@ namespace sparrow
     {
         static constexpr const char function_name[] = "insert_bitmap";
         throw_if_immutable<function_name, true, false>();
+        unshare_buffers();
         SPARROW_ASSERT_TRUE(m_null_bitmap.has_value())
         const auto it = m_null_bitmap->insert(
             sparrow::next(m_null_bitmap->cbegin(), index),
@@ -1147,11 +1225,8 @@ namespace sparrow
             SPARROW_ASSERT_TRUE(schema != nullptr);
         }
 
-        m_children_array_immutable = std::vector<bool>(n_children(), m_array_is_immutable);
-        m_children_schema_immutable = std::vector<bool>(n_children(), m_schema_is_immutable);
         validate_array_and_schema();
         update_buffers();
-        update_children();
         update_dictionary();
         create_bitmap_view();
     }
@@ -91,6 +91,8 @@ namespace sparrow
      * - Returns 0 on success, a non-zero error code otherwise
      * - On success, the consumer must check if the ArrowArray is released
      * - If the ArrowArray is released, the end of stream has been reached
+     * - For concurrent streams, waits for the next array until the stream is closed, and
+     *   returns ECANCELED if the stream has been cancelled
      * - Otherwise, the ArrowArray contains a valid data chunk
      * - The returned array must be released independently by the consumer
      *
@@ -118,6 +120,10 @@ namespace sparrow
      *   description is available
      * - The returned pointer is only guaranteed to be valid until the next callback call
      *
+     * The message is copied into a buffer owned by the calling thread: the pointer stays
+     * valid until the next call of this function on the same thread, even if other threads
+     * report new errors on the stream.
+     *
      * @param stream Pointer to the ArrowArrayStream.
      *
      * @return Pointer to a NULL-terminated error message string, or NULL if unavailable.
@@ -128,6 +134,37 @@ namespace sparrow
 
     SPARROW_API void fill_arrow_array_stream(ArrowArrayStream& stream);
 
+    /**
+     * @brief Fills an ArrowArrayStream whose private data is in concurrent mode.
+     *
+     * The stream can be fed by producer threads while consumer threads call get_next, which
+     * waits for the next array until the stream is closed. See
+     * \ref arrow_array_stream_private_data for the detailed semantics.
+     *
+     * @param stream The ArrowArrayStream to fill.
+     * @param options The capacity of the stream.
+     */
+    SPARROW_API void fill_arrow_array_stream(ArrowArrayStream& stream, concurrent_stream_options options);
+
+    /**
+     * @brief Fills an ArrowArrayStream pulling its arrays from a source.
+     *
+     * get_next returns the array produced by \p source. If \p options enables prefetching,
+     * it also starts reading the next one on a background thread. See
+     * \ref arrow_array_stream_private_data for the detailed semantics.
+     *
+     * @param stream The ArrowArrayStream to fill.
+     * @param schema The schema of the arrays of the stream.
+     * @param source The source of the arrays. It is not called concurrently.
+     * @param options The prefetching of the arrays and its cancellation.
+     */
+    SPARROW_API void fill_arrow_array_stream(
+        ArrowArrayStream& stream,
+        schema_unique_ptr schema,
+        array_source source,
+        source_stream_options options = {}
+    );
+
     /**
      * @brief Move an ArrowArrayStream by transferring ownership of its resources.
      *
@@ -14,10 +14,22 @@
 
 #pragma once
 
+#include <cerrno>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <ranges>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
 
 #include <sparrow/arrow_interface/arrow_array.hpp>
 #include <sparrow/arrow_interface/arrow_schema.hpp>
@@ -25,24 +37,173 @@
 
 namespace sparrow
 {
+    /**
+     * Options of a concurrent ArrowArrayStream, i.e. a stream that can be fed by producer
+     * threads while consumer threads read from it.
+     */
+    struct concurrent_stream_options
+    {
+        /// Maximum number of arrays waiting in the stream, 0 means unbounded.
+        std::size_t capacity = 0;
+    };
+
+    /**
+     * Source of the arrays of a pulled ArrowArrayStream: returns the next array, or nullptr
+     * at the end of the stream.
+     */
+    using array_source = std::function<array_unique_ptr()>;
+
+    /**
+     * Options of an ArrowArrayStream pulling its arrays from an \ref array_source.
+     */
+    struct source_stream_options
+    {
+        /// Reads the next array on a background thread while the consumer processes the
+        /// current one. Disabled by default: the source is only called by get_next.
+        bool prefetch = false;
+
+        /// Interrupts a pending call of the source, which must then return or throw
+        /// promptly. Called when the stream is cancelled or released while a prefetch
+        /// is in flight, before waiting for it. Without it, releasing the stream waits
+        /// for the prefetch to complete.
+        std::function<void()> cancel;
+    };
+
+    /**
+     * Private data of the ArrowArrayStream created by sparrow.
+     *
+     * All the methods are thread-safe. By default, the stream behaves as a plain queue: getting
+     * the next array of an empty stream returns the end-of-stream marker. In concurrent mode
+     * (see \ref concurrent_stream_options), the stream is bounded and stays open until \ref close
+     * or \ref cancel is called:
+     * - importing an array into a full stream blocks until a consumer makes room, while
+     *   \ref try_import_array returns `EAGAIN` instead;
+     * - getting the next array of an empty stream blocks until an array is imported or the
+     *   stream is closed;
+     * - once closed, the remaining arrays can still be consumed, then the end-of-stream marker
+     *   is returned;
+     * - once cancelled, the remaining arrays are discarded and the blocked producers and
+     *   consumers are woken up with an error.
+     *
+     * A stream can also pull its arrays from an \ref array_source instead of having them
+     * imported. Such a stream is closed from the start. If prefetching is enabled (see
+     * \ref source_stream_options), the next array is read on a background thread while the
+     * consumer processes the current one: at most two arrays of the source are alive at a
+     * time, the one handed to the consumer and the one being prefetched. A prefetch in flight
+     * is interrupted by the cancel callback of the options when the stream is cancelled or
+     * released.
+     */
     class arrow_array_stream_private_data
     {
     public:
 
         arrow_array_stream_private_data() = default;
 
+        explicit arrow_array_stream_private_data(concurrent_stream_options options)
+            : m_concurrent(true)
+            , m_capacity(options.capacity)
+        {
+        }
+
+        /**
+         * Creates the private data of a stream pulling its arrays from \p source.
+         */
+        arrow_array_stream_private_data(
+            schema_unique_ptr schema,
+            array_source source,
+            source_stream_options options = {}
+        )
+            : m_schema(std::move(schema))
+            , m_state(state::closed)
+            , m_source(std::make_shared<array_source>(std::move(source)))
+            , m_source_options(std::move(options))
+        {
+        }
+
+        arrow_array_stream_private_data(const arrow_array_stream_private_data&) = delete;
+        arrow_array_stream_private_data& operator=(const arrow_array_stream_private_data&) = delete;
+
+        ~arrow_array_stream_private_data()
+        {
+            if (m_prefetch.valid())
+            {
+                // Nobody asked for the prefetched array: interrupt its read, then join it
+                if (m_source_options.cancel)
+                {
+                    m_source_options.cancel();
+                }
+                m_prefetch.wait();
+            }
+        }
+
+        [[nodiscard]] bool is_concurrent() const noexcept
+        {
+            return m_concurrent;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
         void import_schema(schema_unique_ptr&& out_schema)
         {
-            m_schema = std::move(out_schema);
+            {
+                std::lock_guard lock(m_mutex);
+                m_schema = std::move(out_schema);
+            }
+            m_not_empty.notify_all();
+        }
+
+        /**
+         * Imports the schema built by \p make_schema if the stream has no schema yet, then
+         * calls \p visit with the schema of the stream and returns its result. Both are called
+         * under the lock, so that concurrent producers agree on a single schema and the schema
+         * cannot be replaced while \p visit reads it.
+         */
+        template <std::invocable F, std::invocable<const ArrowSchema&> V>
+        std::invoke_result_t<V, const ArrowSchema&> import_schema_if_missing(F&& make_schema, V&& visit)
+        {
+            std::unique_lock lock(m_mutex);
+            if (m_schema == nullptr)
+            {
+                m_schema = std::forward<F>(make_schema)();
+            }
+            auto result = std::forward<V>(visit)(std::as_const(*m_schema));
+            lock.unlock();
+            m_not_empty.notify_all();
+            return result;
         }
 
         [[nodiscard]] ArrowSchema* schema()
         {
+            std::lock_guard lock(m_mutex);
             return m_schema.get();
         }
 
         [[nodiscard]] const ArrowSchema* schema() const
         {
+            std::lock_guard lock(m_mutex);
+            return m_schema.get();
+        }
+
+        /**
+         * Returns the schema of the stream. In concurrent mode, waits until a schema has been
+         * imported or the stream is closed. Returns nullptr if the stream has no schema.
+         */
+        [[nodiscard]] const ArrowSchema* wait_for_schema() const
+        {
+            std::unique_lock lock(m_mutex);
+            if (m_concurrent)
+            {
+                m_not_empty.wait(
+                    lock,
+                    [this]
+                    {
+                        return m_schema != nullptr || m_state != state::open;
+                    }
+                );
+            }
             return m_schema.get();
         }
 
@@ -52,17 +213,90 @@ namespace sparrow
         {
             for (auto&& array : arrays)
             {
-                m_arrays.push(array_ptr(array));
+                import_array(array_unique_ptr(array));
             }
         }
 
+        /**
+         * Imports an array into the stream. In concurrent mode, blocks while the stream is full.
+         *
+         * @throws std::runtime_error if the stream has been closed or cancelled.
+         */
         void import_array(array_unique_ptr&& array)
         {
-            m_arrays.push(std::move(array));
+            {
+                std::unique_lock lock(m_mutex);
+                m_not_full.wait(
+                    lock,
+                    [this]
+                    {
+                        return !is_full() || m_state != state::open;
+                    }
+                );
+                throw_if_not_open();
+                m_arrays.push(std::move(array));
+            }
+            m_not_empty.notify_one();
+        }
+
+        /**
+         * Imports the array built by \p make_array if the stream is not full. \p make_array is
+         * only called when the array can be imported.
+         *
+         * @return `0` on success, `EAGAIN` if the stream is full, `EPIPE` if the stream has been
+         *         closed and `ECANCELED` if the stream has been cancelled.
+         */
+        template <std::invocable F>
+        [[nodiscard]] int try_import_array(F&& make_array)
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_state == state::cancelled)
+                {
+                    return ECANCELED;
+                }
+                if (m_state == state::closed)
+                {
+                    return EPIPE;
+                }
+                if (is_full())
+                {
+                    return EAGAIN;
+                }
+                m_arrays.push(std::forward<F>(make_array)());
+            }
+            m_not_empty.notify_one();
+            return 0;
         }
 
+        /**
+         * Removes the next array from the stream. A released array is returned at the end of
+         * the stream. In concurrent mode, blocks until an array is available or the stream is
+         * closed.
+         *
+         * @throws std::system_error with `ECANCELED` if the stream has been cancelled.
+         */
         [[nodiscard]] ArrowArray* export_next_array()
         {
+            if (m_source != nullptr)
+            {
+                return export_next_source_array();
+            }
+            std::unique_lock lock(m_mutex);
+            if (m_concurrent)
+            {
+                m_not_empty.wait(
+                    lock,
+                    [this]
+                    {
+                        return !m_arrays.empty() || m_state != state::open;
+                    }
+                );
+            }
+            if (m_state == state::cancelled)
+            {
+                throw std::system_error(ECANCELED, std::generic_category(), "ArrowArrayStream has been cancelled");
+            }
             if (m_arrays.empty())
             {
                 return new ArrowArray{};
@@ -70,23 +304,155 @@ namespace sparrow
 
             ArrowArray* array = m_arrays.front().release();
             m_arrays.pop();
+            lock.unlock();
+            m_not_full.notify_one();
             return array;
         }
 
-        [[nodiscard]] const std::string& get_last_error_message() const
+        /**
+         * Marks the end of the stream: no array can be imported anymore, the remaining arrays
+         * can still be consumed.
+         */
+        void close()
+        {
+            {
+                std::lock_guard lock(m_mutex);
+                if (m_state == state::open)
+                {
+                    m_state = state::closed;
+                }
+            }
+            m_not_empty.notify_all();
+            m_not_full.notify_all();
+        }
+
+        /**
+         * Aborts the stream: the remaining arrays are discarded, and the blocked producers
+         * and consumers are woken up.
+         */
+        void cancel()
         {
+            std::queue<array_unique_ptr> discarded;
+            {
+                std::lock_guard lock(m_mutex);
+                m_state = state::cancelled;
+                std::swap(discarded, m_arrays);
+            }
+            m_not_empty.notify_all();
+            m_not_full.notify_all();
+            if (m_source_options.cancel)
+            {
+                m_source_options.cancel();
+            }
+        }
+
+        [[nodiscard]] bool is_closed() const
+        {
+            std::lock_guard lock(m_mutex);
+            return m_state != state::open;
+        }
+
+        [[nodiscard]] bool is_cancelled() const
+        {
+            std::lock_guard lock(m_mutex);
+            return m_state == state::cancelled;
+        }
+
+        /**
+         * Returns a copy of the last error message: another thread may set a new one
+         * while the caller reads it.
+         */
+        [[nodiscard]] std::string get_last_error_message() const
+        {
+            std::lock_guard lock(m_mutex);
             return m_last_error_message;
         }
 
         void set_last_error_message(std::string_view message)
         {
+            std::lock_guard lock(m_mutex);
             m_last_error_message = message;
         }
 
     private:
 
+        enum class state
+        {
+            open,
+            closed,
+            cancelled
+        };
+
+        ArrowArray* export_next_source_array()
+        {
+            std::lock_guard source_lock(m_source_mutex);
+            if (is_cancelled())
+            {
+                throw std::system_error(ECANCELED, std::generic_category(), "ArrowArrayStream has been cancelled");
+            }
+            if (m_source_exhausted)
+            {
+                return new ArrowArray{};
+            }
+            array_unique_ptr array;
+            try
+            {
+                array = m_prefetch.valid() ? m_prefetch.get() : (*m_source)();
+            }
+            catch (...)
+            {
+                m_source_exhausted = true;
+                throw;
+            }
+            if (array == nullptr)
+            {
+                m_source_exhausted = true;
+                return new ArrowArray{};
+            }
+            if (m_source_options.prefetch)
+            {
+                // The task shares the source, it does not refer to the private data
+                m_prefetch = std::async(
+                    std::launch::async,
+                    [source = m_source]
+                    {
+                        return (*source)();
+                    }
+                );
+            }
+            return array.release();
+        }
+
+        [[nodiscard]] bool is_full() const noexcept
+        {
+            return m_capacity != 0 && m_arrays.size() >= m_capacity;
+        }
+
+        void throw_if_not_open() const
+        {
+            if (m_state == state::cancelled)
+            {
+                throw std::runtime_error("Cannot add array to a cancelled ArrowArrayStream");
+            }
+            if (m_state == state::closed)
+            {
+                throw std::runtime_error("Cannot add array to a closed ArrowArrayStream");
+            }
+        }
+
         schema_unique_ptr m_schema;
         std::queue<array_unique_ptr> m_arrays{};
         std::string m_last_error_message{};
+        mutable std::mutex m_mutex;
+        mutable std::condition_variable m_not_empty;
+        std::condition_variable m_not_full;
+        bool m_concurrent = false;
+        std::size_t m_capacity = 0;
+        state m_state = state::open;
+        std::shared_ptr<array_source> m_source;
+        source_stream_options m_source_options;
+        std::mutex m_source_mutex;
+        bool m_source_exhausted = false;
+        std::future<array_unique_ptr> m_prefetch;
     };
 }
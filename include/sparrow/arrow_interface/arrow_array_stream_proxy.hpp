@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cerrno>
 #include <ranges>
 
 #include "sparrow/array.hpp"
@@ -44,8 +45,11 @@ namespace sparrow
      * - Proper implementation of all mandatory ArrowArrayStream callbacks
      *
      * Thread safety:
-     * - The stream is not thread-safe by design (per specification)
-     * - Concurrent calls to get_next or pop must be externally synchronized
+     * - The specification does not require streams to be thread-safe
+     * - A stream created with \ref concurrent_stream_options can be fed by several producer
+     *   threads (push, try_push) while several consumer threads call get_next or pop. It is
+     *   bounded by its capacity, and stays open until close() or cancel() is called
+     * - Other streams must be externally synchronized
      *
      * @note This class implements the producer side of the Arrow C Stream Interface.
      *       It creates streams that can be consumed by other libraries that understand
@@ -68,6 +72,22 @@ namespace sparrow
          */
         SPARROW_API arrow_array_stream_proxy();
 
+        /**
+         * @brief Constructs a new thread-safe ArrowArrayStream producer.
+         *
+         * Arrays can be pushed from producer threads while consumer threads pop them or call
+         * get_next on the exported stream:
+         * - push blocks while the stream holds \p options.capacity arrays, try_push returns
+         *   false instead;
+         * - get_next and pop wait for the next array until close() is called, then return the
+         *   end of stream once the remaining arrays have been consumed;
+         * - cancel() discards the remaining arrays and wakes up the blocked producers and
+         *   consumers: get_next returns ECANCELED and push throws.
+         *
+         * @param options The capacity of the stream, 0 for an unbounded stream.
+         */
+        SPARROW_API explicit arrow_array_stream_proxy(concurrent_stream_options options);
+
         /**
          * @brief Constructs from an existing ArrowArrayStream by taking ownership.
          *
@@ -153,18 +173,10 @@ namespace sparrow
         {
             arrow_array_stream_private_data& private_data = get_private_data();
 
-            // Check if we need to create schema from first array
-            if (private_data.schema() == nullptr)
-            {
-                schema_unique_ptr schema{new ArrowSchema(), arrow_schema_deleter{}};
-                copy_schema(*get_arrow_schema(*std::ranges::begin(arrays)), *schema);
-                private_data.import_schema(std::move(schema));
-            }
-
             // Validate schema compatibility for all arrays
             for (const auto& array : arrays)
             {
-                if (!check_compatible_schema(*private_data.schema(), *get_arrow_schema(array)))
+                if (!has_compatible_schema(private_data, array))
                 {
                     throw std::runtime_error("Incompatible schema when adding array to ArrowArrayStream");
                 }
@@ -173,10 +185,7 @@ namespace sparrow
             // Import all arrays
             for (auto&& array : std::forward<R>(arrays))
             {
-                ArrowArray extracted_array = extract_arrow_array(std::move(array));
-                array_unique_ptr array_ptr{new ArrowArray(), arrow_array_deleter{}};
-                swap(*array_ptr, extracted_array);
-                private_data.import_array(std::move(array_ptr));
+                private_data.import_array(make_array_unique_ptr(std::move(array)));
             }
         }
 
@@ -213,6 +222,62 @@ namespace sparrow
          */
         SPARROW_API std::optional<array> pop();
 
+        /**
+         * @brief Tries to add a single array to the stream without blocking.
+         *
+         * @tparam A A type satisfying the layout_or_array concept.
+         * @param array The array to add to the stream. It is left untouched if the stream is full.
+         * @return true if the array has been added, false if the stream is full.
+         *
+         * @throws std::runtime_error If the array has an incompatible schema.
+         * @throws std::runtime_error If the stream is immutable, closed or cancelled.
+         */
+        template <class A>
+            requires layout_or_array<std::remove_cvref_t<A>>
+        [[nodiscard]] bool try_push(A&& array)
+        {
+            arrow_array_stream_private_data& private_data = get_private_data();
+            if (!has_compatible_schema(private_data, array))
+            {
+                throw std::runtime_error("Incompatible schema when adding array to ArrowArrayStream");
+            }
+            const int err = private_data.try_import_array(
+                [&]()
+                {
+                    return make_array_unique_ptr(std::forward<A>(array));
+                }
+            );
+            if (err == EAGAIN)
+            {
+                return false;
+            }
+            if (err != 0)
+            {
+                throw std::runtime_error("Cannot add array to a closed or cancelled ArrowArrayStream");
+            }
+            return true;
+        }
+
+        /**
+         * @brief Marks the end of the stream.
+         *
+         * No array can be pushed anymore. Consumers get the remaining arrays, then the end of
+         * stream.
+         *
+         * @throws std::runtime_error If the stream is immutable.
+         */
+        SPARROW_API void close();
+
+        /**
+         * @brief Aborts the stream.
+         *
+         * The remaining arrays are discarded. Blocked producers and consumers are woken up:
+         * push throws and get_next returns ECANCELED.
+         *
+         * @throws std::runtime_error If the stream is immutable.
+         */
+        SPARROW_API void cancel();
+
     private:
 
         std::variant<ArrowArrayStream*, ArrowArrayStream> m_stream;
@@ -248,5 +313,37 @@ namespace sparrow
          * @return Reference to the stream's private data.
          */
         [[nodiscard]] SPARROW_API arrow_array_stream_private_data& get_private_data();
+
+        /**
+         * @brief Checks that \p array is compatible with the schema of the stream, which is
+         * initialized from \p array if the stream has no schema yet.
+         */
+        template <layout_or_array A>
+        [[nodiscard]] static bool
+        has_compatible_schema(arrow_array_stream_private_data& private_data, const A& array)
+        {
+            const ArrowSchema& array_schema = *get_arrow_schema(array);
+            return private_data.import_schema_if_missing(
+                [&array_schema]()
+                {
+                    schema_unique_ptr schema{new ArrowSchema(), arrow_schema_deleter{}};
+                    copy_schema(array_schema, *schema);
+                    return schema;
+                },
+                [&array_schema](const ArrowSchema& schema)
+                {
+                    return check_compatible_schema(schema, array_schema);
+                }
+            );
+        }
+
+        template <layout_or_array A>
+        [[nodiscard]] static array_unique_ptr make_array_unique_ptr(A array)
+        {
+            ArrowArray extracted_array = extract_arrow_array(std::move(array));
+            array_unique_ptr array_ptr{new ArrowArray(), arrow_array_deleter{}};
+            swap(*array_ptr, extracted_array);
+            return array_ptr;
+        }
     };
 }
@@ -72,13 +72,23 @@ namespace sparrow
         [[nodiscard]] const char* name_ptr() const noexcept;
         [[nodiscard]] NameType& name() noexcept;
         [[nodiscard]] const char* metadata_ptr() const noexcept;
-        [[nodiscard]] MetadataType& metadata() noexcept;
+        [[nodiscard]] const MetadataType& metadata() const noexcept;
+        void set_metadata(MetadataType metadata);
+
+        /**
+         * @return The index of the metadata keys, built when the metadata is set, or
+         * nullptr if there is no metadata.
+         */
+        [[nodiscard]] const key_value_index* metadata_index() const noexcept;
 
     private:
 
+        void update_metadata_index();
+
         FormatType m_format;
         NameType m_name;
         MetadataType m_metadata;
+        std::optional<key_value_index> m_metadata_index;
     };
 
     template <class T>
@@ -144,6 +154,7 @@ namespace sparrow
         , m_metadata(to_optional_string(std::forward<M>(metadata)))
     {
         SPARROW_ASSERT_TRUE(!m_format.empty())
+        update_metadata_index();
     }
 
     template <class F, class N, input_metadata_container M>
@@ -156,6 +167,7 @@ namespace sparrow
         , m_metadata(get_metadata_from_key_values(metadata))
     {
         SPARROW_ASSERT_TRUE(!m_format.empty())
+        update_metadata_index();
     }
 
     [[nodiscard]] inline const char* arrow_schema_private_data::format_ptr() const noexcept
@@ -191,9 +203,33 @@ namespace sparrow
         return nullptr;
     }
 
-    inline arrow_schema_private_data::MetadataType& arrow_schema_private_data::metadata() noexcept
+    [[nodiscard]] inline const arrow_schema_private_data::MetadataType&
+    arrow_schema_private_data::metadata() const noexcept
     {
         return m_metadata;
     }
 
+    inline void arrow_schema_private_data::set_metadata(MetadataType metadata)
+    {
+        m_metadata = std::move(metadata);
+        update_metadata_index();
+    }
+
+    [[nodiscard]] inline const key_value_index* arrow_schema_private_data::metadata_index() const noexcept
+    {
+        return m_metadata_index.has_value() ? &*m_metadata_index : nullptr;
+    }
+
+    inline void arrow_schema_private_data::update_metadata_index()
+    {
+        if (m_metadata.has_value())
+        {
+            m_metadata_index.emplace(m_metadata->data());
+        }
+        else
+        {
+            m_metadata_index.reset();
+        }
+    }
+
 }
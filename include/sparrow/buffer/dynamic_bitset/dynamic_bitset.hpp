@@ -391,7 +391,9 @@ namespace sparrow
     {
         using validity_bitmap = sparrow::validity_bitmap;
 
-        inline validity_bitmap ensure_validity_bitmap_impl(std::size_t size, const validity_bitmap& bitmap)
+        // A validity_bitmap input keeps its own allocator
+        template <allocator A>
+        validity_bitmap ensure_validity_bitmap_impl(std::size_t size, const validity_bitmap& bitmap, const A&)
         {
             if (bitmap.size() == 0)
             {
@@ -400,7 +402,8 @@ namespace sparrow
             return bitmap;  // copy
         }
 
-        inline validity_bitmap ensure_validity_bitmap_impl(std::size_t size, validity_bitmap&& bitmap)
+        template <allocator A>
+        validity_bitmap ensure_validity_bitmap_impl(std::size_t size, validity_bitmap&& bitmap, const A&)
         {
             if (bitmap.size() == 0)
             {
@@ -410,12 +413,12 @@ namespace sparrow
         }
 
         // range of booleans
-        template <std::ranges::input_range R>
+        template <std::ranges::input_range R, allocator A>
             requires(std::same_as<std::ranges::range_value_t<R>, bool>)
-        validity_bitmap ensure_validity_bitmap_impl(std::size_t size, R&& range)
+        validity_bitmap ensure_validity_bitmap_impl(std::size_t size, R&& range, const A& a)
         {
             SPARROW_ASSERT_TRUE(size == range_size(range) || range_size(range) == 0);
-            validity_bitmap bitmap(size, true, validity_bitmap::default_allocator{});
+            validity_bitmap bitmap(size, true, a);
             std::size_t i = 0;
             for (auto value : range)
             {
@@ -429,15 +432,15 @@ namespace sparrow
         }
 
         // range of indices / integers (but not booleans)
-        template <std::ranges::input_range R>
+        template <std::ranges::input_range R, allocator A>
             requires(
                 std::unsigned_integral<std::ranges::range_value_t<R>>
                 && !std::same_as<std::ranges::range_value_t<R>, bool>
                 && !std::same_as<std::decay_t<R>, validity_bitmap>
             )
-        validity_bitmap ensure_validity_bitmap_impl(std::size_t size, R&& range_of_indices)
+        validity_bitmap ensure_validity_bitmap_impl(std::size_t size, R&& range_of_indices, const A& a)
         {
-            validity_bitmap bitmap(size, true, validity_bitmap::default_allocator{});
+            validity_bitmap bitmap(size, true, a);
             for (auto index : range_of_indices)
             {
                 bitmap.set(index, false);
@@ -502,7 +505,22 @@ namespace sparrow
     template <validity_bitmap_input R>
     validity_bitmap ensure_validity_bitmap(std::size_t size, R&& validity_input)
     {
-        return detail::ensure_validity_bitmap_impl(size, std::forward<R>(validity_input));
+        return detail::ensure_validity_bitmap_impl(
+            size,
+            std::forward<R>(validity_input),
+            validity_bitmap::default_allocator{}
+        );
+    }
+
+    /**
+     * @brief Same as ensure_validity_bitmap(size, validity_input), except that the
+     * bitmaps created from a range are allocated with \p a. A validity_bitmap input
+     * keeps its own allocator.
+     */
+    template <validity_bitmap_input R, allocator A>
+    validity_bitmap ensure_validity_bitmap(std::size_t size, R&& validity_input, const A& a)
+    {
+        return detail::ensure_validity_bitmap_impl(size, std::forward<R>(validity_input), a);
     }
 
 }  // namespace sparrow
@@ -16,6 +16,8 @@
 
 
 #include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -23,6 +25,7 @@
 #include "sparrow/buffer/dynamic_bitset/bitset_iterator.hpp"
 #include "sparrow/buffer/dynamic_bitset/bitset_reference.hpp"
 #include "sparrow/buffer/dynamic_bitset/null_count_policy.hpp"
+#include "sparrow/utils/bit.hpp"
 #include "sparrow/utils/contracts.hpp"
 
 namespace sparrow
@@ -125,7 +128,8 @@ namespace sparrow
          * @brief Returns the number of bits set to false (null/invalid).
          * @return The count of unset bits
          * @post Return value <= size()
-         * @note Only available when using tracking_null_count policy
+         * @note Only available when using tracking_null_count or lazy_null_count policy.
+         *       With lazy_null_count, the first call after a bulk modification counts the bits.
          */
         [[nodiscard]] constexpr size_type null_count() const noexcept
             requires(NCP::track_null_count);
@@ -301,6 +305,64 @@ namespace sparrow
          */
         [[nodiscard]] constexpr const_reference back() const;
 
+        /**
+         * @brief Combines this bitset with another one using a bitwise AND, in place.
+         * @param other The bitset or bitset view to combine with, its offset may differ
+         *              from the offset of this bitset
+         * @return A reference to this bitset
+         * @pre other.size() == size()
+         * @post test(i) == (old test(i) && other.test(i)) for every i < size()
+         * @post null_count() is updated while the bits are combined
+         * @note The bits are processed 64 at a time
+         * @throws std::runtime_error if this bitset has a non-resizable null buffer that must be
+         *         materialized
+         */
+        template <typename B2, null_count_policy NCP2>
+        self_type& bitwise_and(const dynamic_bitset_base<B2, NCP2>& other);
+
+        /**
+         * @brief Combines this bitset with another one using a bitwise OR, in place.
+         * @param other The bitset or bitset view to combine with, its offset may differ
+         *              from the offset of this bitset
+         * @return A reference to this bitset
+         * @pre other.size() == size()
+         * @post test(i) == (old test(i) || other.test(i)) for every i < size()
+         * @post null_count() is updated while the bits are combined
+         * @note The bits are processed 64 at a time
+         */
+        template <typename B2, null_count_policy NCP2>
+        self_type& bitwise_or(const dynamic_bitset_base<B2, NCP2>& other);
+
+        /**
+         * @brief Combines this bitset with another one using a bitwise XOR, in place.
+         * @param other The bitset or bitset view to combine with, its offset may differ
+         *              from the offset of this bitset
+         * @return A reference to this bitset
+         * @pre other.size() == size()
+         * @post test(i) == (old test(i) != other.test(i)) for every i < size()
+         * @post null_count() is updated while the bits are combined
+         * @note The bits are processed 64 at a time
+         * @throws std::runtime_error if this bitset has a non-resizable null buffer that must be
+         *         materialized
+         */
+        template <typename B2, null_count_policy NCP2>
+        self_type& bitwise_xor(const dynamic_bitset_base<B2, NCP2>& other);
+
+        /**
+         * @brief Clears the bits of this bitset that are set in another one, in place.
+         * @param other The bitset or bitset view to combine with, its offset may differ
+         *              from the offset of this bitset
+         * @return A reference to this bitset
+         * @pre other.size() == size()
+         * @post test(i) == (old test(i) && !other.test(i)) for every i < size()
+         * @post null_count() is updated while the bits are combined
+         * @note The bits are processed 64 at a time
+         * @throws std::runtime_error if this bitset has a non-resizable null buffer that must be
+         *         materialized
+         */
+        template <typename B2, null_count_policy NCP2>
+        self_type& bitwise_and_not(const dynamic_bitset_base<B2, NCP2>& other);
+
         /**
          * @brief Returns an immutable reference to the underlying buffer.
          * @return Reference to the storage buffer
@@ -561,12 +623,32 @@ namespace sparrow
         [[nodiscard]] constexpr size_type count_extra_bits() const noexcept;
 
         /**
-         * @brief Shifts a range of bits to the right by the specified offset.
-         * @param start The starting bit position (absolute, including offset)
-         * @param length The number of bits to shift
-         * @param shift_amount The number of positions to shift right
+         * @brief Allocates the storage of a bitset with a null buffer, all its bits being set.
+         * @post data() != nullptr
+         * @throws std::runtime_error if the storage cannot be resized
+         */
+        void materialize_null_buffer();
+
+        /**
+         * @brief Resizes the storage for n bits without initializing the new bits.
+         * @param n The new size in bits
+         * @post size() == n
+         * @note The null count is not updated
          */
-        constexpr void shift_bits_right(size_type start, size_type length, size_type shift_amount);
+        void resize_storage(size_type n);
+
+        /**
+         * @brief Adds a (possibly negative) delta to the tracked null count.
+         * @param added The number of null bits added
+         * @param removed The number of null bits removed
+         */
+        constexpr void adjust_null_count(size_type added, size_type removed) noexcept;
+
+        /**
+         * @brief Checks whether the null count is tracked and currently known.
+         * @return false when the policy does not track the count, or defers it
+         */
+        [[nodiscard]] constexpr bool has_tracked_null_count() const noexcept;
 
         /**
          * @brief Fills a range of bits with the specified value.
@@ -576,6 +658,15 @@ namespace sparrow
          */
         constexpr void fill_bits(size_type start, size_type count, value_type value);
 
+        /**
+         * @brief Combines the bits of this bitset with the bits of another one, in place.
+         * @param other The bitset to combine with, of the same size
+         * @param op The function combining two 64-bit words of bits
+         * @note The null count is accumulated from the combined words
+         */
+        template <typename B2, null_count_policy NCP2, typename F>
+        void apply_bitwise(const dynamic_bitset_base<B2, NCP2>& other, F op);
+
         storage_type m_buffer;  ///< The underlying storage for bit data
         size_type m_size;       ///< The number of bits in the bitset
         size_type m_offset;     ///< The offset in bits from the start of the buffer
@@ -625,7 +716,14 @@ namespace sparrow
     constexpr auto dynamic_bitset_base<B, NCP>::null_count() const noexcept -> size_type
         requires(NCP::track_null_count)
     {
-        return NCP::null_count();
+        if constexpr (lazy_null_count_policy<NCP>)
+        {
+            return NCP::null_count(data(), m_size, buffer().size(), m_offset);
+        }
+        else
+        {
+            return NCP::null_count();
+        }
     }
 
     template <typename B, null_count_policy NCP>
@@ -871,6 +969,116 @@ namespace sparrow
         return (*this)[size() - 1];
     }
 
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    template <typename B2, null_count_policy NCP2>
+    auto dynamic_bitset_base<B, NCP>::bitwise_and(const dynamic_bitset_base<B2, NCP2>& other) -> self_type&
+    {
+        apply_bitwise(
+            other,
+            [](std::uint64_t lhs, std::uint64_t rhs)
+            {
+                return lhs & rhs;
+            }
+        );
+        return *this;
+    }
+
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    template <typename B2, null_count_policy NCP2>
+    auto dynamic_bitset_base<B, NCP>::bitwise_or(const dynamic_bitset_base<B2, NCP2>& other) -> self_type&
+    {
+        apply_bitwise(
+            other,
+            [](std::uint64_t lhs, std::uint64_t rhs)
+            {
+                return lhs | rhs;
+            }
+        );
+        return *this;
+    }
+
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    template <typename B2, null_count_policy NCP2>
+    auto dynamic_bitset_base<B, NCP>::bitwise_xor(const dynamic_bitset_base<B2, NCP2>& other) -> self_type&
+    {
+        apply_bitwise(
+            other,
+            [](std::uint64_t lhs, std::uint64_t rhs)
+            {
+                return lhs ^ rhs;
+            }
+        );
+        return *this;
+    }
+
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    template <typename B2, null_count_policy NCP2>
+    auto dynamic_bitset_base<B, NCP>::bitwise_and_not(const dynamic_bitset_base<B2, NCP2>& other) -> self_type&
+    {
+        apply_bitwise(
+            other,
+            [](std::uint64_t lhs, std::uint64_t rhs)
+            {
+                return lhs & ~rhs;
+            }
+        );
+        return *this;
+    }
+
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    template <typename B2, null_count_policy NCP2, typename F>
+    void dynamic_bitset_base<B, NCP>::apply_bitwise(const dynamic_bitset_base<B2, NCP2>& other, F op)
+    {
+        SPARROW_ASSERT_TRUE(other.size() == size());
+        constexpr std::uint64_t all_set = ~std::uint64_t(0);
+        if (data() == nullptr)
+        {
+            // All the bits are set, and stay set if op(1, x) == 1 whatever x.
+            if (op(all_set, std::uint64_t(0)) == all_set)
+            {
+                return;
+            }
+            materialize_null_buffer();
+        }
+
+        auto* bits = reinterpret_cast<std::uint8_t*>(data());
+        const auto* other_bits = reinterpret_cast<const std::uint8_t*>(other.data());
+        const size_type other_offset = other.offset();
+        size_type null_count = 0;
+        size_type pos = 0;
+        const auto combine = [&](size_type n)
+        {
+            const std::uint64_t lhs = load_bits(bits, m_offset + pos, n);
+            const std::uint64_t rhs = other_bits == nullptr ? low_bits_mask(n)
+                                                            : load_bits(other_bits, other_offset + pos, n);
+            const std::uint64_t res = op(lhs, rhs) & low_bits_mask(n);
+            store_bits(bits, m_offset + pos, res, n);
+            if constexpr (NCP::track_null_count)
+            {
+                null_count += n - static_cast<size_type>(std::popcount(res));
+            }
+            pos += n;
+        };
+
+        // Process the first bits up to a byte boundary of this bitset, so that
+        // the following words are stored with plain copies.
+        const size_type head = std::min<size_type>(size(), (8 - m_offset % 8) % 8);
+        if (head != 0)
+        {
+            combine(head);
+        }
+        while (pos < size())
+        {
+            combine(std::min<size_type>(64, size() - pos));
+        }
+        this->set_null_count(null_count);
+    }
+
     template <typename B, null_count_policy NCP>
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
     constexpr dynamic_bitset_base<B, NCP>::dynamic_bitset_base(storage_type buf, size_type size)
@@ -1047,25 +1255,17 @@ namespace sparrow
         {
             m_size += count;
         }
-        else
+        else if (count != 0)
         {
+            materialize_null_buffer();
             const size_type old_size = size();
-            const size_type new_size = old_size + count;
+            resize_storage(old_size + count);
 
-            resize(new_size);
-
-            // Shift existing bits to make room for new ones
-            const size_type bits_to_shift = old_size - index;
-            if (bits_to_shift > 0)
-            {
-                shift_bits_right(index + m_offset, bits_to_shift, count);
-            }
-
-            // Fill the inserted region with the specified value
+            // Move the tail word by word to make room for the new bits
+            auto* bits = reinterpret_cast<std::uint8_t*>(data());
+            move_bits(bits, index + count + m_offset, index + m_offset, old_size - index);
             fill_bits(index + m_offset, count, value);
-
-            // Recompute null count after all bit manipulations are complete
-            this->recompute_null_count(data(), m_size, buffer().size(), m_offset);
+            adjust_null_count(value ? 0 : count, 0);
         }
 
         return iterator(this, index);
@@ -1077,46 +1277,51 @@ namespace sparrow
     constexpr dynamic_bitset_base<B, NCP>::iterator
     dynamic_bitset_base<B, NCP>::insert(const_iterator pos, InputIt first, InputIt last)
     {
+        SPARROW_ASSERT_TRUE(cbegin() <= pos);
+        SPARROW_ASSERT_TRUE(pos <= cend());
         const auto index = static_cast<size_type>(std::distance(cbegin(), pos));
         const auto count = static_cast<size_type>(std::distance(first, last));
-        if (data() == nullptr)
+        if (data() == nullptr
+            && std::all_of(
+                first,
+                last,
+                [](auto v)
+                {
+                    return bool(v);
+                }
+            ))
+        {
+            m_size += count;
+            return iterator(this, index);
+        }
+        if (count == 0)
         {
-            if (std::all_of(
-                    first,
-                    last,
-                    [](auto v)
-                    {
-                        return bool(v);
-                    }
-                ))
-            {
-                m_size += count;
-            }
             return iterator(this, index);
         }
-        SPARROW_ASSERT_TRUE(cbegin() <= pos);
-        SPARROW_ASSERT_TRUE(pos <= cend());
 
+        materialize_null_buffer();
         const size_type old_size = size();
-        const size_type new_size = old_size + count;
+        resize_storage(old_size + count);
 
-        resize(new_size);
+        // Move the tail word by word to make room for the new bits
+        auto* bits = reinterpret_cast<std::uint8_t*>(data());
+        move_bits(bits, index + count + m_offset, index + m_offset, old_size - index);
 
-        // Shift existing bits to make room for new ones
-        const size_type bits_to_shift = old_size - index;
-        if (bits_to_shift > 0)
+        // Pack the inserted values into words, counting the nulls on the fly
+        size_type inserted_null_count = 0;
+        for (size_type i = 0; i < count;)
         {
-            shift_bits_right(index + m_offset, bits_to_shift, count);
-        }
-
-        // Insert bits from the iterator range
-        for (size_type i = 0; i < count; ++i)
-        {
-            set(index + i, *first++);
+            const size_type n = std::min<size_type>(64, count - i);
+            std::uint64_t word = 0;
+            for (size_type j = 0; j < n; ++j, ++first)
+            {
+                word |= static_cast<std::uint64_t>(bool(*first)) << j;
+            }
+            store_bits(bits, index + i + m_offset, word, n);
+            inserted_null_count += n - static_cast<size_type>(std::popcount(word));
+            i += n;
         }
-
-        // Recompute null count after all bit manipulations are complete
-        this->recompute_null_count(data(), m_size, buffer().size(), m_offset);
+        adjust_null_count(inserted_null_count, 0);
 
         return iterator(this, index);
     }
@@ -1156,27 +1361,25 @@ namespace sparrow
         {
             m_size -= count;
         }
-        else
+        else if (count != 0)
         {
-            if (last == cend())
+            auto* bits = reinterpret_cast<std::uint8_t*>(data());
+            size_type erased_null_count = 0;
+            if (has_tracked_null_count())
             {
-                resize(first_index);
-                return end();
+                erased_null_count = count
+                                    - static_cast<size_type>(count_non_null(
+                                        bits,
+                                        count,
+                                        buffer().size() * sizeof(block_type),
+                                        first_index + m_offset
+                                    ));
             }
 
-            // Shift bits left using block-level operations
-            const size_type bits_to_move = size() - last_index;
-            if (bits_to_move > 0)
-            {
-                // Copy bits from [last_index, end) to [first_index, ...)
-                for (size_type i = 0; i < bits_to_move; ++i)
-                {
-                    const bool bit_value = test(last_index + i);
-                    set(first_index + i, bit_value);
-                }
-            }
-
-            resize(size() - count);
+            // Move the tail word by word over the erased bits
+            move_bits(bits, first_index + m_offset, last_index + m_offset, size() - last_index);
+            resize_storage(size() - count);
+            adjust_null_count(0, erased_null_count);
         }
         return iterator(this, first_index);
     }
@@ -1201,61 +1404,56 @@ namespace sparrow
 
     template <typename B, null_count_policy NCP>
         requires std::ranges::random_access_range<std::remove_pointer_t<B>>
-    constexpr void
-    dynamic_bitset_base<B, NCP>::shift_bits_right(size_type start, size_type length, size_type shift_amount)
+    void dynamic_bitset_base<B, NCP>::materialize_null_buffer()
     {
-        if (length == 0 || shift_amount == 0)
+        if (data() != nullptr)
         {
             return;
         }
-
-        auto* blocks = data();
-        const size_type src_start_bit = start;
-        const size_type dst_start_bit = start + shift_amount;
-
-        // Work backwards to avoid overwriting source data
-        // Process bit-by-bit in reverse order, but in block-sized chunks where possible
-        size_type remaining = length;
-
-        while (remaining > 0)
+        if constexpr (requires(storage_type_without_cvrefpointer s) { s.resize(0); })
         {
-            // Calculate position for this iteration (working backwards)
-            const size_type current_offset = remaining - 1;
-            const size_type src_bit = src_start_bit + current_offset;
-            const size_type dst_bit = dst_start_bit + current_offset;
-
-            const size_type src_block_idx = block_index(src_bit);
-            const size_type dst_block_idx = block_index(dst_bit);
-            const size_type src_bit_offset = bit_index(src_bit);
-            const size_type dst_bit_offset = bit_index(dst_bit);
-
-            // Determine how many bits we can process in this iteration
-            // We can process up to the start of the current block, or all remaining bits
-            const size_type bits_available_in_src_block = src_bit_offset + 1;
-            const size_type bits_available_in_dst_block = dst_bit_offset + 1;
-            const size_type bits_this_iter = std::min(
-                {remaining, bits_available_in_src_block, bits_available_in_dst_block}
-            );
+            buffer().resize(compute_block_count(size() + m_offset), block_type(~block_type(0)));
+            zero_unused_bits();
+        }
+        else
+        {
+            throw std::runtime_error("Cannot allocate a null buffer.");
+        }
+    }
 
-            // Extract bits from source
-            const size_type extract_start_offset = src_bit_offset - (bits_this_iter - 1);
-            const block_type mask = static_cast<block_type>(
-                ((block_type(1) << bits_this_iter) - 1) << extract_start_offset
-            );
-            const block_type src_bits = static_cast<block_type>(
-                (blocks[src_block_idx] & mask) >> extract_start_offset
-            );
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    void dynamic_bitset_base<B, NCP>::resize_storage(size_type n)
+    {
+        buffer().resize(compute_block_count(n + m_offset), block_type(0));
+        m_size = n;
+        zero_unused_bits();
+    }
 
-            // Write bits to destination
-            const size_type write_start_offset = dst_bit_offset - (bits_this_iter - 1);
-            const block_type dst_mask = static_cast<block_type>(
-                ((block_type(1) << bits_this_iter) - 1) << write_start_offset
-            );
-            blocks[dst_block_idx] = static_cast<block_type>(
-                (blocks[dst_block_idx] & ~dst_mask) | ((src_bits << write_start_offset) & dst_mask)
-            );
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    constexpr void dynamic_bitset_base<B, NCP>::adjust_null_count(size_type added, size_type removed) noexcept
+    {
+        if constexpr (NCP::track_null_count)
+        {
+            if (has_tracked_null_count())
+            {
+                this->set_null_count(NCP::null_count() + added - removed);
+            }
+        }
+    }
 
-            remaining -= bits_this_iter;
+    template <typename B, null_count_policy NCP>
+        requires std::ranges::random_access_range<std::remove_pointer_t<B>>
+    constexpr bool dynamic_bitset_base<B, NCP>::has_tracked_null_count() const noexcept
+    {
+        if constexpr (lazy_null_count_policy<NCP>)
+        {
+            return this->has_null_count();
+        }
+        else
+        {
+            return NCP::track_null_count;
         }
     }
 
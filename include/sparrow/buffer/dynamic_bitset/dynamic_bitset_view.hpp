@@ -233,8 +233,8 @@ namespace sparrow
 
         const size_type new_offset = this->offset() + start;
 
-        // Calculate the null count for the slice if tracking is enabled
-        if constexpr (NCP::track_null_count)
+        // Calculate the null count for the slice if tracking is enabled and not deferred
+        if constexpr (NCP::track_null_count && !lazy_null_count_policy<NCP>)
         {
             size_type slice_null_count = 0;
             for (size_type i = 0; i < length; ++i)
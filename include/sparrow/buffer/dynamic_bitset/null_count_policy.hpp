@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
@@ -23,6 +24,20 @@
 
 namespace sparrow
 {
+    /**
+     * @brief Counts the number of bits set to true in a range of a bitmap.
+     *
+     * Only the bytes holding the bits of [\p offset, \p offset + \p bit_size) are read.
+     * The bulk of the range is counted with the popcount kernel that fits the running
+     * CPU (AVX-512 VPOPCNTDQ, AVX2 or POPCNT), selected at runtime.
+     * @param data Pointer to the byte data, must not be nullptr
+     * @param offset The position of the first bit to count
+     * @param bit_size The number of bits to count
+     * @return The number of bits set to true in the range
+     */
+    [[nodiscard]] SPARROW_API std::size_t
+    count_set_bits(const std::uint8_t* data, std::size_t offset, std::size_t bit_size) noexcept;
+
     /**
      * @brief Counts the number of bits set to true in a buffer.
      * @param data Pointer to the byte data (may be nullptr)
@@ -220,6 +235,168 @@ namespace sparrow
         }
     };
 
+    /**
+     * @class lazy_null_count
+     *
+     * Policy class that computes the null count of a dynamic_bitset_base on demand.
+     *
+     * Constructing the bitset from an existing buffer, or rewriting many bits at
+     * once, only marks the null count as unknown. The count is computed by the
+     * first null_count() query and cached; single bit modifications keep a cached
+     * count up to date.
+     *
+     * Use this policy for views over imported or sliced buffers whose null count
+     * may never be queried.
+     *
+     * @tparam SizeType The size type used for counting (typically std::size_t)
+     */
+    template <typename SizeType = std::size_t>
+    class lazy_null_count
+    {
+    public:
+
+        static constexpr bool track_null_count = true;
+        using size_type = SizeType;
+
+        constexpr lazy_null_count() noexcept = default;
+
+        constexpr explicit lazy_null_count(size_type count) noexcept
+            : m_null_count(static_cast<std::int64_t>(count))
+        {
+        }
+
+        lazy_null_count(const lazy_null_count& other) noexcept
+            : m_null_count(other.m_null_count.load(std::memory_order_relaxed))
+        {
+        }
+
+        lazy_null_count& operator=(const lazy_null_count& other) noexcept
+        {
+            m_null_count.store(other.m_null_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        // Defers the counting to the first query
+        template <std::integral BlockType>
+        void initialize_null_count(
+            const BlockType* /*data*/,
+            size_type /*bit_size*/,
+            size_type /*block_count*/,
+            size_type /*offset*/ = 0
+        ) noexcept
+        {
+            invalidate_null_count();
+        }
+
+        /**
+         * @brief Checks whether the null count is known without counting the bits.
+         */
+        [[nodiscard]] bool has_null_count() const noexcept
+        {
+            return m_null_count.load(std::memory_order_relaxed) != unknown_null_count;
+        }
+
+        /**
+         * @brief Returns the cached null count.
+         * @pre has_null_count()
+         */
+        [[nodiscard]] size_type null_count() const noexcept
+        {
+            return static_cast<size_type>(m_null_count.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Returns the null count, counting the bits of the buffer if it is unknown.
+         *
+         * Concurrent queries on a const bitset may count the bits more than once,
+         * but they all return and cache the same value.
+         * @tparam BlockType The integral type used for storage blocks
+         * @param data Pointer to the block data
+         * @param bit_size The total number of bits to count (logical size, not including offset)
+         * @param block_count The number of blocks in the buffer
+         * @param offset The bit offset from which to start counting (default: 0)
+         */
+        template <std::integral BlockType>
+        [[nodiscard]] size_type
+        null_count(const BlockType* data, size_type bit_size, size_type block_count, size_type offset = 0) const noexcept
+        {
+            std::int64_t count = m_null_count.load(std::memory_order_relaxed);
+            if (count == unknown_null_count)
+            {
+                const auto* byte_data = reinterpret_cast<const std::uint8_t*>(data);
+                const std::size_t byte_size = block_count * sizeof(BlockType);
+                count = static_cast<std::int64_t>(bit_size)
+                        - static_cast<std::int64_t>(count_non_null(
+                            byte_data,
+                            static_cast<std::size_t>(bit_size),
+                            byte_size,
+                            static_cast<std::size_t>(offset)
+                        ));
+                m_null_count.store(count, std::memory_order_relaxed);
+            }
+            return static_cast<size_type>(count);
+        }
+
+        void set_null_count(size_type count) noexcept
+        {
+            m_null_count.store(static_cast<std::int64_t>(count), std::memory_order_relaxed);
+        }
+
+        // Defers the counting to the next query
+        template <std::integral BlockType>
+        void recompute_null_count(
+            const BlockType* /*data*/,
+            size_type /*bit_size*/,
+            size_type /*block_count*/,
+            size_type /*offset*/ = 0
+        ) noexcept
+        {
+            invalidate_null_count();
+        }
+
+        void invalidate_null_count() noexcept
+        {
+            m_null_count.store(unknown_null_count, std::memory_order_relaxed);
+        }
+
+        void update_null_count(bool old_value, bool new_value) noexcept
+        {
+            const std::int64_t count = m_null_count.load(std::memory_order_relaxed);
+            if (count == unknown_null_count)
+            {
+                return;
+            }
+            if (new_value && !old_value)
+            {
+                m_null_count.store(count - 1, std::memory_order_relaxed);
+            }
+            else if (!new_value && old_value)
+            {
+                m_null_count.store(count + 1, std::memory_order_relaxed);
+            }
+        }
+
+        void swap_null_count(lazy_null_count& other) noexcept
+        {
+            const std::int64_t count = m_null_count.load(std::memory_order_relaxed);
+            m_null_count.store(other.m_null_count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            other.m_null_count.store(count, std::memory_order_relaxed);
+        }
+
+        void clear_null_count() noexcept
+        {
+            set_null_count(0);
+        }
+
+    private:
+
+        static constexpr std::int64_t unknown_null_count = -1;
+
+        // The null count, or unknown_null_count until it is computed. Relaxed atomic
+        // accesses are enough: the count does not publish any other data.
+        mutable std::atomic<std::int64_t> m_null_count = 0;
+    };
+
     /**
      * @concept null_count_policy
      *
@@ -240,4 +417,17 @@ namespace sparrow
         { p.recompute_null_count(data, s, s) } -> std::same_as<void>;
     };
 
+    /**
+     * @concept lazy_null_count_policy
+     *
+     * Concept that checks if a null count policy computes the count on demand,
+     * in which case the count may be unknown until it is queried.
+     */
+    template <typename P>
+    concept lazy_null_count_policy = null_count_policy<P>
+                                     && requires(const P p, const std::uint8_t* data, typename P::size_type s) {
+                                            { p.has_null_count() } -> std::same_as<bool>;
+                                            { p.null_count(data, s, s) } -> std::same_as<typename P::size_type>;
+                                        };
+
 }  // namespace sparrow
@@ -0,0 +1,169 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+#include "sparrow/config/config.hpp"
+
+namespace sparrow
+{
+    /**
+     * Alignment of the blocks returned by the memory resources of sparrow,
+     * as recommended by the Arrow specification.
+     */
+    inline constexpr std::size_t buffer_alignment = 64;
+
+    /**
+     * @class arena_memory_resource
+     *
+     * Monotonic memory resource: blocks are carved out of large chunks requested
+     * to the upstream resource, deallocating a block is a no-op, and all the memory
+     * is given back at once by release() or by the destructor.
+     *
+     * The blocks handed out since the last call to release() or reset() must have been
+     * deallocated when the arena is destroyed, which is asserted: the arrays allocating
+     * from the arena must not outlive it.
+     *
+     * Contrary to std::pmr::monotonic_buffer_resource, every block is aligned on
+     * buffer_alignment bytes, whatever the alignment requested by the allocator
+     * (std::pmr::polymorphic_allocator<std::uint8_t> requests an alignment of 1).
+     *
+     * This resource is not thread-safe.
+     */
+    class SPARROW_API arena_memory_resource final : public std::pmr::memory_resource
+    {
+    public:
+
+        static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+        explicit arena_memory_resource(
+            std::size_t initial_chunk_size = default_chunk_size,
+            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+        );
+        ~arena_memory_resource() override;
+
+        arena_memory_resource(const arena_memory_resource&) = delete;
+        arena_memory_resource& operator=(const arena_memory_resource&) = delete;
+
+        /**
+         * @brief Gives all the chunks back to the upstream resource.
+         *
+         * The blocks previously allocated from the arena must not be used anymore.
+         */
+        void release() noexcept;
+
+        /**
+         * @brief Makes the whole arena available for new allocations.
+         *
+         * Contrary to release(), the largest chunk is kept, so that building batches of
+         * the same shape in a loop does not request memory to the upstream resource.
+         * The blocks previously allocated from the arena must not be used anymore.
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Returns the number of bytes handed out since the construction or
+         * the last call to release() or reset(), padding included.
+         */
+        [[nodiscard]] std::size_t bytes_allocated() const noexcept;
+
+        [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept;
+
+    private:
+
+        struct chunk_header;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        void add_chunk(std::size_t min_size);
+
+        std::pmr::memory_resource* p_upstream;
+        chunk_header* p_chunks = nullptr;
+        std::byte* p_current = nullptr;
+        std::byte* p_end = nullptr;
+        std::size_t m_next_chunk_size;
+        std::size_t m_bytes_allocated = 0;
+        std::size_t m_blocks_in_use = 0;
+    };
+
+    /**
+     * @class pool_memory_resource
+     *
+     * Memory resource that serves blocks from size classes (powers of two from
+     * buffer_alignment to max_block_size bytes). Deallocated blocks are kept in
+     * the free list of their class and reused by the next allocations of the same
+     * class; blocks larger than max_block_size are forwarded to the upstream resource.
+     *
+     * Every block is aligned on buffer_alignment bytes.
+     *
+     * The blocks handed out since the last call to release() must have been deallocated
+     * when the pool is destroyed, which is asserted: the arrays allocating from the pool
+     * must not outlive it.
+     *
+     * This resource is not thread-safe.
+     */
+    class SPARROW_API pool_memory_resource final : public std::pmr::memory_resource
+    {
+    public:
+
+        static constexpr std::size_t default_max_block_size = 1024 * 1024;
+        static constexpr std::size_t max_size_class_count = 32;
+
+        explicit pool_memory_resource(
+            std::size_t max_block_size = default_max_block_size,
+            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+        );
+        ~pool_memory_resource() override;
+
+        pool_memory_resource(const pool_memory_resource&) = delete;
+        pool_memory_resource& operator=(const pool_memory_resource&) = delete;
+
+        /**
+         * @brief Gives all the pooled chunks back to the upstream resource.
+         *
+         * The blocks previously allocated from the pool must not be used anymore.
+         * Blocks larger than max_block_size() are not tracked and must have been
+         * deallocated before.
+         */
+        void release() noexcept;
+
+        [[nodiscard]] std::size_t max_block_size() const noexcept;
+
+        [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept;
+
+    private:
+
+        struct chunk_header;
+        struct free_block;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        [[nodiscard]] std::size_t size_class(std::size_t bytes) const noexcept;
+        void refill(std::size_t size_class);
+
+        std::pmr::memory_resource* p_upstream;
+        std::size_t m_max_block_size;
+        chunk_header* p_chunks = nullptr;
+        std::array<free_block*, max_size_class_count> m_free_lists = {};
+        std::size_t m_blocks_in_use = 0;
+    };
+}
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <map>
+#include <memory_resource>
 #include <ranges>
 #include <tuple>
 #include <type_traits>
@@ -71,35 +72,46 @@ namespace sparrow
     // option flag to indicate the desire for large lists
     inline constexpr large_list_flag_t large_list_flag;
 
+    namespace detail
+    {
+        template <class T, class OPTION_FLAGS, class A>
+        [[nodiscard]] constexpr auto build_toplevel(T&& t, const A& alloc)
+        {
+            // for toplevel build calls, the layout policy is determined by the type itself
+            using decayed_t = std::decay_t<T>;
+            using layout_policy = layout_flag_t<decayed_t>;
+
+            if constexpr (is_express_layout_desire<decayed_t>)
+            {
+                // directely unpack
+                using value_type = typename decayed_t::value_type;
+                return builder<value_type, layout_policy, OPTION_FLAGS>::create(std::forward<T>(t).get(), alloc);
+            }
+            else if constexpr (is_nullable_like<T>)
+            {
+                static_assert(mpl::dependent_false<T>::value, "toplevel type must not be nullable");
+            }
+            else
+            {
+                return builder<T, layout_policy, OPTION_FLAGS>::create(std::forward<T>(t), alloc);
+            }
+        }
+    }  // namespace detail
+
     /**
      * @brief  function to create a sparrow array from arbitrary  nested
      * combinations of ranges, tuples, and nullable types, variants.
      * Have a look at the  \ref builder "buider documentation" for more information.
      */
     template <class T, class... OPTION_FLAGS>
+        requires(!std::derived_from<std::remove_cvref_t<T>, std::pmr::memory_resource>)
     [[nodiscard]] constexpr auto build(T&& t, OPTION_FLAGS&&...)
     {
-        // for toplevel build calls, the layout policy is determined by the type itself
-        using decayed_t = std::decay_t<T>;
-        using layout_policy = detail::layout_flag_t<decayed_t>;
         using option_flags_type = sparrow::mpl::typelist<std::decay_t<OPTION_FLAGS>...>;
-
-        if constexpr (detail::is_express_layout_desire<decayed_t>)
-        {
-            // directely unpack
-            using value_type = typename decayed_t::value_type;
-            return detail::builder<value_type, layout_policy, option_flags_type>::create(
-                std::forward<T>(t).get()
-            );
-        }
-        else if constexpr (detail::is_nullable_like<T>)
-        {
-            static_assert(mpl::dependent_false<T>::value, "toplevel type must not be nullable");
-        }
-        else
-        {
-            return detail::builder<T, layout_policy, option_flags_type>::create(std::forward<T>(t));
-        }
+        return detail::build_toplevel<T, option_flags_type>(
+            std::forward<T>(t),
+            buffer<std::uint8_t>::default_allocator{}
+        );
     }
 
     template <class T, class... OPTION_FLAGS>
@@ -109,15 +121,77 @@ namespace sparrow
         return build(std::forward<decltype(subranges)>(subranges), std::forward<OPTION_FLAGS>(flags)...);
     }
 
+    /**
+     * @brief Same as build(t, flags...), except that all the buffers of the array
+     * and of its children (data, offsets, validity bitmaps) are allocated from
+     * \p resource, which must outlive the array (arena_memory_resource and
+     * pool_memory_resource assert it when they are destroyed).
+     *
+     * Building from an arena_memory_resource and releasing the arena once the arrays
+     * are destroyed frees all the buffers at once.
+     */
+    template <class T, class... OPTION_FLAGS>
+    [[nodiscard]] auto build(std::pmr::memory_resource& resource, T&& t, OPTION_FLAGS&&...)
+    {
+        using option_flags_type = sparrow::mpl::typelist<std::decay_t<OPTION_FLAGS>...>;
+        return detail::build_toplevel<T, option_flags_type>(
+            std::forward<T>(t),
+            std::pmr::polymorphic_allocator<std::uint8_t>(&resource)
+        );
+    }
+
+    template <class T, class... OPTION_FLAGS>
+    [[nodiscard]] auto
+    build(std::pmr::memory_resource& resource, std::initializer_list<T> t, OPTION_FLAGS&&... flags)
+    {
+        auto subranges = std::views::all(t);
+        return build(
+            resource,
+            std::forward<decltype(subranges)>(subranges),
+            std::forward<OPTION_FLAGS>(flags)...
+        );
+    }
+
     namespace detail
     {
         // this is called by the nested recursive calls
-        template <class LAYOUT_POLICY, class T, class... OPTION_FLAGS>
+        template <class LAYOUT_POLICY, class T, class A, class... OPTION_FLAGS>
         [[nodiscard]] constexpr auto
-        build_impl(T&& t, [[maybe_unused]] sparrow::mpl::typelist<OPTION_FLAGS...> typelist)
+        build_impl(T&& t, const A& alloc, [[maybe_unused]] sparrow::mpl::typelist<OPTION_FLAGS...> typelist)
         {
             using option_flags_type = sparrow::mpl::typelist<OPTION_FLAGS...>;
-            return builder<T, LAYOUT_POLICY, option_flags_type>::create(std::forward<T>(t));
+            return builder<T, LAYOUT_POLICY, option_flags_type>::create(std::forward<T>(t), alloc);
+        }
+
+        // Validity bitmap of a range of nullable values, allocated with alloc
+        template <class T, class A>
+        [[nodiscard]] validity_bitmap nullable_validity_bitmap(T&& t, const A& alloc)
+        {
+            auto is_non_null = t
+                               | std::views::transform(
+                                   [](const auto& v)
+                                   {
+                                       return v.has_value();
+                                   }
+                               );
+            return ensure_validity_bitmap(range_size(t), is_non_null, alloc);
+        }
+
+        // Builds a primitive_array_impl whose data buffer and validity bitmap are allocated with alloc
+        template <class V, class T, class A>
+        [[nodiscard]] primitive_array_impl<V> create_primitive_array(T&& t, const A& alloc)
+        {
+            using type = primitive_array_impl<V>;
+            const std::size_t size = range_size(t);
+            auto data_buffer = details::primitive_data_access<V>::make_data_buffer(ensure_value_range(t), alloc);
+            if constexpr (is_nullable_like<std::ranges::range_value_t<T>>)
+            {
+                return type(std::move(data_buffer), size, nullable_validity_bitmap(t, alloc));
+            }
+            else
+            {
+                return type(std::move(data_buffer), size);
+            }
         }
 
         template <class T>
@@ -229,10 +303,10 @@ namespace sparrow
         {
             using type = sparrow::primitive_array<ensured_range_value_t<T>>;
 
-            template <class U>
-            [[nodiscard]] static constexpr type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
-                return type(std::forward<U>(t));
+                return create_primitive_array<ensured_range_value_t<T>>(std::forward<U>(t), alloc);
             }
         };
 
@@ -241,10 +315,10 @@ namespace sparrow
         {
             using type = sparrow::date_array<ensured_range_value_t<T>>;
 
-            template <class U>
-            static constexpr type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
-                return type(std::forward<U>(t));
+                return create_primitive_array<ensured_range_value_t<T>>(std::forward<U>(t), alloc);
             }
         };
 
@@ -253,10 +327,10 @@ namespace sparrow
         {
             using type = sparrow::duration_array<ensured_range_value_t<T>>;
 
-            template <class U>
-            [[nodiscard]] static constexpr type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
-                return type(std::forward<U>(t));
+                return create_primitive_array<ensured_range_value_t<T>>(std::forward<U>(t), alloc);
             }
         };
 
@@ -266,8 +340,8 @@ namespace sparrow
             using type = sparrow::timestamp_array<ensured_range_value_t<T>>;
             using timezone_ptr = std::decay_t<decltype(std::declval<ensured_range_value_t<T>>().get_time_zone())>;
 
-            template <class U>
-            [[nodiscard]] static constexpr type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 timezone_ptr tz = [&t]() -> timezone_ptr
                 {
@@ -280,7 +354,22 @@ namespace sparrow
                         return t.begin()->get_time_zone();
                     }
                 }();
-                return type(tz, std::forward<U>(t));
+                auto durations = ensure_value_range(t)
+                                 | std::views::transform(
+                                     [](const auto& v)
+                                     {
+                                         return v.get_sys_time().time_since_epoch().count();
+                                     }
+                                 );
+                u8_buffer<typename type::buffer_inner_value_type> data_buffer(durations, alloc);
+                if constexpr (is_nullable_like<std::ranges::range_value_t<U>>)
+                {
+                    return type(tz, std::move(data_buffer), nullable_validity_bitmap(t, alloc));
+                }
+                else
+                {
+                    return type(tz, std::move(data_buffer), validity_bitmap(range_size(t), true, alloc));
+                }
             }
         };
 
@@ -289,10 +378,10 @@ namespace sparrow
         {
             using type = sparrow::timestamp_without_timezone_array<ensured_range_value_t<T>>;
 
-            template <class U>
-            [[nodiscard]] static constexpr type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
-                return type(std::forward<U>(t));
+                return create_primitive_array<ensured_range_value_t<T>>(std::forward<U>(t), alloc);
             }
         };
 
@@ -301,10 +390,10 @@ namespace sparrow
         {
             using type = sparrow::interval_array<ensured_range_value_t<T>>;
 
-            template <class U>
-            [[nodiscard]] static constexpr type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
-                return type(std::forward<U>(t));
+                return create_primitive_array<ensured_range_value_t<T>>(std::forward<U>(t), alloc);
             }
         };
 
@@ -313,10 +402,10 @@ namespace sparrow
         {
             using type = sparrow::time_array<ensured_range_value_t<T>>;
 
-            template <class U>
-            static constexpr type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
-                return type(std::forward<U>(t));
+                return create_primitive_array<ensured_range_value_t<T>>(std::forward<U>(t), alloc);
             }
         };
 
@@ -330,8 +419,8 @@ namespace sparrow
                 sparrow::big_list_array,
                 sparrow::list_array>;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 auto flat_list_view = std::ranges::views::join(ensure_value_range(t));
 
@@ -346,10 +435,14 @@ namespace sparrow
                 // when the raw_value_type is a "express layout desire" we need to
                 // propagate this information to the builder, so it can handle the
                 using layout_policy_type = layout_flag_t<raw_value_type>;
-                auto typed_array = build_impl<layout_policy_type>(flat_list_view, OPTION_FLAGS{});
+                auto typed_array = build_impl<layout_policy_type>(flat_list_view, alloc, OPTION_FLAGS{});
                 auto detyped_array = array(std::move(typed_array));
 
-                return type(std::move(detyped_array), type::offset_from_sizes(sizes), where_null(t));
+                return type(
+                    std::move(detyped_array),
+                    type::offset_from_sizes(sizes, alloc),
+                    ensure_validity_bitmap(range_size(t), where_null(t), alloc)
+                );
             }
         };
 
@@ -361,8 +454,8 @@ namespace sparrow
                 list_size = std::tuple_size_v<look_trough_t<std::ranges::range_value_t<T>>>;
             using raw_value_type = std::ranges::range_value_t<T>;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 auto flat_list_view = std::ranges::views::join(ensure_value_range(t));
 
@@ -372,8 +465,8 @@ namespace sparrow
 
                 return type(
                     static_cast<std::uint64_t>(list_size),
-                    array(build_impl<layout_policy_type>(flat_list_view, OPTION_FLAGS{})),
-                    where_null(t)
+                    array(build_impl<layout_policy_type>(flat_list_view, alloc, OPTION_FLAGS{})),
+                    ensure_validity_bitmap(range_size(t), where_null(t), alloc)
                 );
             }
         };
@@ -386,8 +479,8 @@ namespace sparrow
             using key_type = typename raw_value_type::first_type;
             using value_type = typename raw_value_type::second_type;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 auto flat_keys = t
                                  | std::views::transform(
@@ -407,15 +500,18 @@ namespace sparrow
                 // when the raw_value_type is a "express layout desire" we need to
                 // propagate this information to the builder, so it can handle the
                 using layout_policy_type = layout_flag_t<raw_value_type>;
-                auto keys_array = build_impl<layout_policy_type>(flat_keys, OPTION_FLAGS{});
-                auto items_array = build_impl<layout_policy_type>(flat_items, OPTION_FLAGS{});
-                auto offset = map_array::offset_from_sizes(sparrow::repeat_view<size_t>(1, std::ranges::size(t)));
+                auto keys_array = build_impl<layout_policy_type>(flat_keys, alloc, OPTION_FLAGS{});
+                auto items_array = build_impl<layout_policy_type>(flat_items, alloc, OPTION_FLAGS{});
+                auto offset = map_array::offset_from_sizes(
+                    sparrow::repeat_view<size_t>(1, std::ranges::size(t)),
+                    alloc
+                );
 
                 return type(
                     sparrow::array{std::move(keys_array)},
                     sparrow::array{std::move(items_array)},
                     std::move(offset),
-                    where_null(t)
+                    ensure_validity_bitmap(std::ranges::size(t), where_null(t), alloc)
                 );
             }
         };
@@ -427,8 +523,8 @@ namespace sparrow
             static constexpr std::size_t n_children = std::tuple_size_v<mnv_t<std::ranges::range_value_t<T>>>;
             using tuple_type = ensured_range_value_t<T>;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 std::vector<array> detyped_children(n_children);
                 for_each_index<n_children>(
@@ -446,12 +542,15 @@ namespace sparrow
                         using tuple_element_type = std::tuple_element_t<decltype(i)::value, tuple_type>;
                         using layout_policy_type = layout_flag_t<tuple_element_type>;
                         detyped_children[decltype(i)::value] = array(
-                            build_impl<layout_policy_type>(tuple_i_col, OPTION_FLAGS{})
+                            build_impl<layout_policy_type>(tuple_i_col, alloc, OPTION_FLAGS{})
                         );
                     }
                 );
 
-                return type(std::move(detyped_children), where_null(t));
+                return type(
+                    std::move(detyped_children),
+                    ensure_validity_bitmap(range_size(t), where_null(t), alloc)
+                );
             }
         };
 
@@ -460,11 +559,11 @@ namespace sparrow
         {
             using type = sparrow::string_array;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 auto flat_list_view = std::ranges::views::join(ensure_value_range(t));
-                u8_buffer<char> data_buffer(flat_list_view);
+                u8_buffer<char> data_buffer(flat_list_view, alloc);
 
                 auto sizes = t
                              | std::views::transform(
@@ -474,7 +573,11 @@ namespace sparrow
                                  }
                              );
 
-                return type(std::move(data_buffer), type::offset_from_sizes(sizes), where_null(t));
+                return type(
+                    std::move(data_buffer),
+                    type::offset_from_sizes(sizes, alloc),
+                    ensure_validity_bitmap(range_size(t), where_null(t), alloc)
+                );
             }
         };
 
@@ -483,10 +586,22 @@ namespace sparrow
         {
             using type = sparrow::fixed_width_binary_array;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
-                return type(std::forward<U>(t));
+                const std::size_t size = range_size(t);
+                const std::size_t element_size = std::ranges::empty(t)
+                                                     ? 0
+                                                     : std::ranges::size(ensure_value(*std::ranges::begin(t)));
+                u8_buffer<byte_t> data_buffer(std::ranges::views::join(ensure_value_range(t)), alloc);
+                if constexpr (is_nullable_like<std::ranges::range_value_t<U>>)
+                {
+                    return type(std::move(data_buffer), size, element_size, nullable_validity_bitmap(t, alloc));
+                }
+                else
+                {
+                    return type(std::move(data_buffer), size, element_size, validity_bitmap(size, true, alloc));
+                }
             }
         };
 
@@ -497,8 +612,8 @@ namespace sparrow
             using variant_type = std::ranges::range_value_t<T>;
             static constexpr std::size_t variant_size = std::variant_size_v<variant_type>;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
                 requires(std::is_same_v<type, sparrow::sparse_union_array>)
             {
                 std::vector<array> detyped_children(variant_size);
@@ -518,7 +633,7 @@ namespace sparrow
 
                         using layout_policy_type = layout_flag_t<type_at_index>;
                         detyped_children[decltype(i)::value] = array(
-                            build_impl<layout_policy_type>(type_i_col, OPTION_FLAGS{})
+                            build_impl<layout_policy_type>(type_i_col, alloc, OPTION_FLAGS{})
                         );
                     }
                 );
@@ -531,7 +646,7 @@ namespace sparrow
                                              return static_cast<std::uint8_t>(v.index());
                                          }
                                      );
-                sparrow::u8_buffer<std::uint8_t> type_id_buffer(type_id_range);
+                sparrow::u8_buffer<std::uint8_t> type_id_buffer(type_id_range, alloc);
 
                 return type(std::move(detyped_children), std::move(type_id_buffer));
             }
@@ -545,8 +660,8 @@ namespace sparrow
             // keep the nulls
             using raw_range_value_type = std::ranges::range_value_t<T>;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 const auto input_size = range_size(t);
                 key_type key = 0;
@@ -572,13 +687,13 @@ namespace sparrow
                         keys.push_back(find_res->second);
                     }
                 }
-                auto keys_buffer = sparrow::u8_buffer<key_type>(keys);
+                auto keys_buffer = sparrow::u8_buffer<key_type>(keys, alloc);
 
                 // since we do not support dict[dict or dict[run_end
                 // we can hard code the layout policy here
                 using layout_policy_type = dont_enforce_layout;
 
-                auto values_array = build_impl<layout_policy_type>(values, OPTION_FLAGS{});
+                auto values_array = build_impl<layout_policy_type>(values, alloc, OPTION_FLAGS{});
 
                 return type(std::move(keys_buffer), array(std::move(values_array)));
             }
@@ -590,8 +705,8 @@ namespace sparrow
             using type = sparrow::run_end_encoded_array;
             using raw_range_value_type = std::ranges::range_value_t<T>;
 
-            template <class U>
-            [[nodiscard]] static type create(U&& t)
+            template <class U, class A>
+            [[nodiscard]] static type create(U&& t, const A& alloc)
             {
                 using value_type = std::decay_t<raw_range_value_type>;
 
@@ -627,12 +742,15 @@ namespace sparrow
                 }
                 acc_run_lengths.push_back(i);
 
-                auto run_length_typed_array = primitive_array<int64_t>(acc_run_lengths);
+                auto run_length_typed_array = primitive_array<int64_t>(
+                    u8_buffer<int64_t>(acc_run_lengths, alloc),
+                    acc_run_lengths.size()
+                );
 
                 // since we do not support dict[dict or dict[run_end
                 // we can hard code the layout policy here
                 using layout_policy_type = dont_enforce_layout;
-                auto values_array = build_impl<layout_policy_type>(values, OPTION_FLAGS{});
+                auto values_array = build_impl<layout_policy_type>(values, alloc, OPTION_FLAGS{});
 
                 return type(array(std::move(run_length_typed_array)), array(std::move(values_array)));
             }
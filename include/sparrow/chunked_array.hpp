@@ -0,0 +1,299 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/utils/iterator.hpp"
+
+namespace sparrow
+{
+    class chunked_array;
+
+    /**
+     * @brief Random access iterator over the elements of a chunked_array.
+     *
+     * The iterator keeps the index of its chunk and its position inside the chunk,
+     * so that incrementing and decrementing it do not search the chunks; only
+     * advancing by an arbitrary distance does, in O(log chunks).
+     */
+    class chunked_array_iterator : public iterator_base<
+                                       chunked_array_iterator,
+                                       array::value_type,
+                                       std::random_access_iterator_tag,
+                                       array::const_reference>
+    {
+    public:
+
+        using self_type = chunked_array_iterator;
+        using base_type = iterator_base<
+            self_type,
+            array::value_type,
+            std::random_access_iterator_tag,
+            array::const_reference>;
+        using reference = typename base_type::reference;
+        using difference_type = typename base_type::difference_type;
+
+        chunked_array_iterator() noexcept = default;
+        SPARROW_API chunked_array_iterator(const chunked_array* array, std::size_t index);
+
+        /**
+         * @return The index of the chunk holding the element pointed to by the iterator.
+         */
+        [[nodiscard]] std::size_t chunk_index() const noexcept
+        {
+            return m_chunk;
+        }
+
+        /**
+         * @return The index of the element pointed to by the iterator, in its chunk.
+         */
+        [[nodiscard]] std::size_t index_in_chunk() const noexcept
+        {
+            return m_index - m_chunk_start;
+        }
+
+    private:
+
+        [[nodiscard]] SPARROW_API reference dereference() const;
+        SPARROW_API void increment();
+        SPARROW_API void decrement();
+        SPARROW_API void advance(difference_type n);
+        [[nodiscard]] difference_type distance_to(const self_type& rhs) const;
+        [[nodiscard]] bool equal(const self_type& rhs) const;
+        [[nodiscard]] bool less_than(const self_type& rhs) const;
+
+        void locate(std::size_t index);
+
+        const chunked_array* p_array = nullptr;
+        std::size_t m_index = 0;
+        std::size_t m_chunk = 0;
+        std::size_t m_chunk_start = 0;
+        std::size_t m_chunk_end = 0;
+
+        friend class iterator_access;
+    };
+
+    /**
+     * @brief A logical array made of several arrays of the same data type.
+     *
+     * A chunked array holds a column too large for a single contiguous array, for
+     * instance a string column of more than 2^31 bytes which would otherwise need
+     * 64-bit offsets, or a column accumulated from several record batches. The chunks
+     * are kept as they are; the elements are addressed by their logical index, and
+     * found in O(log chunks) with a binary search on the cumulative chunk sizes.
+     *
+     * Kernels that need typed access should process the chunks one by one with
+     * visit(), which accepts the same visitors as array::visit().
+     *
+     * @example
+     * ```cpp
+     * chunked_array column(std::vector<array>{array(primitive_array<int>{1, 2}), array(primitive_array<int>{3})});
+     * column.visit([](const auto& typed_chunk) { ... });
+     * ```
+     */
+    class chunked_array
+    {
+    public:
+
+        using size_type = std::size_t;
+        using value_type = array::value_type;
+        using const_reference = array::const_reference;
+        using const_iterator = chunked_array_iterator;
+        using chunk_range = std::ranges::ref_view<const std::vector<array>>;
+
+        /**
+         * @brief Constructs an empty chunked array, without chunk nor data type.
+         */
+        chunked_array() = default;
+
+        /**
+         * @brief Constructs a chunked array from its chunks.
+         *
+         * @param chunks The chunks, in order. They may be empty.
+         * @throws std::invalid_argument if the chunks do not have the same data type.
+         */
+        SPARROW_API explicit chunked_array(std::vector<array> chunks);
+
+        /**
+         * @return The data type of the chunks, or data_type::NA if there is no chunk.
+         */
+        [[nodiscard]] SPARROW_API enum data_type data_type() const;
+
+        /**
+         * @return The name of the first chunk, if any.
+         */
+        [[nodiscard]] SPARROW_API std::optional<std::string_view> name() const;
+
+        /**
+         * @return The total number of elements.
+         */
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return m_chunk_offsets.back();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @return The total number of null elements of the chunks.
+         */
+        [[nodiscard]] SPARROW_API std::int64_t null_count() const;
+
+        [[nodiscard]] size_type chunk_count() const noexcept
+        {
+            return m_chunks.size();
+        }
+
+        [[nodiscard]] SPARROW_API const array& chunk(size_type index) const;
+
+        [[nodiscard]] chunk_range chunks() const noexcept
+        {
+            return std::ranges::ref_view(m_chunks);
+        }
+
+        /**
+         * @return The logical index of the first element of the chunk \p index. Returns
+         * size() for index == chunk_count().
+         */
+        [[nodiscard]] SPARROW_API size_type chunk_offset(size_type index) const;
+
+        /**
+         * @brief Finds the chunk holding the element at \p index, in O(log chunks).
+         *
+         * @return The index of the chunk and the index of the element in the chunk.
+         * @pre index < size()
+         */
+        [[nodiscard]] SPARROW_API std::pair<size_type, size_type> locate(size_type index) const;
+
+        /**
+         * @throws std::out_of_range if \p index >= size().
+         */
+        [[nodiscard]] SPARROW_API const_reference at(size_type index) const;
+        [[nodiscard]] SPARROW_API const_reference operator[](size_type index) const;
+
+        [[nodiscard]] SPARROW_API const_iterator begin() const;
+        [[nodiscard]] SPARROW_API const_iterator end() const;
+        [[nodiscard]] const_iterator cbegin() const
+        {
+            return begin();
+        }
+        [[nodiscard]] const_iterator cend() const
+        {
+            return end();
+        }
+
+        /**
+         * @brief Appends a chunk.
+         *
+         * @throws std::invalid_argument if the data type of \p chunk differs from the
+         *         data type of the existing chunks.
+         */
+        SPARROW_API void add_chunk(array chunk);
+
+        /**
+         * @brief Concatenates the chunks into a single contiguous array, see sparrow::concatenate().
+         *
+         * @throws std::invalid_argument if there is no chunk.
+         */
+        [[nodiscard]] SPARROW_API array combine_chunks() const;
+
+        template <class F>
+        using visit_result_t = array::visit_result_t<F>;
+
+        /**
+         * @brief Calls \p func on the typed layout of each chunk, in order, as
+         * array::visit() does for a single array.
+         *
+         * @return Nothing if \p func returns void, otherwise the results for each chunk.
+         */
+        template <class F>
+        auto visit(F&& func) const
+            -> std::conditional_t<std::is_void_v<visit_result_t<F>>, void, std::vector<visit_result_t<F>>>;
+
+    private:
+
+        void check_data_type(const array& chunk) const;
+
+        std::vector<array> m_chunks;
+        // Cumulative sizes of the chunks, m_chunk_offsets[i] is the logical index of the
+        // first element of the chunk i, and the last element is the total size.
+        std::vector<size_type> m_chunk_offsets = {0};
+    };
+
+    /**
+     * Compares the elements of two chunked arrays, regardless of their chunk layout.
+     */
+    SPARROW_API bool operator==(const chunked_array& lhs, const chunked_array& rhs);
+
+    /*****************************************
+     * chunked_array_iterator implementation *
+     *****************************************/
+
+    inline auto chunked_array_iterator::distance_to(const self_type& rhs) const -> difference_type
+    {
+        return static_cast<difference_type>(rhs.m_index) - static_cast<difference_type>(m_index);
+    }
+
+    inline bool chunked_array_iterator::equal(const self_type& rhs) const
+    {
+        return p_array == rhs.p_array && m_index == rhs.m_index;
+    }
+
+    inline bool chunked_array_iterator::less_than(const self_type& rhs) const
+    {
+        return m_index < rhs.m_index;
+    }
+
+    /********************************
+     * chunked_array implementation *
+     ********************************/
+
+    template <class F>
+    auto chunked_array::visit(F&& func) const
+        -> std::conditional_t<std::is_void_v<visit_result_t<F>>, void, std::vector<visit_result_t<F>>>
+    {
+        if constexpr (std::is_void_v<visit_result_t<F>>)
+        {
+            for (const auto& c : m_chunks)
+            {
+                c.visit(func);
+            }
+        }
+        else
+        {
+            std::vector<visit_result_t<F>> results;
+            results.reserve(m_chunks.size());
+            for (const auto& c : m_chunks)
+            {
+                results.push_back(c.visit(func));
+            }
+            return results;
+        }
+    }
+}
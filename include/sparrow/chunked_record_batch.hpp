@@ -0,0 +1,141 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sparrow/chunked_array.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/record_batch.hpp"
+#include "sparrow/utils/metadata.hpp"
+
+namespace sparrow
+{
+    /**
+     * @brief Table made of named chunked_array columns.
+     *
+     * A chunked record batch gathers record batches with the same columns without
+     * concatenating them: each column is a chunked_array whose chunks are the columns
+     * of the batches. It is the natural container for a stream of record batches, and
+     * for tables whose columns do not fit in a single array.
+     *
+     * @pre All columns have the same length
+     * @pre Column names are unique
+     *
+     * @example
+     * ```cpp
+     * chunked_record_batch table(batches);
+     * table.add_batch(next_batch);
+     * const chunked_array& ids = table.get_column("id");
+     * ```
+     */
+    class chunked_record_batch
+    {
+    public:
+
+        using name_type = std::string;
+        using size_type = std::size_t;
+        using name_range = std::ranges::ref_view<const std::vector<name_type>>;
+
+        chunked_record_batch() = default;
+
+        /**
+         * @brief Constructs a chunked record batch from record batches with the same
+         * column names. The name and metadata are those of the first batch.
+         *
+         * @throws std::invalid_argument if the batches do not have the same column names,
+         *         or if matching columns have different data types.
+         */
+        SPARROW_API explicit chunked_record_batch(const std::vector<record_batch>& batches);
+
+        /**
+         * @brief Constructs a chunked record batch from names and columns.
+         *
+         * @throws std::invalid_argument if the number of names and columns differ, if the
+         *         names are not unique, or if the columns do not have the same length.
+         */
+        SPARROW_API chunked_record_batch(
+            std::vector<name_type> names,
+            std::vector<chunked_array> columns,
+            std::optional<name_type> name = std::nullopt,
+            std::optional<std::vector<metadata_pair>> metadata = std::nullopt
+        );
+
+        [[nodiscard]] size_type nb_columns() const noexcept
+        {
+            return m_columns.size();
+        }
+
+        [[nodiscard]] size_type nb_rows() const noexcept
+        {
+            return m_columns.empty() ? size_type(0) : m_columns.front().size();
+        }
+
+        [[nodiscard]] SPARROW_API bool contains_column(const name_type& key) const;
+
+        /**
+         * @throws std::out_of_range if there is no column named \p key.
+         */
+        [[nodiscard]] SPARROW_API const chunked_array& get_column(const name_type& key) const;
+        [[nodiscard]] SPARROW_API const chunked_array& get_column(size_type index) const;
+        [[nodiscard]] SPARROW_API const name_type& get_column_name(size_type index) const;
+
+        [[nodiscard]] name_range names() const noexcept
+        {
+            return std::ranges::ref_view(m_names);
+        }
+
+        [[nodiscard]] const std::optional<name_type>& name() const noexcept
+        {
+            return m_name;
+        }
+
+        [[nodiscard]] const std::optional<std::vector<metadata_pair>>& metadata() const noexcept
+        {
+            return m_metadata;
+        }
+
+        /**
+         * @brief Appends the columns of \p batch as new chunks of the columns.
+         *
+         * When the chunked record batch has no column, its columns, name and metadata
+         * are taken from \p batch.
+         *
+         * @throws std::invalid_argument if \p batch does not have the same column names,
+         *         or if its columns do not have the same data types.
+         */
+        SPARROW_API void add_batch(const record_batch& batch);
+
+        /**
+         * @brief Concatenates the chunks of each column into a single record batch.
+         */
+        [[nodiscard]] SPARROW_API record_batch combine_chunks() const;
+
+    private:
+
+        void check_consistency() const;
+
+        std::optional<name_type> m_name = std::nullopt;
+        std::optional<std::vector<metadata_pair>> m_metadata = std::nullopt;
+        std::vector<name_type> m_names;
+        std::vector<chunked_array> m_columns;
+        std::unordered_map<name_type, size_type> m_column_indices;
+    };
+}
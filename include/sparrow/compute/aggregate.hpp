@@ -0,0 +1,282 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "sparrow/compute/kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    /**
+     * Type of the result of \ref sum: 64-bit integers for integral and boolean
+     * arrays (wrapping on overflow), double for floating point arrays.
+     */
+    template <class T>
+    using sum_type_t = std::conditional_t<
+        std::is_floating_point_v<T>,
+        double,
+        std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+    namespace detail
+    {
+        /**
+         * Number of independent accumulators used on dense blocks, so that the
+         * compiler can keep them in vector registers without reordering
+         * floating point additions.
+         */
+        inline constexpr std::size_t lane_count = 8;
+
+        template <class T, class V, class F>
+        void fold_dense_block(const T* values, std::size_t n, std::array<V, lane_count>& lanes, F&& f)
+        {
+            std::size_t i = 0;
+            for (; i + lane_count <= n; i += lane_count)
+            {
+                for (std::size_t l = 0; l < lane_count; ++l)
+                {
+                    lanes[l] = f(lanes[l], values[i + l]);
+                }
+            }
+            for (; i < n; ++i)
+            {
+                lanes[0] = f(lanes[0], values[i]);
+            }
+        }
+
+        /// Same as \ref fold_dense_block, only folding the values whose bit is set in \p valid.
+        template <class T, class V, class F>
+        void
+        fold_masked_block(const T* values, std::size_t n, std::uint64_t valid, std::array<V, lane_count>& lanes, F&& f)
+        {
+            std::size_t i = 0;
+            for (; i + lane_count <= n; i += lane_count)
+            {
+                for (std::size_t l = 0; l < lane_count; ++l)
+                {
+                    const V folded = f(lanes[l], values[i + l]);
+                    lanes[l] = ((valid >> (i + l)) & 1u) ? folded : lanes[l];
+                }
+            }
+            for (; i < n; ++i)
+            {
+                if ((valid >> i) & 1u)
+                {
+                    lanes[0] = f(lanes[0], values[i]);
+                }
+            }
+        }
+
+        /**
+         * Calls \p dense on the blocks without null and \p sparse on the others,
+         * with the validity bits of the block. Blocks made of nulls only are skipped.
+         */
+        template <class T, class D, class S>
+        void visit_blocks(const primitive_buffers<T>& buffers, D&& dense, S&& sparse)
+        {
+            for (std::size_t b = 0; b < block_count(buffers.size); ++b)
+            {
+                const std::size_t n = block_length(buffers.size, b);
+                const std::uint64_t valid = validity_block(buffers, b);
+                const T* values = buffers.values + b * block_size;
+                if (valid == low_bits_mask(n))
+                {
+                    dense(values, n);
+                }
+                else if (valid != 0)
+                {
+                    sparse(values, n, valid);
+                }
+            }
+        }
+
+        template <class T, class F>
+        [[nodiscard]] std::optional<T> reduce_valid(const primitive_array<T>& arr, F&& f)
+        {
+            const auto buffers = get_buffers(arr);
+            std::optional<T> first;
+            for (std::size_t b = 0; b < block_count(buffers.size) && !first.has_value(); ++b)
+            {
+                const std::uint64_t valid = validity_block(buffers, b);
+                if (valid != 0)
+                {
+                    first = buffers.values[b * block_size + static_cast<std::size_t>(std::countr_zero(valid))];
+                }
+            }
+            if (!first.has_value())
+            {
+                return std::nullopt;
+            }
+
+            std::array<T, lane_count> lanes;
+            lanes.fill(*first);
+            visit_blocks(
+                buffers,
+                [&](const T* values, std::size_t n)
+                {
+                    fold_dense_block(values, n, lanes, f);
+                },
+                [&](const T* values, std::size_t n, std::uint64_t valid)
+                {
+                    fold_masked_block(values, n, valid, lanes, f);
+                }
+            );
+            T res = lanes[0];
+            for (std::size_t l = 1; l < lane_count; ++l)
+            {
+                res = f(res, lanes[l]);
+            }
+            return res;
+        }
+
+        [[nodiscard]] inline std::size_t count_true(const primitive_array<bool>& arr)
+        {
+            const auto buffers = get_buffers(arr);
+            std::size_t res = 0;
+            for (std::size_t b = 0; b < block_count(buffers.size); ++b)
+            {
+                res += static_cast<std::size_t>(
+                    std::popcount(value_bits_block(buffers, b) & validity_block(buffers, b))
+                );
+            }
+            return res;
+        }
+    }
+
+    /**
+     * @brief Counts the non-null elements of a primitive array.
+     */
+    template <class T>
+    [[nodiscard]] std::size_t count(const primitive_array<T>& arr)
+    {
+        return arr.size() - static_cast<std::size_t>(arr.null_count());
+    }
+
+    /**
+     * @brief Sums the non-null elements of a primitive array.
+     *
+     * Integral values are accumulated in 64-bit integers and wrap on overflow,
+     * boolean arrays count their true values.
+     *
+     * @return The sum, 0 if the array has no non-null element.
+     */
+    template <class T>
+    [[nodiscard]] sum_type_t<T> sum(const primitive_array<T>& arr)
+    {
+        using result_type = sum_type_t<T>;
+        if constexpr (std::same_as<T, bool>)
+        {
+            return static_cast<result_type>(detail::count_true(arr));
+        }
+        else
+        {
+            // Integral sums are computed on unsigned integers to wrap on overflow.
+            using acc_type = std::conditional_t<std::is_floating_point_v<T>, double, std::uint64_t>;
+            const auto add = [](acc_type acc, T value)
+            {
+                return static_cast<acc_type>(acc + static_cast<acc_type>(value));
+            };
+            std::array<acc_type, detail::lane_count> lanes{};
+            detail::visit_blocks(
+                detail::get_buffers(arr),
+                [&](const T* values, std::size_t n)
+                {
+                    detail::fold_dense_block(values, n, lanes, add);
+                },
+                [&](const T* values, std::size_t n, std::uint64_t valid)
+                {
+                    detail::fold_masked_block(values, n, valid, lanes, add);
+                }
+            );
+            acc_type res{};
+            for (const auto lane : lanes)
+            {
+                res = static_cast<acc_type>(res + lane);
+            }
+            return static_cast<result_type>(res);
+        }
+    }
+
+    /**
+     * @brief Returns the smallest non-null element of a primitive array.
+     *
+     * @return The minimum, or std::nullopt if the array has no non-null element.
+     */
+    template <class T>
+    [[nodiscard]] std::optional<T> min(const primitive_array<T>& arr)
+    {
+        if constexpr (std::same_as<T, bool>)
+        {
+            const std::size_t n_valid = count(arr);
+            return n_valid == 0 ? std::nullopt : std::make_optional(detail::count_true(arr) == n_valid);
+        }
+        else
+        {
+            return detail::reduce_valid(
+                arr,
+                [](T lhs, T rhs)
+                {
+                    return rhs < lhs ? rhs : lhs;
+                }
+            );
+        }
+    }
+
+    /**
+     * @brief Returns the largest non-null element of a primitive array.
+     *
+     * @return The maximum, or std::nullopt if the array has no non-null element.
+     */
+    template <class T>
+    [[nodiscard]] std::optional<T> max(const primitive_array<T>& arr)
+    {
+        if constexpr (std::same_as<T, bool>)
+        {
+            return count(arr) == 0 ? std::nullopt : std::make_optional(detail::count_true(arr) != 0);
+        }
+        else
+        {
+            return detail::reduce_valid(
+                arr,
+                [](T lhs, T rhs)
+                {
+                    return lhs < rhs ? rhs : lhs;
+                }
+            );
+        }
+    }
+
+    /**
+     * @brief Returns the mean of the non-null elements of a primitive array.
+     *
+     * @return The mean, or std::nullopt if the array has no non-null element.
+     */
+    template <class T>
+    [[nodiscard]] std::optional<double> mean(const primitive_array<T>& arr)
+    {
+        const std::size_t n_valid = count(arr);
+        if (n_valid == 0)
+        {
+            return std::nullopt;
+        }
+        return static_cast<double>(sum(arr)) / static_cast<double>(n_valid);
+    }
+}
@@ -0,0 +1,227 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "sparrow/compute/kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    namespace detail
+    {
+        /**
+         * Unsigned type used to compute integral operations, so that they wrap
+         * on overflow instead of invoking undefined behavior.
+         */
+        template <class T>
+        using wrapping_type_t = std::conditional_t<
+            (sizeof(T) < sizeof(unsigned int)),
+            unsigned int,
+            std::make_unsigned_t<T>>;
+
+        struct add_op
+        {
+            template <class T>
+            static constexpr T apply(T lhs, T rhs) noexcept
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    return static_cast<T>(lhs + rhs);
+                }
+                else
+                {
+                    using W = wrapping_type_t<T>;
+                    return static_cast<T>(static_cast<W>(static_cast<W>(lhs) + static_cast<W>(rhs)));
+                }
+            }
+        };
+
+        struct sub_op
+        {
+            template <class T>
+            static constexpr T apply(T lhs, T rhs) noexcept
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    return static_cast<T>(lhs - rhs);
+                }
+                else
+                {
+                    using W = wrapping_type_t<T>;
+                    return static_cast<T>(static_cast<W>(static_cast<W>(lhs) - static_cast<W>(rhs)));
+                }
+            }
+        };
+
+        struct mul_op
+        {
+            template <class T>
+            static constexpr T apply(T lhs, T rhs) noexcept
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    return static_cast<T>(lhs * rhs);
+                }
+                else
+                {
+                    using W = wrapping_type_t<T>;
+                    return static_cast<T>(static_cast<W>(static_cast<W>(lhs) * static_cast<W>(rhs)));
+                }
+            }
+        };
+
+        struct div_op
+        {
+            template <class T>
+            static constexpr T apply(T lhs, T rhs) noexcept
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    return static_cast<T>(lhs / rhs);
+                }
+                else if constexpr (std::is_signed_v<T>)
+                {
+                    // min / -1 overflows: compute it as a wrapping negation.
+                    using W = wrapping_type_t<T>;
+                    return rhs == T(-1) ? static_cast<T>(W{0} - static_cast<W>(lhs)) : static_cast<T>(lhs / rhs);
+                }
+                else
+                {
+                    return static_cast<T>(lhs / rhs);
+                }
+            }
+        };
+
+        /**
+         * Integral divisions check the divisors of the non-null slots, and
+         * replace the divisors of the null slots so that they never trap.
+         */
+        template <class T>
+        void prepare_divisors(const primitive_buffers<T>& rhs, const std::uint8_t* validity, T* divisors)
+        {
+            for (std::size_t b = 0; b < block_count(rhs.size); ++b)
+            {
+                const std::size_t n = block_length(rhs.size, b);
+                const std::uint64_t valid = validity == nullptr ? low_bits_mask(n)
+                                                                : load_bits(validity, b * block_size, n);
+                const T* values = rhs.values + b * block_size;
+                T* out = divisors + b * block_size;
+                bool has_zero = false;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const bool is_valid = (valid >> i) & 1u;
+                    has_zero |= is_valid && values[i] == T{0};
+                    out[i] = is_valid ? values[i] : T{1};
+                }
+                if (has_zero)
+                {
+                    throw std::domain_error("integer division by zero");
+                }
+            }
+        }
+
+        template <class Op, class T>
+        [[nodiscard]] primitive_array<T> binary_arithmetic(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+        {
+            check_same_size(lhs.size(), rhs.size());
+            const auto lhs_buffers = get_buffers(lhs);
+            const auto rhs_buffers = get_buffers(rhs);
+            auto [validity, null_count] = intersect_validity(lhs_buffers, rhs_buffers);
+
+            const std::size_t size = lhs_buffers.size;
+            buffer<std::uint8_t> values(size * sizeof(T), std::uint8_t{0}, buffer<std::uint8_t>::default_allocator());
+            T* out = reinterpret_cast<T*>(values.data());
+            const T* lhs_values = lhs_buffers.values;
+            const T* rhs_values = rhs_buffers.values;
+            if constexpr (std::same_as<Op, div_op> && std::is_integral_v<T>)
+            {
+                prepare_divisors(rhs_buffers, validity.empty() ? nullptr : validity.data(), out);
+                rhs_values = out;
+            }
+            // Values behind null slots are computed as well, which keeps the loop branchless.
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                out[i] = Op::apply(lhs_values[i], rhs_values[i]);
+            }
+            return make_primitive_array<T>(std::move(validity), std::move(values), size, null_count);
+        }
+    }
+
+    /**
+     * @brief Adds two primitive arrays element-wise.
+     *
+     * A slot of the result is null if it is null in any of the operands. Integral
+     * additions wrap on overflow.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+        requires(!std::same_as<T, bool>)
+    [[nodiscard]] primitive_array<T> add(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_arithmetic<detail::add_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Subtracts two primitive arrays element-wise.
+     *
+     * A slot of the result is null if it is null in any of the operands. Integral
+     * subtractions wrap on overflow.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+        requires(!std::same_as<T, bool>)
+    [[nodiscard]] primitive_array<T> subtract(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_arithmetic<detail::sub_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Multiplies two primitive arrays element-wise.
+     *
+     * A slot of the result is null if it is null in any of the operands. Integral
+     * multiplications wrap on overflow.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+        requires(!std::same_as<T, bool>)
+    [[nodiscard]] primitive_array<T> multiply(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_arithmetic<detail::mul_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Divides two primitive arrays element-wise.
+     *
+     * A slot of the result is null if it is null in any of the operands. Floating
+     * point divisions follow IEEE 754, integral divisions truncate toward zero.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     * @throws std::domain_error if an integral non-null slot of \p rhs is zero.
+     */
+    template <class T>
+        requires(!std::same_as<T, bool>)
+    [[nodiscard]] primitive_array<T> divide(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_arithmetic<detail::div_op>(lhs, rhs);
+    }
+}
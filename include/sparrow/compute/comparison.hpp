@@ -0,0 +1,223 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include "sparrow/compute/kernel_utils.hpp"
+
+namespace sparrow::compute
+{
+    namespace detail
+    {
+        // Each operation compares two values, or two blocks of 64 booleans at once.
+
+        struct equal_op
+        {
+            template <class T>
+            static constexpr bool apply(const T& lhs, const T& rhs) noexcept
+            {
+                return lhs == rhs;
+            }
+
+            static constexpr std::uint64_t apply_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+            {
+                return ~(lhs ^ rhs);
+            }
+        };
+
+        struct not_equal_op
+        {
+            template <class T>
+            static constexpr bool apply(const T& lhs, const T& rhs) noexcept
+            {
+                return lhs != rhs;
+            }
+
+            static constexpr std::uint64_t apply_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+            {
+                return lhs ^ rhs;
+            }
+        };
+
+        struct less_op
+        {
+            template <class T>
+            static constexpr bool apply(const T& lhs, const T& rhs) noexcept
+            {
+                return lhs < rhs;
+            }
+
+            static constexpr std::uint64_t apply_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+            {
+                return ~lhs & rhs;
+            }
+        };
+
+        struct less_equal_op
+        {
+            template <class T>
+            static constexpr bool apply(const T& lhs, const T& rhs) noexcept
+            {
+                return lhs <= rhs;
+            }
+
+            static constexpr std::uint64_t apply_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+            {
+                return ~lhs | rhs;
+            }
+        };
+
+        struct greater_op
+        {
+            template <class T>
+            static constexpr bool apply(const T& lhs, const T& rhs) noexcept
+            {
+                return lhs > rhs;
+            }
+
+            static constexpr std::uint64_t apply_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+            {
+                return lhs & ~rhs;
+            }
+        };
+
+        struct greater_equal_op
+        {
+            template <class T>
+            static constexpr bool apply(const T& lhs, const T& rhs) noexcept
+            {
+                return lhs >= rhs;
+            }
+
+            static constexpr std::uint64_t apply_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+            {
+                return lhs | ~rhs;
+            }
+        };
+
+        template <class Op, class T>
+        [[nodiscard]] primitive_array<bool> binary_comparison(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+        {
+            check_same_size(lhs.size(), rhs.size());
+            const auto lhs_buffers = get_buffers(lhs);
+            const auto rhs_buffers = get_buffers(rhs);
+            auto [validity, null_count] = intersect_validity(lhs_buffers, rhs_buffers);
+
+            const std::size_t size = lhs_buffers.size;
+            buffer<std::uint8_t> values((size + 7) / 8, std::uint8_t{0}, buffer<std::uint8_t>::default_allocator());
+            for (std::size_t b = 0; b < block_count(size); ++b)
+            {
+                const std::size_t n = block_length(size, b);
+                std::uint64_t word = 0;
+                if constexpr (std::same_as<T, bool>)
+                {
+                    word = Op::apply_bits(value_bits_block(lhs_buffers, b), value_bits_block(rhs_buffers, b));
+                }
+                else
+                {
+                    const T* lhs_values = lhs_buffers.values + b * block_size;
+                    const T* rhs_values = rhs_buffers.values + b * block_size;
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        word |= static_cast<std::uint64_t>(Op::apply(lhs_values[i], rhs_values[i])) << i;
+                    }
+                }
+                store_bits(values.data(), b * block_size, word, n);
+            }
+            return make_primitive_array<bool>(std::move(validity), std::move(values), size, null_count);
+        }
+    }
+
+    /**
+     * @brief Compares two primitive arrays element-wise for equality.
+     *
+     * A slot of the result is null if it is null in any of the operands.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+    [[nodiscard]] primitive_array<bool> equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_comparison<detail::equal_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Compares two primitive arrays element-wise for inequality.
+     *
+     * A slot of the result is null if it is null in any of the operands.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+    [[nodiscard]] primitive_array<bool> not_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_comparison<detail::not_equal_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Checks element-wise whether \p lhs is less than \p rhs.
+     *
+     * A slot of the result is null if it is null in any of the operands.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+    [[nodiscard]] primitive_array<bool> less(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_comparison<detail::less_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Checks element-wise whether \p lhs is less than or equal to \p rhs.
+     *
+     * A slot of the result is null if it is null in any of the operands.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+    [[nodiscard]] primitive_array<bool> less_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_comparison<detail::less_equal_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Checks element-wise whether \p lhs is greater than \p rhs.
+     *
+     * A slot of the result is null if it is null in any of the operands.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+    [[nodiscard]] primitive_array<bool> greater(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_comparison<detail::greater_op>(lhs, rhs);
+    }
+
+    /**
+     * @brief Checks element-wise whether \p lhs is greater than or equal to \p rhs.
+     *
+     * A slot of the result is null if it is null in any of the operands.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     */
+    template <class T>
+    [[nodiscard]] primitive_array<bool> greater_equal(const primitive_array<T>& lhs, const primitive_array<T>& rhs)
+    {
+        return detail::binary_comparison<detail::greater_equal_op>(lhs, rhs);
+    }
+}
@@ -0,0 +1,186 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/utils/bit.hpp"
+#include "sparrow/utils/repeat_container.hpp"
+
+namespace sparrow::compute::detail
+{
+    /**
+     * Number of elements processed at once by the kernels: one 64-bit word
+     * of the validity bitmap.
+     */
+    inline constexpr std::size_t block_size = 64;
+
+    /**
+     * Raw buffers of a primitive array, with the offset of the array applied
+     * to the values. Bitmaps (the validity and the values of boolean arrays)
+     * start at bit \c offset.
+     */
+    template <class T>
+    struct primitive_buffers
+    {
+        const T* values = nullptr;
+        const std::uint8_t* value_bits = nullptr;
+        const std::uint8_t* validity = nullptr;
+        std::size_t offset = 0;
+        std::size_t size = 0;
+    };
+
+    template <class T>
+    [[nodiscard]] primitive_buffers<T> get_buffers(const primitive_array<T>& arr)
+    {
+        const ArrowArray* arrow_array = get_arrow_array(arr);
+        primitive_buffers<T> res;
+        res.offset = static_cast<std::size_t>(arrow_array->offset);
+        res.size = static_cast<std::size_t>(arrow_array->length);
+        // The validity bitmap is ignored when there is no null, so that
+        // kernels only take their dense path.
+        if (arr.null_count() != 0)
+        {
+            res.validity = static_cast<const std::uint8_t*>(arrow_array->buffers[0]);
+        }
+        if constexpr (std::same_as<T, bool>)
+        {
+            res.value_bits = static_cast<const std::uint8_t*>(arrow_array->buffers[1]);
+        }
+        else
+        {
+            res.values = static_cast<const T*>(arrow_array->buffers[1]) + res.offset;
+        }
+        return res;
+    }
+
+    [[nodiscard]] constexpr std::size_t block_count(std::size_t size) noexcept
+    {
+        return (size + block_size - 1) / block_size;
+    }
+
+    [[nodiscard]] constexpr std::size_t block_length(std::size_t size, std::size_t block_index) noexcept
+    {
+        return std::min(block_size, size - block_index * block_size);
+    }
+
+    /// Returns the validity bits of the block \p block_index, all set when the array has no null.
+    template <class T>
+    [[nodiscard]] std::uint64_t validity_block(const primitive_buffers<T>& buffers, std::size_t block_index) noexcept
+    {
+        const std::size_t n = block_length(buffers.size, block_index);
+        return buffers.validity == nullptr
+                   ? low_bits_mask(n)
+                   : load_bits(buffers.validity, buffers.offset + block_index * block_size, n);
+    }
+
+    /// Returns the values of the block \p block_index of a boolean array.
+    [[nodiscard]] inline std::uint64_t
+    value_bits_block(const primitive_buffers<bool>& buffers, std::size_t block_index) noexcept
+    {
+        const std::size_t n = block_length(buffers.size, block_index);
+        return load_bits(buffers.value_bits, buffers.offset + block_index * block_size, n);
+    }
+
+    inline void check_same_size(std::size_t lhs, std::size_t rhs)
+    {
+        if (lhs != rhs)
+        {
+            throw std::invalid_argument("compute kernels require arrays of the same size");
+        }
+    }
+
+    /**
+     * Computes the validity bitmap of the result of a binary kernel, i.e. the
+     * intersection of the validity bitmaps of its operands, one word at a time.
+     * An empty buffer is returned when none of the operands has nulls.
+     *
+     * @return The validity buffer and the null count of the result.
+     */
+    template <class T, class U>
+    [[nodiscard]] std::pair<buffer<std::uint8_t>, std::size_t>
+    intersect_validity(const primitive_buffers<T>& lhs, const primitive_buffers<U>& rhs)
+    {
+        using buffer_type = buffer<std::uint8_t>;
+        if (lhs.validity == nullptr && rhs.validity == nullptr)
+        {
+            return {buffer_type(nullptr, 0, buffer_type::default_allocator()), 0};
+        }
+        const std::size_t size = lhs.size;
+        buffer_type res((size + 7) / 8, std::uint8_t{0}, buffer_type::default_allocator());
+        std::size_t null_count = 0;
+        for (std::size_t b = 0; b < block_count(size); ++b)
+        {
+            const std::size_t n = block_length(size, b);
+            const std::uint64_t word = validity_block(lhs, b) & validity_block(rhs, b);
+            store_bits(res.data(), b * block_size, word, n);
+            null_count += n - static_cast<std::size_t>(std::popcount(word));
+        }
+        return {std::move(res), null_count};
+    }
+
+    /**
+     * Creates the primitive array holding the result of a kernel from its buffers.
+     * \p validity may be empty when the result has no null.
+     */
+    template <class T>
+    [[nodiscard]] primitive_array<T> make_primitive_array(
+        buffer<std::uint8_t>&& validity,
+        buffer<std::uint8_t>&& values,
+        std::size_t size,
+        std::size_t null_count
+    )
+    {
+        const auto flags = validity.empty() ? std::nullopt
+                                            : std::make_optional<std::unordered_set<ArrowFlag>>({ArrowFlag::NULLABLE});
+        ArrowSchema schema = make_arrow_schema(
+            data_type_to_format(sparrow::detail::get_data_type_from_array<primitive_array<T>>::get()),
+            std::optional<std::string_view>{},
+            std::optional<std::vector<metadata_pair>>{},
+            flags,
+            nullptr,
+            repeat_view<bool>(true, 0),
+            nullptr,
+            true
+        );
+        std::vector<buffer<std::uint8_t>> buffers(2);
+        buffers[0] = std::move(validity);
+        buffers[1] = std::move(values);
+        ArrowArray array = make_arrow_array(
+            static_cast<std::int64_t>(size),
+            static_cast<std::int64_t>(null_count),
+            0,
+            std::move(buffers),
+            nullptr,
+            repeat_view<bool>(true, 0),
+            nullptr,
+            true
+        );
+        return primitive_array<T>(arrow_proxy(std::move(array), std::move(schema)));
+    }
+}
@@ -0,0 +1,136 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+#include "sparrow/record_batch.hpp"
+
+namespace sparrow::csv
+{
+    /**
+     * Exception thrown when reading malformed CSV data. The message gives the
+     * line number of the faulty row.
+     */
+    class csv_error : public std::runtime_error
+    {
+    public:
+
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * @brief Types of the columns read from CSV.
+     *
+     * Each type maps to a sparrow array:
+     * - boolean: primitive_array<bool>, from true/false (any case), 1 or 0
+     * - int64: primitive_array<int64_t>
+     * - float64: primitive_array<double>
+     * - string: string_array
+     * - string_view: string_view_array
+     * - date: date_days_array, from YYYY-MM-DD
+     * - timestamp: timestamp_microseconds_array in UTC, from ISO 8601 timestamps
+     *   such as "2024-03-01T12:30:00.250Z" or "2024-03-01 13:30:00+01:00"
+     */
+    enum class column_type : std::uint8_t
+    {
+        boolean,
+        int64,
+        float64,
+        string,
+        string_view,
+        date,
+        timestamp
+    };
+
+    struct column_spec
+    {
+        std::string name;
+        column_type type = column_type::string;
+
+        bool operator==(const column_spec&) const = default;
+    };
+
+    struct read_options
+    {
+        char delimiter = ',';
+        char quote = '"';
+        // Whether the first row holds the column names; otherwise the columns are named f0, f1...
+        bool header = true;
+        // Unquoted fields equal to one of these values are null
+        std::vector<std::string> null_values = {"", "NA", "NULL", "null"};
+        // Number of rows of each record batch, the last one may be shorter
+        std::size_t batch_size = 65536;
+        // Number of rows parsed by a single task
+        std::size_t block_size = 16384;
+        // Number of rows read to infer the schema
+        std::size_t inference_rows = 1000;
+        // Maximum number of parsing threads, 0 for one per hardware thread
+        std::size_t max_threads = 0;
+        // Whether the inferred string columns are string_view_array instead of string_array
+        bool string_views = false;
+        // Schema of the rows, inferred from the first rows if not set
+        std::optional<std::vector<column_spec>> schema;
+    };
+
+    /**
+     * @brief Infers the schema of CSV data from its first options.inference_rows rows.
+     *
+     * Each column gets the narrowest type that holds all its non-null values, in the
+     * order boolean, int64, float64, date, timestamp; int64 and float64 values merge
+     * into float64, dates and timestamps into timestamp. Any other mix of types, as
+     * well as columns whose values are all null, are strings.
+     *
+     * @throws csv_error if a row is malformed.
+     */
+    [[nodiscard]] SPARROW_API std::vector<column_spec>
+    infer_schema(std::string_view csv, const read_options& options = {});
+
+    /**
+     * @brief Reads CSV data into record batches of options.batch_size rows.
+     *
+     * Fields follow RFC 4180: they may be quoted, a quoted field may hold delimiters,
+     * newlines and doubled quotes. Empty lines are skipped, and a row may end with
+     * "\r\n". The rows are split into blocks of options.block_size rows at the newlines
+     * outside quotes; the blocks are parsed in parallel, each into its own buffers, and
+     * the blocks of a batch are then concatenated. The numbers are parsed with
+     * std::from_chars, and the strings are copied straight into the buffers of the
+     * string arrays.
+     *
+     * @throws csv_error if a row is malformed, if it does not have as many fields as
+     *         the schema, or if a field does not match the type of its column.
+     */
+    [[nodiscard]] SPARROW_API std::vector<record_batch>
+    read_csv(std::string_view csv, const read_options& options = {});
+
+    /**
+     * @brief Reads a CSV file into record batches, see read_csv().
+     *
+     * The file is memory mapped, so that its pages are loaded by the parsing threads.
+     *
+     * @throws std::system_error if the file cannot be opened or mapped.
+     * @throws csv_error for the same reasons as read_csv().
+     */
+    [[nodiscard]] SPARROW_API std::vector<record_batch>
+    read_csv_file(const std::filesystem::path& path, const read_options& options = {});
+}
@@ -341,6 +341,25 @@ namespace sparrow
          */
         [[nodiscard]] SPARROW_CONSTEXPR_CLANG const_reference back() const;
 
+        /**
+         * Gets a typed view over the keys of the array. Combined with values_view(),
+         * this gives access to the elements without dispatching on the type of the
+         * dictionary for each of them.
+         *
+         * @return Typed view over the keys.
+         */
+        [[nodiscard]] typed_view<primitive_array<IT>> keys_view() const;
+
+        /**
+         * Gets a typed view over the values of the dictionary.
+         *
+         * @tparam A The layout type of the dictionary.
+         * @return Typed view over the values of the dictionary.
+         * @throws std::invalid_argument if the dictionary is not a layout of type A.
+         */
+        template <layout A>
+        [[nodiscard]] typed_view<A> values_view() const;
+
         /**
          * Constructs a dictionary encoded array with the given arguments.
          *
@@ -879,6 +898,19 @@ namespace sparrow
         return operator[](size() - 1);
     }
 
+    template <std::integral IT>
+    auto dictionary_encoded_array<IT>::keys_view() const -> typed_view<primitive_array<IT>>
+    {
+        return typed_view<primitive_array<IT>>(m_keys_layout);
+    }
+
+    template <std::integral IT>
+    template <layout A>
+    auto dictionary_encoded_array<IT>::values_view() const -> typed_view<A>
+    {
+        return make_typed_view<A>(*p_values_layout);
+    }
+
     template <std::integral IT>
     auto dictionary_encoded_array<IT>::dummy_inner_value() const -> const inner_value_type&
     {
@@ -0,0 +1,77 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "sparrow/c_stream_interface.hpp"
+#include "sparrow/config/config.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Options of the ArrowArrayStream reading an Arrow IPC stream from a file descriptor.
+     */
+    struct array_stream_options
+    {
+        /**
+         * Reads and decodes the next batch on a background thread while the consumer
+         * processes the current one. A read in flight is interrupted when the stream is
+         * cancelled or released, without closing the descriptor. On Windows, the read
+         * cannot be interrupted and releasing the stream waits for it.
+         *
+         * It is off by default because it consumes the input ahead of the consumer: a
+         * second batch is held in memory, a thread and a cancellation pipe are created
+         * per stream, and the bytes of a batch read ahead are lost for another reader of
+         * the descriptor when the stream is released early. It pays off when decoding
+         * or producing a batch takes as long as processing it.
+         */
+        bool prefetch = false;
+
+        /**
+         * Maximum size in bytes of the body of a message. The body is allocated before
+         * being read: a larger body length, such as one read from a corrupted input,
+         * throws ipc_error instead of allocating it.
+         */
+        std::size_t max_body_length = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+    };
+
+    /**
+     * @brief Creates an ArrowArrayStream reading an Arrow IPC stream from a file descriptor.
+     *
+     * The schema message is read by this function; the record batches are read on demand
+     * by the get_next callback of the stream, and returned as struct arrays. At most one
+     * batch of the input is in memory at a time, two with prefetching. This allows to
+     * consume inputs larger than the memory, such as pipes between processes.
+     *
+     * @code{.cpp}
+     * sparrow::arrow_array_stream_proxy stream(sparrow::ipc::make_arrow_array_stream(STDIN_FILENO));
+     * while (auto batch = stream.pop())
+     * {
+     *     process(*batch);
+     * }
+     * @endcode
+     *
+     * @param file_descriptor The descriptor of a file or a pipe, opened for reading. It is not
+     *        closed by the stream, and must stay open until the stream is released.
+     * @param options The prefetching of the batches and the maximum size of a message body.
+     * @throws ipc_error if the input does not start with a schema message.
+     * @throws std::system_error if the input cannot be read.
+     */
+    [[nodiscard]] SPARROW_API ArrowArrayStream
+    make_arrow_array_stream(int file_descriptor, array_stream_options options = {});
+}
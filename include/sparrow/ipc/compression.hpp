@@ -0,0 +1,60 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Codecs of the compressed IPC buffers. The values are the ones of the
+     * CompressionType enumeration of the Arrow format.
+     *
+     * The codecs are optional dependencies of sparrow, enabled with the
+     * SPARROW_WITH_LZ4 and SPARROW_WITH_ZSTD CMake options.
+     */
+    enum class compression_codec : std::int8_t
+    {
+        lz4_frame = 0,
+        zstd = 1
+    };
+
+    /**
+     * @brief Checks whether sparrow has been built with support for \p codec.
+     */
+    [[nodiscard]] SPARROW_API bool is_codec_available(compression_codec codec) noexcept;
+
+    /**
+     * @brief Compresses \p data and appends the result to \p out.
+     *
+     * @throws ipc_error if the codec is not available or if the compression fails.
+     */
+    SPARROW_API void
+    compress(compression_codec codec, std::span<const std::uint8_t> data, std::vector<std::uint8_t>& out);
+
+    /**
+     * @brief Decompresses \p data into \p out.
+     *
+     * @param out Destination, whose size is the size of the decompressed data.
+     * @throws ipc_error if the codec is not available, or if \p data is corrupted or
+     *         does not decompress to exactly out.size() bytes.
+     */
+    SPARROW_API void
+    decompress(compression_codec codec, std::span<const std::uint8_t> data, std::span<std::uint8_t> out);
+}
@@ -0,0 +1,258 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Exception thrown when reading malformed IPC data.
+     */
+    class ipc_error : public std::runtime_error
+    {
+    public:
+
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * @class flatbuffer_builder
+     *
+     * Minimal FlatBuffers serializer, covering what the Arrow IPC metadata needs:
+     * tables of scalars and offsets, strings, vectors of scalars or structs, and
+     * vectors of tables. Unions are encoded as a type scalar and a table offset.
+     *
+     * Objects are described bottom-up and written top-down by finish(), so that
+     * every offset points forward as required by the format.
+     */
+    class SPARROW_API flatbuffer_builder
+    {
+    public:
+
+        /**
+         * Handle on an object created by the builder.
+         */
+        using ref = std::size_t;
+
+        /**
+         * @class table
+         *
+         * Fields of a table under construction. Absent fields take their
+         * default value when read.
+         */
+        class SPARROW_API table
+        {
+        public:
+
+            template <class T>
+                requires std::is_arithmetic_v<T>
+            table& add(std::uint16_t id, T value);
+
+            table& add_offset(std::uint16_t id, ref object);
+
+        private:
+
+            struct field
+            {
+                std::uint16_t id;
+                std::uint8_t size;
+                std::array<std::byte, 8> value;
+                std::optional<ref> object;
+            };
+
+            std::vector<field> m_fields;
+
+            friend class flatbuffer_builder;
+        };
+
+        [[nodiscard]] ref create_string(std::string_view value);
+
+        /**
+         * Creates a vector of scalars or of structs, given by their in-memory representation.
+         * Structs must be standard layout and match the padding rules of the schema.
+         */
+        template <class T>
+            requires std::is_trivially_copyable_v<T>
+        [[nodiscard]] ref create_vector(std::span<const T> values);
+
+        [[nodiscard]] ref create_vector_of_tables(std::vector<ref> tables);
+        [[nodiscard]] ref create_table(table&& t);
+
+        /**
+         * Serializes the object tree whose root is \p root. The size of the result
+         * is a multiple of 8.
+         */
+        [[nodiscard]] std::vector<std::uint8_t> finish(ref root) const;
+
+    private:
+
+        struct blob
+        {
+            std::vector<std::byte> data;
+            std::size_t element_count;
+            std::size_t alignment;
+            bool null_terminated;
+        };
+
+        struct table_vector
+        {
+            std::vector<ref> tables;
+        };
+
+        using object = std::variant<blob, table_vector, table>;
+
+        ref create_blob(const void* data, std::size_t size, std::size_t count, std::size_t alignment, bool null_terminated);
+
+        std::size_t write(std::vector<std::uint8_t>& out, ref object) const;
+
+        std::vector<object> m_objects;
+    };
+
+    /**
+     * @class flatbuffer_table
+     *
+     * Read access to a FlatBuffers table. Every access is bounds-checked and
+     * throws ipc_error when the buffer is malformed.
+     */
+    class SPARROW_API flatbuffer_table
+    {
+    public:
+
+        /**
+         * Location of the elements of a vector in the buffer.
+         */
+        struct vector_view
+        {
+            std::size_t position = 0;
+            std::size_t size = 0;
+        };
+
+        /**
+         * Returns the root table of the buffer.
+         */
+        [[nodiscard]] static flatbuffer_table root(std::span<const std::uint8_t> buffer);
+
+        flatbuffer_table(std::span<const std::uint8_t> buffer, std::size_t position);
+
+        [[nodiscard]] bool has(std::uint16_t id) const;
+
+        template <class T>
+            requires std::is_arithmetic_v<T>
+        [[nodiscard]] T get(std::uint16_t id, T default_value = T{}) const;
+
+        [[nodiscard]] std::optional<flatbuffer_table> table(std::uint16_t id) const;
+        [[nodiscard]] std::string_view string(std::uint16_t id) const;
+
+        /**
+         * Returns the location of a vector whose elements have \p element_size bytes,
+         * an empty vector when the field is absent.
+         */
+        [[nodiscard]] vector_view vector(std::uint16_t id, std::size_t element_size) const;
+
+        /**
+         * Returns the tables of a vector of tables.
+         */
+        [[nodiscard]] std::vector<flatbuffer_table> tables(std::uint16_t id) const;
+
+        /**
+         * Reads the \p index-th element of a vector of scalars or structs.
+         */
+        template <class T>
+            requires std::is_trivially_copyable_v<T>
+        [[nodiscard]] T element(const vector_view& v, std::size_t index) const;
+
+    private:
+
+        [[nodiscard]] std::size_t field_position(std::uint16_t id) const;
+        [[nodiscard]] std::size_t indirect(std::size_t position) const;
+        void check(std::size_t position, std::size_t size) const;
+
+        template <class T>
+        [[nodiscard]] T read(std::size_t position) const;
+
+        std::span<const std::uint8_t> m_buffer;
+        std::size_t m_position;
+        std::size_t m_vtable;
+        std::size_t m_vtable_size;
+    };
+
+    /*************************************
+     * flatbuffer_builder implementation *
+     *************************************/
+
+    template <class T>
+        requires std::is_arithmetic_v<T>
+    auto flatbuffer_builder::table::add(std::uint16_t id, T value) -> table&
+    {
+        static_assert(sizeof(T) <= 8);
+        field f{id, static_cast<std::uint8_t>(sizeof(T)), {}, std::nullopt};
+        std::memcpy(f.value.data(), &value, sizeof(T));
+        m_fields.push_back(f);
+        return *this;
+    }
+
+    template <class T>
+        requires std::is_trivially_copyable_v<T>
+    auto flatbuffer_builder::create_vector(std::span<const T> values) -> ref
+    {
+        return create_blob(values.data(), values.size_bytes(), values.size(), alignof(T), false);
+    }
+
+    /***********************************
+     * flatbuffer_table implementation *
+     ***********************************/
+
+    template <class T>
+    T flatbuffer_table::read(std::size_t position) const
+    {
+        check(position, sizeof(T));
+        T value;
+        std::memcpy(&value, m_buffer.data() + position, sizeof(T));
+        return value;
+    }
+
+    template <class T>
+        requires std::is_arithmetic_v<T>
+    T flatbuffer_table::get(std::uint16_t id, T default_value) const
+    {
+        const std::size_t position = field_position(id);
+        return position == 0 ? default_value : read<T>(position);
+    }
+
+    template <class T>
+        requires std::is_trivially_copyable_v<T>
+    T flatbuffer_table::element(const vector_view& v, std::size_t index) const
+    {
+        if (index >= v.size)
+        {
+            throw ipc_error("Flatbuffer vector index out of range");
+        }
+        return read<T>(v.position + index * sizeof(T));
+    }
+}
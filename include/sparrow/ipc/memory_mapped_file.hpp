@@ -0,0 +1,77 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include "sparrow/config/config.hpp"
+#include "sparrow/ipc/reader.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * @class memory_mapped_file
+     *
+     * Read-only memory mapping of a whole file. The pages of the file are loaded
+     * by the operating system when they are first read.
+     */
+    class SPARROW_API memory_mapped_file
+    {
+    public:
+
+        /**
+         * @brief Maps the file at \p path.
+         *
+         * @throws std::system_error if the file cannot be opened or mapped.
+         */
+        explicit memory_mapped_file(const std::filesystem::path& path);
+        ~memory_mapped_file();
+
+        memory_mapped_file(const memory_mapped_file&) = delete;
+        memory_mapped_file& operator=(const memory_mapped_file&) = delete;
+        memory_mapped_file(memory_mapped_file&&) = delete;
+        memory_mapped_file& operator=(memory_mapped_file&&) = delete;
+
+        [[nodiscard]] std::span<const std::uint8_t> data() const noexcept;
+
+    private:
+
+        const std::uint8_t* p_data = nullptr;
+        std::size_t m_size = 0;
+    };
+
+    /**
+     * @brief Opens an Arrow IPC file through a memory mapping.
+     *
+     * The buffers of the record batches read from the returned reader point into
+     * the mapping, which stays alive as long as the reader or one of these arrays.
+     * With the default options, the columns are created on first access: reading a
+     * few columns of a file only loads the pages of these columns.
+     *
+     * @code{.cpp}
+     * auto reader = sparrow::ipc::open_mapped_file("data.arrow");
+     * const auto batch = reader.get_record_batch(0);
+     * process(batch.get_column("price"));
+     * @endcode
+     *
+     * @throws std::system_error if the file cannot be opened or mapped.
+     * @throws ipc_error if the file is malformed.
+     */
+    [[nodiscard]] SPARROW_API file_reader
+    open_mapped_file(const std::filesystem::path& path, read_options options = {.lazy_columns = true});
+}
@@ -0,0 +1,214 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace sparrow::ipc
+{
+    /**
+     * Constants of the Arrow IPC format: framing of the messages, and
+     * field ids and enumerations of the flatbuffer schemas (Message.fbs,
+     * Schema.fbs and File.fbs of the Arrow specification).
+     */
+    namespace format
+    {
+        // Marker preceding the metadata length of every message
+        inline constexpr std::uint32_t continuation_marker = 0xFFFFFFFF;
+
+        // Magic string opening and closing the IPC files, padded to 8 bytes at the start
+        inline constexpr std::array<char, 6> file_magic = {'A', 'R', 'R', 'O', 'W', '1'};
+        inline constexpr std::size_t file_header_size = 8;
+
+        // MetadataVersion::V5
+        inline constexpr std::int16_t metadata_version = 4;
+
+        enum class message_header : std::uint8_t
+        {
+            none = 0,
+            schema = 1,
+            dictionary_batch = 2,
+            record_batch = 3
+        };
+
+        enum class type_id : std::uint8_t
+        {
+            none = 0,
+            null = 1,
+            integer = 2,
+            floating_point = 3,
+            binary = 4,
+            utf8 = 5,
+            boolean = 6,
+            decimal = 7,
+            date = 8,
+            time = 9,
+            timestamp = 10,
+            interval = 11,
+            list = 12,
+            struct_ = 13,
+            union_ = 14,
+            fixed_size_binary = 15,
+            fixed_size_list = 16,
+            map = 17,
+            duration = 18,
+            large_binary = 19,
+            large_utf8 = 20,
+            large_list = 21,
+            run_end_encoded = 22,
+            binary_view = 23,
+            utf8_view = 24,
+            list_view = 25,
+            large_list_view = 26
+        };
+
+        enum class time_unit : std::int16_t
+        {
+            second = 0,
+            millisecond = 1,
+            microsecond = 2,
+            nanosecond = 3
+        };
+
+        enum class date_unit : std::int16_t
+        {
+            day = 0,
+            millisecond = 1
+        };
+
+        enum class interval_unit : std::int16_t
+        {
+            year_month = 0,
+            day_time = 1,
+            month_day_nano = 2
+        };
+
+        enum class precision : std::int16_t
+        {
+            half = 0,
+            single = 1,
+            double_ = 2
+        };
+
+        enum class union_mode : std::int16_t
+        {
+            sparse = 0,
+            dense = 1
+        };
+
+        // Field ids of the tables
+        namespace message
+        {
+            inline constexpr std::uint16_t version = 0;
+            inline constexpr std::uint16_t header_type = 1;
+            inline constexpr std::uint16_t header = 2;
+            inline constexpr std::uint16_t body_length = 3;
+            inline constexpr std::uint16_t custom_metadata = 4;
+        }
+
+        namespace schema
+        {
+            inline constexpr std::uint16_t endianness = 0;
+            inline constexpr std::uint16_t fields = 1;
+            inline constexpr std::uint16_t custom_metadata = 2;
+        }
+
+        namespace field
+        {
+            inline constexpr std::uint16_t name = 0;
+            inline constexpr std::uint16_t nullable = 1;
+            inline constexpr std::uint16_t type_type = 2;
+            inline constexpr std::uint16_t type = 3;
+            inline constexpr std::uint16_t dictionary = 4;
+            inline constexpr std::uint16_t children = 5;
+            inline constexpr std::uint16_t custom_metadata = 6;
+        }
+
+        namespace dictionary_encoding
+        {
+            inline constexpr std::uint16_t id = 0;
+            inline constexpr std::uint16_t index_type = 1;
+            inline constexpr std::uint16_t is_ordered = 2;
+        }
+
+        namespace key_value
+        {
+            inline constexpr std::uint16_t key = 0;
+            inline constexpr std::uint16_t value = 1;
+        }
+
+        namespace record_batch
+        {
+            inline constexpr std::uint16_t length = 0;
+            inline constexpr std::uint16_t nodes = 1;
+            inline constexpr std::uint16_t buffers = 2;
+            inline constexpr std::uint16_t compression = 3;
+            inline constexpr std::uint16_t variadic_buffer_counts = 4;
+        }
+
+        namespace body_compression
+        {
+            inline constexpr std::uint16_t codec = 0;
+            inline constexpr std::uint16_t method = 1;
+        }
+
+        // Only method of the body compression: each buffer is compressed on its own,
+        // prefixed with its uncompressed length, or with -1 if it is stored uncompressed
+        inline constexpr std::int8_t compression_method_buffer = 0;
+        inline constexpr std::int64_t uncompressed_buffer_marker = -1;
+
+        namespace dictionary_batch
+        {
+            inline constexpr std::uint16_t id = 0;
+            inline constexpr std::uint16_t data = 1;
+            inline constexpr std::uint16_t is_delta = 2;
+        }
+
+        namespace footer
+        {
+            inline constexpr std::uint16_t version = 0;
+            inline constexpr std::uint16_t schema = 1;
+            inline constexpr std::uint16_t dictionaries = 2;
+            inline constexpr std::uint16_t record_batches = 3;
+        }
+
+        // Structs stored inline in the flatbuffer vectors
+        struct field_node
+        {
+            std::int64_t length;
+            std::int64_t null_count;
+        };
+
+        struct buffer
+        {
+            std::int64_t offset;
+            std::int64_t length;
+        };
+
+        struct block
+        {
+            std::int64_t offset;
+            std::int32_t metadata_length;
+            std::int32_t padding;
+            std::int64_t body_length;
+        };
+
+        static_assert(sizeof(field_node) == 16);
+        static_assert(sizeof(buffer) == 16);
+        static_assert(sizeof(block) == 24);
+    }
+}
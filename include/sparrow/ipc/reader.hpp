@@ -0,0 +1,282 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "sparrow/c_interface.hpp"
+#include "sparrow/config/config.hpp"
+#include "sparrow/ipc/flatbuffer.hpp"
+#include "sparrow/ipc/message_format.hpp"
+#include "sparrow/record_batch.hpp"
+#include "sparrow/utils/metadata.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Description of a field of an IPC schema.
+     */
+    struct field_description
+    {
+        struct dictionary_encoding
+        {
+            std::int64_t id;
+            // Format of the indices
+            std::string index_format;
+            bool ordered;
+        };
+
+        // Format of the values, following the C data interface
+        std::string format;
+        std::optional<std::string> name;
+        std::optional<std::vector<metadata_pair>> metadata;
+        bool nullable = true;
+        bool keys_sorted = false;
+        std::optional<dictionary_encoding> dictionary;
+        std::vector<field_description> children;
+    };
+
+    /**
+     * Options of the IPC readers.
+     */
+    struct read_options
+    {
+        /**
+         * Creates the arrays of the record batch columns on first access, see
+         * record_batch::add_lazy_column(). The buffers of the columns that are
+         * never accessed are then never read: they are decompressed, and their
+         * offsets are checked, when the column is first accessed. An invalid
+         * column therefore throws ipc_error from record_batch::get_column()
+         * rather than from the reader.
+         */
+        bool lazy_columns = false;
+    };
+
+    /**
+     * @class message_decoder
+     *
+     * Decodes the messages of an IPC stream, given as the flatbuffer metadata and
+     * the body of each message. The decoder keeps the schema and the dictionaries
+     * of the stream, and turns the record batch messages into record batches.
+     *
+     * The arrays of the record batches do not copy the body: their buffers point
+     * into it, and they hold a reference on the \c owner given along with the body.
+     * Only the buffers that are not aligned on 8 bytes are copied.
+     */
+    class SPARROW_API message_decoder
+    {
+    public:
+
+        explicit message_decoder(read_options options = {});
+
+        /**
+         * @brief Returns the body length stored in the metadata of a message.
+         *
+         * @throws ipc_error if the metadata is malformed.
+         */
+        [[nodiscard]] static std::size_t body_length(std::span<const std::uint8_t> metadata);
+
+        /**
+         * @brief Decodes a message.
+         *
+         * @param metadata The flatbuffer Message.
+         * @param body The body of the message, body_length(metadata) bytes.
+         * @param owner Object keeping \p body alive, shared by the arrays decoded
+         *        from it. May be nullptr if \p body outlives them.
+         * @return The record batch of a record batch message, std::nullopt for
+         *         schema and dictionary messages.
+         * @throws ipc_error if the message is malformed or unsupported.
+         */
+        std::optional<record_batch> decode(
+            std::span<const std::uint8_t> metadata,
+            std::span<const std::uint8_t> body,
+            const std::shared_ptr<const void>& owner
+        );
+
+        /**
+         * @brief Decodes a message, see decode(). The record batch of a record batch
+         *        message is returned as a struct ArrowArray, whose schema is arrow_schema().
+         *
+         * @throws ipc_error if the message is malformed or unsupported.
+         */
+        std::optional<ArrowArray> decode_array(
+            std::span<const std::uint8_t> metadata,
+            std::span<const std::uint8_t> body,
+            const std::shared_ptr<const void>& owner
+        );
+
+        /**
+         * @brief Decodes a record batch message, see decode().
+         *
+         * @throws ipc_error if the message is not a record batch, or if the schema
+         *         or one of the dictionaries it needs has not been decoded yet.
+         */
+        [[nodiscard]] record_batch decode_record_batch(
+            std::span<const std::uint8_t> metadata,
+            std::span<const std::uint8_t> body,
+            const std::shared_ptr<const void>& owner
+        ) const;
+
+        [[nodiscard]] bool has_schema() const noexcept;
+
+        /**
+         * @brief Returns the fields of the schema.
+         *
+         * @pre has_schema() must be true.
+         */
+        [[nodiscard]] const std::vector<field_description>& fields() const;
+
+        /**
+         * @brief Returns the schema of the record batches, as a struct ArrowSchema.
+         *
+         * @pre has_schema() must be true.
+         */
+        [[nodiscard]] ArrowSchema arrow_schema() const;
+
+    private:
+
+        // Decodes the schema and dictionary messages, returns the header of the record batch messages
+        [[nodiscard]] std::optional<flatbuffer_table> decode_header(
+            std::span<const std::uint8_t> metadata,
+            std::span<const std::uint8_t> body,
+            const std::shared_ptr<const void>& owner
+        );
+        void decode_schema(const flatbuffer_table& schema);
+        void decode_dictionary_batch(
+            const flatbuffer_table& dictionary_batch,
+            std::span<const std::uint8_t> body,
+            const std::shared_ptr<const void>& owner
+        );
+        [[nodiscard]] record_batch make_record_batch(
+            const flatbuffer_table& batch,
+            std::span<const std::uint8_t> body,
+            const std::shared_ptr<const void>& owner
+        ) const;
+        [[nodiscard]] ArrowArray make_struct_array(
+            const flatbuffer_table& batch,
+            std::span<const std::uint8_t> body,
+            const std::shared_ptr<const void>& owner
+        ) const;
+
+        read_options m_options;
+        std::optional<std::vector<field_description>> m_fields;
+        std::optional<std::vector<metadata_pair>> m_metadata;
+        // Decoded dictionaries, shared by the arrays referencing them
+        std::map<std::int64_t, std::shared_ptr<const ArrowArray>> m_dictionaries;
+    };
+
+    /**
+     * @class stream_reader
+     *
+     * Reads record batches from an Arrow IPC stream held in memory.
+     *
+     * @code{.cpp}
+     * auto bytes = std::make_shared<std::vector<std::uint8_t>>(load());
+     * sparrow::ipc::stream_reader reader(*bytes, bytes);
+     * while (auto batch = reader.next())
+     * {
+     *     process(*batch);
+     * }
+     * @endcode
+     */
+    class SPARROW_API stream_reader
+    {
+    public:
+
+        /**
+         * @param data The stream.
+         * @param owner Object keeping \p data alive, shared by the decoded arrays.
+         *        May be nullptr if \p data outlives the record batches.
+         * @param options Options of the decoding.
+         */
+        explicit stream_reader(
+            std::span<const std::uint8_t> data,
+            std::shared_ptr<const void> owner = nullptr,
+            read_options options = {}
+        );
+
+        /**
+         * @brief Reads the next record batch.
+         *
+         * @return The batch, or std::nullopt at the end of the stream.
+         * @throws ipc_error if the stream is malformed.
+         */
+        [[nodiscard]] std::optional<record_batch> next();
+
+        /**
+         * @brief Decoder of the stream, holding the schema once it has been read,
+         * including for a stream without any record batch.
+         */
+        [[nodiscard]] const message_decoder& decoder() const noexcept;
+
+    private:
+
+        std::span<const std::uint8_t> m_data;
+        std::shared_ptr<const void> p_owner;
+        std::size_t m_position = 0;
+        bool m_finished = false;
+        message_decoder m_decoder;
+    };
+
+    /**
+     * @class file_reader
+     *
+     * Reads record batches from an Arrow IPC file held in memory, in any order.
+     * The schema and the dictionaries are decoded on construction.
+     */
+    class SPARROW_API file_reader
+    {
+    public:
+
+        /**
+         * @param data The file.
+         * @param owner Object keeping \p data alive, shared by the decoded arrays.
+         *        May be nullptr if \p data outlives the record batches.
+         * @param options Options of the decoding.
+         * @throws ipc_error if the file is malformed.
+         */
+        explicit file_reader(
+            std::span<const std::uint8_t> data,
+            std::shared_ptr<const void> owner = nullptr,
+            read_options options = {}
+        );
+
+        [[nodiscard]] std::size_t num_record_batches() const noexcept;
+
+        /**
+         * @brief Reads the record batch at \p index.
+         *
+         * @throws std::out_of_range if \p index >= num_record_batches().
+         * @throws ipc_error if the batch is malformed.
+         */
+        [[nodiscard]] record_batch get_record_batch(std::size_t index) const;
+
+        [[nodiscard]] const message_decoder& decoder() const noexcept;
+
+    private:
+
+        std::span<const std::uint8_t> m_data;
+        std::shared_ptr<const void> p_owner;
+        std::vector<format::block> m_record_batch_blocks;
+        message_decoder m_decoder;
+    };
+}
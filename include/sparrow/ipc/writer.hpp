@@ -0,0 +1,217 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <vector>
+
+#include "sparrow/config/config.hpp"
+#include "sparrow/ipc/compression.hpp"
+#include "sparrow/ipc/flatbuffer.hpp"
+#include "sparrow/ipc/message_format.hpp"
+#include "sparrow/record_batch.hpp"
+
+namespace sparrow::ipc
+{
+    /**
+     * Options of the IPC writers.
+     */
+    struct write_options
+    {
+        /**
+         * Alignment of the message bodies in the output, and of the buffers
+         * in the bodies. Must be a power of two, at least 8.
+         */
+        std::size_t alignment = 64;
+
+        /**
+         * Codec compressing the buffers of the record batches and of the
+         * dictionaries, std::nullopt to write them uncompressed. A buffer that
+         * does not shrink is stored uncompressed.
+         */
+        std::optional<compression_codec> compression = std::nullopt;
+    };
+
+    namespace detail
+    {
+        /**
+         * State shared by the stream and file writers.
+         */
+        class SPARROW_API writer_base
+        {
+        public:
+
+            writer_base(const writer_base&) = delete;
+            writer_base& operator=(const writer_base&) = delete;
+
+        protected:
+
+            struct written_dictionary
+            {
+                // Buffers of the dictionary, to skip the comparison of the content
+                // when the same dictionary is written again
+                std::vector<const void*> buffers;
+                std::vector<std::uint8_t> content;
+            };
+
+            writer_base(std::ostream& stream, write_options options, bool file_format);
+            ~writer_base() = default;
+
+            /**
+             * Sets the schema of the stream from the columns of \p batch. The schema
+             * message is written by write_schema_message().
+             *
+             * @throws std::invalid_argument if a different schema is already set.
+             */
+            void set_schema(const record_batch& batch);
+            void write_schema_message();
+            void write_batch(const record_batch& batch);
+            void write_end_of_stream();
+            void check_not_closed() const;
+
+            /**
+             * Writes a message made of its flatbuffer metadata and of its body buffers,
+             * each of them padded to the alignment. Returns the location of the message.
+             */
+            format::block
+            write_message(std::span<const std::uint8_t> metadata, std::span<const std::span<const std::uint8_t>> body);
+            void write_padding(std::size_t size);
+
+            std::ostream* p_stream;
+            write_options m_options;
+            std::size_t m_position = 0;
+            bool m_file_format;
+            bool m_closed = false;
+
+            // Schema message set up front or by the first batch, the next batches
+            // must match it
+            std::optional<std::vector<std::uint8_t>> m_schema_message;
+            bool m_schema_written = false;
+            // Last dictionary written for each dictionary id
+            std::vector<written_dictionary> m_dictionaries;
+
+            // File format only
+            flatbuffer_builder m_footer;
+            std::optional<flatbuffer_builder::ref> m_footer_schema;
+            std::vector<format::block> m_dictionary_blocks;
+            std::vector<format::block> m_record_batch_blocks;
+        };
+    }
+
+    /**
+     * @class stream_writer
+     *
+     * Writes record batches in the Arrow IPC streaming format: a schema message,
+     * then for every batch its dictionary batches and its record batch message,
+     * and an end-of-stream marker written by close().
+     *
+     * All the batches must have the same schema. A dictionary batch is written
+     * the first time a dictionary is seen, and again each time it is replaced.
+     * Sliced arrays are compacted before being written.
+     *
+     * The schema can be set up front with write_schema(), so that a stream
+     * without any batch, such as an empty result set, still carries its schema.
+     *
+     * @code{.cpp}
+     * std::ostringstream out;
+     * sparrow::ipc::stream_writer writer(out);
+     * writer.write(batch);
+     * writer.close();
+     * @endcode
+     */
+    class SPARROW_API stream_writer : private detail::writer_base
+    {
+    public:
+
+        explicit stream_writer(std::ostream& stream, write_options options = {});
+
+        /**
+         * @brief Writes a record batch, preceded by the schema if it is the first one.
+         *
+         * @throws std::invalid_argument if the schema of \p batch differs from the
+         *         schema of the first batch, or from the one set by write_schema().
+         * @throws std::logic_error if the writer is closed.
+         */
+        void write(const record_batch& batch);
+
+        /**
+         * @brief Sets the schema of the stream from the columns of \p batch, whose rows
+         * are ignored. The schema is written with the first batch, or by close() if
+         * no batch is written.
+         *
+         * @throws std::invalid_argument if the schema of \p batch differs from the
+         *         schema already set.
+         * @throws std::logic_error if the writer is closed.
+         */
+        void write_schema(const record_batch& batch);
+
+        /**
+         * @brief Writes the schema if no batch has been written, then the end-of-stream
+         * marker. Nothing can be written afterward.
+         */
+        void close();
+    };
+
+    /**
+     * @class file_writer
+     *
+     * Writes record batches in the Arrow IPC file format: the stream format
+     * framed by magic strings, followed by a footer indexing the messages so
+     * that the batches can be read in random order.
+     *
+     * The file format does not support dictionary replacement: the dictionaries
+     * of all the batches must be the ones of the first batch.
+     */
+    class SPARROW_API file_writer : private detail::writer_base
+    {
+    public:
+
+        explicit file_writer(std::ostream& stream, write_options options = {});
+
+        /**
+         * @brief Writes a record batch.
+         *
+         * @throws std::invalid_argument if the schema of \p batch differs from the
+         *         schema of the first batch or from the one set by write_schema(),
+         *         or if one of its dictionaries differs from the one of the first batch.
+         * @throws std::logic_error if the writer is closed.
+         */
+        void write(const record_batch& batch);
+
+        /**
+         * @brief Sets the schema of the file from the columns of \p batch, whose rows
+         * are ignored. The schema is written with the first batch, or by close() if
+         * no batch is written.
+         *
+         * @throws std::invalid_argument if the schema of \p batch differs from the
+         *         schema already set.
+         * @throws std::logic_error if the writer is closed.
+         */
+        void write_schema(const record_batch& batch);
+
+        /**
+         * @brief Writes the footer, preceded by the schema if no batch has been
+         * written. Nothing can be written afterward.
+         *
+         * @throws std::logic_error if the schema is unknown: neither a batch nor a
+         *         schema has been written.
+         */
+        void close();
+    };
+}
@@ -34,5 +34,11 @@ namespace sparrow::detail
         {
             return array.get_arrow_proxy();
         }
+
+        template <class ARRAY>
+        static const auto* get_array_wrapper(const ARRAY& array)
+        {
+            return array.p_array.get();
+        }
     };
 }
@@ -42,8 +42,8 @@ namespace sparrow
      */
     struct array_inner_types_base
     {
-        using bitmap_type = non_owning_dynamic_bitset<std::uint8_t>;
-        using const_bitmap_type = dynamic_bitset_view<const std::uint8_t>;
+        using bitmap_type = arrow_proxy::bitmap_type;
+        using const_bitmap_type = arrow_proxy::const_bitmap_type;
     };
 
     /**
@@ -408,6 +408,20 @@ namespace sparrow
          */
         [[nodiscard]] constexpr D slice_view(size_type start, size_type end) const;
 
+        /**
+         * @brief Creates a compacted copy of the array.
+         *
+         * Creates a new array with the same elements whose buffers only hold
+         * these elements: the offset is 0, the validity bitmap is byte-aligned,
+         * and offsets, children and dictionaries are rebased and trimmed.
+         *
+         * @return New array owning its compacted buffers
+         *
+         * @post Returned array has offset 0 and the same size and elements
+         * @post Returned array does not share any buffer with this array
+         */
+        [[nodiscard]] constexpr D compact() const;
+
     protected:
 
         /**
@@ -711,6 +725,12 @@ namespace sparrow
         return D{get_arrow_proxy().slice_view(start, end)};
     }
 
+    template <class D>
+    constexpr D array_crtp_base<D>::compact() const
+    {
+        return D{get_arrow_proxy().compact()};
+    }
+
     /*
      * @brief Equality comparison operator for arrays.
      *
@@ -15,12 +15,14 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -127,6 +129,22 @@ namespace sparrow
         data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS
     };
 
+    // The dispatch and factory tables are indexed by the value of the data_type
+    static_assert(
+        []
+        {
+            for (std::size_t i = 0; i < all_data_types.size(); ++i)
+            {
+                if (static_cast<std::size_t>(all_data_types[i]) != i)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }(),
+        "all_data_types must list the data types in the order of their values"
+    );
+
     // clang-format off
     // Template specializations for array_type_map - defined here after all array includes
     template <> struct array_type_map<data_type::NA> { using type = null_array; };
@@ -227,6 +245,13 @@ namespace sparrow
      *
      * Extension types are identified by the "ARROW:extension:name" metadata key.
      *
+     * Thread safety: the factories are held in an immutable snapshot indexed by
+     * data_type. Registering a factory copies the current snapshot, modifies the
+     * copy and publishes it atomically, so create() only loads a pointer and never
+     * takes a lock; it can run from many threads while factories are registered.
+     * Published snapshots are kept until the registry is destroyed, registration
+     * is therefore meant to happen a bounded number of times, typically at startup.
+     *
      * @example
      * // Register a custom extension
      * auto& registry = array_registry::instance();
@@ -287,6 +312,7 @@ namespace sparrow
          *
          * @param dt The data_type enum value
          * @param factory Factory function to create the array
+         * @throws std::invalid_argument if dt is not a known data_type
          */
         SPARROW_API void register_base_type(data_type dt, factory_func factory);
 
@@ -440,11 +466,30 @@ namespace sparrow
             [[nodiscard]] bool matches(const array_wrapper& wrapper) const;
         };
 
-        // Base type factories indexed by data_type
-        std::unordered_map<data_type, factory_func> m_base_factories;
+        using base_factory_table = std::array<factory_func, all_data_types.size()>;
+
+        // Immutable set of factories; a new one is published on each registration
+        struct snapshot
+        {
+            // Base type factories indexed by data_type
+            base_factory_table base_factories;
+
+            // Extensions indexed by base data_type
+            std::array<std::vector<extension_entry>, all_data_types.size()> extensions;
+        };
+
+        [[nodiscard]] static std::size_t table_index(data_type dt);
+
+        // Publishes a copy of the current snapshot modified by func
+        template <class F>
+        void update_snapshot(F&& func);
+
+        std::atomic<const snapshot*> m_current = nullptr;
 
-        // Extensions indexed by base data_type
-        std::unordered_map<data_type, std::vector<extension_entry>> m_extensions;
+        // Serializes the writers and owns every published snapshot, since a reader
+        // may still use a previous one
+        std::mutex m_write_mutex;
+        std::vector<std::unique_ptr<const snapshot>> m_snapshots;
 
         /**
          * @brief Helper to check if proxy has a specific extension name.
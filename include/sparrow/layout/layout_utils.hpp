@@ -74,11 +74,12 @@ namespace sparrow::detail
         layout_type* p_layout;
     };
 
-    template <layout_offset OFFSET_TYPE, std::ranges::range SIZES_RANGE>
+    template <layout_offset OFFSET_TYPE, std::ranges::range SIZES_RANGE, allocator A>
         requires(std::unsigned_integral<std::ranges::range_value_t<SIZES_RANGE>>)
-    [[nodiscard]] constexpr sparrow::u8_buffer<OFFSET_TYPE> offset_buffer_from_sizes(SIZES_RANGE&& sizes)
+    [[nodiscard]] constexpr sparrow::u8_buffer<OFFSET_TYPE>
+    offset_buffer_from_sizes(SIZES_RANGE&& sizes, const A& a)
     {
-        sparrow::u8_buffer<OFFSET_TYPE> buffer(range_size(sizes) + 1);
+        sparrow::u8_buffer<OFFSET_TYPE> buffer(range_size(sizes) + 1, a);
 
         OFFSET_TYPE offset = 0;
         auto it = buffer.begin();
@@ -92,4 +93,14 @@ namespace sparrow::detail
         return buffer;
     }
 
+    template <layout_offset OFFSET_TYPE, std::ranges::range SIZES_RANGE>
+        requires(std::unsigned_integral<std::ranges::range_value_t<SIZES_RANGE>>)
+    [[nodiscard]] constexpr sparrow::u8_buffer<OFFSET_TYPE> offset_buffer_from_sizes(SIZES_RANGE&& sizes)
+    {
+        return offset_buffer_from_sizes<OFFSET_TYPE>(
+            std::forward<SIZES_RANGE>(sizes),
+            typename sparrow::u8_buffer<OFFSET_TYPE>::default_allocator{}
+        );
+    }
+
 }  // namespace sparrow
@@ -18,6 +18,7 @@
 
 #include "sparrow/config/config.hpp"
 #include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/typed_view.hpp"
 #include "sparrow/types/data_traits.hpp"
 #include "sparrow/utils/iterator.hpp"
 
@@ -404,6 +405,22 @@ namespace sparrow
          */
         [[nodiscard]] list_value_reverse_iterator crend() const;
 
+        /**
+         * @brief Gets a typed view over the elements of the list.
+         *
+         * The layout of the flattened array is resolved once, so that accessing
+         * the elements through the view does not dispatch on its type.
+         *
+         * @tparam A The layout type of the flattened array
+         * @return Typed view over the elements [index_begin, index_end) of the flattened array
+         * @throws std::invalid_argument if the flattened array is not a layout of type A
+         *
+         * @post Returned view has size() elements
+         * @post View remains valid while underlying array exists
+         */
+        template <layout A>
+        [[nodiscard]] typed_view<A> child_view() const;
+
     private:
 
         const array_wrapper* p_flat_array = nullptr;  ///< Pointer to underlying flattened array
@@ -427,6 +444,13 @@ namespace sparrow
      */
     SPARROW_API
     bool operator==(const list_value& lhs, const list_value& rhs);
+
+    template <layout A>
+    typed_view<A> list_value::child_view() const
+    {
+        SPARROW_ASSERT_TRUE(p_flat_array != nullptr);
+        return make_typed_view<A>(*p_flat_array, m_index_begin, m_index_end);
+    }
 }
 
 #if defined(__cpp_lib_format)
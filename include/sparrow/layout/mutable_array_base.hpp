@@ -115,6 +115,7 @@ namespace sparrow
             SPARROW_ASSERT_TRUE(pos <= this->cend());
             SPARROW_ASSERT_TRUE(first <= last);
             const difference_type distance = std::distance(this->cbegin(), pos);
+            unshare_buffers();
             const auto validity_range = std::ranges::subrange(first, last)
                                         | std::views::transform(
                                             [](const auto& obj)
@@ -187,6 +188,21 @@ namespace sparrow
         [[nodiscard]] constexpr bitmap_iterator bitmap_begin();
         [[nodiscard]] constexpr bitmap_iterator bitmap_end();
 
+        /**
+         * Gives the array exclusive ownership of its buffers before they are modified.
+         * Copies of an array share their buffers until one of them is modified,
+         * see \ref arrow_proxy::unshare_buffers.
+         */
+        constexpr void unshare_buffers();
+
+        /**
+         * Called after the buffers have been copied by \ref unshare_buffers. Arrays caching
+         * views on their buffers must hide this method to refresh these views.
+         */
+        constexpr void on_buffers_unshared()
+        {
+        }
+
         friend class layout_iterator<iterator_types>;
     };
 
@@ -206,6 +222,7 @@ namespace sparrow
     template <class D>
     constexpr auto mutable_array_base<D>::begin() -> iterator
     {
+        unshare_buffers();
         auto& derived_cast = this->derived_cast();
         return iterator(derived_cast.value_begin(), derived_cast.bitmap_begin());
     }
@@ -217,6 +234,7 @@ namespace sparrow
     template <class D>
     constexpr auto mutable_array_base<D>::end() -> iterator
     {
+        unshare_buffers();
         auto& derived_cast = this->derived_cast();
         return iterator(derived_cast.value_end(), derived_cast.bitmap_end());
     }
@@ -230,26 +248,39 @@ namespace sparrow
     constexpr auto mutable_array_base<D>::operator[](size_type i) -> reference
     {
         SPARROW_ASSERT_TRUE(i < this->size());
+        unshare_buffers();
         auto& derived_cast = this->derived_cast();
         return reference(inner_reference(derived_cast.value(i)), derived_cast.has_value(i));
     }
 
+    template <class D>
+    constexpr void mutable_array_base<D>::unshare_buffers()
+    {
+        if (this->get_arrow_proxy().unshare_buffers())
+        {
+            this->derived_cast().on_buffers_unshared();
+        }
+    }
+
     template <class D>
     constexpr auto mutable_array_base<D>::has_value(size_type i) -> bitmap_reference
     {
         SPARROW_ASSERT_TRUE(i < this->size());
+        unshare_buffers();
         return *sparrow::next(bitmap_begin(), i);
     }
 
     template <class D>
     constexpr auto mutable_array_base<D>::bitmap_begin() -> bitmap_iterator
     {
+        unshare_buffers();
         return this->derived_cast().get_bitmap().begin();
     }
 
     template <class D>
     constexpr auto mutable_array_base<D>::bitmap_end() -> bitmap_iterator
     {
+        unshare_buffers();
         return sparrow::next(bitmap_begin(), this->size());
     }
 
@@ -265,6 +296,7 @@ namespace sparrow
     template <typename T>
     constexpr void mutable_array_base<D>::resize(size_type new_length, const nullable<T>& value)
     {
+        unshare_buffers();
         auto& derived = this->derived_cast();
         derived.resize_bitmap(new_length, value.has_value());
         derived.resize_values(new_length, value.get());
@@ -301,6 +333,7 @@ namespace sparrow
         SPARROW_ASSERT_TRUE(pos >= this->cbegin());
         SPARROW_ASSERT_TRUE(pos <= this->cend());
         const size_t distance = static_cast<size_t>(std::distance(this->cbegin(), pos));
+        unshare_buffers();
         auto& derived = this->derived_cast();
         derived.insert_bitmap(sparrow::next(this->bitmap_cbegin(), distance), value.has_value(), count);
         derived.insert_value(sparrow::next(derived.value_cbegin(), distance), value.get(), count);
@@ -357,6 +390,7 @@ namespace sparrow
             return sparrow::next(begin(), first_index);
         }
         const auto count = static_cast<size_t>(std::distance(first, last));
+        unshare_buffers();
         auto& derived = this->derived_cast();
         derived.erase_bitmap(sparrow::next(this->bitmap_cbegin(), first_index), count);
         derived.erase_values(sparrow::next(derived.value_cbegin(), first_index), count);
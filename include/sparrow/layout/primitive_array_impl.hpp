@@ -460,6 +460,8 @@ namespace sparrow
 
         static constexpr size_type DATA_BUFFER_INDEX = 1;
 
+        constexpr void on_buffers_unshared();
+
         friend class run_end_encoded_array;
         friend base_type;
         friend base_type::base_type;
@@ -509,6 +511,12 @@ namespace sparrow
         return *this;
     }
 
+    template <trivial_copyable_type T, typename Ext, trivial_copyable_type T2>
+    constexpr void primitive_array_impl<T, Ext, T2>::on_buffers_unshared()
+    {
+        access_class_type::reset_proxy(this->get_arrow_proxy());
+    }
+
     template <trivial_copyable_type T, typename Ext, trivial_copyable_type T2>
     template <validity_bitmap_input VALIDITY_RANGE, input_metadata_container METADATA_RANGE>
     auto primitive_array_impl<T, Ext, T2>::create_proxy(
@@ -125,6 +125,9 @@ namespace sparrow
             template <std::ranges::input_range RANGE>
             [[nodiscard]] static constexpr u8_buffer<T2> make_data_buffer(RANGE&& r);
 
+            template <std::ranges::input_range RANGE, allocator A>
+            [[nodiscard]] static constexpr u8_buffer<T2> make_data_buffer(RANGE&& r, const A& a);
+
             [[nodiscard]] static constexpr u8_buffer<T2> make_data_buffer(size_t n, const T2& value);
 
         private:
@@ -189,6 +192,9 @@ namespace sparrow
             template <std::ranges::input_range RANGE>
             [[nodiscard]] static u8_buffer<bool> make_data_buffer(RANGE&& r);
 
+            template <std::ranges::input_range RANGE, allocator A>
+            [[nodiscard]] static u8_buffer<bool> make_data_buffer(RANGE&& r, const A& a);
+
             [[nodiscard]] static u8_buffer<bool> make_data_buffer(size_t size, bool value);
 
         private:
@@ -198,8 +204,8 @@ namespace sparrow
             using adaptor_iterator = typename bitset_adaptor::iterator;
             using const_adaptor_iterator = typename bitset_adaptor::const_iterator;
 
-            template <class F>
-            [[nodiscard]] static u8_buffer<bool> make_data_buffer(size_t size, F init_func);
+            template <class F, allocator A>
+            [[nodiscard]] static u8_buffer<bool> make_data_buffer(size_t size, F init_func, const A& a);
 
             [[nodiscard]] size_t get_offset(size_t i) const;
 
@@ -390,6 +396,14 @@ namespace sparrow
             return u8_buffer<T2>(std::forward<RANGE>(r));
         }
 
+        template <trivial_copyable_type T, trivial_copyable_type T2>
+        template <std::ranges::input_range RANGE, allocator A>
+        [[nodiscard]] constexpr u8_buffer<T2>
+        primitive_data_access<T, T2>::make_data_buffer(RANGE&& r, const A& a)
+        {
+            return u8_buffer<T2>(std::forward<RANGE>(r), a);
+        }
+
         template <trivial_copyable_type T, trivial_copyable_type T2>
         [[nodiscard]] constexpr u8_buffer<T2>
         primitive_data_access<T, T2>::make_data_buffer(size_t size, const T2& value)
@@ -535,13 +549,19 @@ namespace sparrow
 
         template <std::ranges::input_range RANGE>
         [[nodiscard]] u8_buffer<bool> primitive_data_access<bool>::make_data_buffer(RANGE&& r)
+        {
+            return make_data_buffer(std::forward<RANGE>(r), u8_buffer<bool>::default_allocator{});
+        }
+
+        template <std::ranges::input_range RANGE, allocator A>
+        [[nodiscard]] u8_buffer<bool> primitive_data_access<bool>::make_data_buffer(RANGE&& r, const A& a)
         {
             auto size = static_cast<size_t>(std::ranges::distance(r));
             auto init_func = [&r](bitset_view& v)
             {
                 std::copy(r.begin(), r.end(), v.begin());
             };
-            return make_data_buffer(size, init_func);
+            return make_data_buffer(size, init_func, a);
         }
 
         [[nodiscard]] inline u8_buffer<bool>
@@ -551,19 +571,19 @@ namespace sparrow
             {
                 std::fill(v.begin(), v.end(), value);
             };
-            return make_data_buffer(size, init_func);
+            return make_data_buffer(size, init_func, u8_buffer<bool>::default_allocator{});
         }
 
-        template <class F>
+        template <class F, allocator A>
         [[nodiscard]] inline u8_buffer<bool>
-        primitive_data_access<bool>::make_data_buffer(size_t size, F init_func)
+        primitive_data_access<bool>::make_data_buffer(size_t size, F init_func, const A& a)
         {
             std::size_t block_nb = size / 8;
             if (block_nb * 8 < size)
             {
                 ++block_nb;
             }
-            u8_buffer<bool> res(block_nb);
+            u8_buffer<bool> res(block_nb, a);
             std::uint8_t* buffer = reinterpret_cast<std::uint8_t*>(res.data());
             bitset_view v(buffer, size);
             init_func(v);
@@ -14,6 +14,14 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include "sparrow/layout/layout_utils.hpp"
 #include "sparrow/utils/functor_index_iterator.hpp"
 #if defined(__cpp_lib_format)
@@ -22,11 +30,74 @@
 
 #include "sparrow/config/config.hpp"
 #include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/typed_view.hpp"
 #include "sparrow/types/data_traits.hpp"
 #include "sparrow/utils/memory.hpp"
 
 namespace sparrow
 {
+    /**
+     * Position of a field of a struct, resolved once from its name with
+     * struct_array::field_handle() or struct_value::field_handle(), and then used
+     * to access the field of many struct_values without looking up the name again.
+     */
+    class struct_field_handle
+    {
+    public:
+
+        constexpr struct_field_handle() noexcept = default;
+
+        constexpr explicit struct_field_handle(std::size_t index) noexcept
+            : m_index(index)
+        {
+        }
+
+        [[nodiscard]] constexpr std::size_t index() const noexcept
+        {
+            return m_index;
+        }
+
+        constexpr bool operator==(const struct_field_handle&) const noexcept = default;
+
+    private:
+
+        std::size_t m_index = 0u;
+    };
+
+    /**
+     * Hash table mapping the names of the fields of a struct to their positions.
+     * It is built once by the struct_array and shared by all its struct_values,
+     * so that accessing a field by name does not compare the names of all the
+     * children. Unnamed children are not indexed; when several children have
+     * the same name, the first one is found.
+     */
+    class SPARROW_API struct_field_index
+    {
+    public:
+
+        struct_field_index() = default;
+        explicit struct_field_index(const std::vector<cloning_ptr<array_wrapper>>& children);
+
+        // Indexes the child at the given position, unless a previous child has the same name
+        void insert(std::optional<std::string_view> name, std::size_t position);
+
+        [[nodiscard]] std::optional<struct_field_handle> find(std::string_view name) const;
+
+    private:
+
+        struct name_hash
+        {
+            using is_transparent = void;
+
+            [[nodiscard]] std::size_t operator()(std::string_view name) const noexcept
+            {
+                return std::hash<std::string_view>{}(name);
+            }
+        };
+
+        std::unordered_map<std::string, std::size_t, name_hash, std::equal_to<>> m_positions;
+    };
+
     class SPARROW_API struct_value
     {
     public:
@@ -41,6 +112,7 @@ namespace sparrow
 
         struct_value() = default;
         struct_value(const std::vector<child_ptr>& children, size_type index);
+        struct_value(const std::vector<child_ptr>& children, const struct_field_index& field_index, size_type index);
 
         [[nodiscard]] size_type size() const;
         [[nodiscard]] bool empty() const;
@@ -49,6 +121,12 @@ namespace sparrow
         [[nodiscard]] const_reference at(size_type i) const;
         [[nodiscard]] const_reference at(std::string_view name) const;
 
+        [[nodiscard]] const_reference operator[](struct_field_handle field) const;
+        [[nodiscard]] const_reference at(struct_field_handle field) const;
+
+        // Resolves the name of a field once, throws std::out_of_range if there is no such field
+        [[nodiscard]] struct_field_handle field_handle(std::string_view name) const;
+
         [[nodiscard]] const_reference front() const;
         [[nodiscard]] const_reference back() const;
 
@@ -64,6 +142,20 @@ namespace sparrow
         [[nodiscard]] const_reverse_iterator rend() const;
         [[nodiscard]] const_reverse_iterator crend() const;
 
+        // Index of this value in the children arrays
+        [[nodiscard]] size_type index() const;
+
+        // Typed view over the whole child array at position i, whose element at
+        // index() is the field i of this value. The view can be built once and
+        // reused for every value of the same struct array.
+        // Throws std::out_of_range if i >= size() and std::invalid_argument if
+        // the child is not a layout of type A.
+        template <layout A>
+        [[nodiscard]] typed_view<A> child_view(size_type i) const;
+
+        template <layout A>
+        [[nodiscard]] typed_view<A> child_view(struct_field_handle field) const;
+
         [[nodiscard]] auto names() const
         {
             const auto result = (*p_children)
@@ -78,12 +170,27 @@ namespace sparrow
 
     private:
 
+        [[nodiscard]] std::optional<struct_field_handle> find_field(std::string_view name) const;
+
         const std::vector<child_ptr>* p_children = nullptr;
+        const struct_field_index* p_field_index = nullptr;
         size_type m_index = 0u;
     };
 
     SPARROW_API
     bool operator==(const struct_value& lhs, const struct_value& rhs);
+
+    template <layout A>
+    typed_view<A> struct_value::child_view(size_type i) const
+    {
+        return make_typed_view<A>(*(p_children->at(i)));
+    }
+
+    template <layout A>
+    typed_view<A> struct_value::child_view(struct_field_handle field) const
+    {
+        return child_view<A>(field.index());
+    }
 }
 
 #if defined(__cpp_lib_format)
@@ -0,0 +1,305 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/layout_concept.hpp"
+#include "sparrow/layout/layout_utils.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
+
+namespace sparrow
+{
+    /**
+     * @brief Statically typed, non-owning view over a range of elements of a layout.
+     *
+     * Accessing the elements of a type-erased array (array, list_value, struct_value)
+     * dispatches on the type of the layout and builds an array_traits::const_reference
+     * variant for each element. A typed_view resolves the layout once, when it is
+     * built, and then forwards element access and iteration to the typed layout
+     * A, so that the access can be inlined in loops over many elements.
+     *
+     * The view covers the elements [first, last) of the layout; element 0 of the
+     * view is element \c first of the layout.
+     *
+     * @tparam A The layout type, for instance primitive_array<std::int32_t>.
+     *
+     * @pre The viewed layout must outlive the view.
+     *
+     * @example
+     * ```cpp
+     * const auto values = make_typed_view<primitive_array<std::int32_t>>(ar);
+     * std::int64_t sum = 0;
+     * for (const auto& value : values)
+     * {
+     *     if (value.has_value())
+     *     {
+     *         sum += value.get();
+     *     }
+     * }
+     * ```
+     */
+    template <layout A>
+    class typed_view
+    {
+    public:
+
+        using layout_type = A;
+        using value_type = typename A::value_type;
+        using const_reference = typename A::const_reference;
+        using size_type = std::size_t;
+        using const_functor_type = detail::layout_bracket_functor<const A, const_reference>;
+        using const_iterator = functor_index_iterator<const_functor_type>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /**
+         * Constructs an empty view.
+         */
+        constexpr typed_view() = default;
+
+        /**
+         * Constructs a view over all the elements of \p layout_.
+         *
+         * @param layout_ The layout to view.
+         */
+        constexpr explicit typed_view(const A& layout_);
+
+        /**
+         * Constructs a view over the elements [first, last) of \p layout_.
+         *
+         * @param layout_ The layout to view.
+         * @param first The index of the first element of the view in \p layout_.
+         * @param last The index past the last element of the view in \p layout_.
+         * @pre first <= last and last <= layout_.size()
+         */
+        constexpr typed_view(const A& layout_, size_type first, size_type last);
+
+        [[nodiscard]] constexpr size_type size() const noexcept;
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        /**
+         * @returns the element at index \p i of the view, without bounds checking.
+         * @pre i < size()
+         */
+        [[nodiscard]] constexpr const_reference operator[](size_type i) const;
+
+        /**
+         * @returns the element at index \p i of the view.
+         * @throws std::out_of_range if \p i is not less than size().
+         */
+        [[nodiscard]] const_reference at(size_type i) const;
+
+        [[nodiscard]] constexpr const_reference front() const;
+        [[nodiscard]] constexpr const_reference back() const;
+
+        [[nodiscard]] constexpr const_iterator begin() const;
+        [[nodiscard]] constexpr const_iterator cbegin() const;
+
+        [[nodiscard]] constexpr const_iterator end() const;
+        [[nodiscard]] constexpr const_iterator cend() const;
+
+        [[nodiscard]] constexpr const_reverse_iterator rbegin() const;
+        [[nodiscard]] constexpr const_reverse_iterator crbegin() const;
+
+        [[nodiscard]] constexpr const_reverse_iterator rend() const;
+        [[nodiscard]] constexpr const_reverse_iterator crend() const;
+
+        /**
+         * @returns the viewed layout.
+         * @pre The view is not default constructed.
+         */
+        [[nodiscard]] constexpr const A& layout() const;
+
+    private:
+
+        const A* p_layout = nullptr;
+        size_type m_first = 0u;
+        size_type m_last = 0u;
+    };
+
+    /**
+     * @returns \c true if \p wrapper holds a layout of type \p A.
+     */
+    template <layout A>
+    [[nodiscard]] bool holds_layout(const array_wrapper& wrapper) noexcept;
+
+    /**
+     * Builds a typed view over all the elements of the layout held by \p wrapper.
+     *
+     * @tparam A The layout type held by \p wrapper.
+     * @throws std::invalid_argument if \p wrapper does not hold a layout of type \p A.
+     */
+    template <layout A>
+    [[nodiscard]] typed_view<A> make_typed_view(const array_wrapper& wrapper);
+
+    /**
+     * Builds a typed view over the elements [first, last) of the layout held by \p wrapper.
+     *
+     * @tparam A The layout type held by \p wrapper.
+     * @throws std::invalid_argument if \p wrapper does not hold a layout of type \p A.
+     */
+    template <layout A>
+    [[nodiscard]] typed_view<A>
+    make_typed_view(const array_wrapper& wrapper, std::size_t first, std::size_t last);
+
+    /*****************************
+     * typed_view implementation *
+     *****************************/
+
+    template <layout A>
+    constexpr typed_view<A>::typed_view(const A& layout_)
+        : typed_view(layout_, 0u, static_cast<size_type>(layout_.size()))
+    {
+    }
+
+    template <layout A>
+    constexpr typed_view<A>::typed_view(const A& layout_, size_type first, size_type last)
+        : p_layout(&layout_)
+        , m_first(first)
+        , m_last(last)
+    {
+        SPARROW_ASSERT_TRUE(first <= last);
+        SPARROW_ASSERT_TRUE(last <= static_cast<size_type>(layout_.size()));
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::size() const noexcept -> size_type
+    {
+        return m_last - m_first;
+    }
+
+    template <layout A>
+    constexpr bool typed_view<A>::empty() const noexcept
+    {
+        return m_first == m_last;
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::operator[](size_type i) const -> const_reference
+    {
+        SPARROW_ASSERT_TRUE(i < size());
+        return (*p_layout)[m_first + i];
+    }
+
+    template <layout A>
+    auto typed_view<A>::at(size_type i) const -> const_reference
+    {
+        if (i >= size())
+        {
+            std::ostringstream oss;
+            oss << "Index " << i << " is greater or equal to size of view (" << size() << ")";
+            throw std::out_of_range(oss.str());
+        }
+        return (*this)[i];
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::front() const -> const_reference
+    {
+        return (*this)[0];
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::back() const -> const_reference
+    {
+        return (*this)[size() - 1];
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::begin() const -> const_iterator
+    {
+        return cbegin();
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::cbegin() const -> const_iterator
+    {
+        return const_iterator(const_functor_type(p_layout), m_first);
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::end() const -> const_iterator
+    {
+        return cend();
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::cend() const -> const_iterator
+    {
+        return const_iterator(const_functor_type(p_layout), m_last);
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::rbegin() const -> const_reverse_iterator
+    {
+        return crbegin();
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::crbegin() const -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::rend() const -> const_reverse_iterator
+    {
+        return crend();
+    }
+
+    template <layout A>
+    constexpr auto typed_view<A>::crend() const -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    template <layout A>
+    constexpr const A& typed_view<A>::layout() const
+    {
+        SPARROW_ASSERT_TRUE(p_layout != nullptr);
+        return *p_layout;
+    }
+
+    template <layout A>
+    bool holds_layout(const array_wrapper& wrapper) noexcept
+    {
+        return dynamic_cast<const array_wrapper_impl<A>*>(&wrapper) != nullptr;
+    }
+
+    template <layout A>
+    typed_view<A> make_typed_view(const array_wrapper& wrapper)
+    {
+        if (!holds_layout<A>(wrapper))
+        {
+            throw std::invalid_argument("make_typed_view: the array does not hold the requested layout");
+        }
+        return typed_view<A>(unwrap_array<A>(wrapper));
+    }
+
+    template <layout A>
+    typed_view<A> make_typed_view(const array_wrapper& wrapper, std::size_t first, std::size_t last)
+    {
+        if (!holds_layout<A>(wrapper))
+        {
+            throw std::invalid_argument("make_typed_view: the array does not hold the requested layout");
+        }
+        return typed_view<A>(unwrap_array<A>(wrapper), first, last);
+    }
+}
@@ -446,6 +446,13 @@ namespace sparrow
         template <std::ranges::range SIZES_RANGE>
         [[nodiscard]] static constexpr auto offset_from_sizes(SIZES_RANGE&& sizes) -> offset_buffer_type;
 
+        /**
+         * @brief Same as offset_from_sizes(sizes), the offset buffer being allocated with \p a.
+         */
+        template <std::ranges::range SIZES_RANGE, allocator A>
+        [[nodiscard]] static constexpr auto
+        offset_from_sizes(SIZES_RANGE&& sizes, const A& a) -> offset_buffer_type;
+
     private:
 
         /**
@@ -1014,6 +1021,17 @@ namespace sparrow
         );
     }
 
+    template <bool BIG>
+    template <std::ranges::range SIZES_RANGE, allocator A>
+    constexpr auto list_array_impl<BIG>::offset_from_sizes(SIZES_RANGE&& sizes, const A& a)
+        -> offset_buffer_type
+    {
+        return detail::offset_buffer_from_sizes<std::remove_const_t<offset_type>>(
+            std::forward<SIZES_RANGE>(sizes),
+            a
+        );
+    }
+
     template <bool BIG>
     template <validity_bitmap_input VB, input_metadata_container METADATA_RANGE>
     arrow_proxy list_array_impl<BIG>::create_proxy(
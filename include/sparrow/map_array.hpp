@@ -230,6 +230,12 @@ namespace sparrow
         template <std::ranges::range SIZES_RANGE>
         [[nodiscard]] static auto offset_from_sizes(SIZES_RANGE&& sizes) -> offset_buffer_type;
 
+        /**
+         * @brief Same as offset_from_sizes(sizes), the offset buffer being allocated with \p a.
+         */
+        template <std::ranges::range SIZES_RANGE, allocator A>
+        [[nodiscard]] static auto offset_from_sizes(SIZES_RANGE&& sizes, const A& a) -> offset_buffer_type;
+
     private:
 
         /**
@@ -548,6 +554,15 @@ namespace sparrow
         );
     }
 
+    template <std::ranges::range SIZES_RANGE, allocator A>
+    auto map_array::offset_from_sizes(SIZES_RANGE&& sizes, const A& a) -> offset_buffer_type
+    {
+        return detail::offset_buffer_from_sizes<std::remove_const_t<offset_type>>(
+            std::forward<SIZES_RANGE>(sizes),
+            a
+        );
+    }
+
     template <input_metadata_container METADATA_RANGE>
     arrow_proxy map_array::create_proxy_impl(
         array&& flat_keys,
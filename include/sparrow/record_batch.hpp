@@ -15,9 +15,15 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -256,6 +262,23 @@ namespace sparrow
          */
         SPARROW_API record_batch(const record_batch& other);
 
+        /**
+         * @brief Deep copies \p other, the buffers of all the columns and of their
+         * children being allocated from \p resource.
+         *
+         * This gathers a batch into a single arena_memory_resource, which frees all its
+         * buffers at once when it is released.
+         *
+         * @param other The record_batch to copy from
+         * @param resource The memory resource the buffers are allocated from
+         *
+         * @pre other must be in a valid state
+         * @pre resource must outlive this record batch
+         * @post This record batch is an independent copy of other
+         * @post The lazy columns of other are materialized
+         */
+        SPARROW_API record_batch(const record_batch& other, std::pmr::memory_resource& resource);
+
         /**
          * @brief Copy assignment operator.
          *
@@ -384,6 +407,15 @@ namespace sparrow
          */
         SPARROW_API const std::optional<name_type>& name() const;
 
+        /**
+         * @brief Gets the metadata of the record batch.
+         *
+         * @return Optional metadata of the record batch
+         *
+         * @post Returns the metadata specified during construction (if any)
+         */
+        SPARROW_API const std::optional<std::vector<metadata_pair>>& metadata() const;
+
         /**
          * @brief Gets a range view of the column names.
          *
@@ -431,6 +463,36 @@ namespace sparrow
          */
         SPARROW_API struct_array extract_struct_array();
 
+        /**
+         * @brief Creates a record batch whose columns are compacted copies of the columns of this one.
+         *
+         * Each column is compacted with array::compact(): its buffers have an offset of 0
+         * and only hold the elements of the column. Referenced columns are compacted into
+         * owned arrays.
+         *
+         * @return Record batch owning the compacted columns
+         *
+         * @post Returned record batch has the same names, name, metadata, and elements
+         * @post All columns of the returned record batch have an offset of 0
+         */
+        [[nodiscard]] SPARROW_API record_batch compact() const;
+
+        /**
+         * @brief Concatenates record batches with the same columns into a single one.
+         *
+         * Each column of the result is the concatenation of the matching columns of
+         * \p batches, see sparrow::concatenate(). The name and the metadata of the result
+         * are those of the first batch.
+         *
+         * @param batches The record batches to concatenate, in order.
+         * @return Record batch owning the concatenated columns
+         * @throws std::invalid_argument if \p batches is empty, if the batches do not have
+         *         the same column names, or if matching columns have different data types.
+         *
+         * @post Returned record batch has nb_rows() equal to the sum of the batch sizes
+         */
+        [[nodiscard]] SPARROW_API static record_batch concatenate(std::span<const record_batch> batches);
+
         /**
          * @brief Adds a new column to the record batch with the specified name.
          *
@@ -511,6 +573,40 @@ namespace sparrow
          */
         SPARROW_API void add_column_reference(array& column);
 
+        /**
+         * @brief Adds a column whose array is created on first access.
+         *
+         * The \p factory is called the first time the column is accessed through
+         * get_column() or columns(), and the array it returns is kept by the record
+         * batch. Until then, the column only costs the factory: this allows readers
+         * to defer the creation of the arrays, and the reading of their buffers, to
+         * the columns that are actually used. Copies of a record batch share the
+         * factories of the columns that are not created yet.
+         *
+         * @param name The name for the column (must be unique)
+         * @param length The length of the array returned by \p factory
+         * @param factory Function creating the array
+         *
+         * @pre name must not already exist in the record batch
+         * @pre If record batch is not empty, length must equal nb_rows()
+         * @pre name must not be empty
+         * @pre factory must return an array of size \p length
+         * @post nb_columns() increases by 1
+         * @post is_column_materialized(nb_columns() - 1) is false
+         */
+        SPARROW_API void add_lazy_column(name_type name, size_type length, std::function<array()> factory);
+
+        /**
+         * @brief Checks whether the array of a column has been created.
+         *
+         * @param index The index of the column
+         * @return false if the column was added with add_lazy_column() and has not
+         *         been accessed yet, true otherwise
+         *
+         * @pre index must be < nb_columns()
+         */
+        [[nodiscard]] SPARROW_API bool is_column_materialized(size_type index) const;
+
     private:
 
         template <class AS>
@@ -561,16 +657,49 @@ namespace sparrow
          */
         SPARROW_API void check_consistency() const;
 
+        /**
+         * @brief Column added with add_lazy_column(), created on first access.
+         *
+         * The array is created under the once_flag of the column, so that concurrent
+         * first accesses to a const record batch create it only once.
+         */
+        struct lazy_column
+        {
+            SPARROW_API lazy_column(size_type length, std::function<array()> factory);
+            SPARROW_API lazy_column(const lazy_column& rhs);
+            SPARROW_API lazy_column(lazy_column&& rhs) noexcept;
+            SPARROW_API lazy_column& operator=(const lazy_column& rhs);
+            SPARROW_API lazy_column& operator=(lazy_column&& rhs) noexcept;
+            ~lazy_column() = default;
+
+            /**
+             * @brief Returns the array of the column, created by the first call.
+             */
+            [[nodiscard]] SPARROW_API array& get() const;
+            [[nodiscard]] SPARROW_API bool is_materialized() const noexcept;
+
+            size_type length;
+            std::function<array()> factory;
+            mutable std::optional<array> value;
+            // Held by pointer, since a once_flag can be neither copied nor reset
+            std::unique_ptr<std::once_flag> once;
+            mutable std::atomic<bool> materialized = false;
+
+        private:
+
+            void mark_materialized() const;
+        };
+
         using metadata_type = std::vector<metadata_pair>;
-        using array_storage_type = std::variant<array, std::reference_wrapper<array>>;
+        using array_storage_type = std::variant<array, std::reference_wrapper<array>, lazy_column>;
 
         std::optional<name_type> m_name = std::nullopt;          ///< Optional name of the record batch
         std::optional<metadata_type> m_metadata = std::nullopt;  ///< Optional metadata for the record batch
         std::vector<name_type> m_name_list;                      ///< Ordered list of column names
         std::vector<array_storage_type> m_array_list;            ///< Ordered list of column arrays (owned or
                                                                  ///< referenced)
-        mutable std::unordered_map<name_type, array*> m_array_map;  ///< Cache for fast name-based
-                                                                    ///< lookup
+        mutable std::unordered_map<name_type, size_type> m_array_map;  ///< Cache for fast name-based
+                                                                       ///< lookup of column indices
         mutable bool m_dirty_map = true;                            ///< Flag indicating cache needs update
 
         /**
@@ -578,6 +707,11 @@ namespace sparrow
          */
         SPARROW_API static array* get_array_ptr(array_storage_type& storage);
         SPARROW_API static const array* get_array_ptr(const array_storage_type& storage);
+
+        /**
+         * @brief Helper to get the size of a column without creating lazy columns.
+         */
+        SPARROW_API static size_type get_array_size(const array_storage_type& storage);
     };
 
     /**
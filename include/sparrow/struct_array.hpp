@@ -243,6 +243,33 @@ namespace sparrow
          */
         [[nodiscard]] SPARROW_API array_wrapper* raw_child(std::size_t i);
 
+        /**
+         * @brief Finds the child array with the given name.
+         *
+         * The names of the children are indexed in a hash table when the children
+         * are set, so the lookup does not compare the names of all the children.
+         *
+         * @param name Name of the child array
+         * @return Handle on the child array, or std::nullopt if there is no such child
+         *
+         * @post If several children have the given name, the handle refers to the first one
+         */
+        [[nodiscard]] SPARROW_API std::optional<struct_field_handle> find_field(std::string_view name) const;
+
+        /**
+         * @brief Resolves the name of a child array into a handle.
+         *
+         * Resolving the name once and accessing the fields of the struct values with
+         * the handle avoids looking up the name for every value.
+         *
+         * @param name Name of the child array
+         * @return Handle on the child array
+         * @throws std::out_of_range if there is no child with the given name
+         *
+         * @post The handle remains valid until the children of the array are modified
+         */
+        [[nodiscard]] SPARROW_API struct_field_handle field_handle(std::string_view name) const;
+
         /**
          * @brief Gets the names of all child arrays.
          *
@@ -472,7 +499,8 @@ namespace sparrow
 
 
         // data members
-        children_type m_children;  ///< Collection of child arrays (fields)
+        children_type m_children;          ///< Collection of child arrays (fields)
+        struct_field_index m_field_index;  ///< Positions of the children by name
 
         // friend classes
         friend class array_crtp_base<self_type>;
@@ -589,6 +617,7 @@ namespace sparrow
         auto [array, schema] = extract_arrow_structures(std::forward<A>(child));
         get_arrow_proxy().add_child(std::move(array), std::move(schema));
         m_children.emplace_back(array_factory(get_arrow_proxy().children().back().view()));
+        m_field_index.insert(m_children.back()->get_arrow_proxy().name(), m_children.size() - 1);
     }
 
     template <std::ranges::input_range R>
@@ -613,6 +642,7 @@ namespace sparrow
         auto [array, schema] = extract_arrow_structures(std::forward<A>(child));
         get_arrow_proxy().set_child(index, std::move(array), std::move(schema));
         m_children[index] = array_factory(get_arrow_proxy().children()[index].view());
+        m_field_index = struct_field_index(m_children);
     }
 }
 
@@ -156,6 +156,17 @@ namespace sparrow
          */
         constexpr u8_buffer(std::size_t n, const T& val);
 
+        /**
+         * Constructs a buffer with \c n uninitialized elements, allocated with \c a.
+         * \c a must allocate std::uint8_t.
+         *
+         * @tparam A The allocator type.
+         * @param n Number of elements.
+         * @param a The allocator to use.
+         */
+        template <allocator A>
+        constexpr u8_buffer(std::size_t n, const A& a);
+
         /**
          * Constructs a buffer with the elements of the range \c range.
          * The range elements must be convertible to \c T.
@@ -171,6 +182,22 @@ namespace sparrow
             )
         constexpr explicit u8_buffer(R&& range);
 
+        /**
+         * Constructs a buffer with the elements of the range \c range, allocated with \c a.
+         * \c a must allocate std::uint8_t.
+         *
+         * @tparam R The range type.
+         * @tparam A The allocator type.
+         * @param range The range to copy elements from.
+         * @param a The allocator to use.
+         */
+        template <std::ranges::input_range R, allocator A>
+            requires(
+                !std::same_as<u8_buffer<T>, std::decay_t<R>>
+                && std::convertible_to<std::ranges::range_value_t<R>, T>
+            )
+        constexpr u8_buffer(R&& range, const A& a);
+
         /**
          * Constructs a buffer with the elements of the initializer list \c ilist.
          *
@@ -235,6 +262,14 @@ namespace sparrow
         std::fill(this->begin(), this->end(), val);
     }
 
+    template <class T>
+    template <allocator A>
+    constexpr u8_buffer<T>::u8_buffer(std::size_t n, const A& a)
+        : holder_type{n * sizeof(T), a}
+        , buffer_adaptor_type(holder_type::value)
+    {
+    }
+
     template <class T>
     template <std::ranges::input_range R>
         requires(
@@ -246,6 +281,17 @@ namespace sparrow
         sparrow::ranges::copy(range, this->begin());
     }
 
+    template <class T>
+    template <std::ranges::input_range R, allocator A>
+        requires(
+            !std::same_as<u8_buffer<T>, std::decay_t<R>> && std::convertible_to<std::ranges::range_value_t<R>, T>
+        )
+    constexpr u8_buffer<T>::u8_buffer(R&& range, const A& a)
+        : u8_buffer(range_size(range), a)
+    {
+        sparrow::ranges::copy(range, this->begin());
+    }
+
     template <class T>
     constexpr u8_buffer<T>::u8_buffer(std::initializer_list<T> ilist)
         : u8_buffer(ilist.size())
@@ -18,6 +18,9 @@
 #include <array>
 #include <bit>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 namespace sparrow
 {
@@ -49,4 +52,138 @@ namespace sparrow
             return value;
         }
     }
+
+    /**
+     * Returns a 64-bit word whose \p n lowest bits are set.
+     * \param n The number of bits to set, values above 64 are clamped.
+     */
+    [[nodiscard]] constexpr std::uint64_t low_bits_mask(std::size_t n) noexcept
+    {
+        return n >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+    }
+
+    /**
+     * Loads up to 64 bits of a LSB-ordered bitmap into a word.
+     * \param bitmap The bitmap to read from.
+     * \param bit_offset The position of the first bit to load.
+     * \param n_bits The number of bits to load, at most 64.
+     * \return A word whose bit i is the bit \p bit_offset + i of \p bitmap; the bits
+     *         past \p n_bits are cleared.
+     * \note The bytes past the last loaded bit are not read.
+     */
+    [[nodiscard]] inline std::uint64_t
+    load_bits(const std::uint8_t* bitmap, std::size_t bit_offset, std::size_t n_bits) noexcept
+    {
+        const std::uint8_t* first = bitmap + bit_offset / 8;
+        const std::size_t shift = bit_offset % 8;
+        const std::size_t n_bytes = (shift + n_bits + 7) / 8;
+        std::uint64_t word = 0;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            std::memcpy(&word, first, std::min<std::size_t>(n_bytes, 8));
+        }
+        else
+        {
+            for (std::size_t i = 0; i < std::min<std::size_t>(n_bytes, 8); ++i)
+            {
+                word |= static_cast<std::uint64_t>(first[i]) << (8 * i);
+            }
+        }
+        word >>= shift;
+        if (n_bytes > 8)
+        {
+            word |= static_cast<std::uint64_t>(first[8]) << (64 - shift);
+        }
+        return word & low_bits_mask(n_bits);
+    }
+
+    /**
+     * Stores the lowest bits of a word into a LSB-ordered bitmap.
+     * \param bitmap The bitmap to write to.
+     * \param bit_offset The position of the first bit to store.
+     * \param word The bits to store.
+     * \param n_bits The number of bits to store, at most 64.
+     * \note The bits of \p bitmap outside of [\p bit_offset, \p bit_offset + \p n_bits)
+     *       are left unchanged.
+     */
+    inline void
+    store_bits(std::uint8_t* bitmap, std::size_t bit_offset, std::uint64_t word, std::size_t n_bits) noexcept
+    {
+        std::uint8_t* first = bitmap + bit_offset / 8;
+        const std::size_t shift = bit_offset % 8;
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            if (shift == 0 && n_bits % 8 == 0)
+            {
+                std::memcpy(first, &word, n_bits / 8);
+                return;
+            }
+        }
+        const std::size_t n_bytes = (shift + n_bits + 7) / 8;
+        const std::uint64_t mask = low_bits_mask(n_bits);
+        word &= mask;
+        for (std::size_t i = 0; i < n_bytes; ++i)
+        {
+            // Byte i holds the bits of word starting at 8 * i - shift.
+            const std::size_t pos = 8 * i;
+            const std::uint64_t byte_bits = pos == 0 ? (word << shift) : (word >> (pos - shift));
+            const std::uint64_t byte_mask = pos == 0 ? (mask << shift) : (mask >> (pos - shift));
+            first[i] = static_cast<std::uint8_t>(
+                (first[i] & ~static_cast<std::uint8_t>(byte_mask)) | static_cast<std::uint8_t>(byte_bits)
+            );
+        }
+    }
+
+    /**
+     * Moves a range of bits inside a LSB-ordered bitmap, 64 bits at a time.
+     * \param bitmap The bitmap holding both ranges.
+     * \param dst_offset The position of the first bit of the destination range.
+     * \param src_offset The position of the first bit of the source range.
+     * \param n_bits The number of bits to move.
+     * \note The ranges may overlap: like std::memmove, the destination receives the
+     *       bits the source held before the call. The bits of \p bitmap outside of the
+     *       destination range are left unchanged.
+     */
+    inline void
+    move_bits(std::uint8_t* bitmap, std::size_t dst_offset, std::size_t src_offset, std::size_t n_bits) noexcept
+    {
+        if (n_bits == 0 || dst_offset == src_offset)
+        {
+            return;
+        }
+        if (dst_offset < src_offset)
+        {
+            // Moving toward the front: copy the words in increasing order, after
+            // aligning the destination on a byte boundary.
+            std::size_t pos = std::min(n_bits, (8 - dst_offset % 8) % 8);
+            if (pos != 0)
+            {
+                store_bits(bitmap, dst_offset, load_bits(bitmap, src_offset, pos), pos);
+            }
+            while (pos < n_bits)
+            {
+                const std::size_t n = std::min<std::size_t>(64, n_bits - pos);
+                store_bits(bitmap, dst_offset + pos, load_bits(bitmap, src_offset + pos, n), n);
+                pos += n;
+            }
+        }
+        else
+        {
+            // Moving toward the back: copy the words in decreasing order, after
+            // aligning the end of the destination on a byte boundary.
+            std::size_t remaining = n_bits;
+            const std::size_t tail = std::min(n_bits, (dst_offset + n_bits) % 8);
+            if (tail != 0)
+            {
+                remaining -= tail;
+                store_bits(bitmap, dst_offset + remaining, load_bits(bitmap, src_offset + remaining, tail), tail);
+            }
+            while (remaining != 0)
+            {
+                const std::size_t n = std::min<std::size_t>(64, remaining);
+                remaining -= n;
+                store_bits(bitmap, dst_offset + remaining, load_bits(bitmap, src_offset + remaining, n), n);
+            }
+        }
+    }
 }
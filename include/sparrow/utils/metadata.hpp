@@ -19,9 +19,11 @@
 #include <cstdint>
 #include <cstring>
 #include <numeric>
+#include <optional>
 #include <ranges>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "sparrow/config/config.hpp"
 #include "sparrow/utils/contracts.hpp"
@@ -76,7 +78,13 @@ namespace sparrow
      */
     SPARROW_API int32_t extract_int32(const char*& ptr);
 
+    /**
+     * @brief Metadata key holding the name of an Arrow extension type.
+     */
+    inline constexpr std::string_view extension_name_metadata_key = "ARROW:extension:name";
+
     class key_value_view;
+    class key_value_index;
 
     /**
      * @brief Iterator for traversing key-value pairs in a binary metadata buffer.
@@ -199,11 +207,16 @@ namespace sparrow
          */
         SPARROW_API void extract_key_value();
 
+        // Builds an iterator on the pair \p index, which starts at \p position in the buffer
+        key_value_view_iterator(const key_value_view& parent, int32_t index, const char* position);
+
         const key_value_view* m_parent;  ///< Pointer to parent view
         int32_t m_index;                 ///< Current iterator index
         const char* m_current;           ///< Current position in buffer
         std::string_view m_key;          ///< Currently extracted key
         std::string_view m_value;        ///< Currently extracted value
+
+        friend key_value_view;
     };
 
     /**
@@ -243,6 +256,17 @@ namespace sparrow
          */
         SPARROW_API key_value_view(const char* ptr);
 
+        /**
+         * @brief Constructs a view over the given binary metadata buffer, with the index
+         * of its keys, which makes find() a binary search.
+         *
+         * @param ptr Pointer to the start of the binary metadata buffer
+         * @param index Index of the keys of the buffer, may be null
+         *
+         * @pre If not null, index must have been built from ptr and must outlive the view
+         */
+        SPARROW_API key_value_view(const char* ptr, const key_value_index* index);
+
         /**
          * @brief Gets const iterator to the beginning of the metadata pairs.
          *
@@ -295,16 +319,80 @@ namespace sparrow
 
         [[nodiscard]] SPARROW_API bool empty() const;
 
+        /**
+         * @brief Finds the first pair with the given key.
+         *
+         * The lookup is a binary search when the view has been built with an index,
+         * and a linear scan of the buffer otherwise.
+         *
+         * @return An iterator on the pair, or end() if there is no such key
+         */
         [[nodiscard]] SPARROW_API key_value_view_iterator find(std::string_view key) const;
 
     private:
 
-        const char* m_ptr;        ///< Pointer to the binary metadata buffer
-        int32_t m_num_pairs = 0;  ///< Number of key-value pairs in the buffer
+        const char* m_ptr;                         ///< Pointer to the binary metadata buffer
+        int32_t m_num_pairs = 0;                   ///< Number of key-value pairs in the buffer
+        const key_value_index* m_index = nullptr;  ///< Optional index of the keys
 
         friend key_value_view_iterator;
     };
 
+    /**
+     * @brief Sorted index of the keys of a binary metadata buffer.
+     *
+     * The buffer is parsed once, then keys are found with a binary search instead
+     * of scanning and parsing the buffer again. The schemas created by sparrow keep
+     * the index of their metadata (see arrow_schema_private_data), along with the
+     * extension name that the array registry looks up for every array it creates.
+     *
+     * @pre The buffer must outlive the index and must not be modified
+     */
+    class key_value_index
+    {
+    public:
+
+        struct entry
+        {
+            std::string_view key;
+            std::string_view value;
+            int32_t index;         ///< Index of the pair in the buffer
+            const char* position;  ///< Start of the pair in the buffer
+        };
+
+        /**
+         * @brief Parses the binary metadata buffer pointed to by \p ptr.
+         *
+         * @pre ptr must point to a valid binary metadata buffer
+         */
+        SPARROW_API explicit key_value_index(const char* ptr);
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_entries.size();
+        }
+
+        /**
+         * @brief Finds the first pair of the buffer with the given key, in O(log n).
+         *
+         * @return The entry of the pair, or nullptr if there is no such key
+         */
+        [[nodiscard]] SPARROW_API const entry* find(std::string_view key) const;
+
+        /**
+         * @return The value of the extension_name_metadata_key key, if any.
+         */
+        [[nodiscard]] const std::optional<std::string_view>& extension_name() const noexcept
+        {
+            return m_extension_name;
+        }
+
+    private:
+
+        std::vector<entry> m_entries;  ///< Sorted by key, then by index
+        std::optional<std::string_view> m_extension_name;
+    };
+
     /**
      * @brief Equality comparison operator for key_value_view (free function).
      *
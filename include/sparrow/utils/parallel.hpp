@@ -0,0 +1,84 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+#include "sparrow/config/config.hpp"
+
+namespace sparrow
+{
+    /**
+     * @brief Returns the number of tasks worth running for \p work units of work,
+     * given that a task should process at least \p min_work_per_task units.
+     *
+     * @return A number between 1 and the number of hardware threads.
+     */
+    [[nodiscard]] inline std::size_t parallel_task_count(std::size_t work, std::size_t min_work_per_task) noexcept
+    {
+        const std::size_t hardware_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        const std::size_t worth = min_work_per_task == 0 ? work : work / min_work_per_task;
+        return std::clamp<std::size_t>(worth, 1, hardware_threads);
+    }
+
+    namespace detail
+    {
+        /**
+         * Runs parallel_for with more than one task, the other threads being taken
+         * from the pool of the library.
+         */
+        SPARROW_API void
+        parallel_for_impl(std::size_t count, const std::function<void(std::size_t)>& func, std::size_t max_tasks);
+    }
+
+    /**
+     * @brief Calls \p func with every index of [0, \p count), using up to \p max_tasks
+     * threads, the calling thread included.
+     *
+     * The indices are distributed dynamically, so that uneven work items keep all the
+     * threads busy. \p func must be safe to call concurrently for different indices.
+     * With a single task, everything runs on the calling thread. Otherwise the other
+     * threads come from a pool created on first use and shared by all the calls, so
+     * that a call does not create threads. The pool has one thread less than the
+     * hardware; \p max_tasks is usually given by parallel_task_count.
+     *
+     * @throws The first exception thrown by \p func, once all the tasks are done.
+     */
+    template <std::invocable<std::size_t> F>
+    void parallel_for(std::size_t count, F&& func, std::size_t max_tasks)
+    {
+        const std::size_t task_count = std::min(count, max_tasks);
+        if (task_count <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                func(i);
+            }
+            return;
+        }
+        detail::parallel_for_impl(
+            count,
+            [&func](std::size_t i)
+            {
+                func(i);
+            },
+            task_count
+        );
+    }
+}
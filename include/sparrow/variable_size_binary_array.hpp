@@ -416,6 +416,13 @@ namespace sparrow
         template <std::ranges::range SIZES_RANGE>
         [[nodiscard]] static constexpr auto offset_from_sizes(SIZES_RANGE&& sizes) -> offset_buffer_type;
 
+        /**
+         * @brief Same as offset_from_sizes(sizes), the offset buffer being allocated with \p a.
+         */
+        template <std::ranges::range SIZES_RANGE, allocator A>
+        [[nodiscard]] static constexpr auto
+        offset_from_sizes(SIZES_RANGE&& sizes, const A& a) -> offset_buffer_type;
+
     private:
 
         /**
@@ -896,6 +903,18 @@ namespace sparrow
         );
     }
 
+    template <std::ranges::sized_range T, class CR, layout_offset OT, typename Ext>
+    template <std::ranges::range SIZES_RANGE, allocator A>
+    constexpr auto
+    variable_size_binary_array_impl<T, CR, OT, Ext>::offset_from_sizes(SIZES_RANGE&& sizes, const A& a)
+        -> offset_buffer_type
+    {
+        return detail::offset_buffer_from_sizes<std::remove_const_t<offset_type>>(
+            std::forward<SIZES_RANGE>(sizes),
+            a
+        );
+    }
+
     template <std::ranges::sized_range T, class CR, layout_offset OT, typename Ext>
     template <mpl::char_like C, validity_bitmap_input VB, input_metadata_container METADATA_RANGE>
     arrow_proxy variable_size_binary_array_impl<T, CR, OT, Ext>::create_proxy(
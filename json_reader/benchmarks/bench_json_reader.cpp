@@ -0,0 +1,156 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include <sparrow/json_reader/json_parser.hpp>
+#include <sparrow/json_reader/streaming_parser.hpp>
+
+namespace sparrow::json_reader::benchmark
+{
+    namespace
+    {
+        template <class F>
+        void write_column(
+            std::ofstream& out,
+            const std::string& name,
+            std::size_t row_count,
+            bool last,
+            F&& write_value
+        )
+        {
+            out << R"({"name": ")" << name << R"(", "count": )" << row_count << R"(, "VALIDITY": [)";
+            for (std::size_t i = 0; i < row_count; ++i)
+            {
+                out << (i == 0 ? "" : ", ") << (i % 10 == 0 ? 0 : 1);
+            }
+            out << R"(], "DATA": [)";
+            for (std::size_t i = 0; i < row_count; ++i)
+            {
+                out << (i == 0 ? "" : ", ");
+                write_value(i);
+            }
+            out << "]}" << (last ? "" : ",\n");
+        }
+
+        // Generates an Arrow integration JSON file with one batch of row_count rows
+        std::filesystem::path generate_json_file(std::size_t row_count)
+        {
+            const auto path = std::filesystem::temp_directory_path()
+                              / ("sparrow_bench_json_reader_" + std::to_string(row_count) + ".json");
+            std::ofstream out(path);
+            out << R"({"schema": {"fields": [
+                {"name": "ints", "nullable": true, "type": {"name": "int", "isSigned": true, "bitWidth": 32}, "children": []},
+                {"name": "longs", "nullable": true, "type": {"name": "int", "isSigned": true, "bitWidth": 64}, "children": []},
+                {"name": "doubles", "nullable": true, "type": {"name": "floatingpoint", "precision": "DOUBLE"}, "children": []},
+                {"name": "bools", "nullable": true, "type": {"name": "bool"}, "children": []},
+                {"name": "strings", "nullable": true, "type": {"name": "utf8"}, "children": []}
+            ]},
+            "batches": [{"count": )"
+                << row_count << R"(, "columns": [)" << '\n';
+            write_column(
+                out,
+                "ints",
+                row_count,
+                false,
+                [&](std::size_t i)
+                {
+                    out << static_cast<int>(i);
+                }
+            );
+            write_column(
+                out,
+                "longs",
+                row_count,
+                false,
+                [&](std::size_t i)
+                {
+                    out << '"' << i * 1000003 << '"';
+                }
+            );
+            write_column(
+                out,
+                "doubles",
+                row_count,
+                false,
+                [&](std::size_t i)
+                {
+                    out << static_cast<double>(i) * 0.25;
+                }
+            );
+            write_column(
+                out,
+                "bools",
+                row_count,
+                false,
+                [&](std::size_t i)
+                {
+                    out << (i % 3 == 0 ? "true" : "false");
+                }
+            );
+            write_column(
+                out,
+                "strings",
+                row_count,
+                true,
+                [&](std::size_t i)
+                {
+                    out << "\"value " << i << '"';
+                }
+            );
+            out << "]}]}\n";
+            return path;
+        }
+    }
+
+    static void BM_JsonReader_Dom(::benchmark::State& state)
+    {
+        const auto path = generate_json_file(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            std::ifstream file(path);
+            const nlohmann::json root = nlohmann::json::parse(file);
+            auto batch = build_record_batch_from_json(root, 0);
+            ::benchmark::DoNotOptimize(batch);
+        }
+        state.SetBytesProcessed(
+            static_cast<std::int64_t>(state.iterations() * std::filesystem::file_size(path))
+        );
+        std::filesystem::remove(path);
+    }
+
+    static void BM_JsonReader_Streaming(::benchmark::State& state)
+    {
+        const auto path = generate_json_file(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            auto batch = build_record_batch_from_json_file(path, 0);
+            ::benchmark::DoNotOptimize(batch);
+        }
+        state.SetBytesProcessed(
+            static_cast<std::int64_t>(state.iterations() * std::filesystem::file_size(path))
+        );
+        std::filesystem::remove(path);
+    }
+
+    BENCHMARK(BM_JsonReader_Dom)->RangeMultiplier(100)->Range(10000, 1000000)->Unit(::benchmark::kMillisecond);
+    BENCHMARK(BM_JsonReader_Streaming)->RangeMultiplier(100)->Range(10000, 1000000)->Unit(::benchmark::kMillisecond);
+}
@@ -48,6 +48,19 @@ namespace sparrow::json_reader
         const nlohmann::json& root
     );
 
+    /**
+     * @brief Builds the record batch at index \p num_batches of an Arrow integration JSON
+     *        document already loaded into a DOM.
+     *
+     * This is the entry point for callers holding an nlohmann::json document. To read a
+     * file or a string, build_record_batch_from_json_file() and
+     * build_record_batch_from_json_string() avoid building the DOM of the whole document;
+     * they rely on the DOM parsers above for the nested columns, and the tests check them
+     * against this function.
+     *
+     * @throws std::runtime_error if the document is malformed, or if \p num_batches is
+     *         out of range.
+     */
     SPARROW_JSON_READER_API sparrow::record_batch
     build_record_batch_from_json(const nlohmann::json& root, size_t num_batches);
 }
@@ -0,0 +1,124 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sparrow/record_batch.hpp>
+
+#include "sparrow/json_reader/config.hpp"
+
+namespace sparrow::json_reader
+{
+    /**
+     * @brief Types of the columns read from NDJSON.
+     *
+     * Each type maps to a sparrow array:
+     * - null: null_array, for the fields that are always null
+     * - boolean: primitive_array<bool>
+     * - int64: primitive_array<int64_t>
+     * - float64: primitive_array<double>
+     * - string: string_array
+     * - timestamp: timestamp_microseconds_array in UTC
+     * - list: list_array
+     * - structure: struct_array
+     */
+    enum class ndjson_type : std::uint8_t
+    {
+        null,
+        boolean,
+        int64,
+        float64,
+        string,
+        timestamp,
+        list,
+        structure
+    };
+
+    /**
+     * @brief A field of an NDJSON schema.
+     *
+     * A list has a single child, named "item", describing its values; a structure
+     * has a child per member.
+     */
+    struct ndjson_field
+    {
+        std::string name;
+        ndjson_type type = ndjson_type::null;
+        std::vector<ndjson_field> children;
+
+        bool operator==(const ndjson_field&) const = default;
+    };
+
+    struct ndjson_read_options
+    {
+        // Number of rows of each record batch, the last one may be shorter
+        std::size_t batch_size = 65536;
+        // Number of rows read to infer the schema
+        std::size_t inference_rows = 1000;
+        // Number of rows parsed by a single task
+        std::size_t block_size = 8192;
+        // Maximum number of parsing threads, 0 for one per hardware thread
+        std::size_t max_threads = 0;
+        // Schema of the rows, inferred from the first rows if not set
+        std::optional<std::vector<ndjson_field>> schema;
+    };
+
+    /**
+     * @brief Infers the schema of NDJSON rows from the first \p max_rows ones.
+     *
+     * Each row must be an object, whose members become the fields of the schema, in
+     * order of first appearance. The types of a field are merged over the rows: null
+     * values and missing members give no information, integers and floating point
+     * numbers merge into float64, strings holding ISO 8601 timestamps (for instance
+     * "2024-03-01T12:30:00.250Z") are timestamps unless another row holds a plain
+     * string, and the members of objects and the values of arrays are merged
+     * recursively. Any other conflict makes the field a string, holding the JSON text
+     * of the values that are not strings.
+     *
+     * @throws std::runtime_error if a row is not a valid JSON object.
+     */
+    [[nodiscard]] SPARROW_JSON_READER_API std::vector<ndjson_field>
+    infer_ndjson_schema(std::string_view ndjson, std::size_t max_rows = 1000);
+
+    /**
+     * @brief Reads NDJSON rows into record batches of options.batch_size rows.
+     *
+     * Blank lines are skipped. The rows are split into blocks of options.block_size rows
+     * that are parsed in parallel, each into its own column builders; the blocks of a
+     * batch are then concatenated. Members that are not in the schema are ignored and
+     * missing members are null.
+     *
+     * @throws std::runtime_error if a row is not a valid JSON object, or if a value
+     *         does not match the type of its field. The message gives the line number.
+     */
+    [[nodiscard]] SPARROW_JSON_READER_API std::vector<sparrow::record_batch>
+    read_ndjson(std::string_view ndjson, const ndjson_read_options& options = {});
+
+    /**
+     * @brief Reads an NDJSON file into record batches, see read_ndjson().
+     *
+     * @throws std::runtime_error if the file cannot be read, or for the same reasons
+     *         as read_ndjson().
+     */
+    [[nodiscard]] SPARROW_JSON_READER_API std::vector<sparrow::record_batch>
+    read_ndjson_file(const std::filesystem::path& path, const ndjson_read_options& options = {});
+}
@@ -0,0 +1,50 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+#include <sparrow/record_batch.hpp>
+
+#include "sparrow/json_reader/config.hpp"
+
+namespace sparrow::json_reader
+{
+    /**
+     * @brief Builds the record batch at index \p num_batches of an Arrow integration JSON file.
+     *
+     * Unlike build_record_batch_from_json(), the document is not loaded into a DOM: it is
+     * parsed on demand with simdjson, and the primitive, boolean, string and binary columns
+     * are written directly into the buffers of the arrays. The other columns are built by
+     * the DOM parsers, from their own JSON subtree only.
+     *
+     * @throws std::runtime_error if the file cannot be read, if it is malformed, or if
+     *         \p num_batches is out of range.
+     */
+    SPARROW_JSON_READER_API sparrow::record_batch
+    build_record_batch_from_json_file(const std::filesystem::path& path, size_t num_batches);
+
+    /**
+     * @brief Builds the record batch at index \p num_batches of an Arrow integration JSON
+     *        document, see build_record_batch_from_json_file().
+     *
+     * @throws std::runtime_error if the document is malformed, or if \p num_batches is
+     *         out of range.
+     */
+    SPARROW_JSON_READER_API sparrow::record_batch
+    build_record_batch_from_json_string(std::string_view json, size_t num_batches);
+}
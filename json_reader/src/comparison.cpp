@@ -14,6 +14,7 @@
 
 #include "sparrow/json_reader/comparison.hpp"
 
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -194,15 +195,20 @@ namespace sparrow::json_reader
         {
             return prefix_with_name + " is null";
         }
-        if (array->null_count != array_from_json->null_count)
+
+        const sparrow::array array_from_ptr(array, schema_from_json);
+        const sparrow::array array_from_json_ptr(array_from_json, schema_from_json);
+
+        // A null count of -1 is unknown: the arrays count it from their validity bitmap
+        const std::int64_t null_count = array_from_ptr.null_count();
+        const std::int64_t null_count_from_json = array_from_json_ptr.null_count();
+        if (null_count != null_count_from_json)
         {
-            return prefix_with_name + " null count mismatch: pointer=" + std::to_string(array->null_count)
-                   + " vs json=" + std::to_string(array_from_json->null_count);
+            return prefix_with_name + " null count mismatch: pointer=" + std::to_string(null_count)
+                   + " vs json=" + std::to_string(null_count_from_json);
         }
 
         std::vector<std::string> differences;
-        const sparrow::array array_from_ptr(array, schema_from_json);
-        const sparrow::array array_from_json_ptr(array_from_json, schema_from_json);
 
         // check is same layout
         if (array_from_ptr.data_type() != array_from_json_ptr.data_type())
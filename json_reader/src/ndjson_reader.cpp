@@ -0,0 +1,837 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/json_reader/ndjson_reader.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <simdjson.h>
+
+#include <sparrow/list_array.hpp>
+#include <sparrow/null_array.hpp>
+#include <sparrow/primitive_array.hpp>
+#include <sparrow/struct_array.hpp>
+#include <sparrow/timestamp_array.hpp>
+#include <sparrow/u8_buffer.hpp>
+#include <sparrow/utils/parallel.hpp>
+#include <sparrow/variable_size_binary_array.hpp>
+
+namespace sparrow::json_reader
+{
+    namespace
+    {
+        namespace ondemand = simdjson::ondemand;
+
+        bool is_blank(std::string_view line)
+        {
+            return std::ranges::all_of(
+                line,
+                [](char c)
+                {
+                    return c == ' ' || c == '\t' || c == '\r';
+                }
+            );
+        }
+
+        // Calls func(line, line_number) for each non blank line of \p text, until it returns false
+        template <class F>
+        void for_each_row(std::string_view text, std::size_t first_line, F&& func)
+        {
+            std::size_t line_number = first_line;
+            std::size_t begin = 0;
+            while (begin < text.size())
+            {
+                const std::size_t newline = text.find('\n', begin);
+                const std::size_t end = newline == std::string_view::npos ? text.size() : newline;
+                const std::string_view line = text.substr(begin, end - begin);
+                if (!is_blank(line) && !func(line, line_number))
+                {
+                    return;
+                }
+                begin = end + 1;
+                ++line_number;
+            }
+        }
+
+        // The line lies in a padded buffer ending at \p padded_end, whose padding is
+        // available after the line
+        ondemand::document iterate_row(ondemand::parser& parser, std::string_view line, const char* padded_end)
+        {
+            const auto capacity = static_cast<std::size_t>(padded_end - line.data());
+            ondemand::document document = parser.iterate(simdjson::padded_string_view(line, capacity));
+            return document;
+        }
+
+        [[noreturn]] void throw_row_error(std::size_t line_number, std::string_view what)
+        {
+            throw std::runtime_error("NDJSON line " + std::to_string(line_number) + ": " + std::string(what));
+        }
+
+        // Calls func() and prefixes the message of the errors it throws with the line number
+        template <class F>
+        void with_line_number(std::size_t line_number, F&& func)
+        {
+            try
+            {
+                func();
+            }
+            catch (const simdjson::simdjson_error& e)
+            {
+                throw_row_error(line_number, e.what());
+            }
+            catch (const std::runtime_error& e)
+            {
+                throw_row_error(line_number, e.what());
+            }
+        }
+
+        bool parse_digits(std::string_view str, int& value)
+        {
+            value = 0;
+            for (const char c : str)
+            {
+                if (c < '0' || c > '9')
+                {
+                    return false;
+                }
+                value = value * 10 + (c - '0');
+            }
+            return !str.empty();
+        }
+
+        // Parses YYYY-MM-DDThh:mm:ss[.fraction][Z|+hh:mm|-hh:mm] into microseconds since
+        // the epoch; the date and the time may also be separated by a space
+        std::optional<std::int64_t> parse_timestamp(std::string_view str)
+        {
+            if (str.size() < 19 || str[4] != '-' || str[7] != '-' || (str[10] != 'T' && str[10] != ' ')
+                || str[13] != ':' || str[16] != ':')
+            {
+                return std::nullopt;
+            }
+            int year = 0;
+            int month = 0;
+            int day = 0;
+            int hour = 0;
+            int minute = 0;
+            int second = 0;
+            if (!parse_digits(str.substr(0, 4), year) || !parse_digits(str.substr(5, 2), month)
+                || !parse_digits(str.substr(8, 2), day) || !parse_digits(str.substr(11, 2), hour)
+                || !parse_digits(str.substr(14, 2), minute) || !parse_digits(str.substr(17, 2), second))
+            {
+                return std::nullopt;
+            }
+            const date::year_month_day ymd{
+                date::year{year},
+                date::month{static_cast<unsigned>(month)},
+                date::day{static_cast<unsigned>(day)}
+            };
+            if (!ymd.ok() || hour > 23 || minute > 59 || second > 59)
+            {
+                return std::nullopt;
+            }
+
+            std::size_t pos = 19;
+            std::int64_t microseconds = 0;
+            if (pos < str.size() && str[pos] == '.')
+            {
+                const std::size_t first_digit = ++pos;
+                std::int64_t scale = 1'000'000;
+                while (pos < str.size() && str[pos] >= '0' && str[pos] <= '9')
+                {
+                    // The digits beyond the microseconds are truncated
+                    if (scale > 1)
+                    {
+                        scale /= 10;
+                        microseconds += (str[pos] - '0') * scale;
+                    }
+                    ++pos;
+                }
+                if (pos == first_digit)
+                {
+                    return std::nullopt;
+                }
+            }
+
+            int offset_minutes = 0;
+            if (pos < str.size())
+            {
+                if (str[pos] == 'Z')
+                {
+                    ++pos;
+                }
+                else if (str[pos] == '+' || str[pos] == '-')
+                {
+                    const int sign = str[pos] == '-' ? -1 : 1;
+                    std::string_view offset = str.substr(pos + 1);
+                    int offset_hour = 0;
+                    int offset_minute = 0;
+                    if (offset.size() == 5 && offset[2] == ':')
+                    {
+                        if (!parse_digits(offset.substr(0, 2), offset_hour)
+                            || !parse_digits(offset.substr(3, 2), offset_minute))
+                        {
+                            return std::nullopt;
+                        }
+                    }
+                    else if (offset.size() != 4 || !parse_digits(offset.substr(0, 2), offset_hour)
+                             || !parse_digits(offset.substr(2, 2), offset_minute))
+                    {
+                        return std::nullopt;
+                    }
+                    offset_minutes = sign * (offset_hour * 60 + offset_minute);
+                    pos = str.size();
+                }
+            }
+            if (pos != str.size())
+            {
+                return std::nullopt;
+            }
+
+            const std::int64_t days = date::sys_days{ymd}.time_since_epoch().count();
+            const std::int64_t minutes = (days * 24 + hour) * 60 + minute - offset_minutes;
+            return (minutes * 60 + second) * 1'000'000 + microseconds;
+        }
+
+        std::string_view trim_right(std::string_view str)
+        {
+            const auto end = str.find_last_not_of(" \t\r\n");
+            return end == std::string_view::npos ? std::string_view{} : str.substr(0, end + 1);
+        }
+
+        // Schema inference
+        // ================
+
+        ndjson_type value_type(ondemand::value& value)
+        {
+            const ondemand::json_type type = value.type();
+            switch (type)
+            {
+                case ondemand::json_type::array:
+                    return ndjson_type::list;
+                case ondemand::json_type::object:
+                    return ndjson_type::structure;
+                case ondemand::json_type::number:
+                {
+                    // Unsigned integers are beyond the int64 range
+                    const ondemand::number_type number_type = value.get_number_type();
+                    return number_type == ondemand::number_type::signed_integer ? ndjson_type::int64
+                                                                                : ndjson_type::float64;
+                }
+                case ondemand::json_type::string:
+                {
+                    const std::string_view str = value.get_string();
+                    return parse_timestamp(str).has_value() ? ndjson_type::timestamp : ndjson_type::string;
+                }
+                case ondemand::json_type::boolean:
+                    return ndjson_type::boolean;
+                default:
+                    return ndjson_type::null;
+            }
+        }
+
+        ndjson_type merge_types(ndjson_type current, ndjson_type observed)
+        {
+            if (current == ndjson_type::null || current == observed)
+            {
+                return observed;
+            }
+            const auto is_either = [&](ndjson_type lhs, ndjson_type rhs)
+            {
+                return (current == lhs && observed == rhs) || (current == rhs && observed == lhs);
+            };
+            if (is_either(ndjson_type::int64, ndjson_type::float64))
+            {
+                return ndjson_type::float64;
+            }
+            // Strings and other conflicts: the values are kept as text
+            return ndjson_type::string;
+        }
+
+        void infer_field(ndjson_field& field, ondemand::value value);
+
+        void infer_members(ndjson_field& field, ondemand::object object)
+        {
+            for (auto member : object)
+            {
+                const std::string_view key = member.unescaped_key();
+                auto child = std::ranges::find(field.children, key, &ndjson_field::name);
+                if (child == field.children.end())
+                {
+                    field.children.push_back(ndjson_field{std::string(key), ndjson_type::null, {}});
+                    child = std::prev(field.children.end());
+                }
+                infer_field(*child, member.value());
+            }
+        }
+
+        void infer_field(ndjson_field& field, ondemand::value value)
+        {
+            const ndjson_type observed = value_type(value);
+            if (observed == ndjson_type::null)
+            {
+                return;
+            }
+            const ndjson_type merged = merge_types(field.type, observed);
+            if (merged != field.type)
+            {
+                if (field.type != ndjson_type::null || merged == ndjson_type::string)
+                {
+                    field.children.clear();
+                }
+                field.type = merged;
+                if (merged == ndjson_type::list)
+                {
+                    field.children.push_back(ndjson_field{"item", ndjson_type::null, {}});
+                }
+            }
+            if (observed == ndjson_type::list && field.type == ndjson_type::list)
+            {
+                for (auto element : value.get_array())
+                {
+                    infer_field(field.children.front(), element.value());
+                }
+            }
+            else if (observed == ndjson_type::structure && field.type == ndjson_type::structure)
+            {
+                infer_members(field, value.get_object());
+            }
+        }
+
+        std::vector<ndjson_field> infer_schema(std::string_view text, const char* padded_end, std::size_t max_rows)
+        {
+            ndjson_field root{"", ndjson_type::structure, {}};
+            ondemand::parser parser;
+            std::size_t row_count = 0;
+            for_each_row(
+                text,
+                1,
+                [&](std::string_view line, std::size_t line_number)
+                {
+                    if (row_count == max_rows)
+                    {
+                        return false;
+                    }
+                    with_line_number(
+                        line_number,
+                        [&]()
+                        {
+                            ondemand::document document = iterate_row(parser, line, padded_end);
+                            infer_members(root, document.get_object());
+                        }
+                    );
+                    ++row_count;
+                    return true;
+                }
+            );
+            return std::move(root.children);
+        }
+
+        // Column builders
+        // ===============
+
+        const date::time_zone* utc_zone()
+        {
+            static const date::time_zone* zone = date::locate_zone("UTC");
+            return zone;
+        }
+
+        std::int32_t to_offset(std::size_t size)
+        {
+            if (size > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+            {
+                throw std::runtime_error("Column data exceeds the 32-bit offsets of a batch, reduce batch_size");
+            }
+            return static_cast<std::int32_t>(size);
+        }
+
+        /**
+         * Accumulates the values of a field in the buffers of its array. A builder only
+         * uses the buffers of its type: the integers hold the int64 and timestamp values,
+         * the offsets those of the strings and lists.
+         */
+        class column_builder
+        {
+        public:
+
+            explicit column_builder(const ndjson_field& field)
+                : m_field(&field)
+                , m_validity(validity_bitmap::default_allocator())
+                , m_integers(0)
+                , m_doubles(0)
+                , m_chars(0)
+                , m_offsets(0)
+            {
+                if (field.type == ndjson_type::string || field.type == ndjson_type::list)
+                {
+                    m_offsets.push_back(0);
+                }
+                m_children.reserve(field.children.size());
+                for (std::size_t i = 0; i < field.children.size(); ++i)
+                {
+                    m_children.emplace_back(field.children[i]);
+                    m_child_index.emplace(field.children[i].name, i);
+                }
+                m_seen.resize(field.children.size());
+            }
+
+            void append(ondemand::value value)
+            {
+                if (value.is_null())
+                {
+                    append_null();
+                    return;
+                }
+                switch (m_field->type)
+                {
+                    case ndjson_type::null:
+                        throw std::runtime_error("Value of the null field '" + m_field->name + "'");
+                    case ndjson_type::boolean:
+                    {
+                        const bool element = value.get_bool();
+                        m_booleans.push_back(element);
+                        break;
+                    }
+                    case ndjson_type::int64:
+                    {
+                        const std::int64_t element = value.get_int64();
+                        m_integers.push_back(element);
+                        break;
+                    }
+                    case ndjson_type::float64:
+                    {
+                        const double element = value.get_double();
+                        m_doubles.push_back(element);
+                        break;
+                    }
+                    case ndjson_type::string:
+                        append_text(value);
+                        break;
+                    case ndjson_type::timestamp:
+                    {
+                        const std::string_view str = value.get_string();
+                        const std::optional<std::int64_t> timestamp = parse_timestamp(str);
+                        if (!timestamp.has_value())
+                        {
+                            throw std::runtime_error("Invalid timestamp: " + std::string(str));
+                        }
+                        m_integers.push_back(*timestamp);
+                        break;
+                    }
+                    case ndjson_type::list:
+                    {
+                        column_builder& items = m_children.front();
+                        for (auto element : value.get_array())
+                        {
+                            items.append(element.value());
+                        }
+                        m_offsets.push_back(to_offset(items.m_size));
+                        break;
+                    }
+                    case ndjson_type::structure:
+                        append_members(value.get_object());
+                        break;
+                }
+                m_validity.push_back(true);
+                ++m_size;
+            }
+
+            void append_null()
+            {
+                switch (m_field->type)
+                {
+                    case ndjson_type::null:
+                        break;
+                    case ndjson_type::boolean:
+                        m_booleans.push_back(false);
+                        break;
+                    case ndjson_type::int64:
+                    case ndjson_type::timestamp:
+                        m_integers.push_back(0);
+                        break;
+                    case ndjson_type::float64:
+                        m_doubles.push_back(0.);
+                        break;
+                    case ndjson_type::string:
+                    case ndjson_type::list:
+                        m_offsets.push_back(m_offsets.back());
+                        break;
+                    case ndjson_type::structure:
+                        for (auto& child : m_children)
+                        {
+                            child.append_null();
+                        }
+                        break;
+                }
+                m_validity.push_back(false);
+                ++m_size;
+            }
+
+            // Appends a row, whose members are the values of the children
+            void append_row(ondemand::object object)
+            {
+                append_members(object);
+                m_validity.push_back(true);
+                ++m_size;
+            }
+
+            // Appends the values of a builder of the same field
+            void append(column_builder&& other)
+            {
+                m_validity.insert(m_validity.cend(), other.m_validity.cbegin(), other.m_validity.cend());
+                switch (m_field->type)
+                {
+                    case ndjson_type::null:
+                        break;
+                    case ndjson_type::boolean:
+                        m_booleans.insert(m_booleans.end(), other.m_booleans.begin(), other.m_booleans.end());
+                        break;
+                    case ndjson_type::int64:
+                    case ndjson_type::timestamp:
+                        m_integers.insert(m_integers.cend(), other.m_integers.cbegin(), other.m_integers.cend());
+                        break;
+                    case ndjson_type::float64:
+                        m_doubles.insert(m_doubles.cend(), other.m_doubles.cbegin(), other.m_doubles.cend());
+                        break;
+                    case ndjson_type::string:
+                        append_offsets(other.m_offsets, m_chars.size());
+                        m_chars.insert(m_chars.cend(), other.m_chars.cbegin(), other.m_chars.cend());
+                        break;
+                    case ndjson_type::list:
+                        append_offsets(other.m_offsets, m_children.front().m_size);
+                        m_children.front().append(std::move(other.m_children.front()));
+                        break;
+                    case ndjson_type::structure:
+                        for (std::size_t i = 0; i < m_children.size(); ++i)
+                        {
+                            m_children[i].append(std::move(other.m_children[i]));
+                        }
+                        break;
+                }
+                m_size += other.m_size;
+            }
+
+            sparrow::array finish()
+            {
+                const std::string& name = m_field->name;
+                switch (m_field->type)
+                {
+                    case ndjson_type::null:
+                        return sparrow::array{sparrow::null_array{m_size, name}};
+                    case ndjson_type::boolean:
+                        return sparrow::array{
+                            sparrow::primitive_array<bool>{std::move(m_booleans), std::move(m_validity), name}
+                        };
+                    case ndjson_type::int64:
+                        return sparrow::array{sparrow::primitive_array<std::int64_t>{
+                            std::move(m_integers),
+                            m_size,
+                            std::move(m_validity),
+                            name
+                        }};
+                    case ndjson_type::float64:
+                        return sparrow::array{
+                            sparrow::primitive_array<double>{std::move(m_doubles), m_size, std::move(m_validity), name}
+                        };
+                    case ndjson_type::string:
+                        return sparrow::array{
+                            sparrow::string_array{std::move(m_chars), std::move(m_offsets), std::move(m_validity), name}
+                        };
+                    case ndjson_type::timestamp:
+                        return sparrow::array{sparrow::timestamp_microseconds_array{
+                            utc_zone(),
+                            std::move(m_integers),
+                            std::move(m_validity),
+                            name
+                        }};
+                    case ndjson_type::list:
+                        return sparrow::array{sparrow::list_array{
+                            m_children.front().finish(),
+                            std::move(m_offsets),
+                            std::move(m_validity),
+                            name
+                        }};
+                    case ndjson_type::structure:
+                        return sparrow::array{
+                            sparrow::struct_array{finish_children(), std::move(m_validity), name}
+                        };
+                }
+                throw std::runtime_error("Invalid NDJSON type");
+            }
+
+            std::vector<sparrow::array> finish_children()
+            {
+                std::vector<sparrow::array> arrays;
+                arrays.reserve(m_children.size());
+                for (auto& child : m_children)
+                {
+                    arrays.push_back(child.finish());
+                }
+                return arrays;
+            }
+
+        private:
+
+            void append_members(ondemand::object object)
+            {
+                std::fill(m_seen.begin(), m_seen.end(), false);
+                for (auto member : object)
+                {
+                    const std::string_view key = member.unescaped_key();
+                    const auto it = m_child_index.find(key);
+                    // Members missing from the schema are ignored, duplicates keep the first value
+                    if (it == m_child_index.end() || m_seen[it->second])
+                    {
+                        continue;
+                    }
+                    m_seen[it->second] = true;
+                    m_children[it->second].append(member.value());
+                }
+                for (std::size_t i = 0; i < m_children.size(); ++i)
+                {
+                    if (!m_seen[i])
+                    {
+                        m_children[i].append_null();
+                    }
+                }
+            }
+
+            // The values that are not strings are kept as their JSON text
+            void append_text(ondemand::value& value)
+            {
+                const ondemand::json_type type = value.type();
+                std::string_view text;
+                if (type == ondemand::json_type::string)
+                {
+                    text = value.get_string();
+                }
+                else
+                {
+                    const std::string_view raw = value.raw_json();
+                    text = trim_right(raw);
+                }
+                m_chars.insert(m_chars.cend(), text.begin(), text.end());
+                m_offsets.push_back(to_offset(m_chars.size()));
+            }
+
+            void append_offsets(const u8_buffer<std::int32_t>& offsets, std::size_t base)
+            {
+                for (std::size_t i = 1; i < offsets.size(); ++i)
+                {
+                    m_offsets.push_back(to_offset(base + static_cast<std::size_t>(offsets[i])));
+                }
+            }
+
+            const ndjson_field* m_field;
+            std::size_t m_size = 0;
+            validity_bitmap m_validity;
+            std::vector<bool> m_booleans;
+            u8_buffer<std::int64_t> m_integers;
+            u8_buffer<double> m_doubles;
+            u8_buffer<char> m_chars;
+            u8_buffer<std::int32_t> m_offsets;
+            std::vector<column_builder> m_children;
+            std::unordered_map<std::string_view, std::size_t> m_child_index;
+            // Members found in the current object
+            std::vector<bool> m_seen;
+        };
+
+        // Reading
+        // =======
+
+        // Consecutive rows of the same batch, parsed by a single task
+        struct row_block
+        {
+            std::size_t begin;
+            std::size_t end;
+            std::size_t first_line;
+            std::size_t batch;
+        };
+
+        std::vector<row_block>
+        split_blocks(std::string_view text, std::size_t block_size, std::size_t batch_size, std::size_t& row_count)
+        {
+            std::vector<row_block> blocks;
+            std::size_t block_rows = 0;
+            row_count = 0;
+            for_each_row(
+                text,
+                1,
+                [&](std::string_view line, std::size_t line_number)
+                {
+                    const auto offset = static_cast<std::size_t>(line.data() - text.data());
+                    if (block_rows == block_size || row_count % batch_size == 0)
+                    {
+                        blocks.push_back({offset, offset, line_number, row_count / batch_size});
+                        block_rows = 0;
+                    }
+                    blocks.back().end = offset + line.size();
+                    ++block_rows;
+                    ++row_count;
+                    return true;
+                }
+            );
+            return blocks;
+        }
+
+        void parse_block(std::string_view text, const char* padded_end, const row_block& block, column_builder& builder)
+        {
+            ondemand::parser parser;
+            for_each_row(
+                text.substr(block.begin, block.end - block.begin),
+                block.first_line,
+                [&](std::string_view line, std::size_t line_number)
+                {
+                    with_line_number(
+                        line_number,
+                        [&]()
+                        {
+                            ondemand::document document = iterate_row(parser, line, padded_end);
+                            builder.append_row(document.get_object());
+                            if (!document.at_end())
+                            {
+                                throw std::runtime_error("Unexpected content after the row");
+                            }
+                        }
+                    );
+                    return true;
+                }
+            );
+        }
+
+        std::vector<sparrow::record_batch>
+        read_rows(simdjson::padded_string_view ndjson, const ndjson_read_options& options)
+        {
+            if (options.batch_size == 0 || options.block_size == 0)
+            {
+                throw std::invalid_argument("batch_size and block_size must be positive");
+            }
+            const std::string_view text(ndjson.data(), ndjson.size());
+            const char* padded_end = ndjson.data() + ndjson.size() + simdjson::SIMDJSON_PADDING;
+
+            ndjson_field root{"", ndjson_type::structure, {}};
+            root.children = options.schema.has_value() ? *options.schema
+                                                       : infer_schema(text, padded_end, options.inference_rows);
+
+            std::size_t row_count = 0;
+            const std::vector<row_block> blocks = split_blocks(text, options.block_size, options.batch_size, row_count);
+            if (blocks.empty())
+            {
+                return {};
+            }
+
+            std::size_t max_tasks = parallel_task_count(blocks.size(), 1);
+            if (options.max_threads != 0)
+            {
+                max_tasks = std::min(max_tasks, options.max_threads);
+            }
+
+            std::vector<column_builder> builders;
+            builders.reserve(blocks.size());
+            for (std::size_t i = 0; i < blocks.size(); ++i)
+            {
+                builders.emplace_back(root);
+            }
+            parallel_for(
+                blocks.size(),
+                [&](std::size_t i)
+                {
+                    parse_block(text, padded_end, blocks[i], builders[i]);
+                },
+                max_tasks
+            );
+
+            // The blocks of a batch are concatenated into the builder of its first block
+            const std::size_t batch_count = blocks.back().batch + 1;
+            std::vector<std::size_t> first_blocks(batch_count + 1, blocks.size());
+            for (std::size_t i = blocks.size(); i-- > 0;)
+            {
+                first_blocks[blocks[i].batch] = i;
+            }
+
+            std::vector<std::string> names;
+            names.reserve(root.children.size());
+            for (const auto& field : root.children)
+            {
+                names.push_back(field.name);
+            }
+            std::vector<sparrow::record_batch> batches(batch_count);
+            parallel_for(
+                batch_count,
+                [&](std::size_t batch)
+                {
+                    column_builder& builder = builders[first_blocks[batch]];
+                    for (std::size_t i = first_blocks[batch] + 1; i < first_blocks[batch + 1]; ++i)
+                    {
+                        builder.append(std::move(builders[i]));
+                    }
+                    batches[batch] = sparrow::record_batch{names, builder.finish_children()};
+                },
+                max_tasks
+            );
+            return batches;
+        }
+    }
+
+    std::vector<ndjson_field> infer_ndjson_schema(std::string_view ndjson, std::size_t max_rows)
+    {
+        // Only the rows used for the inference are copied to a padded buffer
+        std::size_t end = 0;
+        std::size_t row_count = 0;
+        for_each_row(
+            ndjson,
+            1,
+            [&](std::string_view line, std::size_t)
+            {
+                if (row_count == max_rows)
+                {
+                    return false;
+                }
+                end = static_cast<std::size_t>(line.data() - ndjson.data()) + line.size();
+                ++row_count;
+                return true;
+            }
+        );
+        const simdjson::padded_string padded(ndjson.substr(0, end));
+        return infer_schema(
+            std::string_view(padded.data(), padded.size()),
+            padded.data() + padded.size() + simdjson::SIMDJSON_PADDING,
+            max_rows
+        );
+    }
+
+    std::vector<sparrow::record_batch> read_ndjson(std::string_view ndjson, const ndjson_read_options& options)
+    {
+        const simdjson::padded_string padded(ndjson);
+        return read_rows(padded, options);
+    }
+
+    std::vector<sparrow::record_batch>
+    read_ndjson_file(const std::filesystem::path& path, const ndjson_read_options& options)
+    {
+        simdjson::padded_string ndjson;
+        if (simdjson::padded_string::load(path.string()).get(ndjson) != simdjson::SUCCESS)
+        {
+            throw std::runtime_error("Could not open file: " + path.string());
+        }
+        return read_rows(ndjson, options);
+    }
+}
@@ -0,0 +1,544 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/json_reader/streaming_parser.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <simdjson.h>
+
+#include <sparrow/layout/array_access.hpp>
+#include <sparrow/primitive_array.hpp>
+#include <sparrow/u8_buffer.hpp>
+#include <sparrow/variable_size_binary_array.hpp>
+
+#include "sparrow/json_reader/constant.hpp"
+#include "sparrow/json_reader/json_parser.hpp"
+#include "sparrow/json_reader/utils.hpp"
+
+namespace sparrow::json_reader
+{
+    namespace
+    {
+        namespace ondemand = simdjson::ondemand;
+
+        // Calls func(index, value) for each value of the array member \p key of \p column,
+        // which must hold exactly \p count values
+        template <class F>
+        void for_each_value(ondemand::object& column, std::string_view key, std::size_t count, F&& func)
+        {
+            auto values = column.find_field_unordered(key);
+            if (values.error() == simdjson::NO_SUCH_FIELD)
+            {
+                throw std::runtime_error(std::string(key) + " not found in array");
+            }
+            std::size_t index = 0;
+            for (auto element : values.get_array())
+            {
+                if (index == count)
+                {
+                    throw std::runtime_error("Too many values in " + std::string(key));
+                }
+                ondemand::value value = element.value();
+                func(index, value);
+                ++index;
+            }
+            if (index != count)
+            {
+                throw std::runtime_error("Missing values in " + std::string(key));
+            }
+        }
+
+        template <std::integral T>
+        T get_integer(ondemand::value& value)
+        {
+            const ondemand::json_type type = value.type();
+            if (type == ondemand::json_type::string)
+            {
+                // 64-bit integers are written as strings
+                const std::string_view str = value.get_string();
+                T result{};
+                const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+                if (ec != std::errc{} || ptr != str.data() + str.size())
+                {
+                    throw std::runtime_error("Invalid integer value: " + std::string(str));
+                }
+                return result;
+            }
+            if constexpr (std::is_signed_v<T>)
+            {
+                const std::int64_t result = value.get_int64();
+                return static_cast<T>(result);
+            }
+            else
+            {
+                const std::uint64_t result = value.get_uint64();
+                return static_cast<T>(result);
+            }
+        }
+
+        template <std::floating_point T>
+        T get_floating_point(ondemand::value& value)
+        {
+            const double result = value.get_double();
+            return static_cast<T>(result);
+        }
+
+        void append_hex(std::string_view hex, u8_buffer<char>& data)
+        {
+            if (hex.size() % 2 != 0)
+            {
+                throw std::runtime_error("Invalid hexadecimal value: " + std::string(hex));
+            }
+            for (std::size_t i = 0; i < hex.size(); i += 2)
+            {
+                unsigned char byte = 0;
+                const auto [ptr, ec] = std::from_chars(hex.data() + i, hex.data() + i + 2, byte, 16);
+                if (ec != std::errc{} || ptr != hex.data() + i + 2)
+                {
+                    throw std::runtime_error("Invalid hexadecimal value: " + std::string(hex));
+                }
+                data.push_back(static_cast<char>(byte));
+            }
+        }
+
+        struct column_description
+        {
+            std::string name;
+            std::optional<std::vector<sparrow::metadata_pair>> metadata;
+            std::size_t count;
+            // std::nullopt for the non nullable columns
+            std::optional<validity_bitmap> validity;
+
+            [[nodiscard]] bool is_valid(std::size_t i) const
+            {
+                return !validity.has_value() || validity->test(i);
+            }
+        };
+
+        column_description describe_column(ondemand::object& column, const nlohmann::json& schema)
+        {
+            const std::uint64_t count = column["count"].get_uint64();
+            column_description description{
+                schema.at("name").get<std::string>(),
+                utils::get_metadata(schema),
+                static_cast<std::size_t>(count),
+                std::nullopt
+            };
+            if (schema.at("nullable").get<bool>())
+            {
+                auto& validity = description.validity.emplace(
+                    description.count,
+                    true,
+                    validity_bitmap::default_allocator{}
+                );
+                for_each_value(
+                    column,
+                    VALIDITY,
+                    description.count,
+                    [&validity](std::size_t i, ondemand::value& value)
+                    {
+                        const std::int64_t is_valid = value.get_int64();
+                        if (is_valid == 0)
+                        {
+                            validity.set(i, false);
+                        }
+                    }
+                );
+            }
+            return description;
+        }
+
+        // The null values are zeroed, as done by the DOM parsers
+        template <class T, class F>
+        sparrow::array read_primitive_column(ondemand::object& column, const nlohmann::json& schema, F get_value)
+        {
+            column_description description = describe_column(column, schema);
+            u8_buffer<T> data(description.count);
+            for_each_value(
+                column,
+                DATA,
+                description.count,
+                [&](std::size_t i, ondemand::value& value)
+                {
+                    const T element = get_value(value);
+                    data[i] = description.is_valid(i) ? element : T{};
+                }
+            );
+            if (description.validity.has_value())
+            {
+                return sparrow::array{sparrow::primitive_array<T>{
+                    std::move(data),
+                    description.count,
+                    std::move(*description.validity),
+                    description.name,
+                    std::move(description.metadata)
+                }};
+            }
+            return sparrow::array{sparrow::primitive_array<T>{
+                std::move(data),
+                description.count,
+                false,
+                description.name,
+                std::move(description.metadata)
+            }};
+        }
+
+        sparrow::array read_bool_column(ondemand::object& column, const nlohmann::json& schema)
+        {
+            column_description description = describe_column(column, schema);
+            std::vector<bool> data(description.count);
+            for_each_value(
+                column,
+                DATA,
+                description.count,
+                [&](std::size_t i, ondemand::value& value)
+                {
+                    const bool element = value.get_bool();
+                    data[i] = element && description.is_valid(i);
+                }
+            );
+            if (description.validity.has_value())
+            {
+                return sparrow::array{sparrow::primitive_array<bool>{
+                    std::move(data),
+                    std::move(*description.validity),
+                    description.name,
+                    std::move(description.metadata)
+                }};
+            }
+            return sparrow::array{
+                sparrow::primitive_array<bool>{std::move(data), false, description.name, std::move(description.metadata)}
+            };
+        }
+
+        // Strings are copied as is, binary values are hexadecimal strings
+        template <class A, bool is_hex>
+        sparrow::array read_binary_column(ondemand::object& column, const nlohmann::json& schema)
+        {
+            using offset_buffer_type = typename A::offset_buffer_type;
+            using offset_type = typename offset_buffer_type::value_type;
+
+            column_description description = describe_column(column, schema);
+            offset_buffer_type offsets(description.count + 1);
+            u8_buffer<char> data(0);
+            offsets[0] = 0;
+            for_each_value(
+                column,
+                DATA,
+                description.count,
+                [&](std::size_t i, ondemand::value& value)
+                {
+                    const std::string_view str = value.get_string();
+                    if (description.is_valid(i))
+                    {
+                        if constexpr (is_hex)
+                        {
+                            append_hex(str, data);
+                        }
+                        else
+                        {
+                            data.insert(data.cend(), str.begin(), str.end());
+                        }
+                    }
+                    offsets[i + 1] = static_cast<offset_type>(data.size());
+                }
+            );
+            const bool nullable = description.validity.has_value();
+            sparrow::array result{A{
+                std::move(data),
+                std::move(offsets),
+                nullable ? std::move(*description.validity)
+                         : validity_bitmap(description.count, true, validity_bitmap::default_allocator{}),
+                description.name,
+                std::move(description.metadata)
+            }};
+            if (!nullable)
+            {
+                detail::array_access::get_arrow_proxy(result).set_flags({});
+            }
+            return result;
+        }
+
+        template <class F>
+        sparrow::array dispatch_integer(const nlohmann::json& type, F&& read)
+        {
+            const bool is_signed = type.at("isSigned").get<bool>();
+            switch (type.at("bitWidth").get<std::size_t>())
+            {
+                case 8:
+                    return is_signed ? read.template operator()<std::int8_t>()
+                                     : read.template operator()<std::uint8_t>();
+                case 16:
+                    return is_signed ? read.template operator()<std::int16_t>()
+                                     : read.template operator()<std::uint16_t>();
+                case 32:
+                    return is_signed ? read.template operator()<std::int32_t>()
+                                     : read.template operator()<std::uint32_t>();
+                case 64:
+                    return is_signed ? read.template operator()<std::int64_t>()
+                                     : read.template operator()<std::uint64_t>();
+            }
+            throw std::runtime_error("Invalid bit width or signedness");
+        }
+
+        /**
+         * Builds the record batches of a document, given the raw JSON of its schema and of
+         * its dictionaries. The schema is small and is parsed with nlohmann; the dictionaries
+         * are only parsed if a column needs them.
+         */
+        class batch_reader
+        {
+        public:
+
+            batch_reader(std::string_view schema_json, std::string_view dictionaries_json)
+                : m_schema(nlohmann::json::parse(schema_json))
+                , m_dictionaries_json(dictionaries_json)
+            {
+            }
+
+            sparrow::record_batch read(ondemand::object& batch)
+            {
+                // Fields by name, removed once used, as several columns may have the same name
+                std::vector<std::pair<std::string, const nlohmann::json*>> fields;
+                for (const auto& field : m_schema.at("fields"))
+                {
+                    fields.emplace_back(field.at("name").get<std::string>(), &field);
+                }
+
+                std::vector<std::string> names;
+                std::vector<sparrow::array> arrays;
+                for (auto element : batch["columns"].get_array())
+                {
+                    ondemand::object column = element.get_object();
+                    const std::string_view name_view = column["name"].get_string();
+                    std::string name(name_view);
+                    const auto field_it = std::ranges::find_if(
+                        fields,
+                        [&name](const auto& field)
+                        {
+                            return field.first == name;
+                        }
+                    );
+                    if (field_it == fields.end())
+                    {
+                        throw std::runtime_error("Column '" + name + "' not found in schema");
+                    }
+                    arrays.push_back(read_column(column, *field_it->second));
+                    names.push_back(std::move(name));
+                    fields.erase(field_it);
+                }
+                return make_record_batch(std::move(names), std::move(arrays));
+            }
+
+            // The batch of a document without batches: empty columns
+            sparrow::record_batch read_empty()
+            {
+                std::vector<std::string> names;
+                std::vector<sparrow::array> arrays;
+                for (const auto& field : m_schema.at("fields"))
+                {
+                    nlohmann::json empty_column = nlohmann::json::object();
+                    empty_column["name"] = field.at("name");
+                    empty_column["count"] = 0;
+                    empty_column[DATA] = nlohmann::json::array();
+                    empty_column[VALIDITY] = nlohmann::json::array();
+                    arrays.push_back(build_array_from_json(empty_column, field, root()));
+                    names.push_back(field.at("name").get<std::string>());
+                }
+                return make_record_batch(std::move(names), std::move(arrays));
+            }
+
+        private:
+
+            sparrow::array read_column(ondemand::object& column, const nlohmann::json& schema)
+            {
+                const auto& type = schema.at("type");
+                const std::string type_name = type.at("name").get<std::string>();
+                if (!schema.contains("dictionary"))
+                {
+                    if (type_name == "int")
+                    {
+                        return dispatch_integer(
+                            type,
+                            [&]<class T>()
+                            {
+                                return read_primitive_column<T>(column, schema, get_integer<T>);
+                            }
+                        );
+                    }
+                    if (type_name == "floatingpoint")
+                    {
+                        const std::string precision = type.at("precision").get<std::string>();
+                        if (precision == "SINGLE")
+                        {
+                            return read_primitive_column<float>(column, schema, get_floating_point<float>);
+                        }
+                        if (precision == "DOUBLE")
+                        {
+                            return read_primitive_column<double>(column, schema, get_floating_point<double>);
+                        }
+                    }
+                    if (type_name == "bool")
+                    {
+                        return read_bool_column(column, schema);
+                    }
+                    if (type_name == "utf8")
+                    {
+                        return read_binary_column<sparrow::string_array, false>(column, schema);
+                    }
+                    if (type_name == "largeutf8")
+                    {
+                        return read_binary_column<sparrow::big_string_array, false>(column, schema);
+                    }
+                    if (type_name == "binary")
+                    {
+                        return read_binary_column<sparrow::binary_array, true>(column, schema);
+                    }
+                    if (type_name == "largebinary")
+                    {
+                        return read_binary_column<sparrow::big_binary_array, true>(column, schema);
+                    }
+                }
+                // The other columns are built by the DOM parsers, from the JSON of the column only
+                const std::string_view column_json = column.raw_json();
+                return build_array_from_json(nlohmann::json::parse(column_json), schema, root());
+            }
+
+            sparrow::record_batch make_record_batch(std::vector<std::string> names, std::vector<sparrow::array> arrays)
+            {
+                std::optional<std::vector<sparrow::metadata_pair>> metadata;
+                if (m_schema.contains("metadata"))
+                {
+                    metadata = utils::get_metadata(m_schema);
+                }
+                return sparrow::record_batch{names, std::move(arrays), "", std::move(metadata)};
+            }
+
+            // Document holding the schema and the dictionaries, as expected by the DOM parsers
+            const nlohmann::json& root()
+            {
+                if (!m_root.has_value())
+                {
+                    m_root = nlohmann::json::object();
+                    (*m_root)["schema"] = m_schema;
+                    (*m_root)["dictionaries"] = m_dictionaries_json.empty()
+                                                    ? nlohmann::json::array()
+                                                    : nlohmann::json::parse(m_dictionaries_json);
+                }
+                return *m_root;
+            }
+
+            nlohmann::json m_schema;
+            std::string_view m_dictionaries_json;
+            std::optional<nlohmann::json> m_root;
+        };
+
+        sparrow::record_batch read_record_batch(simdjson::padded_string_view json, size_t num_batches)
+        {
+            try
+            {
+                ondemand::parser parser;
+                std::string_view schema_json;
+                std::string_view dictionaries_json;
+                std::string_view batch_json;
+                std::size_t batch_count = 0;
+                {
+                    ondemand::document document = parser.iterate(json);
+                    for (auto member : document.get_object())
+                    {
+                        const std::string_view key = member.unescaped_key();
+                        if (key == "schema")
+                        {
+                            schema_json = member.value().raw_json();
+                        }
+                        else if (key == "batches")
+                        {
+                            // The batches other than the requested one are skipped without being parsed
+                            for (auto batch : member.value().get_array())
+                            {
+                                if (batch_count == num_batches)
+                                {
+                                    batch_json = batch.raw_json();
+                                }
+                                ++batch_count;
+                            }
+                        }
+                        else if (key == "dictionaries")
+                        {
+                            dictionaries_json = member.value().raw_json();
+                        }
+                    }
+                }
+                if (schema_json.empty())
+                {
+                    throw std::runtime_error("Schema not found");
+                }
+
+                // A document without batches has a single empty batch
+                const std::size_t available_batches = std::max<std::size_t>(batch_count, 1);
+                if (num_batches >= available_batches)
+                {
+                    throw std::runtime_error(
+                        "Invalid batch number: index " + std::to_string(num_batches) + " out of "
+                        + std::to_string(available_batches) + " batches"
+                    );
+                }
+                batch_reader reader(schema_json, dictionaries_json);
+                if (batch_count == 0)
+                {
+                    return reader.read_empty();
+                }
+
+                // The batch is parsed again once the schema is known. Its JSON lies in the
+                // padded document, whose padding is still available after it.
+                const std::size_t capacity = static_cast<std::size_t>(
+                    json.data() + json.capacity() - batch_json.data()
+                );
+                ondemand::document batch_document = parser.iterate(
+                    simdjson::padded_string_view(batch_json, capacity)
+                );
+                ondemand::object batch = batch_document.get_object();
+                return reader.read(batch);
+            }
+            catch (const simdjson::simdjson_error& e)
+            {
+                throw std::runtime_error(std::string("Invalid JSON document: ") + e.what());
+            }
+        }
+    }
+
+    sparrow::record_batch build_record_batch_from_json_file(const std::filesystem::path& path, size_t num_batches)
+    {
+        simdjson::padded_string json;
+        if (simdjson::padded_string::load(path.string()).get(json) != simdjson::SUCCESS)
+        {
+            throw std::runtime_error("Could not open file: " + path.string());
+        }
+        return read_record_batch(json, num_batches);
+    }
+
+    sparrow::record_batch build_record_batch_from_json_string(std::string_view json, size_t num_batches)
+    {
+        const simdjson::padded_string padded_json(json);
+        return read_record_batch(padded_json, num_batches);
+    }
+}
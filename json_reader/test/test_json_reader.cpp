@@ -14,21 +14,30 @@
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 
+#include <algorithm>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <optional>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <doctest/doctest.h>
 #include <nlohmann/json.hpp>
 
 #include <sparrow/array.hpp>
+#include <sparrow/ipc/reader.hpp>
+#include <sparrow/ipc/writer.hpp>
 #include <sparrow/json_reader/comparison.hpp>
 #include <sparrow/json_reader/json_parser.hpp>
+#include <sparrow/json_reader/ndjson_reader.hpp>
+#include <sparrow/json_reader/streaming_parser.hpp>
 #include <sparrow/json_reader/utils.hpp>
+#include <sparrow/primitive_array.hpp>
 #include <sparrow/record_batch.hpp>
 
 const std::filesystem::path json_files_path = JSON_FILES_PATH;
@@ -214,6 +223,32 @@ TEST_SUITE("json_reader_parser")
         }
     }
 
+    TEST_CASE("compare_arrays with an unknown null count")
+    {
+        const std::vector<std::int32_t> values{1, 2, 3, 4};
+        auto [array, schema] = sparrow::extract_arrow_structures(
+            sparrow::primitive_array<std::int32_t>(values, std::vector<std::size_t>{1, 3})
+        );
+        auto [array_from_json, schema_from_json] = sparrow::extract_arrow_structures(
+            sparrow::primitive_array<std::int32_t>(values, std::vector<std::size_t>{1, 3})
+        );
+        REQUIRE_EQ(array_from_json.null_count, 2);
+        array.null_count = -1;
+
+        const std::optional<std::string> result = sparrow::json_reader::compare_arrays(
+            "Array",
+            &array,
+            &array_from_json,
+            &schema_from_json
+        );
+        CHECK_FALSE(result.has_value());
+
+        array.release(&array);
+        schema.release(&schema);
+        array_from_json.release(&array_from_json);
+        schema_from_json.release(&schema_from_json);
+    }
+
     TEST_CASE("schema_roundtrip_comparison")
     {
         for (const auto& json_path : jsons_to_test)
@@ -258,6 +293,345 @@ TEST_SUITE("json_reader_parser")
             }
         }
     }
+
+    TEST_CASE("build_record_batch_from_json_file")
+    {
+        for (const auto& json_path : jsons_to_test)
+        {
+            SUBCASE(json_path.filename().string().c_str())
+            {
+                const auto json_data = load_json_file(json_path);
+                const size_t num_batches = std::max<size_t>(get_number_of_batches(json_path), 1);
+
+                for (size_t batch_idx = 0; batch_idx < num_batches; ++batch_idx)
+                {
+                    INFO("Processing batch " << batch_idx << " of " << num_batches);
+
+                    // The streaming parser builds the same batch as the DOM parsers
+                    auto expected = sparrow::json_reader::build_record_batch_from_json(json_data, batch_idx);
+                    auto record_batch = sparrow::json_reader::build_record_batch_from_json_file(json_path, batch_idx);
+                    CHECK_EQ(record_batch, expected);
+
+                    auto [expected_array, expected_schema] = sparrow::extract_arrow_structures(
+                        expected.extract_struct_array()
+                    );
+                    auto [array, schema] = sparrow::extract_arrow_structures(record_batch.extract_struct_array());
+                    const std::optional<std::string> result = sparrow::json_reader::compare_schemas(
+                        "Schema comparison",
+                        &schema,
+                        &expected_schema
+                    );
+                    if (result.has_value())
+                    {
+                        INFO("Schema comparison error: " << result.value());
+                        CHECK(!result.has_value());
+                    }
+                    expected_array.release(&expected_array);
+                    expected_schema.release(&expected_schema);
+                    array.release(&array);
+                    schema.release(&schema);
+                }
+                CHECK_THROWS_AS(
+                    std::ignore = sparrow::json_reader::build_record_batch_from_json_file(json_path, num_batches),
+                    std::runtime_error
+                );
+            }
+        }
+        CHECK_THROWS_AS(
+            std::ignore = sparrow::json_reader::build_record_batch_from_json_file(json_files_path / "missing.json", 0),
+            std::runtime_error
+        );
+    }
+
+    TEST_CASE("ipc_roundtrip")
+    {
+        using bytes_type = std::vector<std::uint8_t>;
+        auto to_bytes = [](const std::ostringstream& out)
+        {
+            const std::string str = out.str();
+            return std::make_shared<const bytes_type>(str.begin(), str.end());
+        };
+
+        for (const auto& json_path : jsons_to_test)
+        {
+            SUBCASE(json_path.filename().string().c_str())
+            {
+                const auto json_data = load_json_file(json_path);
+                const size_t num_batches = get_number_of_batches(json_path);
+                std::vector<sparrow::record_batch> batches;
+                for (size_t batch_idx = 0; batch_idx < num_batches; ++batch_idx)
+                {
+                    batches.push_back(sparrow::json_reader::build_record_batch_from_json(json_data, batch_idx));
+                }
+                // The schema is set up front, so that the files without batches keep it
+                const auto schema = sparrow::json_reader::build_record_batch_from_json(json_data, 0);
+
+                SUBCASE("stream")
+                {
+                    std::ostringstream out;
+                    sparrow::ipc::stream_writer writer(out);
+                    writer.write_schema(schema);
+                    for (const auto& batch : batches)
+                    {
+                        writer.write(batch);
+                    }
+                    writer.close();
+
+                    const auto bytes = to_bytes(out);
+                    sparrow::ipc::stream_reader reader(*bytes, bytes);
+                    for (size_t batch_idx = 0; batch_idx < num_batches; ++batch_idx)
+                    {
+                        INFO("Processing batch " << batch_idx << " of " << num_batches);
+                        const auto read = reader.next();
+                        REQUIRE(read.has_value());
+                        CHECK_EQ(*read, batches[batch_idx]);
+                    }
+                    CHECK_FALSE(reader.next().has_value());
+                    REQUIRE(reader.decoder().has_schema());
+                    CHECK_EQ(reader.decoder().fields().size(), schema.nb_columns());
+                }
+
+                SUBCASE("file")
+                {
+                    std::ostringstream out;
+                    sparrow::ipc::file_writer writer(out);
+                    writer.write_schema(schema);
+                    for (const auto& batch : batches)
+                    {
+                        writer.write(batch);
+                    }
+                    writer.close();
+
+                    const auto bytes = to_bytes(out);
+                    const sparrow::ipc::file_reader reader(*bytes, bytes);
+                    REQUIRE_EQ(reader.num_record_batches(), num_batches);
+                    // Read in reverse order, the file format allows random access
+                    for (size_t batch_idx = num_batches; batch_idx-- > 0;)
+                    {
+                        INFO("Processing batch " << batch_idx << " of " << num_batches);
+                        CHECK_EQ(reader.get_record_batch(batch_idx), batches[batch_idx]);
+                    }
+                    CHECK_EQ(reader.decoder().fields().size(), schema.nb_columns());
+                }
+            }
+        }
+    }
+
+    TEST_CASE("build_record_batch_from_json_string")
+    {
+        // The members may come in any order
+        const std::string json = R"({
+            "batches": [
+                {"count": 1, "columns": [
+                    {"name": "ints", "count": 1, "DATA": ["1"], "VALIDITY": [1]},
+                    {"name": "strings", "count": 1, "VALIDITY": [0], "DATA": ["ignored"], "OFFSET": [0, 7]}
+                ]},
+                {"columns": [
+                    {"DATA": ["9223372036854775807", "-2", "3"], "VALIDITY": [1, 0, 1], "count": 3, "name": "ints"},
+                    {"name": "strings", "count": 3, "VALIDITY": [1, 1, 0], "OFFSET": [0, 2, 5, 5], "DATA": ["\u00e9", "a\"b", ""]}
+                ], "count": 3}
+            ],
+            "schema": {"fields": [
+                {"name": "ints", "nullable": true, "type": {"name": "int", "isSigned": true, "bitWidth": 64}, "children": []},
+                {"name": "strings", "nullable": true, "type": {"name": "utf8"}, "children": []}
+            ]}
+        })";
+
+        const auto batch = sparrow::json_reader::build_record_batch_from_json_string(json, 1);
+        REQUIRE_EQ(batch.nb_rows(), 3);
+        const auto ints = batch.get_column("ints").visit(
+            [](const auto& column)
+            {
+                std::vector<std::optional<int64_t>> values;
+                if constexpr (std::is_same_v<std::decay_t<decltype(column)>, sparrow::primitive_array<int64_t>>)
+                {
+                    for (const auto& value : column)
+                    {
+                        values.push_back(value.has_value() ? std::make_optional(value.get()) : std::nullopt);
+                    }
+                }
+                return values;
+            }
+        );
+        const std::vector<std::optional<int64_t>> expected_ints = {INT64_MAX, std::nullopt, 3};
+        CHECK_EQ(ints, expected_ints);
+        const auto strings = batch.get_column("strings").visit(
+            [](const auto& column)
+            {
+                std::vector<std::optional<std::string>> values;
+                if constexpr (std::is_same_v<std::decay_t<decltype(column)>, sparrow::string_array>)
+                {
+                    for (const auto& value : column)
+                    {
+                        values.push_back(
+                            value.has_value() ? std::make_optional(std::string(value.get())) : std::nullopt
+                        );
+                    }
+                }
+                return values;
+            }
+        );
+        const std::vector<std::optional<std::string>> expected_strings = {"\xc3\xa9", "a\"b", std::nullopt};
+        CHECK_EQ(strings, expected_strings);
+
+        CHECK_THROWS_AS(
+            std::ignore = sparrow::json_reader::build_record_batch_from_json_string(json, 2),
+            std::runtime_error
+        );
+        CHECK_THROWS_AS(
+            std::ignore = sparrow::json_reader::build_record_batch_from_json_string(R"({"batches": [)", 0),
+            std::runtime_error
+        );
+    }
+}
+
+TEST_SUITE("ndjson_reader")
+{
+    using sparrow::json_reader::ndjson_field;
+    using sparrow::json_reader::ndjson_type;
+
+    template <class A, class T>
+    std::vector<std::optional<T>> column_values(const sparrow::array& column)
+    {
+        return column.visit(
+            [](const auto& typed_column)
+            {
+                std::vector<std::optional<T>> values;
+                if constexpr (std::is_same_v<std::decay_t<decltype(typed_column)>, A>)
+                {
+                    for (const auto& value : typed_column)
+                    {
+                        values.push_back(value.has_value() ? std::make_optional(T(value.get())) : std::nullopt);
+                    }
+                }
+                return values;
+            }
+        );
+    }
+
+    const std::string events = R"({"id": 1, "score": 0.5, "user": {"name": "ann", "tags": ["a", "b"]}, "at": "2024-03-01T12:30:00.250Z"}
+
+{"id": 2, "score": 3, "user": {"name": "bob", "tags": []}, "at": "2024-03-01 13:30:00+01:00", "extra": true}
+{"id": null, "user": null, "at": null, "extra": false}
+{"id": 4, "score": -1.25, "user": {"tags": ["c"]}, "at": "1970-01-01T00:00:00Z", "extra": null}
+)";
+
+    TEST_CASE("infer_ndjson_schema")
+    {
+        const std::vector<ndjson_field> expected = {
+            {"id", ndjson_type::int64, {}},
+            {"score", ndjson_type::float64, {}},
+            {"user",
+             ndjson_type::structure,
+             {{"name", ndjson_type::string, {}},
+              {"tags", ndjson_type::list, {{"item", ndjson_type::string, {}}}}}},
+            {"at", ndjson_type::timestamp, {}},
+            {"extra", ndjson_type::boolean, {}}
+        };
+        CHECK_EQ(sparrow::json_reader::infer_ndjson_schema(events), expected);
+
+        // Only the first row is sampled
+        const auto first_row = sparrow::json_reader::infer_ndjson_schema(events, 1);
+        REQUIRE_EQ(first_row.size(), 4);
+        CHECK_EQ(first_row[1].type, ndjson_type::float64);
+
+        // Conflicting values are kept as text
+        const auto mixed = sparrow::json_reader::infer_ndjson_schema("{\"a\": 1}\n{\"a\": \"x\"}\n{\"a\": null}");
+        REQUIRE_EQ(mixed.size(), 1);
+        CHECK_EQ(mixed[0].type, ndjson_type::string);
+
+        CHECK_THROWS_AS(std::ignore = sparrow::json_reader::infer_ndjson_schema("[1, 2]"), std::runtime_error);
+    }
+
+    TEST_CASE("read_ndjson")
+    {
+        for (const std::size_t block_size : {1, 2, 8192})
+        {
+            SUBCASE(("block_size " + std::to_string(block_size)).c_str())
+            {
+                sparrow::json_reader::ndjson_read_options options;
+                options.batch_size = 3;
+                options.block_size = block_size;
+                const auto batches = sparrow::json_reader::read_ndjson(events, options);
+                REQUIRE_EQ(batches.size(), 2);
+                CHECK_EQ(batches[0].nb_rows(), 3);
+                CHECK_EQ(batches[1].nb_rows(), 1);
+
+                const std::vector<std::optional<int64_t>> expected_ids = {1, 2, std::nullopt};
+                CHECK_EQ(
+                    (column_values<sparrow::primitive_array<int64_t>, int64_t>(batches[0].get_column("id"))),
+                    expected_ids
+                );
+                const std::vector<std::optional<double>> expected_scores = {0.5, 3., std::nullopt};
+                CHECK_EQ(
+                    (column_values<sparrow::primitive_array<double>, double>(batches[0].get_column("score"))),
+                    expected_scores
+                );
+                const std::vector<std::optional<bool>> expected_extras = {std::nullopt, true, false};
+                CHECK_EQ(
+                    (column_values<sparrow::primitive_array<bool>, bool>(batches[0].get_column("extra"))),
+                    expected_extras
+                );
+
+                const auto timestamps = batches[0].get_column("at").visit(
+                    [](const auto& column)
+                    {
+                        std::vector<std::optional<int64_t>> values;
+                        if constexpr (std::is_same_v<std::decay_t<decltype(column)>, sparrow::timestamp_microseconds_array>)
+                        {
+                            for (const auto& value : column)
+                            {
+                                values.push_back(
+                                    value.has_value()
+                                        ? std::make_optional(value.get().get_sys_time().time_since_epoch().count())
+                                        : std::nullopt
+                                );
+                            }
+                        }
+                        return values;
+                    }
+                );
+                const std::vector<std::optional<int64_t>> expected_timestamps = {
+                    1709296200250000,
+                    1709296200000000,
+                    std::nullopt
+                };
+                CHECK_EQ(timestamps, expected_timestamps);
+
+                const auto& user = batches[0].get_column("user");
+                CHECK_EQ(user.data_type(), sparrow::data_type::STRUCT);
+                CHECK_EQ(user.size(), 3);
+                CHECK(user[0].has_value());
+                CHECK_FALSE(user[2].has_value());
+
+                const std::vector<std::optional<double>> expected_last_score = {-1.25};
+                CHECK_EQ(
+                    (column_values<sparrow::primitive_array<double>, double>(batches[1].get_column("score"))),
+                    expected_last_score
+                );
+                CHECK_EQ(batches[1].get_column("user").data_type(), sparrow::data_type::STRUCT);
+            }
+        }
+    }
+
+    TEST_CASE("read_ndjson with a schema")
+    {
+        sparrow::json_reader::ndjson_read_options options;
+        options.schema = std::vector<ndjson_field>{{"id", ndjson_type::string, {}}};
+        const auto batches = sparrow::json_reader::read_ndjson(events, options);
+        REQUIRE_EQ(batches.size(), 1);
+        REQUIRE_EQ(batches[0].nb_columns(), 1);
+        const std::vector<std::optional<std::string>> expected = {"1", "2", std::nullopt, "4"};
+        CHECK_EQ((column_values<sparrow::string_array, std::string>(batches[0].get_column("id"))), expected);
+
+        options.schema = std::vector<ndjson_field>{{"id", ndjson_type::boolean, {}}};
+        CHECK_THROWS_WITH_AS(
+            std::ignore = sparrow::json_reader::read_ndjson(events, options),
+            doctest::Contains("NDJSON line 1"),
+            std::runtime_error
+        );
+        CHECK(sparrow::json_reader::read_ndjson("\n  \n").empty());
+    }
 }
 
 TEST_SUITE("json_reader_utils")
@@ -14,6 +14,10 @@
 
 #include "sparrow/array.hpp"
 
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
 #include "sparrow/arrow_interface/arrow_array.hpp"
 #include "sparrow/arrow_interface/arrow_array_schema_proxy.hpp"
 #include "sparrow/arrow_interface/arrow_schema.hpp"
@@ -146,6 +150,11 @@ namespace sparrow
         return {get_arrow_proxy().slice_view(start, end)};
     }
 
+    array array::compact() const
+    {
+        return {get_arrow_proxy().compact()};
+    }
+
     arrow_proxy& array::get_arrow_proxy()
     {
         return p_array->get_arrow_proxy();
@@ -156,6 +165,57 @@ namespace sparrow
         return p_array->get_arrow_proxy();
     }
 
+    namespace
+    {
+        bool same_layout(const ArrowSchema& lhs, const ArrowSchema& rhs)
+        {
+            if (std::string_view(lhs.format) != std::string_view(rhs.format) || lhs.n_children != rhs.n_children
+                || (lhs.dictionary == nullptr) != (rhs.dictionary == nullptr))
+            {
+                return false;
+            }
+            for (int64_t i = 0; i < lhs.n_children; ++i)
+            {
+                if (!same_layout(*lhs.children[i], *rhs.children[i]))
+                {
+                    return false;
+                }
+            }
+            return lhs.dictionary == nullptr || same_layout(*lhs.dictionary, *rhs.dictionary);
+        }
+    }
+
+    array concatenate(std::span<const array* const> arrays)
+    {
+        if (arrays.empty())
+        {
+            throw std::invalid_argument("Cannot concatenate an empty range of arrays");
+        }
+        const ArrowSchema& schema = *get_arrow_schema(*arrays.front());
+        std::vector<const ArrowArray*> arrow_arrays;
+        arrow_arrays.reserve(arrays.size());
+        for (const array* arr : arrays)
+        {
+            if (!same_layout(schema, *get_arrow_schema(*arr)))
+            {
+                throw std::invalid_argument("Cannot concatenate arrays of different data types");
+            }
+            arrow_arrays.push_back(get_arrow_array(*arr));
+        }
+        return array(concatenate_arrays(arrow_arrays, schema), copy_schema(schema));
+    }
+
+    array concatenate(std::span<const array> arrays)
+    {
+        std::vector<const array*> pointers;
+        pointers.reserve(arrays.size());
+        for (const auto& arr : arrays)
+        {
+            pointers.push_back(&arr);
+        }
+        return concatenate(std::span<const array* const>(pointers));
+    }
+
     bool operator==(const array& lhs, const array& rhs)
     {
         return lhs.visit(
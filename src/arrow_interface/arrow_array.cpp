@@ -14,13 +14,44 @@
 
 #include "sparrow/arrow_interface/arrow_array.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include "sparrow/arrow_interface/arrow_array_schema_common_release.hpp"
+#include "sparrow/arrow_interface/arrow_array_schema_info_utils.hpp"
+#include "sparrow/buffer/dynamic_bitset/null_count_policy.hpp"
 #include "sparrow/layout/fixed_width_binary_array_utils.hpp"
 #include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/parallel.hpp"
 #include "sparrow/utils/repeat_container.hpp"
 
 namespace sparrow
 {
+    namespace
+    {
+        std::atomic<std::uint64_t> buffers_sharing_epoch_counter = 1;
+    }
+
+    std::uint64_t buffers_sharing_epoch() noexcept
+    {
+        return buffers_sharing_epoch_counter.load(std::memory_order_acquire);
+    }
+
+    void increase_buffers_sharing_epoch() noexcept
+    {
+        buffers_sharing_epoch_counter.fetch_add(1, std::memory_order_acq_rel);
+    }
+
     void release_arrow_array(ArrowArray* array)
     {
         SPARROW_ASSERT_FALSE(array == nullptr)
@@ -196,54 +227,1373 @@ namespace sparrow
         std::swap(lhs.private_data, rhs.private_data);
     }
 
+    namespace
+    {
+        // A range of a buffer whose copy is deferred by parallel_copy_array
+        struct copy_chunk
+        {
+            const std::uint8_t* source;
+            std::uint8_t* target;
+            std::size_t size;
+        };
+
+        // Large buffers are split, so that their copy is spread over several threads
+        constexpr std::size_t copy_chunk_size = std::size_t(1) << 20;
+
+        void add_copy_chunks(
+            std::vector<copy_chunk>& chunks,
+            const std::uint8_t* source,
+            std::uint8_t* target,
+            std::size_t size
+        )
+        {
+            for (std::size_t offset = 0; offset < size; offset += copy_chunk_size)
+            {
+                chunks.push_back({source + offset, target + offset, std::min(copy_chunk_size, size - offset)});
+            }
+        }
+
+        // When \p deferred_copies is not null, the deep copied buffers are allocated but
+        // not filled: the copies to make are added to \p deferred_copies instead.
+        void copy_array_impl(
+            const ArrowArray& source_array,
+            const ArrowSchema& source_schema,
+            ArrowArray& target,
+            bool share_buffers,
+            std::vector<copy_chunk>* deferred_copies = nullptr,
+            std::pmr::memory_resource* resource = nullptr
+        )
+        {
+            SPARROW_ASSERT_TRUE(&source_array != &target);
+            SPARROW_ASSERT_TRUE(source_array.release != nullptr);
+            SPARROW_ASSERT_TRUE(source_schema.release != nullptr);
+            SPARROW_ASSERT_TRUE(source_array.n_children == source_schema.n_children);
+            SPARROW_ASSERT_TRUE((source_array.dictionary == nullptr) == (source_schema.dictionary == nullptr));
+
+            target.n_children = source_array.n_children;
+            if (source_array.n_children > 0)
+            {
+                target.children = new ArrowArray*[static_cast<std::size_t>(source_array.n_children)];
+                for (int64_t i = 0; i < source_array.n_children; ++i)
+                {
+                    SPARROW_ASSERT_TRUE(source_array.children[i] != nullptr);
+                    target.children[i] = new ArrowArray{};
+                    copy_array_impl(
+                        *source_array.children[i],
+                        *source_schema.children[i],
+                        *target.children[i],
+                        share_buffers,
+                        deferred_copies,
+                        resource
+                    );
+                }
+            }
+
+            if (source_array.dictionary != nullptr)
+            {
+                target.dictionary = new ArrowArray{};
+                copy_array_impl(
+                    *source_array.dictionary,
+                    *source_schema.dictionary,
+                    *target.dictionary,
+                    share_buffers,
+                    deferred_copies,
+                    resource
+                );
+            }
+
+            target.length = source_array.length;
+            target.null_count = source_array.null_count;
+            target.offset = source_array.offset;
+            target.n_buffers = source_array.n_buffers;
+
+            const auto children_ownership = repeat_view<bool>{true, static_cast<std::size_t>(target.n_children)};
+            // Buffers can only be shared when they are owned by a sparrow private data,
+            // other producers do not give us any mean to extend the lifetime of their buffers.
+            if (share_buffers && source_array.release == &release_arrow_array && source_array.private_data != nullptr)
+            {
+                const auto source_private_data = static_cast<const arrow_array_private_data*>(
+                    source_array.private_data
+                );
+                auto* private_data = new arrow_array_private_data(
+                    source_private_data->share_buffers(),
+                    children_ownership,
+                    true
+                );
+                if (!source_private_data->buffers_offsets().empty())
+                {
+                    private_data->set_buffers_offsets(source_private_data->buffers_offsets());
+                }
+                target.private_data = private_data;
+            }
+            else
+            {
+                const auto buffers = get_arrow_array_buffers(source_array, source_schema);
+                SPARROW_ASSERT_TRUE(buffers.size() == static_cast<std::size_t>(source_array.n_buffers));
+
+                using buffer_type = buffer<std::uint8_t>;
+                std::vector<buffer_type> buffers_copy;
+                buffers_copy.reserve(static_cast<std::size_t>(source_array.n_buffers));
+                for (const auto& buffer : buffers)
+                {
+                    // Empty buffers are copied right away, so that absent buffers, such
+                    // as a missing validity bitmap, stay null in the copy
+                    if (buffer.size() == 0 || (deferred_copies == nullptr && resource == nullptr))
+                    {
+                        buffers_copy.emplace_back(buffer);
+                    }
+                    else if (deferred_copies == nullptr)
+                    {
+                        buffers_copy.emplace_back(
+                            buffer.cbegin(),
+                            buffer.cend(),
+                            std::pmr::polymorphic_allocator<std::uint8_t>(resource)
+                        );
+                    }
+                    else
+                    {
+                        buffers_copy.emplace_back(buffer.size(), buffer_type::default_allocator());
+                    }
+                }
+                auto* private_data = new arrow_array_private_data(std::move(buffers_copy), children_ownership, true);
+                target.private_data = private_data;
+                if (deferred_copies != nullptr)
+                {
+                    // Moving the buffers to the private data does not move their storage
+                    for (std::size_t i = 0; i < buffers.size(); ++i)
+                    {
+                        add_copy_chunks(
+                            *deferred_copies,
+                            buffers[i].data(),
+                            private_data->buffers()[i].data(),
+                            buffers[i].size()
+                        );
+                    }
+                }
+            }
+            const auto private_data = static_cast<arrow_array_private_data*>(target.private_data);
+            target.buffers = private_data->buffers_ptrs<void>();
+            target.release = release_arrow_array;
+        }
+    }
+
     void copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema, ArrowArray& target)
     {
-        SPARROW_ASSERT_TRUE(&source_array != &target);
-        SPARROW_ASSERT_TRUE(source_array.release != nullptr);
-        SPARROW_ASSERT_TRUE(source_schema.release != nullptr);
-        SPARROW_ASSERT_TRUE(source_array.n_children == source_schema.n_children);
-        SPARROW_ASSERT_TRUE((source_array.dictionary == nullptr) == (source_schema.dictionary == nullptr));
-        const auto buffers = get_arrow_array_buffers(source_array, source_schema);
-        SPARROW_ASSERT_TRUE(buffers.size() == static_cast<std::size_t>(source_array.n_buffers));
+        copy_array_impl(source_array, source_schema, target, false);
+    }
+
+    void copy_array(
+        const ArrowArray& source_array,
+        const ArrowSchema& source_schema,
+        ArrowArray& target,
+        std::pmr::memory_resource& resource
+    )
+    {
+        copy_array_impl(source_array, source_schema, target, false, nullptr, &resource);
+    }
+
+    void shallow_copy_array(const ArrowArray& source_array, const ArrowSchema& source_schema, ArrowArray& target)
+    {
+        copy_array_impl(source_array, source_schema, target, true);
+    }
+
+    void parallel_copy_array(
+        const ArrowArray& source_array,
+        const ArrowSchema& source_schema,
+        ArrowArray& target,
+        std::size_t max_threads
+    )
+    {
+        // The tree of arrays and its buffers are allocated first, then the buffers are
+        // filled in parallel
+        std::vector<copy_chunk> chunks;
+        copy_array_impl(source_array, source_schema, target, false, &chunks);
+
+        std::size_t total_size = 0;
+        for (const auto& chunk : chunks)
+        {
+            total_size += chunk.size;
+        }
+        std::size_t task_count = parallel_task_count(total_size, copy_chunk_size);
+        if (max_threads != 0)
+        {
+            task_count = std::min(task_count, max_threads);
+        }
+        parallel_for(
+            chunks.size(),
+            [&chunks](std::size_t i)
+            {
+                std::memcpy(chunks[i].target, chunks[i].source, chunks[i].size);
+            },
+            task_count
+        );
+    }
+
+    namespace
+    {
+        using compact_buffer_type = buffer<std::uint8_t>;
+
+        compact_buffer_type make_compact_buffer(std::size_t size)
+        {
+            return compact_buffer_type(size, std::uint8_t{0}, compact_buffer_type::default_allocator());
+        }
+
+        bool bit_is_set(const std::uint8_t* data, std::size_t index)
+        {
+            return (data[index / 8] >> (index % 8)) & 1u;
+        }
+
+        void set_bit(std::uint8_t* data, std::size_t index)
+        {
+            data[index / 8] |= static_cast<std::uint8_t>(1u << (index % 8));
+        }
+
+        // Calls `func` with a value of the integer type described by `format`, used for
+        // dictionary indices and run ends.
+        template <class F>
+        decltype(auto) visit_integer_format(std::string_view format, F&& func)
+        {
+            switch (format_to_data_type(format))
+            {
+                case data_type::INT8:
+                    return func(std::int8_t{});
+                case data_type::UINT8:
+                    return func(std::uint8_t{});
+                case data_type::INT16:
+                    return func(std::int16_t{});
+                case data_type::UINT16:
+                    return func(std::uint16_t{});
+                case data_type::INT32:
+                    return func(std::int32_t{});
+                case data_type::UINT32:
+                    return func(std::uint32_t{});
+                case data_type::INT64:
+                    return func(std::int64_t{});
+                case data_type::UINT64:
+                    return func(std::uint64_t{});
+                default:
+                    throw std::invalid_argument("Unsupported integer format: " + std::string(format));
+            }
+        }
+
+        std::size_t parse_format_number(std::string_view digits)
+        {
+            std::size_t value = 0;
+            const auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+            if (ec != std::errc{} || ptr != digits.data() + digits.size())
+            {
+                throw std::invalid_argument("Invalid number in format: " + std::string(digits));
+            }
+            return value;
+        }
+
+        // Returns the child index for each type id of a union format ("+ud:0,1,..." or "+us:...").
+        std::vector<std::size_t> parse_union_type_ids(std::string_view format)
+        {
+            std::vector<std::size_t> child_indices(256, 0);
+            format.remove_prefix(4);
+            std::size_t child_index = 0;
+            while (!format.empty())
+            {
+                const auto comma = format.find(',');
+                const auto type_id = parse_format_number(format.substr(0, comma));
+                SPARROW_ASSERT_TRUE(type_id < child_indices.size());
+                child_indices[type_id] = child_index++;
+                format = comma == std::string_view::npos ? std::string_view{} : format.substr(comma + 1);
+            }
+            return child_indices;
+        }
+
+        struct compacted_layout
+        {
+            std::vector<compact_buffer_type> buffers;
+            std::vector<ArrowArray*> children;
+            ArrowArray* dictionary = nullptr;
+            int64_t null_count = 0;
+        };
+
+        // Builds a new dictionary made of the `keys` entries of `dictionary`. Only the
+        // layouts made of a validity bitmap and flat buffers are supported, nullopt is
+        // returned for the others.
+        std::optional<ArrowArray>
+        gather_dictionary(const ArrowArray& dictionary, const ArrowSchema& schema, const std::vector<std::size_t>& keys)
+        {
+            const auto dt = format_to_data_type(schema.format);
+            const auto views = get_arrow_array_buffers(dictionary, schema);
+            const auto first = static_cast<std::size_t>(dictionary.offset);
+            const std::size_t length = keys.size();
+
+            std::vector<compact_buffer_type> buffers;
+            const std::uint8_t* validity = views[0].data();
+            int64_t null_count = 0;
+            if (validity != nullptr)
+            {
+                auto new_validity = make_compact_buffer((length + 7) / 8);
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    if (bit_is_set(validity, first + keys[i]))
+                    {
+                        set_bit(new_validity.data(), i);
+                    }
+                    else
+                    {
+                        ++null_count;
+                    }
+                }
+                buffers.push_back(std::move(new_validity));
+            }
+            else
+            {
+                buffers.emplace_back();
+            }
+
+            auto gather_variable_size = [&]<class OT>(OT)
+            {
+                const OT* offsets = views[1].data<OT>() + first;
+                auto new_offsets = make_compact_buffer((length + 1) * sizeof(OT));
+                OT* out = new_offsets.template data<OT>();
+                out[0] = 0;
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    out[i + 1] = static_cast<OT>(out[i] + offsets[keys[i] + 1] - offsets[keys[i]]);
+                }
+                auto data = make_compact_buffer(static_cast<std::size_t>(out[length]));
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    const auto size = static_cast<std::size_t>(out[i + 1] - out[i]);
+                    if (size != 0)
+                    {
+                        std::memcpy(
+                            data.data() + out[i],
+                            views[2].data() + offsets[keys[i]],
+                            size
+                        );
+                    }
+                }
+                buffers.push_back(std::move(new_offsets));
+                buffers.push_back(std::move(data));
+            };
+
+            switch (dt)
+            {
+                case data_type::BOOL:
+                {
+                    auto values = make_compact_buffer((length + 7) / 8);
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        if (bit_is_set(views[1].data(), first + keys[i]))
+                        {
+                            set_bit(values.data(), i);
+                        }
+                    }
+                    buffers.push_back(std::move(values));
+                    break;
+                }
+                case data_type::STRING:
+                case data_type::BINARY:
+                    gather_variable_size(std::int32_t{});
+                    break;
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                    gather_variable_size(std::int64_t{});
+                    break;
+                default:
+                {
+                    if (views.size() != 2 || dictionary.n_children != 0 || dictionary.dictionary != nullptr)
+                    {
+                        return std::nullopt;
+                    }
+                    const auto size = static_cast<std::size_t>(dictionary.offset + dictionary.length);
+                    const std::size_t width = size == 0 ? 0 : views[1].size() / size;
+                    auto values = make_compact_buffer(length * width);
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        std::memcpy(values.data() + i * width, views[1].data() + (first + keys[i]) * width, width);
+                    }
+                    buffers.push_back(std::move(values));
+                    break;
+                }
+            }
+            return make_arrow_array(
+                static_cast<int64_t>(length),
+                null_count,
+                0,
+                std::move(buffers),
+                nullptr,
+                repeat_view<bool>(true, 0),
+                nullptr,
+                false
+            );
+        }
+
+        // A range of elements of an array to concatenate; `start` is relative to the
+        // offset of the array.
+        struct array_piece
+        {
+            const ArrowArray* array;
+            std::size_t start;
+            std::size_t length;
 
-        target.n_children = source_array.n_children;
-        if (source_array.n_children > 0)
+            [[nodiscard]] std::size_t first() const
+            {
+                return static_cast<std::size_t>(array->offset) + start;
+            }
+        };
+
+        // Copies `bit_count` bits starting at bit `src_offset` of `src` to bit `dst_offset`
+        // of `dst`, whose bits are cleared.
+        void append_bits(
+            std::uint8_t* dst,
+            std::size_t dst_offset,
+            const std::uint8_t* src,
+            std::size_t src_offset,
+            std::size_t bit_count
+        )
         {
-            target.children = new ArrowArray*[static_cast<std::size_t>(source_array.n_children)];
-            for (int64_t i = 0; i < source_array.n_children; ++i)
+            std::size_t i = 0;
+            for (; i < bit_count && (dst_offset + i) % 8 != 0; ++i)
+            {
+                if (bit_is_set(src, src_offset + i))
+                {
+                    set_bit(dst, dst_offset + i);
+                }
+            }
+            // Whole bytes of the destination, each one made of two shifted source bytes
+            const std::size_t byte_count = (bit_count - i) / 8;
+            std::uint8_t* out = dst + (dst_offset + i) / 8;
+            const std::uint8_t* in = src + (src_offset + i) / 8;
+            const std::size_t shift = (src_offset + i) % 8;
+            if (shift == 0)
+            {
+                std::memcpy(out, in, byte_count);
+            }
+            else
             {
-                SPARROW_ASSERT_TRUE(source_array.children[i] != nullptr);
-                target.children[i] = new ArrowArray{};
-                copy_array(*source_array.children[i], *source_schema.children[i], *target.children[i]);
+                for (std::size_t b = 0; b < byte_count; ++b)
+                {
+                    out[b] = static_cast<std::uint8_t>((in[b] >> shift) | (in[b + 1] << (8 - shift)));
+                }
+            }
+            for (i += byte_count * 8; i < bit_count; ++i)
+            {
+                if (bit_is_set(src, src_offset + i))
+                {
+                    set_bit(dst, dst_offset + i);
+                }
             }
         }
 
-        if (source_array.dictionary != nullptr)
+        void fill_bits(std::uint8_t* dst, std::size_t dst_offset, std::size_t bit_count)
         {
-            target.dictionary = new ArrowArray{};
-            copy_array(*source_array.dictionary, *source_schema.dictionary, *target.dictionary);
+            std::size_t i = 0;
+            for (; i < bit_count && (dst_offset + i) % 8 != 0; ++i)
+            {
+                set_bit(dst, dst_offset + i);
+            }
+            const std::size_t byte_count = (bit_count - i) / 8;
+            std::memset(dst + (dst_offset + i) / 8, 0xFF, byte_count);
+            for (i += byte_count * 8; i < bit_count; ++i)
+            {
+                set_bit(dst, dst_offset + i);
+            }
         }
 
-        target.length = source_array.length;
-        target.null_count = source_array.null_count;
-        target.offset = source_array.offset;
-        target.n_buffers = source_array.n_buffers;
+        template <std::integral OT>
+        OT checked_offset(std::size_t value)
+        {
+            if (value > static_cast<std::size_t>(std::numeric_limits<OT>::max()))
+            {
+                throw std::overflow_error("The concatenated array exceeds the capacity of its offsets");
+            }
+            return static_cast<OT>(value);
+        }
+
+        void concatenate_impl(const std::vector<array_piece>& pieces, const ArrowSchema& schema, ArrowArray& target);
 
-        std::vector<buffer<std::uint8_t>> buffers_copy;
-        buffers_copy.reserve(static_cast<std::size_t>(source_array.n_buffers));
+        ArrowArray* concatenate_child(
+            const std::vector<array_piece>& child_pieces,
+            const ArrowSchema& schema,
+            std::size_t index
+        )
+        {
+            auto* child = new ArrowArray{};
+            concatenate_impl(child_pieces, *schema.children[index], *child);
+            return child;
+        }
 
-        for (const auto& buffer : buffers)
+        // The pieces of the child `index` covering the same elements as the pieces of the parent
+        std::vector<array_piece> same_range_child_pieces(const std::vector<array_piece>& pieces, std::size_t index)
         {
-            buffers_copy.emplace_back(buffer);
+            std::vector<array_piece> child_pieces;
+            child_pieces.reserve(pieces.size());
+            for (const auto& piece : pieces)
+            {
+                child_pieces.push_back({piece.array->children[index], piece.first(), piece.length});
+            }
+            return child_pieces;
         }
-        target.private_data = new arrow_array_private_data(
-            std::move(buffers_copy),
-            repeat_view<bool>{true, static_cast<std::size_t>(target.n_children)},
-            true
+
+        template <std::integral OT>
+        void concatenate_variable_size_binary(
+            const std::vector<array_piece>& pieces,
+            const std::vector<std::vector<buffer_view<std::uint8_t>>>& views,
+            std::size_t length,
+            compacted_layout& layout
+        )
+        {
+            std::size_t data_size = 0;
+            for (std::size_t p = 0; p < pieces.size(); ++p)
+            {
+                const OT* offsets = views[p][1].data<OT>() + pieces[p].first();
+                data_size += static_cast<std::size_t>(offsets[pieces[p].length] - offsets[0]);
+            }
+            auto new_offsets = make_compact_buffer((length + 1) * sizeof(OT));
+            auto data = make_compact_buffer(data_size);
+            OT* out = new_offsets.data<OT>();
+            std::size_t position = 0;
+            std::size_t data_position = 0;
+            for (std::size_t p = 0; p < pieces.size(); ++p)
+            {
+                const OT* offsets = views[p][1].data<OT>() + pieces[p].first();
+                for (std::size_t i = 0; i < pieces[p].length; ++i)
+                {
+                    out[position + i] = checked_offset<OT>(data_position + static_cast<std::size_t>(offsets[i] - offsets[0]));
+                }
+                position += pieces[p].length;
+                const auto size = static_cast<std::size_t>(offsets[pieces[p].length] - offsets[0]);
+                if (size != 0)
+                {
+                    std::memcpy(data.data() + data_position, views[p][2].data() + offsets[0], size);
+                }
+                data_position += size;
+            }
+            out[length] = checked_offset<OT>(data_position);
+            layout.buffers.push_back(std::move(new_offsets));
+            layout.buffers.push_back(std::move(data));
+        }
+
+        template <std::integral OT>
+        void concatenate_list(
+            const std::vector<array_piece>& pieces,
+            const ArrowSchema& schema,
+            const std::vector<std::vector<buffer_view<std::uint8_t>>>& views,
+            std::size_t length,
+            compacted_layout& layout
+        )
+        {
+            auto new_offsets = make_compact_buffer((length + 1) * sizeof(OT));
+            OT* out = new_offsets.data<OT>();
+            std::vector<array_piece> child_pieces;
+            child_pieces.reserve(pieces.size());
+            std::size_t position = 0;
+            std::size_t child_position = 0;
+            for (std::size_t p = 0; p < pieces.size(); ++p)
+            {
+                const OT* offsets = views[p][1].data<OT>() + pieces[p].first();
+                for (std::size_t i = 0; i < pieces[p].length; ++i)
+                {
+                    out[position + i] = checked_offset<OT>(child_position + static_cast<std::size_t>(offsets[i] - offsets[0]));
+                }
+                position += pieces[p].length;
+                const auto child_start = static_cast<std::size_t>(offsets[0]);
+                const auto child_length = static_cast<std::size_t>(offsets[pieces[p].length] - offsets[0]);
+                child_pieces.push_back({pieces[p].array->children[0], child_start, child_length});
+                child_position += child_length;
+            }
+            out[length] = checked_offset<OT>(child_position);
+            layout.buffers.push_back(std::move(new_offsets));
+            layout.children.push_back(concatenate_child(child_pieces, schema, 0));
+        }
+
+        // List views may reference the child in any order: each piece only keeps the range
+        // of the child spanned by its non-empty lists.
+        template <std::integral OT>
+        void concatenate_list_view(
+            const std::vector<array_piece>& pieces,
+            const ArrowSchema& schema,
+            const std::vector<std::vector<buffer_view<std::uint8_t>>>& views,
+            std::size_t length,
+            compacted_layout& layout
+        )
+        {
+            auto new_offsets = make_compact_buffer(length * sizeof(OT));
+            auto new_sizes = make_compact_buffer(length * sizeof(OT));
+            OT* out = new_offsets.data<OT>();
+            std::vector<array_piece> child_pieces;
+            child_pieces.reserve(pieces.size());
+            std::size_t position = 0;
+            std::size_t child_position = 0;
+            for (std::size_t p = 0; p < pieces.size(); ++p)
+            {
+                const std::size_t first = pieces[p].first();
+                const OT* offsets = views[p][1].data<OT>() + first;
+                const OT* sizes = views[p][2].data<OT>() + first;
+                OT child_begin = std::numeric_limits<OT>::max();
+                OT child_end = 0;
+                for (std::size_t i = 0; i < pieces[p].length; ++i)
+                {
+                    if (sizes[i] != 0)
+                    {
+                        child_begin = std::min(child_begin, offsets[i]);
+                        child_end = std::max(child_end, static_cast<OT>(offsets[i] + sizes[i]));
+                    }
+                }
+                if (child_end == 0)
+                {
+                    child_begin = 0;
+                }
+                for (std::size_t i = 0; i < pieces[p].length; ++i)
+                {
+                    out[position + i] = sizes[i] != 0
+                                            ? checked_offset<OT>(
+                                                  child_position + static_cast<std::size_t>(offsets[i] - child_begin)
+                                              )
+                                            : OT{0};
+                }
+                if (pieces[p].length != 0)
+                {
+                    std::memcpy(new_sizes.data() + position * sizeof(OT), sizes, pieces[p].length * sizeof(OT));
+                }
+                position += pieces[p].length;
+                const auto child_length = static_cast<std::size_t>(child_end - child_begin);
+                child_pieces.push_back({pieces[p].array->children[0], static_cast<std::size_t>(child_begin), child_length});
+                child_position += child_length;
+            }
+            layout.buffers.push_back(std::move(new_offsets));
+            layout.buffers.push_back(std::move(new_sizes));
+            layout.children.push_back(concatenate_child(child_pieces, schema, 0));
+        }
+
+        // The bytes of the out-of-line strings of all the pieces are gathered into a single
+        // variadic buffer.
+        void concatenate_binary_view(
+            const std::vector<array_piece>& pieces,
+            const std::vector<std::vector<buffer_view<std::uint8_t>>>& views,
+            std::size_t length,
+            compacted_layout& layout
+        )
+        {
+            constexpr std::size_t view_size = 16;
+            constexpr std::size_t inline_size = 12;
+            const auto is_valid = [&](std::size_t p, std::size_t index)
+            {
+                const std::uint8_t* validity = views[p][0].data();
+                return validity == nullptr || bit_is_set(validity, index);
+            };
+
+            std::size_t data_size = 0;
+            for (std::size_t p = 0; p < pieces.size(); ++p)
+            {
+                const std::size_t first = pieces[p].first();
+                for (std::size_t i = 0; i < pieces[p].length; ++i)
+                {
+                    std::int32_t size = 0;
+                    std::memcpy(&size, views[p][1].data() + (first + i) * view_size, sizeof(size));
+                    if (static_cast<std::size_t>(size) > inline_size && is_valid(p, first + i))
+                    {
+                        data_size += static_cast<std::size_t>(size);
+                    }
+                }
+            }
+
+            auto new_views = make_compact_buffer(length * view_size);
+            auto data = make_compact_buffer(data_size);
+            std::size_t position = 0;
+            std::size_t data_offset = 0;
+            for (std::size_t p = 0; p < pieces.size(); ++p)
+            {
+                const std::size_t first = pieces[p].first();
+                for (std::size_t i = 0; i < pieces[p].length; ++i, ++position)
+                {
+                    if (!is_valid(p, first + i))
+                    {
+                        // Null views are left zeroed.
+                        continue;
+                    }
+                    const std::uint8_t* src_view = views[p][1].data() + (first + i) * view_size;
+                    std::uint8_t* dst_view = new_views.data() + position * view_size;
+                    std::memcpy(dst_view, src_view, view_size);
+                    std::int32_t size = 0;
+                    std::memcpy(&size, src_view, sizeof(size));
+                    if (static_cast<std::size_t>(size) <= inline_size)
+                    {
+                        continue;
+                    }
+                    std::int32_t buffer_index = 0;
+                    std::int32_t buffer_offset = 0;
+                    std::memcpy(&buffer_index, src_view + 8, sizeof(buffer_index));
+                    std::memcpy(&buffer_offset, src_view + 12, sizeof(buffer_offset));
+                    const auto* src_data = static_cast<const std::uint8_t*>(
+                        pieces[p].array->buffers[static_cast<std::size_t>(buffer_index) + 2]
+                    );
+                    std::memcpy(data.data() + data_offset, src_data + buffer_offset, static_cast<std::size_t>(size));
+                    const std::int32_t new_index = 0;
+                    const auto new_offset = checked_offset<std::int32_t>(data_offset);
+                    std::memcpy(dst_view + 8, &new_index, sizeof(new_index));
+                    std::memcpy(dst_view + 12, &new_offset, sizeof(new_offset));
+                    data_offset += static_cast<std::size_t>(size);
+                }
+            }
+
+            layout.buffers.push_back(std::move(new_views));
+            auto sizes = make_compact_buffer(data_size == 0 ? 0 : sizeof(std::int64_t));
+            if (data_size != 0)
+            {
+                sizes.data<std::int64_t>()[0] = static_cast<std::int64_t>(data_size);
+                layout.buffers.push_back(std::move(data));
+            }
+            layout.buffers.push_back(std::move(sizes));
+        }
+
+        // Each piece keeps the range of each child spanned by its offsets; the offsets are
+        // rebased on the concatenated children.
+        void concatenate_dense_union(
+            const std::vector<array_piece>& pieces,
+            const ArrowSchema& schema,
+            const std::vector<std::vector<buffer_view<std::uint8_t>>>& views,
+            std::size_t length,
+            compacted_layout& layout
+        )
+        {
+            const auto child_indices = parse_union_type_ids(schema.format);
+            const auto n_children = static_cast<std::size_t>(schema.n_children);
+            auto new_type_ids = make_compact_buffer(length);
+            auto new_offsets = make_compact_buffer(length * sizeof(std::int32_t));
+            std::int32_t* out = new_offsets.data<std::int32_t>();
+            std::vector<std::vector<array_piece>> child_pieces(n_children);
+            std::vector<std::size_t> child_positions(n_children, 0);
+            std::size_t position = 0;
+            for (std::size_t p = 0; p < pieces.size(); ++p)
+            {
+                const std::size_t first = pieces[p].first();
+                const std::uint8_t* type_ids = views[p][0].data() + first;
+                const std::int32_t* offsets = views[p][1].data<std::int32_t>() + first;
+                std::vector<std::int32_t> child_begin(n_children, std::numeric_limits<std::int32_t>::max());
+                std::vector<std::int32_t> child_end(n_children, 0);
+                for (std::size_t i = 0; i < pieces[p].length; ++i)
+                {
+                    const auto child = child_indices[type_ids[i]];
+                    child_begin[child] = std::min(child_begin[child], offsets[i]);
+                    child_end[child] = std::max(child_end[child], offsets[i] + 1);
+                }
+                for (std::size_t child = 0; child < n_children; ++child)
+                {
+                    if (child_end[child] == 0)
+                    {
+                        child_begin[child] = 0;
+                    }
+                }
+                for (std::size_t i = 0; i < pieces[p].length; ++i)
+                {
+                    const auto child = child_indices[type_ids[i]];
+                    out[position + i] = checked_offset<std::int32_t>(
+                        child_positions[child] + static_cast<std::size_t>(offsets[i] - child_begin[child])
+                    );
+                }
+                if (pieces[p].length != 0)
+                {
+                    std::memcpy(new_type_ids.data() + position, type_ids, pieces[p].length);
+                }
+                position += pieces[p].length;
+                for (std::size_t child = 0; child < n_children; ++child)
+                {
+                    const auto child_length = static_cast<std::size_t>(child_end[child] - child_begin[child]);
+                    child_pieces[child].push_back(
+                        {pieces[p].array->children[child], static_cast<std::size_t>(child_begin[child]), child_length}
+                    );
+                    child_positions[child] += child_length;
+                }
+            }
+            layout.buffers.push_back(std::move(new_type_ids));
+            layout.buffers.push_back(std::move(new_offsets));
+            for (std::size_t child = 0; child < n_children; ++child)
+            {
+                layout.children.push_back(concatenate_child(child_pieces[child], schema, child));
+            }
+        }
+
+        // Each piece keeps the runs overlapping its range, run ends being expressed in the
+        // logical coordinates of the parent array and shifted by the length of the previous
+        // pieces.
+        void concatenate_run_end_encoded(
+            const std::vector<array_piece>& pieces,
+            const ArrowSchema& schema,
+            compacted_layout& layout
+        )
+        {
+            const ArrowSchema& run_ends_schema = *schema.children[0];
+            visit_integer_format(
+                run_ends_schema.format,
+                [&]<class T>(T)
+                {
+                    std::vector<compact_buffer_type> new_ends_parts;
+                    std::vector<array_piece> value_pieces;
+                    std::size_t total_runs = 0;
+                    std::size_t position = 0;
+                    for (const auto& piece : pieces)
+                    {
+                        const ArrowArray& run_ends = *piece.array->children[0];
+                        const auto run_ends_views = get_arrow_array_buffers(run_ends, run_ends_schema);
+                        const T* ends = run_ends_views[1].data<T>() + run_ends.offset;
+                        const auto n_runs = static_cast<std::size_t>(run_ends.length);
+                        const std::size_t first = piece.first();
+                        const std::size_t end = first + piece.length;
+                        std::size_t first_run = 0;
+                        while (first_run < n_runs && static_cast<std::size_t>(ends[first_run]) <= first)
+                        {
+                            ++first_run;
+                        }
+                        std::size_t last_run = first_run;
+                        while (piece.length != 0 && last_run < n_runs && static_cast<std::size_t>(ends[last_run]) < end)
+                        {
+                            ++last_run;
+                        }
+                        const std::size_t piece_runs = piece.length == 0 ? 0 : last_run - first_run + 1;
+                        auto part = make_compact_buffer(piece_runs * sizeof(T));
+                        T* out = part.template data<T>();
+                        for (std::size_t i = 0; i < piece_runs; ++i)
+                        {
+                            const auto run_end = std::min(static_cast<std::size_t>(ends[first_run + i]), end);
+                            out[i] = checked_offset<T>(position + run_end - first);
+                        }
+                        new_ends_parts.push_back(std::move(part));
+                        value_pieces.push_back({piece.array->children[1], first_run, piece_runs});
+                        total_runs += piece_runs;
+                        position += piece.length;
+                    }
+
+                    auto new_ends = make_compact_buffer(total_runs * sizeof(T));
+                    std::size_t byte_position = 0;
+                    for (const auto& part : new_ends_parts)
+                    {
+                        if (!part.empty())
+                        {
+                            std::memcpy(new_ends.data() + byte_position, part.data(), part.size());
+                        }
+                        byte_position += part.size();
+                    }
+                    std::vector<compact_buffer_type> run_ends_buffers;
+                    run_ends_buffers.emplace_back();
+                    run_ends_buffers.push_back(std::move(new_ends));
+                    layout.children.push_back(new ArrowArray(make_arrow_array(
+                        static_cast<int64_t>(total_runs),
+                        0,
+                        0,
+                        std::move(run_ends_buffers),
+                        nullptr,
+                        repeat_view<bool>(true, 0),
+                        nullptr,
+                        false
+                    )));
+                    layout.children.push_back(concatenate_child(value_pieces, schema, 1));
+                }
+            );
+        }
+
+        // Returns the bytes of each entry of a dictionary, nullopt for the null entries, or
+        // nullopt if the layout of the dictionary is not supported.
+        std::optional<std::vector<std::optional<std::string_view>>>
+        dictionary_entries(const ArrowArray& dictionary, const ArrowSchema& schema)
+        {
+            const auto dt = format_to_data_type(schema.format);
+            const auto views = get_arrow_array_buffers(dictionary, schema);
+            const auto first = static_cast<std::size_t>(dictionary.offset);
+            const auto length = static_cast<std::size_t>(dictionary.length);
+            if (dt == data_type::BOOL || dictionary.n_children != 0 || dictionary.dictionary != nullptr
+                || views.size() < 2)
+            {
+                return std::nullopt;
+            }
+
+            std::vector<std::optional<std::string_view>> entries(length);
+            const std::uint8_t* validity = views[0].data();
+            const auto bytes = [](const std::uint8_t* data, std::size_t begin, std::size_t size)
+            {
+                return std::string_view(reinterpret_cast<const char*>(data) + begin, size);
+            };
+            auto variable_size = [&]<class OT>(OT)
+            {
+                const OT* offsets = views[1].data<OT>();
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    const std::size_t index = first + i;
+                    if (validity == nullptr || bit_is_set(validity, index))
+                    {
+                        entries[i] = bytes(
+                            views[2].data(),
+                            static_cast<std::size_t>(offsets[index]),
+                            static_cast<std::size_t>(offsets[index + 1] - offsets[index])
+                        );
+                    }
+                }
+            };
+            switch (dt)
+            {
+                case data_type::STRING:
+                case data_type::BINARY:
+                    variable_size(std::int32_t{});
+                    return entries;
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                    variable_size(std::int64_t{});
+                    return entries;
+                default:
+                {
+                    if (views.size() != 2)
+                    {
+                        return std::nullopt;
+                    }
+                    const auto size = first + length;
+                    const std::size_t width = size == 0 ? 0 : views[1].size() / size;
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        if (validity == nullptr || bit_is_set(validity, first + i))
+                        {
+                            entries[i] = bytes(views[1].data(), (first + i) * width, width);
+                        }
+                    }
+                    return entries;
+                }
+            }
+        }
+
+        // Replaces the dictionary shared by the pieces by the entries referenced by the valid
+        // indices of `indices`, and remaps the indices accordingly. The dictionary is copied
+        // as is when its layout does not allow gathering entries.
+        ArrowArray* prune_dictionary(
+            const ArrowArray& dictionary,
+            const ArrowSchema& schema,
+            const compact_buffer_type& validity,
+            compact_buffer_type& indices,
+            std::size_t length
+        )
+        {
+            const ArrowSchema& dictionary_schema = *schema.dictionary;
+            const auto dictionary_length = static_cast<std::size_t>(dictionary.length);
+            auto* target = new ArrowArray{};
+
+            visit_integer_format(
+                schema.format,
+                [&]<class T>(T)
+                {
+                    T* keys = indices.data<T>();
+                    std::vector<bool> used(dictionary_length, false);
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        if (validity.empty() || bit_is_set(validity.data(), i))
+                        {
+                            used[static_cast<std::size_t>(keys[i])] = true;
+                        }
+                    }
+                    std::vector<std::size_t> kept;
+                    std::vector<std::size_t> remap(dictionary_length, 0);
+                    for (std::size_t key = 0; key < dictionary_length; ++key)
+                    {
+                        if (used[key])
+                        {
+                            remap[key] = kept.size();
+                            kept.push_back(key);
+                        }
+                    }
+                    std::optional<ArrowArray> gathered;
+                    if (kept.size() != dictionary_length)
+                    {
+                        gathered = gather_dictionary(dictionary, dictionary_schema, kept);
+                    }
+                    if (!gathered.has_value())
+                    {
+                        concatenate_impl({{&dictionary, 0, dictionary_length}}, dictionary_schema, *target);
+                        return;
+                    }
+                    *target = std::move(*gathered);
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        if (validity.empty() || bit_is_set(validity.data(), i))
+                        {
+                            keys[i] = static_cast<T>(remap[static_cast<std::size_t>(keys[i])]);
+                        }
+                        else
+                        {
+                            keys[i] = T{0};
+                        }
+                    }
+                }
+            );
+            return target;
+        }
+
+        // Whether two dictionaries hold the same entries without comparing them: either they
+        // are the same array, or they are flat arrays viewing the same buffers, as the
+        // dictionaries of the slices of an array do.
+        bool same_dictionary(const ArrowArray& lhs, const ArrowArray& rhs)
+        {
+            if (&lhs == &rhs)
+            {
+                return true;
+            }
+            if (lhs.length != rhs.length || lhs.offset != rhs.offset || lhs.n_buffers != rhs.n_buffers
+                || lhs.n_children != 0 || rhs.n_children != 0 || lhs.dictionary != nullptr
+                || rhs.dictionary != nullptr)
+            {
+                return false;
+            }
+            return std::equal(lhs.buffers, lhs.buffers + lhs.n_buffers, rhs.buffers);
+        }
+
+        // Concatenates the dictionaries of the pieces into a single one, and rewrites the
+        // indices of `indices` accordingly. When the pieces share the same dictionary, its
+        // unreferenced entries are pruned; otherwise the dictionaries are merged, and their
+        // duplicate entries removed when the layout allows it.
+        ArrowArray* unify_dictionaries(
+            const std::vector<array_piece>& pieces,
+            const ArrowSchema& schema,
+            const compact_buffer_type& validity,
+            compact_buffer_type& indices,
+            std::size_t length
+        )
+        {
+            const ArrowArray* shared = pieces.front().array->dictionary;
+            const bool is_shared = std::ranges::all_of(
+                pieces,
+                [shared](const array_piece& piece)
+                {
+                    return same_dictionary(*piece.array->dictionary, *shared);
+                }
+            );
+            if (is_shared)
+            {
+                return prune_dictionary(*shared, schema, validity, indices, length);
+            }
+
+            const ArrowSchema& dictionary_schema = *schema.dictionary;
+            auto* target = new ArrowArray{};
+
+            std::vector<array_piece> dictionary_pieces;
+            std::vector<std::size_t> dictionary_bases;
+            std::size_t dictionary_length = 0;
+            for (const auto& piece : pieces)
+            {
+                const auto piece_length = static_cast<std::size_t>(piece.array->dictionary->length);
+                dictionary_pieces.push_back({piece.array->dictionary, 0, piece_length});
+                dictionary_bases.push_back(dictionary_length);
+                dictionary_length += piece_length;
+            }
+            ArrowArray merged{};
+            concatenate_impl(dictionary_pieces, dictionary_schema, merged);
+
+            // Key of the merged dictionary for each entry of the merged dictionary
+            std::vector<std::size_t> remap(dictionary_length);
+            std::vector<std::size_t> kept;
+            const auto entries = dictionary_entries(merged, dictionary_schema);
+            if (entries.has_value())
+            {
+                std::unordered_map<std::string_view, std::size_t> unique_entries;
+                std::optional<std::size_t> null_key;
+                for (std::size_t key = 0; key < dictionary_length; ++key)
+                {
+                    const auto& entry = (*entries)[key];
+                    std::optional<std::size_t> existing;
+                    if (entry.has_value())
+                    {
+                        if (const auto it = unique_entries.find(*entry); it != unique_entries.end())
+                        {
+                            existing = it->second;
+                        }
+                    }
+                    else
+                    {
+                        existing = null_key;
+                    }
+                    if (existing.has_value())
+                    {
+                        remap[key] = *existing;
+                        continue;
+                    }
+                    remap[key] = kept.size();
+                    if (entry.has_value())
+                    {
+                        unique_entries.emplace(*entry, kept.size());
+                    }
+                    else
+                    {
+                        null_key = kept.size();
+                    }
+                    kept.push_back(key);
+                }
+            }
+
+            std::optional<ArrowArray> gathered;
+            if (entries.has_value() && kept.size() != dictionary_length)
+            {
+                gathered = gather_dictionary(merged, dictionary_schema, kept);
+            }
+            if (gathered.has_value())
+            {
+                merged.release(&merged);
+                *target = std::move(*gathered);
+            }
+            else
+            {
+                *target = std::move(merged);
+                for (std::size_t key = 0; key < dictionary_length; ++key)
+                {
+                    remap[key] = key;
+                }
+            }
+
+            visit_integer_format(
+                schema.format,
+                [&]<class T>(T)
+                {
+                    if (!remap.empty())
+                    {
+                        checked_offset<T>(*std::ranges::max_element(remap));
+                    }
+                    T* keys = indices.data<T>();
+                    std::size_t position = 0;
+                    for (std::size_t p = 0; p < pieces.size(); ++p)
+                    {
+                        for (std::size_t i = 0; i < pieces[p].length; ++i, ++position)
+                        {
+                            if (validity.empty() || bit_is_set(validity.data(), position))
+                            {
+                                const auto key = dictionary_bases[p] + static_cast<std::size_t>(keys[position]);
+                                keys[position] = static_cast<T>(remap[key]);
+                            }
+                            else
+                            {
+                                keys[position] = T{0};
+                            }
+                        }
+                    }
+                }
+            );
+            return target;
+        }
+
+        void concatenate_impl(const std::vector<array_piece>& pieces, const ArrowSchema& schema, ArrowArray& target)
+        {
+            SPARROW_ASSERT_TRUE(!pieces.empty());
+            SPARROW_ASSERT_TRUE(schema.release != nullptr);
+
+            std::vector<std::vector<buffer_view<std::uint8_t>>> views;
+            views.reserve(pieces.size());
+            std::size_t length = 0;
+            bool has_validity = false;
+            for (const auto& piece : pieces)
+            {
+                SPARROW_ASSERT_TRUE(piece.array->release != nullptr);
+                SPARROW_ASSERT_TRUE(piece.array->n_children == schema.n_children);
+                SPARROW_ASSERT_TRUE((piece.array->dictionary == nullptr) == (schema.dictionary == nullptr));
+                SPARROW_ASSERT_TRUE(piece.start + piece.length <= static_cast<std::size_t>(piece.array->length));
+                views.push_back(get_arrow_array_buffers(*piece.array, schema));
+                length += piece.length;
+                has_validity = has_validity || (!views.back().empty() && views.back()[0].data() != nullptr);
+            }
+            const auto dt = format_to_data_type(schema.format);
+
+            compacted_layout layout;
+            if (has_bitmap(dt))
+            {
+                compact_buffer_type validity;
+                if (has_validity)
+                {
+                    validity = make_compact_buffer((length + 7) / 8);
+                    std::size_t position = 0;
+                    for (std::size_t p = 0; p < pieces.size(); ++p)
+                    {
+                        const std::uint8_t* piece_validity = views[p][0].data();
+                        if (piece_validity == nullptr)
+                        {
+                            fill_bits(validity.data(), position, pieces[p].length);
+                        }
+                        else
+                        {
+                            append_bits(validity.data(), position, piece_validity, pieces[p].first(), pieces[p].length);
+                        }
+                        position += pieces[p].length;
+                    }
+                    layout.null_count = static_cast<int64_t>(
+                        length - count_non_null(validity.data(), length, validity.size())
+                    );
+                }
+                layout.buffers.push_back(std::move(validity));
+            }
+
+            switch (dt)
+            {
+                case data_type::NA:
+                    layout.null_count = static_cast<int64_t>(length);
+                    break;
+                case data_type::BOOL:
+                {
+                    auto values = make_compact_buffer((length + 7) / 8);
+                    std::size_t position = 0;
+                    for (std::size_t p = 0; p < pieces.size(); ++p)
+                    {
+                        append_bits(values.data(), position, views[p][1].data(), pieces[p].first(), pieces[p].length);
+                        position += pieces[p].length;
+                    }
+                    layout.buffers.push_back(std::move(values));
+                    break;
+                }
+                case data_type::STRING:
+                case data_type::BINARY:
+                    concatenate_variable_size_binary<std::int32_t>(pieces, views, length, layout);
+                    break;
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                    concatenate_variable_size_binary<std::int64_t>(pieces, views, length, layout);
+                    break;
+                case data_type::LIST:
+                case data_type::MAP:
+                    concatenate_list<std::int32_t>(pieces, schema, views, length, layout);
+                    break;
+                case data_type::LARGE_LIST:
+                    concatenate_list<std::int64_t>(pieces, schema, views, length, layout);
+                    break;
+                case data_type::LIST_VIEW:
+                    concatenate_list_view<std::int32_t>(pieces, schema, views, length, layout);
+                    break;
+                case data_type::LARGE_LIST_VIEW:
+                    concatenate_list_view<std::int64_t>(pieces, schema, views, length, layout);
+                    break;
+                case data_type::FIXED_SIZED_LIST:
+                {
+                    const auto list_size = parse_format_number(std::string_view(schema.format).substr(3));
+                    std::vector<array_piece> child_pieces;
+                    child_pieces.reserve(pieces.size());
+                    for (const auto& piece : pieces)
+                    {
+                        child_pieces.push_back(
+                            {piece.array->children[0], piece.first() * list_size, piece.length * list_size}
+                        );
+                    }
+                    layout.children.push_back(concatenate_child(child_pieces, schema, 0));
+                    break;
+                }
+                case data_type::STRUCT:
+                    for (std::size_t i = 0; i < static_cast<std::size_t>(schema.n_children); ++i)
+                    {
+                        layout.children.push_back(concatenate_child(same_range_child_pieces(pieces, i), schema, i));
+                    }
+                    break;
+                case data_type::SPARSE_UNION:
+                {
+                    auto type_ids = make_compact_buffer(length);
+                    std::size_t position = 0;
+                    for (std::size_t p = 0; p < pieces.size(); ++p)
+                    {
+                        if (pieces[p].length != 0)
+                        {
+                            std::memcpy(type_ids.data() + position, views[p][0].data() + pieces[p].first(), pieces[p].length);
+                        }
+                        position += pieces[p].length;
+                    }
+                    layout.buffers.push_back(std::move(type_ids));
+                    for (std::size_t i = 0; i < static_cast<std::size_t>(schema.n_children); ++i)
+                    {
+                        layout.children.push_back(concatenate_child(same_range_child_pieces(pieces, i), schema, i));
+                    }
+                    break;
+                }
+                case data_type::DENSE_UNION:
+                    concatenate_dense_union(pieces, schema, views, length, layout);
+                    break;
+                case data_type::RUN_ENCODED:
+                    concatenate_run_end_encoded(pieces, schema, layout);
+                    break;
+                case data_type::STRING_VIEW:
+                case data_type::BINARY_VIEW:
+                    concatenate_binary_view(pieces, views, length, layout);
+                    break;
+                default:
+                {
+                    // Fixed-width layouts: the element width is deduced from the size of
+                    // the data buffers.
+                    std::size_t width = 0;
+                    for (std::size_t p = 0; p < pieces.size() && width == 0; ++p)
+                    {
+                        SPARROW_ASSERT_TRUE(views[p].size() == 2);
+                        const auto size = static_cast<std::size_t>(pieces[p].array->offset + pieces[p].array->length);
+                        width = size == 0 ? 0 : views[p][1].size() / size;
+                    }
+                    auto values = make_compact_buffer(length * width);
+                    std::size_t position = 0;
+                    for (std::size_t p = 0; p < pieces.size(); ++p)
+                    {
+                        const std::size_t size = pieces[p].length * width;
+                        if (size != 0)
+                        {
+                            std::memcpy(values.data() + position, views[p][1].data() + pieces[p].first() * width, size);
+                        }
+                        position += size;
+                    }
+                    layout.buffers.push_back(std::move(values));
+                    break;
+                }
+            }
+
+            if (schema.dictionary != nullptr)
+            {
+                layout.dictionary = unify_dictionaries(
+                    pieces,
+                    schema,
+                    layout.buffers.front(),
+                    layout.buffers.back(),
+                    length
+                );
+            }
+
+            const auto n_children = layout.children.size();
+            ArrowArray** children = nullptr;
+            if (n_children != 0)
+            {
+                children = new ArrowArray*[n_children];
+                std::ranges::copy(layout.children, children);
+            }
+            fill_arrow_array(
+                target,
+                static_cast<int64_t>(length),
+                layout.null_count,
+                0,
+                std::move(layout.buffers),
+                children,
+                repeat_view<bool>(true, n_children),
+                layout.dictionary,
+                true
+            );
+        }
+    }
+
+    void concatenate_arrays(
+        std::span<const ArrowArray* const> source_arrays,
+        const ArrowSchema& source_schema,
+        ArrowArray& target
+    )
+    {
+        if (source_arrays.empty())
+        {
+            throw std::invalid_argument("Cannot concatenate an empty range of arrays");
+        }
+        std::vector<array_piece> pieces;
+        pieces.reserve(source_arrays.size());
+        for (const ArrowArray* source : source_arrays)
+        {
+            SPARROW_ASSERT_TRUE(source != nullptr);
+            pieces.push_back({source, 0, static_cast<std::size_t>(source->length)});
+        }
+        concatenate_impl(pieces, source_schema, target);
+    }
+
+    void compact_array(const ArrowArray& source_array, const ArrowSchema& source_schema, ArrowArray& target)
+    {
+        SPARROW_ASSERT_TRUE(&source_array != &target);
+        concatenate_impl(
+            {{&source_array, 0, static_cast<std::size_t>(source_array.length)}},
+            source_schema,
+            target
         );
-        const auto private_data = static_cast<arrow_array_private_data*>(target.private_data);
-        target.buffers = private_data->buffers_ptrs<void>();
-        target.release = release_arrow_array;
     }
 
     void arrow_array_deleter::operator()(ArrowArray* array) const
@@ -14,7 +14,11 @@
 
 #include "sparrow/arrow_interface/arrow_array_schema_proxy.hpp"
 
+#include <mutex>
+#include <optional>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "sparrow/arrow_interface/arrow_array.hpp"
 #include "sparrow/arrow_interface/arrow_array_schema_info_utils.hpp"
@@ -25,6 +29,7 @@
 #include "sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp"
 #include "sparrow/buffer/dynamic_bitset/null_count_policy.hpp"
 #include "sparrow/c_interface.hpp"
+#include "sparrow/layout/fixed_width_binary_array_utils.hpp"
 #include "sparrow/utils/contracts.hpp"
 
 namespace sparrow
@@ -45,6 +50,21 @@ namespace sparrow
         SPARROW_ASSERT_TRUE(schema->release != nullptr);
     }
 
+    // Returns the null count of a slice when it follows from the null count of the sliced
+    // array, or -1 so that it is only computed if it is queried.
+    [[nodiscard]] constexpr int64_t slice_null_count(int64_t null_count, size_t length, size_t new_length)
+    {
+        if (null_count == 0)
+        {
+            return 0;
+        }
+        if (null_count > 0 && std::cmp_equal(null_count, length))
+        {
+            return static_cast<int64_t>(new_length);
+        }
+        return -1;
+    }
+
     arrow_proxy arrow_proxy::view() const
     {
         if (m_array_is_immutable && !m_schema_is_immutable)
@@ -79,43 +99,139 @@ namespace sparrow
             array_without_sanitize().buffers = get_array_private_data()->buffers_ptrs<void>();
             array_without_sanitize().n_buffers = static_cast<int64_t>(n_buffers());
         }
-        const arrow_proxy& const_this = *this;
-        m_buffers = get_arrow_array_buffers(
-            const_this.array_without_sanitize(),
-            const_this.schema_without_sanitize()
-        );
+        // Views that have not been requested yet are built by buffers() on first access
+        if (m_buffers_materialized)
+        {
+            m_buffers_materialized = false;
+            materialize_buffers();
+        }
     }
 
-    void arrow_proxy::update_children()
+    void arrow_proxy::materialize_buffers() const
     {
-        m_children.clear();
-        m_children.reserve(n_children());
+        if (m_buffers_materialized.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_materialize_mutex);
+        if (!m_buffers_materialized.load(std::memory_order_relaxed))
+        {
+            m_buffers = get_arrow_array_buffers(array_without_sanitize(), schema_without_sanitize());
+            m_buffers_materialized.store(true, std::memory_order_release);
+        }
+    }
 
-        const arrow_proxy& const_this = *this;
-        ArrowArray** array_children = const_this.array_without_sanitize().children;
-        ArrowSchema** schema_children = const_this.schema_without_sanitize().children;
-        for (size_t i = 0; i < n_children(); ++i)
+    bool arrow_proxy::unshare_buffers()
+    {
+        // Nothing can have become shared in this tree since the last walk
+        const std::uint64_t epoch = buffers_sharing_epoch();
+        if (m_unshared_epoch == epoch)
         {
-            if (m_children_array_immutable[i] && m_children_schema_immutable[i])
-            {
-                m_children.emplace_back(
-                    const_cast<const ArrowArray*>(array_children[i]),
-                    const_cast<const ArrowSchema*>(schema_children[i])
-                );
-            }
-            else if (m_children_array_immutable[i] && !m_children_schema_immutable[i])
-            {
-                m_children.emplace_back(const_cast<const ArrowArray*>(array_children[i]), schema_children[i]);
-            }
-            else if (!m_children_array_immutable[i] && m_children_schema_immutable[i])
+            return false;
+        }
+        bool unshared = false;
+        if (is_created_with_sparrow() && !m_array_is_immutable && !m_schema_is_immutable)
+        {
+            arrow_array_private_data* private_data = get_array_private_data();
+            // Trimmed buffers are copied as well, so that the layouts can write
+            // into the buffers without taking their offsets into account.
+            if (private_data->has_shared_buffers() || !private_data->buffers_offsets().empty())
             {
-                m_children.emplace_back(array_children[i], const_cast<const ArrowSchema*>(schema_children[i]));
+                // Like copy_array, only the part of the buffers used by the array is copied
+                arrow_array_private_data::BufferType buffers_copy;
+                const auto& current_buffers = buffers();
+                buffers_copy.reserve(current_buffers.size());
+                for (const auto& buffer : current_buffers)
+                {
+                    buffers_copy.emplace_back(buffer);
+                }
+                private_data->set_buffers(std::move(buffers_copy));
+                update_buffers();
+                create_bitmap_view();
+                unshared = true;
             }
-            else
+        }
+        for (auto& child : children())
+        {
+            unshared = child.unshare_buffers() || unshared;
+        }
+        if (m_dictionary != nullptr)
+        {
+            unshared = m_dictionary->unshare_buffers() || unshared;
+        }
+        m_unshared_epoch = epoch;
+        return unshared;
+    }
+
+    void arrow_proxy::materialize_children() const
+    {
+        if (m_children_materialized.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_materialize_mutex);
+        if (m_children_materialized.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        m_children.clear();
+        m_children.reserve(n_children());
+        for (size_t i = 0; i < n_children(); ++i)
+        {
+            m_children.push_back(make_child(i));
+        }
+        m_children_materialized.store(true, std::memory_order_release);
+    }
+
+    arrow_proxy arrow_proxy::make_child(size_t index) const
+    {
+        ArrowArray* array_child = array_without_sanitize().children[index];
+        ArrowSchema* schema_child = schema_without_sanitize().children[index];
+        const std::uint8_t immutability = get_child_immutability(index);
+        const bool array_immutable = (immutability & child_array_immutable) != 0;
+        const bool schema_immutable = (immutability & child_schema_immutable) != 0;
+        if (array_immutable && schema_immutable)
+        {
+            return arrow_proxy(
+                const_cast<const ArrowArray*>(array_child),
+                const_cast<const ArrowSchema*>(schema_child)
+            );
+        }
+        else if (array_immutable)
+        {
+            return arrow_proxy(const_cast<const ArrowArray*>(array_child), schema_child);
+        }
+        else if (schema_immutable)
+        {
+            return arrow_proxy(array_child, const_cast<const ArrowSchema*>(schema_child));
+        }
+        return arrow_proxy(array_child, schema_child);
+    }
+
+    std::uint8_t arrow_proxy::get_child_immutability(size_t index) const
+    {
+        if (m_children_immutability.empty())
+        {
+            return static_cast<std::uint8_t>(
+                (m_array_is_immutable ? child_array_immutable : 0)
+                | (m_schema_is_immutable ? child_schema_immutable : 0)
+            );
+        }
+        return m_children_immutability[index];
+    }
+
+    void arrow_proxy::set_child_immutability(size_t index, std::uint8_t immutability)
+    {
+        if (m_children_immutability.empty())
+        {
+            const std::uint8_t inherited = get_child_immutability(index);
+            if (immutability == inherited)
             {
-                m_children.emplace_back(array_children[i], schema_children[i]);
+                return;
             }
+            m_children_immutability.assign(n_children(), inherited);
         }
+        m_children_immutability[index] = immutability;
     }
 
     void arrow_proxy::update_dictionary()
@@ -149,10 +265,12 @@ namespace sparrow
     {
         m_buffers.clear();
         m_children.clear();
+        m_buffers_materialized = false;
+        m_children_materialized = false;
         m_dictionary.reset();
         m_is_dictionary_immutable = false;
-        m_children_array_immutable.clear();
-        m_children_schema_immutable.clear();
+        m_children_immutability.clear();
+        m_unshared_epoch = 0;
     }
 
     bool arrow_proxy::array_created_with_sparrow() const
@@ -209,16 +327,13 @@ namespace sparrow
     {
         if (!other.empty())
         {
-            m_array = copy_array(other.array(), other.schema());
+            m_array = shallow_copy_array(other.array(), other.schema());
             m_schema = copy_schema(other.schema());
             m_array_is_immutable = false;
             m_schema_is_immutable = false;
             m_is_dictionary_immutable = false;
-            m_children_array_immutable = std::vector<bool>(n_children(), false);
-            m_children_schema_immutable = std::vector<bool>(n_children(), false);
             validate_array_and_schema();
             update_buffers();
-            update_children();
             update_dictionary();
             create_bitmap_view();
         }
@@ -229,8 +344,6 @@ namespace sparrow
             m_array_is_immutable = false;
             m_schema_is_immutable = false;
             m_is_dictionary_immutable = false;
-            m_children_array_immutable.clear();
-            m_children_schema_immutable.clear();
             m_null_bitmap.reset();
             m_const_bitmap.reset();
         }
@@ -256,10 +369,12 @@ namespace sparrow
         , m_array_is_immutable(other.m_array_is_immutable)
         , m_schema_is_immutable(other.m_schema_is_immutable)
         , m_is_dictionary_immutable(other.m_is_dictionary_immutable)
-        , m_children_array_immutable(std::move(other.m_children_array_immutable))
-        , m_children_schema_immutable(std::move(other.m_children_schema_immutable))
+        , m_buffers_materialized(other.m_buffers_materialized.load())
+        , m_children_materialized(other.m_children_materialized.load())
+        , m_children_immutability(std::move(other.m_children_immutability))
         , m_null_bitmap(std::move(other.m_null_bitmap))
         , m_const_bitmap(std::move(other.m_const_bitmap))
+        , m_unshared_epoch(other.m_unshared_epoch)
     {
         other.m_array = {};
         other.m_schema = {};
@@ -378,13 +493,49 @@ namespace sparrow
         schema_without_sanitize().name = private_data->name_ptr();
     }
 
+    namespace
+    {
+        // Returns the index of the metadata kept in the private data of a schema created
+        // by sparrow, or nullptr if the schema has none
+        const key_value_index* get_metadata_index(const ArrowSchema& schema)
+        {
+            if (schema.release != &sparrow::release_arrow_schema || schema.metadata == nullptr)
+            {
+                return nullptr;
+            }
+            const auto* private_data = static_cast<const arrow_schema_private_data*>(schema.private_data);
+            return private_data->metadata_ptr() == schema.metadata ? private_data->metadata_index() : nullptr;
+        }
+    }
+
     [[nodiscard]] std::optional<key_value_view> arrow_proxy::metadata() const
     {
-        if (schema_without_sanitize().metadata == nullptr)
+        const ArrowSchema& schema = schema_without_sanitize();
+        if (schema.metadata == nullptr)
+        {
+            return std::nullopt;
+        }
+        return key_value_view(schema.metadata, get_metadata_index(schema));
+    }
+
+    [[nodiscard]] std::optional<std::string_view> arrow_proxy::extension_name() const
+    {
+        const ArrowSchema& schema = schema_without_sanitize();
+        if (const key_value_index* index = get_metadata_index(schema); index != nullptr)
+        {
+            return index->extension_name();
+        }
+        if (schema.metadata == nullptr)
+        {
+            return std::nullopt;
+        }
+        const key_value_view metadata(schema.metadata);
+        const auto it = metadata.find(extension_name_metadata_key);
+        if (it == metadata.end())
         {
             return std::nullopt;
         }
-        return key_value_view(schema_without_sanitize().metadata);
+        return (*it).second;
     }
 
     [[nodiscard]] std::unordered_set<ArrowFlag> arrow_proxy::flags() const
@@ -418,7 +569,13 @@ namespace sparrow
 
     [[nodiscard]] int64_t arrow_proxy::null_count() const
     {
-        return array_without_sanitize().null_count;
+        const int64_t null_count = array_without_sanitize().null_count;
+        // An unknown null count is computed, and cached, by the validity bitmap
+        if (null_count < 0 && m_const_bitmap.has_value())
+        {
+            return static_cast<int64_t>(m_const_bitmap->null_count());
+        }
+        return null_count;
     }
 
     void arrow_proxy::set_null_count(int64_t null_count)
@@ -451,6 +608,7 @@ namespace sparrow
         SPARROW_ASSERT_TRUE(std::cmp_less(n_buffers, std::numeric_limits<int64_t>::max()));
         static constexpr const char function_name[] = "set_n_buffers";
         throw_if_immutable<function_name, true, false>();
+        unshare_buffers();
         array_without_sanitize().n_buffers = static_cast<int64_t>(n_buffers);
         arrow_array_private_data* private_data = get_array_private_data();
         private_data->resize_buffers(n_buffers);
@@ -507,14 +665,15 @@ namespace sparrow
         static constexpr const char function_name[] = "set_child";
         throw_if_immutable<function_name, true, true>();
         remove_child(index);
-        m_children_array_immutable[index] = false;
-        m_children_schema_immutable[index] = false;
+        // The new child may share its buffers
+        increase_buffers_sharing_epoch();
+        set_child_immutability(index, 0);
         array_without_sanitize().children[index] = array;
         schema_without_sanitize().children[index] = schema;
-        m_children[index] = arrow_proxy(
-            array_without_sanitize().children[index],
-            schema_without_sanitize().children[index]
-        );
+        if (m_children_materialized)
+        {
+            m_children[index] = make_child(index);
+        }
         get_array_private_data()->set_child_ownership(index, false);
         get_schema_private_data()->set_child_ownership(index, false);
     }
@@ -525,14 +684,15 @@ namespace sparrow
         static constexpr const char function_name[] = "set_child";
         throw_if_immutable<function_name, true, true>();
         remove_child(index);
-        m_children_array_immutable[index] = true;
-        m_children_schema_immutable[index] = true;
+        // The new child may share its buffers
+        increase_buffers_sharing_epoch();
+        set_child_immutability(index, child_array_immutable | child_schema_immutable);
         array_without_sanitize().children[index] = const_cast<ArrowArray*>(array);
         schema_without_sanitize().children[index] = const_cast<ArrowSchema*>(schema);
-        m_children[index] = arrow_proxy(
-            array_without_sanitize().children[index],
-            schema_without_sanitize().children[index]
-        );
+        if (m_children_materialized)
+        {
+            m_children[index] = make_child(index);
+        }
         get_array_private_data()->set_child_ownership(index, false);
         get_schema_private_data()->set_child_ownership(index, false);
     }
@@ -543,14 +703,15 @@ namespace sparrow
         static constexpr const char function_name[] = "set_child";
         throw_if_immutable<function_name, true, true>();
         remove_child(index);
-        m_children_array_immutable[index] = false;
-        m_children_schema_immutable[index] = false;
+        // The new child may share its buffers
+        increase_buffers_sharing_epoch();
+        set_child_immutability(index, 0);
         array_without_sanitize().children[index] = new ArrowArray(std::move(array));
         schema_without_sanitize().children[index] = new ArrowSchema(std::move(schema));
-        m_children[index] = arrow_proxy(
-            array_without_sanitize().children[index],
-            schema_without_sanitize().children[index]
-        );
+        if (m_children_materialized)
+        {
+            m_children[index] = make_child(index);
+        }
         get_array_private_data()->set_child_ownership(index, true);
         get_schema_private_data()->set_child_ownership(index, true);
     }
@@ -599,9 +760,14 @@ namespace sparrow
 
         array_private_data->resize_children(children_count);
         schema_private_data->resize_children(children_count);
-        m_children.resize(children_count, arrow_proxy());
-        m_children_schema_immutable.resize(children_count, false);
-        m_children_array_immutable.resize(children_count, false);
+        if (m_children_materialized)
+        {
+            m_children.resize(children_count, arrow_proxy());
+        }
+        if (!m_children_immutability.empty())
+        {
+            m_children_immutability.resize(children_count, 0);
+        }
 
         new_array_children.reset(tmp_array_children);
         new_schema_children.reset(tmp_schema_children);
@@ -623,11 +789,13 @@ namespace sparrow
 
     [[nodiscard]] const std::vector<sparrow::buffer_view<uint8_t>>& arrow_proxy::buffers() const
     {
+        materialize_buffers();
         return m_buffers;
     }
 
     [[nodiscard]] std::vector<sparrow::buffer_view<uint8_t>>& arrow_proxy::buffers()
     {
+        materialize_buffers();
         return m_buffers;
     }
 
@@ -636,6 +804,7 @@ namespace sparrow
         SPARROW_ASSERT_TRUE(std::cmp_less(index, n_buffers()));
         static constexpr const char function_name[] = "set_buffer";
         throw_if_immutable<function_name, true, false>();
+        unshare_buffers();
         get_array_private_data()->set_buffer(index, buffer);
         update_buffers();
         if (index == bitmap_buffer_index)
@@ -649,6 +818,7 @@ namespace sparrow
         SPARROW_ASSERT_TRUE(std::cmp_less(index, n_buffers()));
         static constexpr const char function_name[] = "set_buffer";
         throw_if_immutable<function_name, true, false>();
+        unshare_buffers();
         get_array_private_data()->set_buffer(index, std::move(buffer));
         update_buffers();
         if (index == bitmap_buffer_index)
@@ -659,11 +829,13 @@ namespace sparrow
 
     [[nodiscard]] const std::vector<arrow_proxy>& arrow_proxy::children() const
     {
+        materialize_children();
         return m_children;
     }
 
     [[nodiscard]] std::vector<arrow_proxy>& arrow_proxy::children()
     {
+        materialize_children();
         return m_children;
     }
 
@@ -729,6 +901,8 @@ namespace sparrow
         static constexpr const char function_name[] = "set_dictionary";
         throw_if_immutable<function_name, true, true>();
         remove_dictionary();
+        // The new dictionary may share its buffers
+        increase_buffers_sharing_epoch();
         array_without_sanitize().dictionary = array_dictionary;
         schema_without_sanitize().dictionary = schema_dictionary;
         get_array_private_data()->set_dictionary_ownership(false);
@@ -746,6 +920,8 @@ namespace sparrow
         static constexpr const char function_name[] = "set_dictionary";
         throw_if_immutable<function_name, true, true>();
         remove_dictionary();
+        // The new dictionary may share its buffers
+        increase_buffers_sharing_epoch();
         array_without_sanitize().dictionary = const_cast<ArrowArray*>(array_dictionary);
         schema_without_sanitize().dictionary = const_cast<ArrowSchema*>(schema_dictionary);
         get_array_private_data()->set_dictionary_ownership(false);
@@ -761,6 +937,8 @@ namespace sparrow
         static constexpr const char function_name[] = "set_dictionary";
         throw_if_immutable<function_name, true, true>();
         remove_dictionary();
+        // The new dictionary may share its buffers
+        increase_buffers_sharing_epoch();
         array_without_sanitize().dictionary = new ArrowArray(std::move(array_dictionary));
         schema_without_sanitize().dictionary = new ArrowSchema(std::move(schema_dictionary));
         get_array_private_data()->set_dictionary_ownership(true);
@@ -885,14 +1063,22 @@ namespace sparrow
         std::swap(m_buffers, other.m_buffers);
         std::swap(m_children, other.m_children);
         std::swap(m_dictionary, other.m_dictionary);
+        std::swap(m_array_is_immutable, other.m_array_is_immutable);
+        std::swap(m_schema_is_immutable, other.m_schema_is_immutable);
+        std::swap(m_is_dictionary_immutable, other.m_is_dictionary_immutable);
+        m_buffers_materialized = other.m_buffers_materialized.exchange(m_buffers_materialized.load());
+        m_children_materialized = other.m_children_materialized.exchange(m_children_materialized.load());
+        std::swap(m_children_immutability, other.m_children_immutability);
         std::swap(m_null_bitmap, other.m_null_bitmap);
         std::swap(m_const_bitmap, other.m_const_bitmap);
+        std::swap(m_unshared_epoch, other.m_unshared_epoch);
     }
 
     void arrow_proxy::resize_bitmap(size_t new_size, bool value)
     {
         static constexpr const char function_name[] = "resize_bitmap";
         throw_if_immutable<function_name, true, false>();
+        unshare_buffers();
         SPARROW_ASSERT_TRUE(m_null_bitmap.has_value())
         m_null_bitmap->resize(new_size, value);
         const auto null_count = m_null_bitmap->null_count();
@@ -910,6 +1096,7 @@ namespace sparrow
     {
         static constexpr const char function_name[] = "insert_bitmap";
         throw_if_immutable<function_name, true, false>();
+        unshare_buffers();
         SPARROW_ASSERT_TRUE(m_null_bitmap.has_value())
         SPARROW_ASSERT_TRUE(std::cmp_less_equal(index, length()))
         if (count == 0)
@@ -933,6 +1120,7 @@ namespace sparrow
     {
         static constexpr const char function_name[] = "erase_bitmap";
         throw_if_immutable<function_name, true, false>();
+        unshare_buffers();
         SPARROW_ASSERT_TRUE(m_null_bitmap.has_value())
         SPARROW_ASSERT_TRUE(std::cmp_less(index, length()))
         const auto it_first = sparrow::next(m_null_bitmap->cbegin(), index);
@@ -966,45 +1154,168 @@ namespace sparrow
     arrow_proxy arrow_proxy::slice(size_t start, size_t end) const
     {
         SPARROW_ASSERT_TRUE(start <= end);
+        // The copy shares the buffers of this proxy
         arrow_proxy copy = *this;
 
         const auto new_length = end - start;
+        const auto new_offset = static_cast<size_t>(offset()) + start;
 
-        copy.set_offset(start);
+        copy.set_offset(new_offset);
         copy.set_length(new_length);
+        copy.trim_buffers();
 
         if (has_bitmap(data_type()))
         {
-            const auto& bitmap_buffer = copy.buffers()[bitmap_buffer_index];
-            const auto new_non_null = count_non_null(bitmap_buffer.data(), new_length, bitmap_buffer.size(), start);
-            const auto null_count = new_length - new_non_null;
-            copy.create_bitmap_view(null_count);
-            copy.update_null_count();
+            copy.set_null_count(slice_null_count(array_without_sanitize().null_count, length(), new_length));
+            copy.create_bitmap_view();
         }
 
         return copy;
     }
 
+    arrow_proxy arrow_proxy::compact() const
+    {
+        return arrow_proxy(compact_array(array(), schema()), copy_schema(schema()));
+    }
+
+    namespace
+    {
+        // Returns the size in bits of the elements of each buffer indexed by the offset
+        // of the array, or 0 for the buffers that are not (data buffers of the binary
+        // layouts, variadic buffers). Returns nullopt when the offset also applies to
+        // the children, in which case the buffers cannot be trimmed.
+        std::optional<std::vector<size_t>>
+        offset_indexed_buffers_bit_width(data_type dt, std::string_view format, size_t n_buffers)
+        {
+            const auto fixed_width = [](size_t bits) -> std::optional<std::vector<size_t>>
+            {
+                return std::vector<size_t>{1, bits};
+            };
+            switch (dt)
+            {
+                case data_type::BOOL:
+                    return fixed_width(1);
+                case data_type::UINT8:
+                case data_type::INT8:
+                    return fixed_width(8);
+                case data_type::UINT16:
+                case data_type::INT16:
+                case data_type::HALF_FLOAT:
+                    return fixed_width(16);
+                case data_type::UINT32:
+                case data_type::INT32:
+                case data_type::FLOAT:
+                case data_type::DATE_DAYS:
+                case data_type::TIME_SECONDS:
+                case data_type::TIME_MILLISECONDS:
+                case data_type::INTERVAL_MONTHS:
+                case data_type::DECIMAL32:
+                    return fixed_width(32);
+                case data_type::UINT64:
+                case data_type::INT64:
+                case data_type::DOUBLE:
+                case data_type::DATE_MILLISECONDS:
+                case data_type::TIMESTAMP_SECONDS:
+                case data_type::TIMESTAMP_MILLISECONDS:
+                case data_type::TIMESTAMP_MICROSECONDS:
+                case data_type::TIMESTAMP_NANOSECONDS:
+                case data_type::TIME_MICROSECONDS:
+                case data_type::TIME_NANOSECONDS:
+                case data_type::DURATION_SECONDS:
+                case data_type::DURATION_MILLISECONDS:
+                case data_type::DURATION_MICROSECONDS:
+                case data_type::DURATION_NANOSECONDS:
+                case data_type::INTERVAL_DAYS_TIME:
+                case data_type::DECIMAL64:
+                    return fixed_width(64);
+                case data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS:
+                case data_type::DECIMAL128:
+                    return fixed_width(128);
+                case data_type::DECIMAL256:
+                    return fixed_width(256);
+                case data_type::FIXED_WIDTH_BINARY:
+                    return fixed_width(num_bytes_for_fixed_sized_binary(format) * 8);
+                // Offsets are absolute positions in the data buffer or the child array
+                case data_type::STRING:
+                case data_type::BINARY:
+                case data_type::LIST:
+                case data_type::MAP:
+                    return std::vector<size_t>{1, 32, 0};
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                case data_type::LARGE_LIST:
+                    return std::vector<size_t>{1, 64, 0};
+                case data_type::LIST_VIEW:
+                    return std::vector<size_t>{1, 32, 32};
+                case data_type::LARGE_LIST_VIEW:
+                    return std::vector<size_t>{1, 64, 64};
+                case data_type::STRING_VIEW:
+                case data_type::BINARY_VIEW:
+                {
+                    std::vector<size_t> res(n_buffers, 0);
+                    res[0] = 1;
+                    res[1] = 128;
+                    return res;
+                }
+                case data_type::NA:
+                case data_type::FIXED_SIZED_LIST:
+                case data_type::STRUCT:
+                case data_type::SPARSE_UNION:
+                case data_type::DENSE_UNION:
+                case data_type::RUN_ENCODED:
+                    return std::nullopt;
+            }
+            return std::nullopt;
+        }
+    }
+
+    void arrow_proxy::trim_buffers()
+    {
+        const auto current_offset = static_cast<size_t>(offset());
+        if (current_offset == 0 || !is_created_with_sparrow() || m_array_is_immutable || m_schema_is_immutable)
+        {
+            return;
+        }
+        auto bit_widths = offset_indexed_buffers_bit_width(data_type(), format(), n_buffers());
+        if (!bit_widths.has_value())
+        {
+            return;
+        }
+        // The list layouts have fewer buffers than the binary layouts
+        bit_widths->resize(n_buffers(), 0);
+        arrow_array_private_data* private_data = get_array_private_data();
+        std::vector<size_t> byte_offsets(n_buffers(), 0);
+        for (size_t i = 0; i < n_buffers(); ++i)
+        {
+            if (private_data->buffers()[i].empty())
+            {
+                continue;
+            }
+            const size_t bit_offset = current_offset * (*bit_widths)[i];
+            if (bit_offset % 8 != 0)
+            {
+                return;
+            }
+            byte_offsets[i] = bit_offset / 8;
+        }
+        private_data->set_buffers_offsets(byte_offsets);
+        array_without_sanitize().offset = 0;
+        update_buffers();
+    }
+
     arrow_proxy arrow_proxy::slice_view(size_t start, size_t end) const
     {
         SPARROW_ASSERT_TRUE(start <= end);
         ArrowSchema as = schema();
         as.release = empty_release_arrow_schema;
         ArrowArray ar = array();
-        ar.offset = static_cast<int64_t>(start);
+        ar.offset = static_cast<int64_t>(static_cast<size_t>(offset()) + start);
         const auto new_length = end - start;
         ar.length = static_cast<int64_t>(new_length);
+        ar.null_count = slice_null_count(ar.null_count, length(), new_length);
         ar.release = empty_release_arrow_array;
 
-        arrow_proxy ap{std::move(ar), std::move(as)};
-        if (has_bitmap(data_type()))
-        {
-            const auto& bitmap_buffer = ap.buffers()[bitmap_buffer_index];
-            const auto new_non_null = count_non_null(bitmap_buffer.data(), new_length, bitmap_buffer.size(), start);
-            ap.create_bitmap_view(new_non_null);
-            ap.array().null_count = static_cast<int64_t>(new_non_null);
-        }
-        return ap;
+        return arrow_proxy{std::move(ar), std::move(as)};
     }
 
     void arrow_proxy::sanitize_schema()
@@ -1093,20 +1404,35 @@ namespace sparrow
             // Use const accessor to get array - works for both mutable and immutable proxies
             const ArrowArray& arr = std::as_const(*this).array_without_sanitize();
 
-            const auto new_null_count = null_count.value_or(static_cast<size_t>(arr.null_count));
+            // A negative null count is unknown, the bitmaps compute it when it is first queried
+            const int64_t new_null_count = null_count.has_value() ? static_cast<int64_t>(*null_count)
+                                                                  : arr.null_count;
+            const auto emplace_bitmap = [&](auto& bitmap, auto* data)
+            {
+                if (new_null_count < 0)
+                {
+                    bitmap.emplace(data, current_size, current_offset);
+                }
+                else
+                {
+                    bitmap.emplace(data, current_size, current_offset, static_cast<size_t>(new_null_count));
+                }
+            };
 
-            if (array_created_with_sparrow())
+            auto private_data = static_cast<arrow_array_private_data*>(arr.private_data);
+            // The mutable bitmap is not available on trimmed buffers, mutating methods
+            // copy them first (see unshare_buffers)
+            if (array_created_with_sparrow() && private_data->buffers_offsets().empty())
             {
-                auto private_data = static_cast<arrow_array_private_data*>(arr.private_data);
                 auto& bitmap_buffer = private_data->buffers()[bitmap_buffer_index];
-                m_null_bitmap.emplace(&bitmap_buffer, current_size, current_offset, new_null_count);
-                m_const_bitmap.emplace(bitmap_buffer.data(), current_size, current_offset, new_null_count);
+                emplace_bitmap(m_null_bitmap, &bitmap_buffer);
+                emplace_bitmap(m_const_bitmap, bitmap_buffer.data());
             }
             else
             {
+                m_null_bitmap.reset();
                 auto* bitmap_ptr = static_cast<const uint8_t*>(arr.buffers[bitmap_buffer_index]);
-                m_const_bitmap
-                    .emplace(const_cast<uint8_t*>(bitmap_ptr), current_size, current_offset, new_null_count);
+                emplace_bitmap(m_const_bitmap, const_cast<uint8_t*>(bitmap_ptr));
             }
         }
     }
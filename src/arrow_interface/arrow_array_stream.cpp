@@ -14,6 +14,9 @@
 
 #include "sparrow/arrow_interface/arrow_array_stream.hpp"
 
+#include <string>
+#include <system_error>
+
 #include "sparrow/arrow_interface/arrow_array.hpp"
 #include "sparrow/arrow_interface/arrow_schema.hpp"
 
@@ -50,7 +53,13 @@ namespace sparrow
         auto private_data = static_cast<arrow_array_stream_private_data*>(stream->private_data);
         try
         {
-            copy_schema(*private_data->schema(), *out);
+            const ArrowSchema* schema = private_data->wait_for_schema();
+            if (schema == nullptr)
+            {
+                private_data->set_last_error_message("ArrowArrayStream has no schema");
+                return EINVAL;
+            }
+            copy_schema(*schema, *out);
             return 0;
         }
         catch (const std::bad_alloc& e)
@@ -104,6 +113,11 @@ namespace sparrow
             private_data->set_last_error_message(e.what());
             return ENOMEM;
         }
+        catch (const std::system_error& e)
+        {
+            private_data->set_last_error_message(e.what());
+            return e.code().value();
+        }
         catch (const std::exception& e)
         {
             private_data->set_last_error_message(e.what());
@@ -131,7 +145,10 @@ namespace sparrow
         }
 
         auto private_data = static_cast<arrow_array_stream_private_data*>(stream->private_data);
-        const std::string& error_msg = private_data->get_last_error_message();
+        // The message is copied into a buffer of the calling thread, so that the returned
+        // pointer stays valid while other threads report new errors on the stream
+        thread_local std::string error_msg;
+        error_msg = private_data->get_last_error_message();
 
         if (error_msg.empty())
         {
@@ -141,15 +158,46 @@ namespace sparrow
         return error_msg.c_str();
     }
 
+    namespace
+    {
+        void fill_arrow_array_stream_callbacks(ArrowArrayStream& stream)
+        {
+            stream.get_last_error = &get_last_error_from_arrow_array_stream;
+            stream.get_next = &get_next_from_arrow_array_stream;
+            stream.get_schema = &get_schema_from_arrow_array_stream;
+            stream.release = &release_arrow_array_stream;
+        }
+    }
+
     void fill_arrow_array_stream(ArrowArrayStream& stream)
     {
-        stream.get_last_error = &get_last_error_from_arrow_array_stream;
-        stream.get_next = &get_next_from_arrow_array_stream;
-        stream.get_schema = &get_schema_from_arrow_array_stream;
-        stream.release = &release_arrow_array_stream;
+        fill_arrow_array_stream_callbacks(stream);
         stream.private_data = new arrow_array_stream_private_data();
     }
 
+    void fill_arrow_array_stream(ArrowArrayStream& stream, concurrent_stream_options options)
+    {
+        fill_arrow_array_stream_callbacks(stream);
+        stream.private_data = new arrow_array_stream_private_data(options);
+    }
+
+    void fill_arrow_array_stream(
+        ArrowArrayStream& stream,
+        schema_unique_ptr schema,
+        array_source source,
+        source_stream_options options
+    )
+    {
+        SPARROW_ASSERT_TRUE(schema != nullptr);
+        SPARROW_ASSERT_TRUE(source);
+        fill_arrow_array_stream_callbacks(stream);
+        stream.private_data = new arrow_array_stream_private_data(
+            std::move(schema),
+            std::move(source),
+            std::move(options)
+        );
+    }
+
     ArrowArrayStream move_array_stream(ArrowArrayStream&& source)
     {
         ArrowArrayStream target = source;
@@ -25,6 +25,12 @@ namespace sparrow
         fill_arrow_array_stream(std::get<ArrowArrayStream>(m_stream));
     }
 
+    arrow_array_stream_proxy::arrow_array_stream_proxy(concurrent_stream_options options)
+        : m_stream(ArrowArrayStream{})
+    {
+        fill_arrow_array_stream(std::get<ArrowArrayStream>(m_stream), options);
+    }
+
     arrow_array_stream_proxy::arrow_array_stream_proxy(ArrowArrayStream&& stream)
         : m_stream(move_array_stream(stream))
     {
@@ -174,6 +180,16 @@ namespace sparrow
         return sparrow::array(std::move(array), std::move(schema));
     }
 
+    void arrow_array_stream_proxy::close()
+    {
+        get_private_data().close();
+    }
+
+    void arrow_array_stream_proxy::cancel()
+    {
+        get_private_data().cancel();
+    }
+
     void arrow_array_stream_proxy::throw_if_immutable() const
     {
         const ArrowArrayStream* stream = get_stream_ptr();
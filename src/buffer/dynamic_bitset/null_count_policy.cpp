@@ -19,76 +19,60 @@
 #include <cstdint>
 
 #include "sparrow/details/3rdparty/libpopcnt/libpopcnt.h"
+#include "sparrow/utils/bit.hpp"
 
 namespace sparrow
 {
-    std::size_t
-    count_non_null(const std::uint8_t* data, std::size_t bit_size, std::size_t byte_size, std::size_t offset) noexcept
+    std::size_t count_set_bits(const std::uint8_t* data, std::size_t offset, std::size_t bit_size) noexcept
     {
-        if (data == nullptr || byte_size == 0)
-        {
-            return bit_size;
-        }
+        constexpr std::size_t bits_per_byte = 8;
+        constexpr std::size_t bits_per_word = 64;
 
-        if (bit_size == 0)
+        if (bit_size <= bits_per_word)
         {
-            return 0;
+            return static_cast<std::size_t>(std::popcount(load_bits(data, offset, bit_size)));
         }
 
-        constexpr std::size_t bits_per_byte = 8;
-
-        // Calculate the starting byte and bit position
-        const std::size_t start_byte = offset / bits_per_byte;
-        const std::size_t start_bit = offset % bits_per_byte;
-
-        // Check if offset is beyond the buffer
-        if (start_byte >= byte_size)
+        // Head: the bits of the first partial byte
+        const std::size_t head = (bits_per_byte - offset % bits_per_byte) % bits_per_byte;
+        const std::size_t first_byte = (offset + head) / bits_per_byte;
+        std::size_t res = 0;
+        if (head != 0)
         {
-            return 0;
+            const auto bits = static_cast<std::uint8_t>(data[first_byte - 1] >> (bits_per_byte - head));
+            res += static_cast<std::size_t>(std::popcount(bits));
         }
 
-        uint64_t res = 0;
-        std::size_t bits_counted = 0;
-        std::size_t current_byte = start_byte;
+        // Body: the full bytes, counted by the dispatched kernel
+        const std::size_t full_bytes = (bit_size - head) / bits_per_byte;
+        res += static_cast<std::size_t>(popcnt(data + first_byte, full_bytes));
 
-        // Handle the first partial byte (if offset is not byte-aligned)
-        if (start_bit != 0)
+        // Tail: the bits of the last partial byte
+        const std::size_t tail = (bit_size - head) % bits_per_byte;
+        if (tail != 0)
         {
-            const std::size_t bits_in_first_byte = std::min(bits_per_byte - start_bit, bit_size);
-            const std::uint8_t first_byte_mask = static_cast<std::uint8_t>(
-                ((1u << bits_in_first_byte) - 1u) << start_bit
-            );
-            const std::uint8_t masked_byte = data[current_byte] & first_byte_mask;
-            res += static_cast<uint64_t>(std::popcount(masked_byte));
-            bits_counted += bits_in_first_byte;
-            ++current_byte;
+            const auto mask = static_cast<std::uint8_t>((1u << tail) - 1u);
+            const auto bits = static_cast<std::uint8_t>(data[first_byte + full_bytes] & mask);
+            res += static_cast<std::size_t>(std::popcount(bits));
         }
+        return res;
+    }
 
-        // Count full bytes in the middle
-        if (bits_counted < bit_size && current_byte < byte_size)
+    std::size_t
+    count_non_null(const std::uint8_t* data, std::size_t bit_size, std::size_t byte_size, std::size_t offset) noexcept
+    {
+        if (data == nullptr || byte_size == 0)
         {
-            const std::size_t remaining_bits = bit_size - bits_counted;
-            const std::size_t full_bytes = remaining_bits / bits_per_byte;
-            const std::size_t bytes_to_count = std::min(full_bytes, byte_size - current_byte);
-
-            if (bytes_to_count > 0)
-            {
-                res += popcnt(data + current_byte, bytes_to_count);
-                bits_counted += bytes_to_count * bits_per_byte;
-                current_byte += bytes_to_count;
-            }
+            return bit_size;
         }
 
-        // Handle the last partial byte
-        if (bits_counted < bit_size && current_byte < byte_size)
+        // Bits past the end of the buffer are not counted
+        const std::size_t available_bits = byte_size * 8;
+        if (offset >= available_bits)
         {
-            const std::size_t remaining_bits = bit_size - bits_counted;
-            const std::uint8_t last_byte_mask = static_cast<std::uint8_t>((1u << remaining_bits) - 1u);
-            const std::uint8_t masked_byte = data[current_byte] & last_byte_mask;
-            res += static_cast<uint64_t>(std::popcount(masked_byte));
+            return 0;
         }
-
-        return static_cast<std::size_t>(res);
+        return count_set_bits(data, offset, std::min(bit_size, available_bits - offset));
     }
 
 }  // namespace sparrow
@@ -0,0 +1,278 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/buffer/memory_resource.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <new>
+
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    namespace
+    {
+        // The chunks start with their header, padded so that the first block is aligned
+        constexpr std::size_t chunk_header_size = buffer_alignment;
+
+        [[nodiscard]] std::byte* align_up(std::byte* p, std::size_t alignment) noexcept
+        {
+            const auto address = reinterpret_cast<std::uintptr_t>(p);
+            const auto aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            return p + (aligned - address);
+        }
+
+        // The arrays built from a resource keep allocating from it and give their
+        // blocks back when they are destroyed: a block still in use when the
+        // resource is destroyed means that the resource does not outlive the arrays.
+        void check_no_block_in_use(std::size_t blocks_in_use)
+        {
+            SPARROW_ASSERT(
+                blocks_in_use == 0,
+                "The memory resource is destroyed while blocks allocated from it are in use"
+            );
+        }
+    }
+
+    /****************************************
+     * arena_memory_resource implementation *
+     ****************************************/
+
+    struct arena_memory_resource::chunk_header
+    {
+        chunk_header* next;
+        std::size_t size;
+    };
+
+    arena_memory_resource::arena_memory_resource(std::size_t initial_chunk_size, std::pmr::memory_resource* upstream)
+        : p_upstream(upstream)
+        , m_next_chunk_size(std::max(initial_chunk_size, 2 * chunk_header_size))
+    {
+    }
+
+    arena_memory_resource::~arena_memory_resource()
+    {
+        check_no_block_in_use(m_blocks_in_use);
+        release();
+    }
+
+    void arena_memory_resource::release() noexcept
+    {
+        while (p_chunks != nullptr)
+        {
+            chunk_header* next = p_chunks->next;
+            p_upstream->deallocate(p_chunks, p_chunks->size, buffer_alignment);
+            p_chunks = next;
+        }
+        p_current = nullptr;
+        p_end = nullptr;
+        m_bytes_allocated = 0;
+        m_blocks_in_use = 0;
+    }
+
+    void arena_memory_resource::reset() noexcept
+    {
+        if (p_chunks == nullptr)
+        {
+            return;
+        }
+        // The last chunk is the largest one: it is kept so that the next batch of the
+        // same shape is served without requesting memory to the upstream resource
+        chunk_header* largest = p_chunks;
+        p_chunks = largest->next;
+        release();
+        largest->next = nullptr;
+        p_chunks = largest;
+        p_current = reinterpret_cast<std::byte*>(largest) + chunk_header_size;
+        p_end = reinterpret_cast<std::byte*>(largest) + largest->size;
+        m_next_chunk_size = 2 * largest->size;
+    }
+
+    std::size_t arena_memory_resource::bytes_allocated() const noexcept
+    {
+        return m_bytes_allocated;
+    }
+
+    std::pmr::memory_resource* arena_memory_resource::upstream_resource() const noexcept
+    {
+        return p_upstream;
+    }
+
+    void* arena_memory_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        alignment = std::max(alignment, buffer_alignment);
+        std::byte* p = p_current == nullptr ? nullptr : align_up(p_current, alignment);
+        if (p == nullptr || static_cast<std::size_t>(p_end - p) < bytes)
+        {
+            add_chunk(bytes + alignment);
+            p = align_up(p_current, alignment);
+        }
+        m_bytes_allocated += static_cast<std::size_t>(p + bytes - p_current);
+        p_current = p + bytes;
+        ++m_blocks_in_use;
+        return p;
+    }
+
+    void arena_memory_resource::do_deallocate(void* p, std::size_t, std::size_t)
+    {
+        // The memory is given back by release()
+        if (p != nullptr && m_blocks_in_use != 0)
+        {
+            --m_blocks_in_use;
+        }
+    }
+
+    bool arena_memory_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+    void arena_memory_resource::add_chunk(std::size_t min_size)
+    {
+        const std::size_t size = std::max(m_next_chunk_size, min_size + chunk_header_size);
+        auto* mem = static_cast<std::byte*>(p_upstream->allocate(size, buffer_alignment));
+        p_chunks = new (mem) chunk_header{p_chunks, size};
+        p_current = mem + chunk_header_size;
+        p_end = mem + size;
+        // Geometric growth keeps the number of chunks logarithmic in the total size
+        m_next_chunk_size = 2 * size;
+    }
+
+    /***************************************
+     * pool_memory_resource implementation *
+     ***************************************/
+
+    struct pool_memory_resource::chunk_header
+    {
+        chunk_header* next;
+        std::size_t size;
+    };
+
+    struct pool_memory_resource::free_block
+    {
+        free_block* next;
+    };
+
+    namespace
+    {
+        // Size of the chunks requested to the upstream resource to refill a size class
+        constexpr std::size_t pool_chunk_size = 64 * 1024;
+    }
+
+    pool_memory_resource::pool_memory_resource(std::size_t max_block_size, std::pmr::memory_resource* upstream)
+        : p_upstream(upstream)
+        , m_max_block_size(std::bit_ceil(std::clamp(
+              max_block_size,
+              buffer_alignment,
+              buffer_alignment << (max_size_class_count - 1)
+          )))
+    {
+    }
+
+    pool_memory_resource::~pool_memory_resource()
+    {
+        check_no_block_in_use(m_blocks_in_use);
+        release();
+    }
+
+    void pool_memory_resource::release() noexcept
+    {
+        while (p_chunks != nullptr)
+        {
+            chunk_header* next = p_chunks->next;
+            p_upstream->deallocate(p_chunks, p_chunks->size, buffer_alignment);
+            p_chunks = next;
+        }
+        m_free_lists.fill(nullptr);
+        m_blocks_in_use = 0;
+    }
+
+    std::size_t pool_memory_resource::max_block_size() const noexcept
+    {
+        return m_max_block_size;
+    }
+
+    std::pmr::memory_resource* pool_memory_resource::upstream_resource() const noexcept
+    {
+        return p_upstream;
+    }
+
+    void* pool_memory_resource::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if (bytes > m_max_block_size || alignment > buffer_alignment)
+        {
+            void* p = p_upstream->allocate(bytes, std::max(alignment, buffer_alignment));
+            ++m_blocks_in_use;
+            return p;
+        }
+        const std::size_t index = size_class(bytes);
+        if (m_free_lists[index] == nullptr)
+        {
+            refill(index);
+        }
+        free_block* block = m_free_lists[index];
+        m_free_lists[index] = block->next;
+        ++m_blocks_in_use;
+        return block;
+    }
+
+    void pool_memory_resource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+    {
+        // Empty buffers give back a null pointer
+        if (p == nullptr)
+        {
+            return;
+        }
+        if (m_blocks_in_use != 0)
+        {
+            --m_blocks_in_use;
+        }
+        if (bytes > m_max_block_size || alignment > buffer_alignment)
+        {
+            p_upstream->deallocate(p, bytes, std::max(alignment, buffer_alignment));
+            return;
+        }
+        const std::size_t index = size_class(bytes);
+        m_free_lists[index] = new (p) free_block{m_free_lists[index]};
+    }
+
+    bool pool_memory_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+    std::size_t pool_memory_resource::size_class(std::size_t bytes) const noexcept
+    {
+        const std::size_t block_size = std::bit_ceil(std::max(bytes, buffer_alignment));
+        return static_cast<std::size_t>(std::countr_zero(block_size) - std::countr_zero(buffer_alignment));
+    }
+
+    void pool_memory_resource::refill(std::size_t size_class)
+    {
+        const std::size_t block_size = buffer_alignment << size_class;
+        const std::size_t block_count = std::max(std::size_t(1), pool_chunk_size / block_size);
+        const std::size_t size = chunk_header_size + block_count * block_size;
+        auto* mem = static_cast<std::byte*>(p_upstream->allocate(size, buffer_alignment));
+        p_chunks = new (mem) chunk_header{p_chunks, size};
+
+        free_block* head = m_free_lists[size_class];
+        for (std::size_t i = block_count; i > 0; --i)
+        {
+            head = new (mem + chunk_header_size + (i - 1) * block_size) free_block{head};
+        }
+        m_free_lists[size_class] = head;
+    }
+}
@@ -0,0 +1,196 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/chunked_array.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /*****************************************
+     * chunked_array_iterator implementation *
+     *****************************************/
+
+    chunked_array_iterator::chunked_array_iterator(const chunked_array* array, std::size_t index)
+        : p_array(array)
+    {
+        locate(index);
+    }
+
+    auto chunked_array_iterator::dereference() const -> reference
+    {
+        return p_array->chunk(m_chunk)[m_index - m_chunk_start];
+    }
+
+    void chunked_array_iterator::increment()
+    {
+        ++m_index;
+        if (m_index == m_chunk_end && m_index != p_array->size())
+        {
+            locate(m_index);
+        }
+    }
+
+    void chunked_array_iterator::decrement()
+    {
+        --m_index;
+        if (m_index < m_chunk_start)
+        {
+            locate(m_index);
+        }
+    }
+
+    void chunked_array_iterator::advance(difference_type n)
+    {
+        m_index = static_cast<std::size_t>(static_cast<difference_type>(m_index) + n);
+        if (m_index < m_chunk_start || m_index >= m_chunk_end)
+        {
+            locate(m_index);
+        }
+    }
+
+    void chunked_array_iterator::locate(std::size_t index)
+    {
+        m_index = index;
+        if (index >= p_array->size())
+        {
+            // The end iterator is attached to the last chunk, so that decrementing it does
+            // not search the chunks.
+            m_chunk = p_array->chunk_count() == 0 ? 0 : p_array->chunk_count() - 1;
+            m_chunk_start = p_array->chunk_count() == 0 ? 0 : p_array->chunk_offset(m_chunk);
+            m_chunk_end = p_array->size();
+            return;
+        }
+        m_chunk = p_array->locate(index).first;
+        m_chunk_start = p_array->chunk_offset(m_chunk);
+        m_chunk_end = p_array->chunk_offset(m_chunk + 1);
+    }
+
+    /********************************
+     * chunked_array implementation *
+     ********************************/
+
+    chunked_array::chunked_array(std::vector<array> chunks)
+    {
+        m_chunks.reserve(chunks.size());
+        m_chunk_offsets.reserve(chunks.size() + 1);
+        for (auto& c : chunks)
+        {
+            add_chunk(std::move(c));
+        }
+    }
+
+    enum data_type chunked_array::data_type() const
+    {
+        return m_chunks.empty() ? data_type::NA : m_chunks.front().data_type();
+    }
+
+    std::optional<std::string_view> chunked_array::name() const
+    {
+        return m_chunks.empty() ? std::nullopt : m_chunks.front().name();
+    }
+
+    std::int64_t chunked_array::null_count() const
+    {
+        return std::accumulate(
+            m_chunks.cbegin(),
+            m_chunks.cend(),
+            std::int64_t(0),
+            [](std::int64_t count, const array& c)
+            {
+                return count + c.null_count();
+            }
+        );
+    }
+
+    const array& chunked_array::chunk(size_type index) const
+    {
+        SPARROW_ASSERT_TRUE(index < chunk_count());
+        return m_chunks[index];
+    }
+
+    auto chunked_array::chunk_offset(size_type index) const -> size_type
+    {
+        SPARROW_ASSERT_TRUE(index <= chunk_count());
+        return m_chunk_offsets[index];
+    }
+
+    auto chunked_array::locate(size_type index) const -> std::pair<size_type, size_type>
+    {
+        SPARROW_ASSERT_TRUE(index < size());
+        // The first chunk starting after index is right after the chunk holding it;
+        // empty chunks share their offset with the next chunk and are skipped.
+        const auto it = std::ranges::upper_bound(m_chunk_offsets, index);
+        const auto chunk_index = static_cast<size_type>(std::distance(m_chunk_offsets.cbegin(), it)) - 1;
+        return {chunk_index, index - m_chunk_offsets[chunk_index]};
+    }
+
+    auto chunked_array::at(size_type index) const -> const_reference
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range(
+                "chunked_array::at: index out of range for chunked array of size " + std::to_string(size())
+                + " at index " + std::to_string(index)
+            );
+        }
+        return (*this)[index];
+    }
+
+    auto chunked_array::operator[](size_type index) const -> const_reference
+    {
+        const auto [chunk_index, index_in_chunk] = locate(index);
+        return m_chunks[chunk_index][index_in_chunk];
+    }
+
+    auto chunked_array::begin() const -> const_iterator
+    {
+        return const_iterator(this, 0);
+    }
+
+    auto chunked_array::end() const -> const_iterator
+    {
+        return const_iterator(this, size());
+    }
+
+    void chunked_array::add_chunk(array chunk)
+    {
+        check_data_type(chunk);
+        m_chunk_offsets.push_back(m_chunk_offsets.back() + chunk.size());
+        m_chunks.push_back(std::move(chunk));
+    }
+
+    array chunked_array::combine_chunks() const
+    {
+        return concatenate(m_chunks);
+    }
+
+    void chunked_array::check_data_type(const array& chunk) const
+    {
+        if (!m_chunks.empty() && chunk.data_type() != m_chunks.front().data_type())
+        {
+            throw std::invalid_argument("The chunks of a chunked_array must have the same data type");
+        }
+    }
+
+    bool operator==(const chunked_array& lhs, const chunked_array& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+}
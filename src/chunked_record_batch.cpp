@@ -0,0 +1,137 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/chunked_record_batch.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    chunked_record_batch::chunked_record_batch(const std::vector<record_batch>& batches)
+    {
+        for (const auto& batch : batches)
+        {
+            add_batch(batch);
+        }
+    }
+
+    chunked_record_batch::chunked_record_batch(
+        std::vector<name_type> names,
+        std::vector<chunked_array> columns,
+        std::optional<name_type> name,
+        std::optional<std::vector<metadata_pair>> metadata
+    )
+        : m_name(std::move(name))
+        , m_metadata(std::move(metadata))
+        , m_names(std::move(names))
+        , m_columns(std::move(columns))
+    {
+        if (m_names.size() != m_columns.size())
+        {
+            throw std::invalid_argument("A chunked_record_batch needs as many names as columns");
+        }
+        for (size_type i = 0; i < m_names.size(); ++i)
+        {
+            if (!m_column_indices.emplace(m_names[i], i).second)
+            {
+                throw std::invalid_argument("Duplicate column name in chunked_record_batch: " + m_names[i]);
+            }
+        }
+        check_consistency();
+    }
+
+    bool chunked_record_batch::contains_column(const name_type& key) const
+    {
+        return m_column_indices.contains(key);
+    }
+
+    const chunked_array& chunked_record_batch::get_column(const name_type& key) const
+    {
+        const auto iter = m_column_indices.find(key);
+        if (iter == m_column_indices.end())
+        {
+            throw std::out_of_range("Column's name not found in chunked record batch");
+        }
+        return m_columns[iter->second];
+    }
+
+    const chunked_array& chunked_record_batch::get_column(size_type index) const
+    {
+        SPARROW_ASSERT_TRUE(index < nb_columns());
+        return m_columns[index];
+    }
+
+    auto chunked_record_batch::get_column_name(size_type index) const -> const name_type&
+    {
+        SPARROW_ASSERT_TRUE(index < nb_columns());
+        return m_names[index];
+    }
+
+    void chunked_record_batch::add_batch(const record_batch& batch)
+    {
+        if (m_columns.empty())
+        {
+            m_name = batch.name();
+            m_metadata = batch.metadata();
+            m_names.assign(batch.names().begin(), batch.names().end());
+            m_columns.resize(m_names.size());
+            for (size_type i = 0; i < m_names.size(); ++i)
+            {
+                m_column_indices.emplace(m_names[i], i);
+            }
+        }
+        else if (!std::ranges::equal(batch.names(), m_names))
+        {
+            throw std::invalid_argument("Cannot add a record batch with different columns to a chunked_record_batch");
+        }
+        // Checks the data types before modifying the columns, so that a failure leaves
+        // them unchanged.
+        for (size_type i = 0; i < m_columns.size(); ++i)
+        {
+            if (m_columns[i].chunk_count() != 0 && batch.get_column(i).data_type() != m_columns[i].data_type())
+            {
+                throw std::invalid_argument("Column '" + m_names[i] + "' has a different data type");
+            }
+        }
+        for (size_type i = 0; i < m_columns.size(); ++i)
+        {
+            m_columns[i].add_chunk(batch.get_column(i));
+        }
+    }
+
+    record_batch chunked_record_batch::combine_chunks() const
+    {
+        std::vector<array> columns;
+        columns.reserve(m_columns.size());
+        for (const auto& column : m_columns)
+        {
+            columns.push_back(column.combine_chunks());
+        }
+        return record_batch(m_names, std::move(columns), m_name, m_metadata);
+    }
+
+    void chunked_record_batch::check_consistency() const
+    {
+        for (const auto& column : m_columns)
+        {
+            if (column.size() != nb_rows())
+            {
+                throw std::invalid_argument("The columns of a chunked_record_batch must have the same length");
+            }
+        }
+    }
+}
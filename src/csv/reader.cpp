@@ -0,0 +1,1019 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/csv/reader.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "sparrow/date_array.hpp"
+#include "sparrow/ipc/memory_mapped_file.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/timestamp_array.hpp"
+#include "sparrow/u8_buffer.hpp"
+#include "sparrow/utils/parallel.hpp"
+#include "sparrow/variable_size_binary_array.hpp"
+#include "sparrow/variable_size_binary_view_array.hpp"
+
+namespace sparrow::csv
+{
+    namespace
+    {
+        // Rows and fields
+        // ===============
+
+        // Calls func(row, line_number) for each non empty row of \p text, until it returns
+        // false. A row ends at the first newline outside quotes, its trailing carriage
+        // return is removed. Like in for_each_field, only a quote at the start of a field
+        // opens a quoted field, a quote in the middle of an unquoted field is a plain character.
+        template <class F>
+        void for_each_row(std::string_view text, char delimiter, char quote, std::size_t first_line, F&& func)
+        {
+            const char separators[] = {delimiter, '\n'};
+            const std::string_view row_separators(separators, 2);
+            std::size_t line_number = first_line;
+            std::size_t begin = 0;
+            while (begin < text.size())
+            {
+                std::size_t end = begin;
+                std::size_t line_count = 1;
+                // Each iteration skips a field, end is at the start of a field
+                while (end < text.size())
+                {
+                    if (text[end] == quote)
+                    {
+                        // Skips the quoted field up to its closing quote, doubled quotes
+                        // included. An unterminated field runs to the end of the text.
+                        std::size_t pos = end + 1;
+                        while (true)
+                        {
+                            const std::size_t close = std::min(text.find(quote, pos), text.size());
+                            line_count += static_cast<std::size_t>(
+                                std::count(text.data() + pos, text.data() + close, '\n')
+                            );
+                            if (close + 1 < text.size() && text[close + 1] == quote)
+                            {
+                                pos = close + 2;
+                                continue;
+                            }
+                            end = std::min(close + 1, text.size());
+                            break;
+                        }
+                    }
+                    const std::size_t separator = text.find_first_of(row_separators, end);
+                    if (separator == std::string_view::npos)
+                    {
+                        end = text.size();
+                        break;
+                    }
+                    end = separator;
+                    if (text[end] == '\n')
+                    {
+                        break;
+                    }
+                    ++end;
+                }
+                std::string_view row = text.substr(begin, end - begin);
+                if (!row.empty() && row.back() == '\r')
+                {
+                    row.remove_suffix(1);
+                }
+                if (!row.empty() && !func(row, line_number))
+                {
+                    return;
+                }
+                begin = end + 1;
+                line_number += line_count;
+            }
+        }
+
+        // Calls func(index, field, quoted) for each field of \p row and returns the number
+        // of fields. The quoted fields holding doubled quotes are unescaped in \p scratch.
+        template <class F>
+        std::size_t
+        for_each_field(std::string_view row, char delimiter, char quote, std::string& scratch, F&& func)
+        {
+            std::size_t index = 0;
+            std::size_t pos = 0;
+            while (true)
+            {
+                std::string_view field;
+                const bool quoted = pos < row.size() && row[pos] == quote;
+                if (quoted)
+                {
+                    std::size_t close = row.find(quote, pos + 1);
+                    if (close == std::string_view::npos)
+                    {
+                        throw csv_error("Unterminated quoted field");
+                    }
+                    field = row.substr(pos + 1, close - pos - 1);
+                    if (close + 1 < row.size() && row[close + 1] == quote)
+                    {
+                        scratch.assign(field);
+                        while (close + 1 < row.size() && row[close + 1] == quote)
+                        {
+                            scratch.push_back(quote);
+                            const std::size_t next = row.find(quote, close + 2);
+                            if (next == std::string_view::npos)
+                            {
+                                throw csv_error("Unterminated quoted field");
+                            }
+                            scratch.append(row.substr(close + 2, next - close - 2));
+                            close = next;
+                        }
+                        field = scratch;
+                    }
+                    pos = close + 1;
+                    if (pos < row.size() && row[pos] != delimiter)
+                    {
+                        throw csv_error("Unexpected character after a quoted field");
+                    }
+                }
+                else
+                {
+                    const std::size_t end = std::min(row.find(delimiter, pos), row.size());
+                    field = row.substr(pos, end - pos);
+                    pos = end;
+                }
+                func(index, field, quoted);
+                ++index;
+                if (pos >= row.size())
+                {
+                    return index;
+                }
+                // Skips the delimiter
+                ++pos;
+            }
+        }
+
+        [[noreturn]] void throw_row_error(std::size_t line_number, std::string_view what)
+        {
+            throw csv_error("CSV line " + std::to_string(line_number) + ": " + std::string(what));
+        }
+
+        // Calls func() and prefixes the message of the errors it throws with the line number
+        template <class F>
+        void with_line_number(std::size_t line_number, F&& func)
+        {
+            try
+            {
+                func();
+            }
+            catch (const csv_error& e)
+            {
+                throw_row_error(line_number, e.what());
+            }
+        }
+
+        std::vector<std::string>
+        split_names(std::string_view row, const read_options& options, std::size_t line_number)
+        {
+            std::vector<std::string> names;
+            std::string scratch;
+            with_line_number(
+                line_number,
+                [&]()
+                {
+                    for_each_field(
+                        row,
+                        options.delimiter,
+                        options.quote,
+                        scratch,
+                        [&](std::size_t, std::string_view field, bool)
+                        {
+                            names.emplace_back(field);
+                        }
+                    );
+                }
+            );
+            return names;
+        }
+
+        // Values
+        // ======
+
+        bool parse_digits(std::string_view str, int& value)
+        {
+            value = 0;
+            for (const char c : str)
+            {
+                if (c < '0' || c > '9')
+                {
+                    return false;
+                }
+                value = value * 10 + (c - '0');
+            }
+            return !str.empty();
+        }
+
+        bool iequals(std::string_view lhs, std::string_view rhs)
+        {
+            return std::ranges::equal(
+                lhs,
+                rhs,
+                [](char l, char r)
+                {
+                    return (l | 0x20) == r;
+                }
+            );
+        }
+
+        std::optional<bool> parse_boolean(std::string_view str)
+        {
+            if (str == "1" || iequals(str, "true"))
+            {
+                return true;
+            }
+            if (str == "0" || iequals(str, "false"))
+            {
+                return false;
+            }
+            return std::nullopt;
+        }
+
+        template <class T>
+        std::optional<T> parse_number(std::string_view str)
+        {
+            T value{};
+            const char* end = str.data() + str.size();
+            const auto [ptr, ec] = std::from_chars(str.data(), end, value);
+            if (ec != std::errc{} || ptr != end)
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        // Days from 1970-01-01 to a date of the proleptic Gregorian calendar
+        std::int64_t days_from_civil(int year, int month, int day)
+        {
+            year -= month <= 2 ? 1 : 0;
+            const int era = (year >= 0 ? year : year - 399) / 400;
+            const int year_of_era = year - era * 400;
+            const int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+            const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+            return static_cast<std::int64_t>(era) * 146097 + day_of_era - 719468;
+        }
+
+        // Parses YYYY-MM-DD into days since the epoch
+        std::optional<std::int64_t> parse_date(std::string_view str)
+        {
+            int year = 0;
+            int month = 0;
+            int day = 0;
+            if (str.size() != 10 || str[4] != '-' || str[7] != '-' || !parse_digits(str.substr(0, 4), year)
+                || !parse_digits(str.substr(5, 2), month) || !parse_digits(str.substr(8, 2), day))
+            {
+                return std::nullopt;
+            }
+            static constexpr int month_days[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+            const bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+            if (month < 1 || month > 12 || day < 1 || day > month_days[month - 1] || (month == 2 && day == 29 && !leap))
+            {
+                return std::nullopt;
+            }
+            return days_from_civil(year, month, day);
+        }
+
+        // Parses YYYY-MM-DDThh:mm:ss[.fraction][Z|+hh:mm|-hh:mm] into microseconds since
+        // the epoch; the date and the time may also be separated by a space
+        std::optional<std::int64_t> parse_timestamp(std::string_view str)
+        {
+            if (str.size() < 19 || (str[10] != 'T' && str[10] != ' ') || str[13] != ':' || str[16] != ':')
+            {
+                return std::nullopt;
+            }
+            const std::optional<std::int64_t> days = parse_date(str.substr(0, 10));
+            int hour = 0;
+            int minute = 0;
+            int second = 0;
+            if (!days.has_value() || !parse_digits(str.substr(11, 2), hour)
+                || !parse_digits(str.substr(14, 2), minute) || !parse_digits(str.substr(17, 2), second)
+                || hour > 23 || minute > 59 || second > 59)
+            {
+                return std::nullopt;
+            }
+
+            std::size_t pos = 19;
+            std::int64_t microseconds = 0;
+            if (pos < str.size() && str[pos] == '.')
+            {
+                const std::size_t first_digit = ++pos;
+                std::int64_t scale = 1'000'000;
+                while (pos < str.size() && str[pos] >= '0' && str[pos] <= '9')
+                {
+                    // The digits beyond the microseconds are truncated
+                    if (scale > 1)
+                    {
+                        scale /= 10;
+                        microseconds += (str[pos] - '0') * scale;
+                    }
+                    ++pos;
+                }
+                if (pos == first_digit)
+                {
+                    return std::nullopt;
+                }
+            }
+
+            int offset_minutes = 0;
+            if (pos < str.size() && str[pos] == 'Z')
+            {
+                ++pos;
+            }
+            else if (pos < str.size() && (str[pos] == '+' || str[pos] == '-'))
+            {
+                const int sign = str[pos] == '-' ? -1 : 1;
+                const std::string_view offset = str.substr(pos + 1);
+                int offset_hour = 0;
+                int offset_minute = 0;
+                const bool valid = offset.size() == 5
+                                       ? offset[2] == ':' && parse_digits(offset.substr(0, 2), offset_hour)
+                                             && parse_digits(offset.substr(3, 2), offset_minute)
+                                       : offset.size() == 4 && parse_digits(offset.substr(0, 2), offset_hour)
+                                             && parse_digits(offset.substr(2, 2), offset_minute);
+                if (!valid)
+                {
+                    return std::nullopt;
+                }
+                offset_minutes = sign * (offset_hour * 60 + offset_minute);
+                pos = str.size();
+            }
+            if (pos != str.size())
+            {
+                return std::nullopt;
+            }
+
+            const std::int64_t minutes = (*days * 24 + hour) * 60 + minute - offset_minutes;
+            return (minutes * 60 + second) * 1'000'000 + microseconds;
+        }
+
+        // Dates are accepted as timestamps at midnight, see merge_types()
+        std::optional<std::int64_t> parse_timestamp_or_date(std::string_view str)
+        {
+            if (const std::optional<std::int64_t> days = parse_date(str); days.has_value())
+            {
+                return *days * 86'400'000'000;
+            }
+            return parse_timestamp(str);
+        }
+
+        bool is_null_value(std::string_view field, const std::vector<std::string>& null_values)
+        {
+            return std::ranges::find(null_values, field) != null_values.end();
+        }
+
+        bool is_string(column_type type)
+        {
+            return type == column_type::string || type == column_type::string_view;
+        }
+
+        // Schema inference
+        // ================
+
+        column_type field_type(std::string_view field)
+        {
+            if (iequals(field, "true") || iequals(field, "false"))
+            {
+                return column_type::boolean;
+            }
+            if (parse_number<std::int64_t>(field).has_value())
+            {
+                return column_type::int64;
+            }
+            if (parse_number<double>(field).has_value())
+            {
+                return column_type::float64;
+            }
+            if (parse_date(field).has_value())
+            {
+                return column_type::date;
+            }
+            if (parse_timestamp(field).has_value())
+            {
+                return column_type::timestamp;
+            }
+            return column_type::string;
+        }
+
+        column_type merge_types(column_type current, column_type observed)
+        {
+            if (current == observed)
+            {
+                return current;
+            }
+            const auto is_either = [&](column_type lhs, column_type rhs)
+            {
+                return (current == lhs && observed == rhs) || (current == rhs && observed == lhs);
+            };
+            if (is_either(column_type::int64, column_type::float64))
+            {
+                return column_type::float64;
+            }
+            if (is_either(column_type::date, column_type::timestamp))
+            {
+                return column_type::timestamp;
+            }
+            return column_type::string;
+        }
+
+        std::vector<column_spec> infer_types(
+            std::string_view text,
+            std::size_t first_line,
+            std::vector<std::string> names,
+            const read_options& options
+        )
+        {
+            // Columns without any value are not typed yet
+            std::vector<std::optional<column_type>> types(names.size());
+            std::string scratch;
+            std::size_t row_count = 0;
+            for_each_row(
+                text,
+                options.delimiter,
+                options.quote,
+                first_line,
+                [&](std::string_view row, std::size_t line_number)
+                {
+                    if (row_count == options.inference_rows)
+                    {
+                        return false;
+                    }
+                    with_line_number(
+                        line_number,
+                        [&]()
+                        {
+                            const std::size_t field_count = for_each_field(
+                                row,
+                                options.delimiter,
+                                options.quote,
+                                scratch,
+                                [&](std::size_t index, std::string_view field, bool quoted)
+                                {
+                                    if (index >= types.size())
+                                    {
+                                        return;
+                                    }
+                                    if (!quoted && is_null_value(field, options.null_values))
+                                    {
+                                        return;
+                                    }
+                                    // Quoted values are never inferred as numbers
+                                    const column_type observed = quoted ? column_type::string : field_type(field);
+                                    types[index] = types[index].has_value() ? merge_types(*types[index], observed)
+                                                                            : observed;
+                                }
+                            );
+                            if (field_count != types.size())
+                            {
+                                throw csv_error(
+                                    "Expected " + std::to_string(types.size()) + " fields, got "
+                                    + std::to_string(field_count)
+                                );
+                            }
+                        }
+                    );
+                    ++row_count;
+                    return true;
+                }
+            );
+
+            const column_type string_type = options.string_views ? column_type::string_view : column_type::string;
+            std::vector<column_spec> schema;
+            schema.reserve(names.size());
+            for (std::size_t i = 0; i < names.size(); ++i)
+            {
+                const column_type type = types[i].value_or(column_type::string);
+                schema.push_back({std::move(names[i]), type == column_type::string ? string_type : type});
+            }
+            return schema;
+        }
+
+        // Column builders
+        // ===============
+
+        std::int32_t to_offset(std::size_t size)
+        {
+            if (size > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+            {
+                throw csv_error("Column data exceeds the 32-bit offsets of a batch, reduce batch_size");
+            }
+            return static_cast<std::int32_t>(size);
+        }
+
+        // Binary view layout: the length, then either the inlined bytes or a prefix,
+        // the index of the data buffer and the offset of the bytes in this buffer
+        constexpr std::size_t view_size = 16;
+        constexpr std::size_t max_inline_size = 12;
+        constexpr std::size_t view_offset_position = 12;
+
+        /**
+         * Accumulates the values of a column in the buffers of its array. A builder only
+         * uses the buffers of its type: the integers hold the int64 and timestamp values,
+         * the views and bytes those of the string views.
+         */
+        class column_builder
+        {
+        public:
+
+            column_builder(column_type type, const std::vector<std::string>& null_values)
+                : m_type(type)
+                , p_null_values(&null_values)
+                , m_validity(validity_bitmap::default_allocator())
+                , m_integers(0)
+                , m_doubles(0)
+                , m_days(0)
+                , m_chars(0)
+                , m_offsets(0)
+                , m_views(0)
+                , m_bytes(0)
+            {
+                if (m_type == column_type::string)
+                {
+                    m_offsets.push_back(0);
+                }
+            }
+
+            void append(std::string_view field, bool quoted)
+            {
+                // Quoted strings are never null, so that an empty string can be written as ""
+                if ((!quoted || !is_string(m_type)) && is_null_value(field, *p_null_values))
+                {
+                    append_null();
+                    return;
+                }
+                switch (m_type)
+                {
+                    case column_type::boolean:
+                        m_booleans.push_back(parse_or_throw(parse_boolean(field), field));
+                        break;
+                    case column_type::int64:
+                        m_integers.push_back(parse_or_throw(parse_number<std::int64_t>(field), field));
+                        break;
+                    case column_type::float64:
+                        m_doubles.push_back(parse_or_throw(parse_number<double>(field), field));
+                        break;
+                    case column_type::string:
+                        m_chars.insert(m_chars.cend(), field.begin(), field.end());
+                        m_offsets.push_back(to_offset(m_chars.size()));
+                        break;
+                    case column_type::string_view:
+                        append_view(field);
+                        break;
+                    case column_type::date:
+                    {
+                        const std::int64_t days = parse_or_throw(parse_date(field), field);
+                        m_days.push_back(date_days{chrono::days{static_cast<std::int32_t>(days)}});
+                        break;
+                    }
+                    case column_type::timestamp:
+                        m_integers.push_back(parse_or_throw(parse_timestamp_or_date(field), field));
+                        break;
+                }
+                m_validity.push_back(true);
+                ++m_size;
+            }
+
+            void append_null()
+            {
+                switch (m_type)
+                {
+                    case column_type::boolean:
+                        m_booleans.push_back(false);
+                        break;
+                    case column_type::int64:
+                    case column_type::timestamp:
+                        m_integers.push_back(0);
+                        break;
+                    case column_type::float64:
+                        m_doubles.push_back(0.);
+                        break;
+                    case column_type::string:
+                        m_offsets.push_back(m_offsets.back());
+                        break;
+                    case column_type::string_view:
+                        m_views.resize(m_views.size() + view_size, 0);
+                        break;
+                    case column_type::date:
+                        m_days.push_back(date_days{});
+                        break;
+                }
+                m_validity.push_back(false);
+                ++m_size;
+            }
+
+            // Appends the values of a builder of the same column
+            void append(column_builder&& other)
+            {
+                m_validity.insert(m_validity.cend(), other.m_validity.cbegin(), other.m_validity.cend());
+                switch (m_type)
+                {
+                    case column_type::boolean:
+                        m_booleans.insert(m_booleans.end(), other.m_booleans.begin(), other.m_booleans.end());
+                        break;
+                    case column_type::int64:
+                    case column_type::timestamp:
+                        m_integers.insert(m_integers.cend(), other.m_integers.cbegin(), other.m_integers.cend());
+                        break;
+                    case column_type::float64:
+                        m_doubles.insert(m_doubles.cend(), other.m_doubles.cbegin(), other.m_doubles.cend());
+                        break;
+                    case column_type::string:
+                    {
+                        const std::size_t base = m_chars.size();
+                        for (std::size_t i = 1; i < other.m_offsets.size(); ++i)
+                        {
+                            m_offsets.push_back(to_offset(base + static_cast<std::size_t>(other.m_offsets[i])));
+                        }
+                        m_chars.insert(m_chars.cend(), other.m_chars.cbegin(), other.m_chars.cend());
+                        break;
+                    }
+                    case column_type::string_view:
+                        append_views(other);
+                        break;
+                    case column_type::date:
+                        m_days.insert(m_days.cend(), other.m_days.cbegin(), other.m_days.cend());
+                        break;
+                }
+                m_size += other.m_size;
+            }
+
+            array finish(const std::string& name)
+            {
+                switch (m_type)
+                {
+                    case column_type::boolean:
+                        return array{primitive_array<bool>{std::move(m_booleans), std::move(m_validity), name}};
+                    case column_type::int64:
+                        return array{
+                            primitive_array<std::int64_t>{std::move(m_integers), m_size, std::move(m_validity), name}
+                        };
+                    case column_type::float64:
+                        return array{primitive_array<double>{std::move(m_doubles), m_size, std::move(m_validity), name}};
+                    case column_type::string:
+                        return array{string_array{std::move(m_chars), std::move(m_offsets), std::move(m_validity), name}};
+                    case column_type::string_view:
+                    {
+                        std::vector<u8_buffer<std::uint8_t>> data_buffers;
+                        data_buffers.push_back(std::move(m_bytes));
+                        return array{string_view_array{
+                            m_size,
+                            std::move(m_views),
+                            std::move(data_buffers),
+                            std::move(m_validity),
+                            name
+                        }};
+                    }
+                    case column_type::date:
+                        return array{date_days_array{std::move(m_days), m_size, std::move(m_validity), name}};
+                    case column_type::timestamp:
+                        return array{timestamp_microseconds_array{
+                            utc_zone(),
+                            std::move(m_integers),
+                            std::move(m_validity),
+                            name
+                        }};
+                }
+                throw csv_error("Invalid column type");
+            }
+
+        private:
+
+            template <class T>
+            static T parse_or_throw(const std::optional<T>& value, std::string_view field)
+            {
+                if (!value.has_value())
+                {
+                    throw csv_error("Invalid value: " + std::string(field));
+                }
+                return *value;
+            }
+
+            static const date::time_zone* utc_zone()
+            {
+                static const date::time_zone* zone = date::locate_zone("UTC");
+                return zone;
+            }
+
+            void append_view(std::string_view field)
+            {
+                const std::size_t position = m_views.size();
+                m_views.resize(position + view_size, 0);
+                std::uint8_t* view = m_views.data() + position;
+                const std::int32_t length = to_offset(field.size());
+                std::memcpy(view, &length, sizeof(length));
+                if (field.size() <= max_inline_size)
+                {
+                    std::memcpy(view + sizeof(length), field.data(), field.size());
+                    return;
+                }
+                // The prefix, then the data buffer index, which stays 0
+                std::memcpy(view + sizeof(length), field.data(), sizeof(std::int32_t));
+                const std::int32_t offset = to_offset(m_bytes.size());
+                std::memcpy(view + view_offset_position, &offset, sizeof(offset));
+                const auto* bytes = reinterpret_cast<const std::uint8_t*>(field.data());
+                m_bytes.insert(m_bytes.cend(), bytes, bytes + field.size());
+            }
+
+            void append_views(const column_builder& other)
+            {
+                const std::size_t position = m_views.size();
+                const std::size_t base = m_bytes.size();
+                m_views.insert(m_views.cend(), other.m_views.cbegin(), other.m_views.cend());
+                m_bytes.insert(m_bytes.cend(), other.m_bytes.cbegin(), other.m_bytes.cend());
+                if (base == 0)
+                {
+                    return;
+                }
+                // The bytes of the long strings of other now start at base
+                for (std::size_t i = position; i < m_views.size(); i += view_size)
+                {
+                    std::uint8_t* view = m_views.data() + i;
+                    std::int32_t length = 0;
+                    std::memcpy(&length, view, sizeof(length));
+                    if (static_cast<std::size_t>(length) > max_inline_size)
+                    {
+                        std::int32_t offset = 0;
+                        std::memcpy(&offset, view + view_offset_position, sizeof(offset));
+                        offset = to_offset(base + static_cast<std::size_t>(offset));
+                        std::memcpy(view + view_offset_position, &offset, sizeof(offset));
+                    }
+                }
+            }
+
+            column_type m_type;
+            const std::vector<std::string>* p_null_values;
+            std::size_t m_size = 0;
+            validity_bitmap m_validity;
+            std::vector<bool> m_booleans;
+            u8_buffer<std::int64_t> m_integers;
+            u8_buffer<double> m_doubles;
+            u8_buffer<date_days> m_days;
+            u8_buffer<char> m_chars;
+            u8_buffer<std::int32_t> m_offsets;
+            u8_buffer<std::uint8_t> m_views;
+            u8_buffer<std::uint8_t> m_bytes;
+        };
+
+        // Reading
+        // =======
+
+        // Consecutive rows of the same batch, parsed by a single task
+        struct row_block
+        {
+            std::size_t begin;
+            std::size_t end;
+            std::size_t first_line;
+            std::size_t batch;
+        };
+
+        std::vector<row_block> split_blocks(
+            std::string_view text,
+            std::size_t first_line,
+            const read_options& options
+        )
+        {
+            std::vector<row_block> blocks;
+            std::size_t block_rows = 0;
+            std::size_t row_count = 0;
+            for_each_row(
+                text,
+                options.delimiter,
+                options.quote,
+                first_line,
+                [&](std::string_view row, std::size_t line_number)
+                {
+                    const auto offset = static_cast<std::size_t>(row.data() - text.data());
+                    if (block_rows == options.block_size || row_count % options.batch_size == 0)
+                    {
+                        blocks.push_back({offset, offset, line_number, row_count / options.batch_size});
+                        block_rows = 0;
+                    }
+                    blocks.back().end = offset + row.size();
+                    ++block_rows;
+                    ++row_count;
+                    return true;
+                }
+            );
+            return blocks;
+        }
+
+        void parse_block(
+            std::string_view text,
+            const row_block& block,
+            const read_options& options,
+            std::vector<column_builder>& builders
+        )
+        {
+            std::string scratch;
+            for_each_row(
+                text.substr(block.begin, block.end - block.begin),
+                options.delimiter,
+                options.quote,
+                block.first_line,
+                [&](std::string_view row, std::size_t line_number)
+                {
+                    with_line_number(
+                        line_number,
+                        [&]()
+                        {
+                            const std::size_t field_count = for_each_field(
+                                row,
+                                options.delimiter,
+                                options.quote,
+                                scratch,
+                                [&](std::size_t index, std::string_view field, bool quoted)
+                                {
+                                    if (index < builders.size())
+                                    {
+                                        builders[index].append(field, quoted);
+                                    }
+                                }
+                            );
+                            if (field_count != builders.size())
+                            {
+                                throw csv_error(
+                                    "Expected " + std::to_string(builders.size()) + " fields, got "
+                                    + std::to_string(field_count)
+                                );
+                            }
+                        }
+                    );
+                    return true;
+                }
+            );
+        }
+
+        // Splits the header row, if any, from the data rows
+        struct csv_layout
+        {
+            std::vector<std::string> names;
+            std::string_view data;
+            std::size_t first_line = 1;
+        };
+
+        csv_layout read_layout(std::string_view text, const read_options& options)
+        {
+            csv_layout layout{{}, text, 1};
+            // The first row gives the names, or the number of columns
+            std::optional<std::string_view> first_row;
+            std::size_t first_row_line = 1;
+            for_each_row(
+                text,
+                options.delimiter,
+                options.quote,
+                1,
+                [&](std::string_view row, std::size_t line_number)
+                {
+                    first_row = row;
+                    first_row_line = line_number;
+                    return false;
+                }
+            );
+            if (!first_row.has_value())
+            {
+                return layout;
+            }
+            layout.names = split_names(*first_row, options, first_row_line);
+            if (options.header)
+            {
+                const auto end = static_cast<std::size_t>(first_row->data() - text.data()) + first_row->size();
+                layout.data = text.substr(std::min(end + 1, text.size()));
+                layout.first_line = first_row_line
+                                    + static_cast<std::size_t>(std::count(first_row->begin(), first_row->end(), '\n'))
+                                    + 1;
+            }
+            else
+            {
+                for (std::size_t i = 0; i < layout.names.size(); ++i)
+                {
+                    layout.names[i] = "f" + std::to_string(i);
+                }
+            }
+            return layout;
+        }
+
+        std::vector<column_spec> resolve_schema(const read_options& options, csv_layout& layout)
+        {
+            if (!options.schema.has_value())
+            {
+                return infer_types(layout.data, layout.first_line, layout.names, options);
+            }
+            if (!layout.names.empty() && layout.names.size() != options.schema->size())
+            {
+                throw csv_error(
+                    "The schema has " + std::to_string(options.schema->size()) + " columns, the CSV data has "
+                    + std::to_string(layout.names.size())
+                );
+            }
+            return *options.schema;
+        }
+    }
+
+    std::vector<column_spec> infer_schema(std::string_view csv, const read_options& options)
+    {
+        csv_layout layout = read_layout(csv, options);
+        return infer_types(layout.data, layout.first_line, std::move(layout.names), options);
+    }
+
+    std::vector<record_batch> read_csv(std::string_view csv, const read_options& options)
+    {
+        if (options.batch_size == 0 || options.block_size == 0)
+        {
+            throw std::invalid_argument("batch_size and block_size must be positive");
+        }
+        csv_layout layout = read_layout(csv, options);
+        const std::vector<column_spec> schema = resolve_schema(options, layout);
+
+        const std::vector<row_block> blocks = split_blocks(layout.data, layout.first_line, options);
+        if (blocks.empty())
+        {
+            return {};
+        }
+
+        std::size_t max_tasks = parallel_task_count(blocks.size(), 1);
+        if (options.max_threads != 0)
+        {
+            max_tasks = std::min(max_tasks, options.max_threads);
+        }
+
+        std::vector<std::vector<column_builder>> builders(blocks.size());
+        for (auto& block_builders : builders)
+        {
+            block_builders.reserve(schema.size());
+            for (const auto& column : schema)
+            {
+                block_builders.emplace_back(column.type, options.null_values);
+            }
+        }
+        parallel_for(
+            blocks.size(),
+            [&](std::size_t i)
+            {
+                parse_block(layout.data, blocks[i], options, builders[i]);
+            },
+            max_tasks
+        );
+
+        // The blocks of a batch are concatenated into the builders of its first block
+        const std::size_t batch_count = blocks.back().batch + 1;
+        std::vector<std::size_t> first_blocks(batch_count + 1, blocks.size());
+        for (std::size_t i = blocks.size(); i-- > 0;)
+        {
+            first_blocks[blocks[i].batch] = i;
+        }
+
+        std::vector<std::string> names;
+        names.reserve(schema.size());
+        for (const auto& column : schema)
+        {
+            names.push_back(column.name);
+        }
+        std::vector<record_batch> batches(batch_count);
+        parallel_for(
+            batch_count,
+            [&](std::size_t batch)
+            {
+                std::vector<column_builder>& batch_builders = builders[first_blocks[batch]];
+                std::vector<array> columns;
+                columns.reserve(schema.size());
+                for (std::size_t column = 0; column < schema.size(); ++column)
+                {
+                    column_builder& builder = batch_builders[column];
+                    for (std::size_t i = first_blocks[batch] + 1; i < first_blocks[batch + 1]; ++i)
+                    {
+                        builder.append(std::move(builders[i][column]));
+                    }
+                    columns.push_back(builder.finish(names[column]));
+                }
+                batches[batch] = record_batch{names, std::move(columns)};
+            },
+            max_tasks
+        );
+        return batches;
+    }
+
+    std::vector<record_batch> read_csv_file(const std::filesystem::path& path, const read_options& options)
+    {
+        const ipc::memory_mapped_file file(path);
+        const auto data = file.data();
+        return read_csv(std::string_view(reinterpret_cast<const char*>(data.data()), data.size()), options);
+    }
+}
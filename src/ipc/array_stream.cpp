@@ -0,0 +1,266 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/array_stream.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+#include "sparrow/arrow_interface/arrow_array_stream.hpp"
+#include "sparrow/ipc/reader.hpp"
+#include "sparrow/utils/bit.hpp"
+
+#if defined(_WIN32)
+#    include <io.h>
+#else
+#    include <fcntl.h>
+#    include <poll.h>
+#    include <unistd.h>
+#endif
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+#if !defined(_WIN32)
+        // Waits until \p fd is readable. Throws if \p cancel_fd becomes readable first.
+        void wait_readable(int fd, int cancel_fd)
+        {
+            std::array<pollfd, 2> fds = {pollfd{fd, POLLIN, 0}, pollfd{cancel_fd, POLLIN, 0}};
+            while (::poll(fds.data(), fds.size(), -1) < 0)
+            {
+                if (errno != EINTR)
+                {
+                    throw std::system_error(errno, std::generic_category(), "Cannot read Arrow IPC stream");
+                }
+            }
+            if (fds[1].revents != 0)
+            {
+                throw std::system_error(ECANCELED, std::generic_category(), "Arrow IPC stream read cancelled");
+            }
+        }
+#endif
+
+        // Reads \p size bytes from \p fd. Returns false if the end of the input is reached
+        // before the first byte and \p allow_end is true. If \p cancel_fd is not -1, the read
+        // is interrupted when it becomes readable.
+        bool read_exactly(int fd, void* data, std::size_t size, bool allow_end = false, [[maybe_unused]] int cancel_fd = -1)
+        {
+            auto* position = static_cast<std::uint8_t*>(data);
+            std::size_t remaining = size;
+            while (remaining != 0)
+            {
+#if !defined(_WIN32)
+                if (cancel_fd != -1)
+                {
+                    wait_readable(fd, cancel_fd);
+                }
+#endif
+#if defined(_WIN32)
+                const auto count = ::_read(fd, position, static_cast<unsigned>(std::min<std::size_t>(remaining, INT_MAX)));
+#else
+                const auto count = ::read(fd, position, remaining);
+#endif
+                if (count < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(), "Cannot read Arrow IPC stream");
+                }
+                if (count == 0)
+                {
+                    if (allow_end && remaining == size)
+                    {
+                        return false;
+                    }
+                    throw ipc_error("Truncated IPC message");
+                }
+                position += count;
+                remaining -= static_cast<std::size_t>(count);
+            }
+            return true;
+        }
+
+        // Reads the messages of the stream one by one, each of them in its own
+        // buffer shared by the arrays decoded from it
+        class message_source
+        {
+        public:
+
+            message_source(int fd, std::size_t max_body_length)
+                : m_fd(fd)
+                , m_max_body_length(max_body_length)
+            {
+            }
+
+            message_source(const message_source&) = delete;
+            message_source& operator=(const message_source&) = delete;
+
+            ~message_source()
+            {
+#if !defined(_WIN32)
+                for (const int fd : m_cancel_pipe)
+                {
+                    if (fd != -1)
+                    {
+                        ::close(fd);
+                    }
+                }
+#endif
+            }
+
+            /**
+             * Makes the reads interruptible by cancel(). On Windows, the reads cannot
+             * be interrupted and this does nothing.
+             */
+            void enable_cancellation()
+            {
+#if !defined(_WIN32)
+                if (::pipe(m_cancel_pipe.data()) != 0)
+                {
+                    throw std::system_error(errno, std::generic_category(), "Cannot create the cancellation pipe");
+                }
+                for (const int fd : m_cancel_pipe)
+                {
+                    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+                }
+#endif
+            }
+
+            // Interrupts a pending read, and makes the following ones fail
+            void cancel() noexcept
+            {
+#if !defined(_WIN32)
+                if (m_cancel_pipe[1] != -1)
+                {
+                    const char byte = 0;
+                    [[maybe_unused]] const auto count = ::write(m_cancel_pipe[1], &byte, 1);
+                }
+#endif
+            }
+
+            std::optional<ArrowArray> next()
+            {
+                std::optional<ArrowArray> batch;
+                while (read_message(batch))
+                {
+                    if (batch.has_value())
+                    {
+                        return batch;
+                    }
+                }
+                return std::nullopt;
+            }
+
+            /**
+             * Reads and decodes the next message. Returns false at the end of the stream.
+             */
+            bool read_message(std::optional<ArrowArray>& batch)
+            {
+                std::uint32_t metadata_length = 0;
+                // The end-of-stream marker is optional
+                if (!read_exactly(m_fd, &metadata_length, sizeof(metadata_length), true, m_cancel_pipe[0]))
+                {
+                    return false;
+                }
+                if (metadata_length == format::continuation_marker)
+                {
+                    read_exactly(m_fd, &metadata_length, sizeof(metadata_length), false, m_cancel_pipe[0]);
+                }
+                // The lengths of the IPC format are little-endian
+                metadata_length = to_native_endian<std::endian::little>(metadata_length);
+                if (metadata_length == 0)
+                {
+                    return false;
+                }
+                std::vector<std::uint8_t> metadata(metadata_length);
+                read_exactly(m_fd, metadata.data(), metadata.size(), false, m_cancel_pipe[0]);
+
+                // The body is stored in words so that its buffers are aligned
+                const std::size_t body_length = message_decoder::body_length(metadata);
+                if (body_length > m_max_body_length)
+                {
+                    throw ipc_error("IPC message body larger than array_stream_options::max_body_length");
+                }
+                const std::shared_ptr<std::uint64_t[]> body(new std::uint64_t[std::max<std::size_t>((body_length + 7) / 8, 1)]);
+                read_exactly(m_fd, body.get(), body_length, false, m_cancel_pipe[0]);
+                const std::span<const std::uint8_t> body_span(reinterpret_cast<const std::uint8_t*>(body.get()), body_length);
+                batch = m_decoder.decode_array(metadata, body_span, body);
+                return true;
+            }
+
+            [[nodiscard]] const message_decoder& decoder() const noexcept
+            {
+                return m_decoder;
+            }
+
+        private:
+
+            int m_fd;
+            std::size_t m_max_body_length;
+            // Read end and write end of the pipe interrupting the reads, -1 if disabled
+            std::array<int, 2> m_cancel_pipe = {-1, -1};
+            message_decoder m_decoder;
+        };
+    }
+
+    ArrowArrayStream make_arrow_array_stream(int file_descriptor, array_stream_options options)
+    {
+        auto source = std::make_shared<message_source>(file_descriptor, options.max_body_length);
+        source_stream_options stream_options;
+        if (options.prefetch)
+        {
+            source->enable_cancellation();
+            stream_options.prefetch = true;
+            stream_options.cancel = [source]()
+            {
+                source->cancel();
+            };
+        }
+        // The schema is the first message of the stream
+        std::optional<ArrowArray> first;
+        if (!source->read_message(first) || !source->decoder().has_schema())
+        {
+            throw ipc_error("Arrow IPC stream without schema");
+        }
+        schema_unique_ptr schema{new ArrowSchema(source->decoder().arrow_schema()), arrow_schema_deleter{}};
+
+        ArrowArrayStream stream{};
+        fill_arrow_array_stream(
+            stream,
+            std::move(schema),
+            [source]() -> array_unique_ptr
+            {
+                auto batch = source->next();
+                if (!batch.has_value())
+                {
+                    return nullptr;
+                }
+                return array_unique_ptr{new ArrowArray(*batch), arrow_array_deleter{}};
+            },
+            std::move(stream_options)
+        );
+        return stream;
+    }
+}
@@ -0,0 +1,175 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/compression.hpp"
+
+#include <string>
+
+#include "sparrow/ipc/flatbuffer.hpp"
+
+#if defined(SPARROW_WITH_LZ4)
+#    include <lz4frame.h>
+#endif
+
+#if defined(SPARROW_WITH_ZSTD)
+#    include <zstd.h>
+#endif
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+        [[noreturn]] void throw_unavailable(compression_codec codec)
+        {
+            throw ipc_error(
+                std::string(codec == compression_codec::lz4_frame ? "LZ4 frame" : "ZSTD")
+                + " compression is not available in this build of sparrow"
+            );
+        }
+
+#if defined(SPARROW_WITH_LZ4)
+        void lz4_compress(std::span<const std::uint8_t> data, std::vector<std::uint8_t>& out)
+        {
+            const std::size_t start = out.size();
+            out.resize(start + LZ4F_compressFrameBound(data.size(), nullptr));
+            const std::size_t size = LZ4F_compressFrame(out.data() + start, out.size() - start, data.data(), data.size(), nullptr);
+            if (LZ4F_isError(size))
+            {
+                throw ipc_error(std::string("LZ4 compression failed: ") + LZ4F_getErrorName(size));
+            }
+            out.resize(start + size);
+        }
+
+        void lz4_decompress(std::span<const std::uint8_t> data, std::span<std::uint8_t> out)
+        {
+            LZ4F_dctx* context = nullptr;
+            if (LZ4F_isError(LZ4F_createDecompressionContext(&context, LZ4F_VERSION)))
+            {
+                throw ipc_error("Cannot create LZ4 decompression context");
+            }
+            std::size_t read = 0;
+            std::size_t written = 0;
+            // Hint of the number of bytes still expected, 0 once the frame is complete
+            std::size_t result = 1;
+            while (result != 0 && !LZ4F_isError(result))
+            {
+                std::size_t src_size = data.size() - read;
+                std::size_t dst_size = out.size() - written;
+                result = LZ4F_decompress(context, out.data() + written, &dst_size, data.data() + read, &src_size, nullptr);
+                read += src_size;
+                written += dst_size;
+                if (src_size == 0 && dst_size == 0)
+                {
+                    // Truncated input or output too small
+                    break;
+                }
+            }
+            LZ4F_freeDecompressionContext(context);
+            if (LZ4F_isError(result) || result != 0 || written != out.size())
+            {
+                throw ipc_error("Corrupted LZ4 compressed IPC buffer");
+            }
+        }
+#endif
+
+#if defined(SPARROW_WITH_ZSTD)
+        void zstd_compress(std::span<const std::uint8_t> data, std::vector<std::uint8_t>& out)
+        {
+            const std::size_t start = out.size();
+            out.resize(start + ZSTD_compressBound(data.size()));
+            const std::size_t size = ZSTD_compress(out.data() + start, out.size() - start, data.data(), data.size(), 1);
+            if (ZSTD_isError(size))
+            {
+                throw ipc_error(std::string("ZSTD compression failed: ") + ZSTD_getErrorName(size));
+            }
+            out.resize(start + size);
+        }
+
+        void zstd_decompress(std::span<const std::uint8_t> data, std::span<std::uint8_t> out)
+        {
+            const std::size_t size = ZSTD_decompress(out.data(), out.size(), data.data(), data.size());
+            if (ZSTD_isError(size) || size != out.size())
+            {
+                throw ipc_error("Corrupted ZSTD compressed IPC buffer");
+            }
+        }
+#endif
+    }
+
+    bool is_codec_available(compression_codec codec) noexcept
+    {
+        switch (codec)
+        {
+            case compression_codec::lz4_frame:
+#if defined(SPARROW_WITH_LZ4)
+                return true;
+#else
+                return false;
+#endif
+            case compression_codec::zstd:
+#if defined(SPARROW_WITH_ZSTD)
+                return true;
+#else
+                return false;
+#endif
+        }
+        return false;
+    }
+
+    void compress(
+        compression_codec codec,
+        [[maybe_unused]] std::span<const std::uint8_t> data,
+        [[maybe_unused]] std::vector<std::uint8_t>& out
+    )
+    {
+        switch (codec)
+        {
+#if defined(SPARROW_WITH_LZ4)
+            case compression_codec::lz4_frame:
+                lz4_compress(data, out);
+                return;
+#endif
+#if defined(SPARROW_WITH_ZSTD)
+            case compression_codec::zstd:
+                zstd_compress(data, out);
+                return;
+#endif
+            default:
+                throw_unavailable(codec);
+        }
+    }
+
+    void decompress(
+        compression_codec codec,
+        [[maybe_unused]] std::span<const std::uint8_t> data,
+        [[maybe_unused]] std::span<std::uint8_t> out
+    )
+    {
+        switch (codec)
+        {
+#if defined(SPARROW_WITH_LZ4)
+            case compression_codec::lz4_frame:
+                lz4_decompress(data, out);
+                return;
+#endif
+#if defined(SPARROW_WITH_ZSTD)
+            case compression_codec::zstd:
+                zstd_decompress(data, out);
+                return;
+#endif
+            default:
+                throw_unavailable(codec);
+        }
+    }
+}
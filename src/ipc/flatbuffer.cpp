@@ -0,0 +1,304 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/flatbuffer.hpp"
+
+#include <algorithm>
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+        constexpr std::size_t uoffset_size = sizeof(std::uint32_t);
+
+        void pad_to(std::vector<std::uint8_t>& out, std::size_t alignment, std::size_t shift = 0)
+        {
+            while ((out.size() + shift) % alignment != 0)
+            {
+                out.push_back(0);
+            }
+        }
+
+        template <class T>
+        void append(std::vector<std::uint8_t>& out, T value)
+        {
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        template <class T>
+        void overwrite(std::vector<std::uint8_t>& out, std::size_t position, T value)
+        {
+            std::memcpy(out.data() + position, &value, sizeof(T));
+        }
+
+        void patch_offset(std::vector<std::uint8_t>& out, std::size_t position, std::size_t target)
+        {
+            overwrite(out, position, static_cast<std::uint32_t>(target - position));
+        }
+    }
+
+    /*************************************
+     * flatbuffer_builder implementation *
+     *************************************/
+
+    auto flatbuffer_builder::table::add_offset(std::uint16_t id, ref object) -> table&
+    {
+        m_fields.push_back(field{id, static_cast<std::uint8_t>(uoffset_size), {}, object});
+        return *this;
+    }
+
+    auto flatbuffer_builder::create_string(std::string_view value) -> ref
+    {
+        return create_blob(value.data(), value.size(), value.size(), 1, true);
+    }
+
+    auto flatbuffer_builder::create_vector_of_tables(std::vector<ref> tables) -> ref
+    {
+        m_objects.emplace_back(table_vector{std::move(tables)});
+        return m_objects.size() - 1;
+    }
+
+    auto flatbuffer_builder::create_table(table&& t) -> ref
+    {
+        m_objects.emplace_back(std::move(t));
+        return m_objects.size() - 1;
+    }
+
+    auto flatbuffer_builder::create_blob(
+        const void* data,
+        std::size_t size,
+        std::size_t count,
+        std::size_t alignment,
+        bool null_terminated
+    ) -> ref
+    {
+        blob b{std::vector<std::byte>(size), count, alignment, null_terminated};
+        if (size != 0)
+        {
+            std::memcpy(b.data.data(), data, size);
+        }
+        m_objects.emplace_back(std::move(b));
+        return m_objects.size() - 1;
+    }
+
+    std::vector<std::uint8_t> flatbuffer_builder::finish(ref root) const
+    {
+        std::vector<std::uint8_t> out(uoffset_size, 0);
+        const std::size_t root_position = write(out, root);
+        patch_offset(out, 0, root_position);
+        pad_to(out, 8);
+        return out;
+    }
+
+    std::size_t flatbuffer_builder::write(std::vector<std::uint8_t>& out, ref object) const
+    {
+        const auto& obj = m_objects[object];
+        if (const auto* b = std::get_if<blob>(&obj))
+        {
+            // The length prefix is aligned on 4 bytes, and the elements on their own alignment
+            pad_to(out, std::max(b->alignment, uoffset_size), uoffset_size);
+            const std::size_t position = out.size();
+            append(out, static_cast<std::uint32_t>(b->element_count));
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(b->data.data());
+            out.insert(out.end(), bytes, bytes + b->data.size());
+            if (b->null_terminated)
+            {
+                out.push_back(0);
+            }
+            return position;
+        }
+        if (const auto* v = std::get_if<table_vector>(&obj))
+        {
+            pad_to(out, uoffset_size);
+            const std::size_t position = out.size();
+            append(out, static_cast<std::uint32_t>(v->tables.size()));
+            out.resize(out.size() + v->tables.size() * uoffset_size, 0);
+            for (std::size_t i = 0; i < v->tables.size(); ++i)
+            {
+                const std::size_t target = write(out, v->tables[i]);
+                patch_offset(out, position + uoffset_size + i * uoffset_size, target);
+            }
+            return position;
+        }
+
+        const auto& t = std::get<table>(obj);
+        // Larger fields first, so that every field is naturally aligned
+        std::vector<const table::field*> fields;
+        fields.reserve(t.m_fields.size());
+        std::uint16_t field_count = 0;
+        for (const auto& f : t.m_fields)
+        {
+            fields.push_back(&f);
+            field_count = std::max(field_count, static_cast<std::uint16_t>(f.id + 1));
+        }
+        std::ranges::stable_sort(
+            fields,
+            [](const table::field* lhs, const table::field* rhs)
+            {
+                return lhs->size > rhs->size;
+            }
+        );
+
+        std::vector<std::uint16_t> field_offsets(field_count, 0);
+        std::size_t table_size = sizeof(std::int32_t);
+        std::size_t table_alignment = sizeof(std::int32_t);
+        for (const auto* f : fields)
+        {
+            table_size = (table_size + f->size - 1) / f->size * f->size;
+            field_offsets[f->id] = static_cast<std::uint16_t>(table_size);
+            table_size += f->size;
+            table_alignment = std::max(table_alignment, static_cast<std::size_t>(f->size));
+        }
+
+        // The vtable is written right before the table
+        pad_to(out, sizeof(std::uint16_t));
+        const std::size_t vtable_position = out.size();
+        append(out, static_cast<std::uint16_t>(sizeof(std::uint16_t) * (2 + field_count)));
+        append(out, static_cast<std::uint16_t>(table_size));
+        for (const auto offset : field_offsets)
+        {
+            append(out, offset);
+        }
+
+        pad_to(out, table_alignment);
+        const std::size_t position = out.size();
+        out.resize(out.size() + table_size, 0);
+        overwrite(out, position, static_cast<std::int32_t>(position - vtable_position));
+        for (const auto* f : fields)
+        {
+            if (!f->object.has_value())
+            {
+                std::memcpy(out.data() + position + field_offsets[f->id], f->value.data(), f->size);
+            }
+        }
+        for (const auto* f : fields)
+        {
+            if (f->object.has_value())
+            {
+                const std::size_t target = write(out, *f->object);
+                patch_offset(out, position + field_offsets[f->id], target);
+            }
+        }
+        return position;
+    }
+
+    /***********************************
+     * flatbuffer_table implementation *
+     ***********************************/
+
+    flatbuffer_table flatbuffer_table::root(std::span<const std::uint8_t> buffer)
+    {
+        if (buffer.size() < uoffset_size)
+        {
+            throw ipc_error("Flatbuffer is too small");
+        }
+        std::uint32_t root_offset = 0;
+        std::memcpy(&root_offset, buffer.data(), sizeof(root_offset));
+        return flatbuffer_table(buffer, root_offset);
+    }
+
+    flatbuffer_table::flatbuffer_table(std::span<const std::uint8_t> buffer, std::size_t position)
+        : m_buffer(buffer)
+        , m_position(position)
+        , m_vtable(0)
+        , m_vtable_size(0)
+    {
+        const auto vtable_offset = read<std::int32_t>(position);
+        const auto vtable = static_cast<std::int64_t>(position) - vtable_offset;
+        if (vtable < 0 || static_cast<std::size_t>(vtable) >= buffer.size())
+        {
+            throw ipc_error("Invalid flatbuffer vtable offset");
+        }
+        m_vtable = static_cast<std::size_t>(vtable);
+        m_vtable_size = read<std::uint16_t>(m_vtable);
+        if (m_vtable_size < 2 * sizeof(std::uint16_t))
+        {
+            throw ipc_error("Invalid flatbuffer vtable size");
+        }
+        check(m_vtable, m_vtable_size);
+    }
+
+    void flatbuffer_table::check(std::size_t position, std::size_t size) const
+    {
+        if (position > m_buffer.size() || size > m_buffer.size() - position)
+        {
+            throw ipc_error("Flatbuffer access out of bounds");
+        }
+    }
+
+    std::size_t flatbuffer_table::field_position(std::uint16_t id) const
+    {
+        const std::size_t entry = sizeof(std::uint16_t) * (2 + static_cast<std::size_t>(id));
+        if (entry + sizeof(std::uint16_t) > m_vtable_size)
+        {
+            return 0;
+        }
+        const auto offset = read<std::uint16_t>(m_vtable + entry);
+        return offset == 0 ? 0 : m_position + offset;
+    }
+
+    std::size_t flatbuffer_table::indirect(std::size_t position) const
+    {
+        const auto offset = read<std::uint32_t>(position);
+        check(position + offset, 0);
+        return position + offset;
+    }
+
+    bool flatbuffer_table::has(std::uint16_t id) const
+    {
+        return field_position(id) != 0;
+    }
+
+    std::optional<flatbuffer_table> flatbuffer_table::table(std::uint16_t id) const
+    {
+        const std::size_t position = field_position(id);
+        if (position == 0)
+        {
+            return std::nullopt;
+        }
+        return flatbuffer_table(m_buffer, indirect(position));
+    }
+
+    std::string_view flatbuffer_table::string(std::uint16_t id) const
+    {
+        const auto v = vector(id, 1);
+        return {reinterpret_cast<const char*>(m_buffer.data() + v.position), v.size};
+    }
+
+    auto flatbuffer_table::vector(std::uint16_t id, std::size_t element_size) const -> vector_view
+    {
+        const std::size_t position = field_position(id);
+        if (position == 0)
+        {
+            return {};
+        }
+        const std::size_t start = indirect(position);
+        const auto size = read<std::uint32_t>(start);
+        check(start + uoffset_size, static_cast<std::size_t>(size) * element_size);
+        return {start + uoffset_size, size};
+    }
+
+    std::vector<flatbuffer_table> flatbuffer_table::tables(std::uint16_t id) const
+    {
+        const auto v = vector(id, uoffset_size);
+        std::vector<flatbuffer_table> res;
+        res.reserve(v.size);
+        for (std::size_t i = 0; i < v.size; ++i)
+        {
+            res.emplace_back(m_buffer, indirect(v.position + i * uoffset_size));
+        }
+        return res;
+    }
+}
@@ -0,0 +1,157 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/memory_mapped_file.hpp"
+
+#include <memory>
+#include <string>
+#include <system_error>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <cerrno>
+
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+        [[noreturn]] void throw_system_error(int error, const std::filesystem::path& path)
+        {
+            throw std::system_error(error, std::system_category(), "Cannot map file " + path.string());
+        }
+    }
+
+#if defined(_WIN32)
+
+    memory_mapped_file::memory_mapped_file(const std::filesystem::path& path)
+    {
+        HANDLE file = ::CreateFileW(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr
+        );
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw_system_error(static_cast<int>(::GetLastError()), path);
+        }
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(file, &size))
+        {
+            const auto error = ::GetLastError();
+            ::CloseHandle(file);
+            throw_system_error(static_cast<int>(error), path);
+        }
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        if (m_size == 0)
+        {
+            // Empty files cannot be mapped
+            ::CloseHandle(file);
+            return;
+        }
+        HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const auto mapping_error = ::GetLastError();
+        ::CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            throw_system_error(static_cast<int>(mapping_error), path);
+        }
+        // The view keeps the mapping alive
+        void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        const auto view_error = ::GetLastError();
+        ::CloseHandle(mapping);
+        if (view == nullptr)
+        {
+            throw_system_error(static_cast<int>(view_error), path);
+        }
+        p_data = static_cast<const std::uint8_t*>(view);
+    }
+
+    memory_mapped_file::~memory_mapped_file()
+    {
+        if (p_data != nullptr)
+        {
+            ::UnmapViewOfFile(p_data);
+        }
+    }
+
+#else
+
+    memory_mapped_file::memory_mapped_file(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw_system_error(errno, path);
+        }
+        struct stat status = {};
+        if (::fstat(fd, &status) != 0)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw_system_error(error, path);
+        }
+        m_size = static_cast<std::size_t>(status.st_size);
+        if (m_size == 0)
+        {
+            // Empty files cannot be mapped
+            ::close(fd);
+            return;
+        }
+        // The mapping remains valid once the file is closed
+        void* address = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (address == MAP_FAILED)
+        {
+            throw_system_error(error, path);
+        }
+        p_data = static_cast<const std::uint8_t*>(address);
+    }
+
+    memory_mapped_file::~memory_mapped_file()
+    {
+        if (p_data != nullptr)
+        {
+            ::munmap(const_cast<std::uint8_t*>(p_data), m_size);
+        }
+    }
+
+#endif
+
+    std::span<const std::uint8_t> memory_mapped_file::data() const noexcept
+    {
+        return {p_data, p_data == nullptr ? 0 : m_size};
+    }
+
+    file_reader open_mapped_file(const std::filesystem::path& path, read_options options)
+    {
+        auto file = std::make_shared<const memory_mapped_file>(path);
+        const auto data = file->data();
+        return file_reader(data, std::move(file), options);
+    }
+}
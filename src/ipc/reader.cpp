@@ -0,0 +1,1390 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/reader.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/ipc/compression.hpp"
+#include "sparrow/layout/fixed_width_binary_array_utils.hpp"
+#include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/bit.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/parallel.hpp"
+#include "sparrow/utils/repeat_container.hpp"
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+        /***********************
+         * Zero-copy ArrowArray *
+         ***********************/
+
+        // Private data of the arrays whose buffers point into an IPC message body
+        struct ipc_array_private_data
+        {
+            std::shared_ptr<const void> owner;
+            std::vector<const void*> buffers;
+            std::vector<ArrowArray*> children;
+            // Buffers that could not be referenced in place: misaligned buffers,
+            // decompressed buffers, and the variadic buffer sizes of the view types
+            std::vector<buffer<std::uint8_t>> copies;
+        };
+
+        void release_ipc_array(ArrowArray* array)
+        {
+            auto* private_data = static_cast<ipc_array_private_data*>(array->private_data);
+            for (ArrowArray* child : private_data->children)
+            {
+                if (child->release != nullptr)
+                {
+                    child->release(child);
+                }
+                delete child;
+            }
+            if (array->dictionary != nullptr)
+            {
+                if (array->dictionary->release != nullptr)
+                {
+                    array->dictionary->release(array->dictionary);
+                }
+                delete array->dictionary;
+            }
+            delete private_data;
+            *array = ArrowArray{};
+        }
+
+        // Creates an empty array owning its private data, so that a partially built
+        // array can be released if the decoding fails.
+        ArrowArray make_ipc_array(std::shared_ptr<const void> owner)
+        {
+            ArrowArray array{};
+            array.private_data = new ipc_array_private_data{std::move(owner), {}, {}, {}};
+            array.release = release_ipc_array;
+            return array;
+        }
+
+        ipc_array_private_data& private_data_of(ArrowArray& array)
+        {
+            return *static_cast<ipc_array_private_data*>(array.private_data);
+        }
+
+        // Points the C structure to the buffers and children held by the private data
+        void finalize(ArrowArray& array)
+        {
+            auto& private_data = private_data_of(array);
+            array.n_buffers = static_cast<std::int64_t>(private_data.buffers.size());
+            array.buffers = private_data.buffers.empty() ? nullptr : private_data.buffers.data();
+            array.n_children = static_cast<std::int64_t>(private_data.children.size());
+            array.children = private_data.children.empty() ? nullptr : private_data.children.data();
+        }
+
+        // Shallow copy of a decoded array, keeping \p owner alive
+        ArrowArray share_array(const ArrowArray& source, const std::shared_ptr<const void>& owner)
+        {
+            ArrowArray array = make_ipc_array(owner);
+            try
+            {
+                auto& private_data = private_data_of(array);
+                private_data.buffers.assign(source.buffers, source.buffers + source.n_buffers);
+                for (std::int64_t i = 0; i < source.n_children; ++i)
+                {
+                    private_data.children.push_back(new ArrowArray(share_array(*source.children[i], owner)));
+                }
+                if (source.dictionary != nullptr)
+                {
+                    array.dictionary = new ArrowArray(share_array(*source.dictionary, owner));
+                }
+            }
+            catch (...)
+            {
+                array.release(&array);
+                throw;
+            }
+            array.length = source.length;
+            array.null_count = source.null_count;
+            array.offset = source.offset;
+            finalize(array);
+            return array;
+        }
+
+        /***************
+         * Schema      *
+         ***************/
+
+        char time_unit_char(std::int16_t unit)
+        {
+            switch (static_cast<format::time_unit>(unit))
+            {
+                case format::time_unit::second:
+                    return 's';
+                case format::time_unit::millisecond:
+                    return 'm';
+                case format::time_unit::microsecond:
+                    return 'u';
+                case format::time_unit::nanosecond:
+                    return 'n';
+            }
+            throw ipc_error("Invalid time unit in IPC schema");
+        }
+
+        std::string integer_format(const flatbuffer_table& type)
+        {
+            const auto bit_width = type.get<std::int32_t>(0);
+            const bool is_signed = type.get<bool>(1);
+            switch (bit_width)
+            {
+                case 8:
+                    return is_signed ? "c" : "C";
+                case 16:
+                    return is_signed ? "s" : "S";
+                case 32:
+                    return is_signed ? "i" : "I";
+                case 64:
+                    return is_signed ? "l" : "L";
+                default:
+                    throw ipc_error("Invalid integer bit width in IPC schema");
+            }
+        }
+
+        std::string decode_type(const flatbuffer_table& field, std::size_t children_count)
+        {
+            using format::type_id;
+            const auto id = static_cast<type_id>(field.get<std::uint8_t>(format::field::type_type));
+            const auto type_table = field.table(format::field::type);
+            auto type = [&]() -> const flatbuffer_table&
+            {
+                if (!type_table.has_value())
+                {
+                    throw ipc_error("Missing type in IPC field");
+                }
+                return *type_table;
+            };
+
+            switch (id)
+            {
+                case type_id::null:
+                    return "n";
+                case type_id::integer:
+                    return integer_format(type());
+                case type_id::floating_point:
+                    switch (static_cast<format::precision>(type().get<std::int16_t>(0)))
+                    {
+                        case format::precision::half:
+                            return "e";
+                        case format::precision::single:
+                            return "f";
+                        case format::precision::double_:
+                            return "g";
+                    }
+                    throw ipc_error("Invalid floating point precision in IPC schema");
+                case type_id::binary:
+                    return "z";
+                case type_id::utf8:
+                    return "u";
+                case type_id::boolean:
+                    return "b";
+                case type_id::decimal:
+                {
+                    const auto bit_width = type().get<std::int32_t>(2, 128);
+                    std::string res = "d:" + std::to_string(type().get<std::int32_t>(0)) + ","
+                                      + std::to_string(type().get<std::int32_t>(1));
+                    return bit_width == 128 ? res : res + "," + std::to_string(bit_width);
+                }
+                case type_id::date:
+                    return type().get<std::int16_t>(0, 1) == static_cast<std::int16_t>(format::date_unit::day)
+                               ? "tdD"
+                               : "tdm";
+                case type_id::time:
+                    return std::string("tt") + time_unit_char(type().get<std::int16_t>(0, 1));
+                case type_id::timestamp:
+                    return std::string("ts") + time_unit_char(type().get<std::int16_t>(0)) + ":"
+                           + std::string(type().string(1));
+                case type_id::interval:
+                    switch (static_cast<format::interval_unit>(type().get<std::int16_t>(0)))
+                    {
+                        case format::interval_unit::year_month:
+                            return "tiM";
+                        case format::interval_unit::day_time:
+                            return "tiD";
+                        case format::interval_unit::month_day_nano:
+                            return "tin";
+                    }
+                    throw ipc_error("Invalid interval unit in IPC schema");
+                case type_id::list:
+                    return "+l";
+                case type_id::struct_:
+                    return "+s";
+                case type_id::union_:
+                {
+                    const bool dense = type().get<std::int16_t>(0)
+                                       == static_cast<std::int16_t>(format::union_mode::dense);
+                    std::string res = dense ? "+ud:" : "+us:";
+                    const auto type_ids = type().vector(1, sizeof(std::int32_t));
+                    for (std::size_t i = 0; i < children_count; ++i)
+                    {
+                        if (i != 0)
+                        {
+                            res += ',';
+                        }
+                        const auto type_code = type_ids.size == 0 ? static_cast<std::int32_t>(i)
+                                                                  : type().element<std::int32_t>(type_ids, i);
+                        res += std::to_string(type_code);
+                    }
+                    return res;
+                }
+                case type_id::fixed_size_binary:
+                    return "w:" + std::to_string(type().get<std::int32_t>(0));
+                case type_id::fixed_size_list:
+                    return "+w:" + std::to_string(type().get<std::int32_t>(0));
+                case type_id::map:
+                    return "+m";
+                case type_id::duration:
+                    return std::string("tD") + time_unit_char(type().get<std::int16_t>(0, 1));
+                case type_id::large_binary:
+                    return "Z";
+                case type_id::large_utf8:
+                    return "U";
+                case type_id::large_list:
+                    return "+L";
+                case type_id::run_end_encoded:
+                    return "+r";
+                case type_id::binary_view:
+                    return "vz";
+                case type_id::utf8_view:
+                    return "vu";
+                case type_id::list_view:
+                    return "+vl";
+                case type_id::large_list_view:
+                    return "+vL";
+                case type_id::none:
+                    break;
+            }
+            throw ipc_error("Unsupported type in IPC schema");
+        }
+
+        std::optional<std::vector<metadata_pair>> decode_metadata(const flatbuffer_table& table, std::uint16_t id)
+        {
+            if (!table.has(id))
+            {
+                return std::nullopt;
+            }
+            std::vector<metadata_pair> res;
+            for (const auto& kv : table.tables(id))
+            {
+                res.emplace_back(std::string(kv.string(format::key_value::key)), std::string(kv.string(format::key_value::value)));
+            }
+            return res;
+        }
+
+        field_description decode_field(const flatbuffer_table& field)
+        {
+            field_description res;
+            if (field.has(format::field::name))
+            {
+                res.name = std::string(field.string(format::field::name));
+            }
+            res.nullable = field.get<bool>(format::field::nullable);
+            res.metadata = decode_metadata(field, format::field::custom_metadata);
+            for (const auto& child : field.tables(format::field::children))
+            {
+                res.children.push_back(decode_field(child));
+            }
+            res.format = decode_type(field, res.children.size());
+            if (res.format == "+m")
+            {
+                res.keys_sorted = field.table(format::field::type)->get<bool>(0);
+            }
+            if (const auto encoding = field.table(format::field::dictionary))
+            {
+                std::string index_format = "i";
+                if (const auto index_type = encoding->table(format::dictionary_encoding::index_type))
+                {
+                    index_format = integer_format(*index_type);
+                }
+                res.dictionary = field_description::dictionary_encoding{
+                    encoding->get<std::int64_t>(format::dictionary_encoding::id),
+                    std::move(index_format),
+                    encoding->get<bool>(format::dictionary_encoding::is_ordered)
+                };
+            }
+            return res;
+        }
+
+        const field_description* find_dictionary_field(const std::vector<field_description>& fields, std::int64_t id)
+        {
+            for (const auto& field : fields)
+            {
+                if (field.dictionary.has_value() && field.dictionary->id == id)
+                {
+                    return &field;
+                }
+                if (const auto* res = find_dictionary_field(field.children, id))
+                {
+                    return res;
+                }
+            }
+            return nullptr;
+        }
+
+        ArrowSchema make_schema(const field_description& field, bool as_values = false);
+
+        ArrowSchema make_value_schema(const field_description& field, bool with_identity)
+        {
+            const std::size_t children_count = field.children.size();
+            ArrowSchema** children = children_count == 0 ? nullptr : new ArrowSchema*[children_count];
+            for (std::size_t i = 0; i < children_count; ++i)
+            {
+                children[i] = new ArrowSchema(make_schema(field.children[i]));
+            }
+            std::unordered_set<ArrowFlag> flags;
+            if (with_identity && field.nullable)
+            {
+                flags.insert(ArrowFlag::NULLABLE);
+            }
+            if (field.keys_sorted)
+            {
+                flags.insert(ArrowFlag::MAP_KEYS_SORTED);
+            }
+            return make_arrow_schema(
+                field.format,
+                with_identity ? field.name : std::nullopt,
+                with_identity ? field.metadata : std::nullopt,
+                std::make_optional(std::move(flags)),
+                children,
+                repeat_view<bool>(true, children_count),
+                nullptr,
+                false
+            );
+        }
+
+        ArrowSchema make_schema(const field_description& field, bool as_values)
+        {
+            if (!field.dictionary.has_value() || as_values)
+            {
+                return make_value_schema(field, !as_values);
+            }
+            auto* dictionary = new ArrowSchema(make_value_schema(field, false));
+            std::unordered_set<ArrowFlag> flags;
+            if (field.nullable)
+            {
+                flags.insert(ArrowFlag::NULLABLE);
+            }
+            if (field.dictionary->ordered)
+            {
+                flags.insert(ArrowFlag::DICTIONARY_ORDERED);
+            }
+            return make_arrow_schema(
+                field.dictionary->index_format,
+                field.name,
+                field.metadata,
+                std::make_optional(std::move(flags)),
+                nullptr,
+                repeat_view<bool>(true, 0),
+                dictionary,
+                true
+            );
+        }
+
+        /***************
+         * Body        *
+         ***************/
+
+        bool has_validity(data_type dt)
+        {
+            switch (dt)
+            {
+                case data_type::NA:
+                case data_type::RUN_ENCODED:
+                case data_type::DENSE_UNION:
+                case data_type::SPARSE_UNION:
+                    return false;
+                default:
+                    return true;
+            }
+        }
+
+        // Number of buffers of a layout in the IPC format, the variadic buffers of
+        // the view types excepted
+        std::size_t buffer_count(data_type dt)
+        {
+            switch (dt)
+            {
+                case data_type::NA:
+                case data_type::RUN_ENCODED:
+                    return 0;
+                case data_type::SPARSE_UNION:
+                case data_type::FIXED_SIZED_LIST:
+                case data_type::STRUCT:
+                    return 1;
+                case data_type::STRING:
+                case data_type::BINARY:
+                case data_type::LARGE_STRING:
+                case data_type::LARGE_BINARY:
+                case data_type::LIST_VIEW:
+                case data_type::LARGE_LIST_VIEW:
+                    return 3;
+                default:
+                    return 2;
+            }
+        }
+
+        // Size in bytes of an element of the fixed-width layouts, 0 for the other layouts
+        std::size_t fixed_width(data_type dt, const std::string& fmt)
+        {
+            switch (dt)
+            {
+                case data_type::UINT8:
+                case data_type::INT8:
+                    return 1;
+                case data_type::UINT16:
+                case data_type::INT16:
+                case data_type::HALF_FLOAT:
+                    return 2;
+                case data_type::UINT32:
+                case data_type::INT32:
+                case data_type::FLOAT:
+                case data_type::DATE_DAYS:
+                case data_type::TIME_SECONDS:
+                case data_type::TIME_MILLISECONDS:
+                case data_type::INTERVAL_MONTHS:
+                    return 4;
+                case data_type::UINT64:
+                case data_type::INT64:
+                case data_type::DOUBLE:
+                case data_type::DATE_MILLISECONDS:
+                case data_type::TIMESTAMP_SECONDS:
+                case data_type::TIMESTAMP_MILLISECONDS:
+                case data_type::TIMESTAMP_MICROSECONDS:
+                case data_type::TIMESTAMP_NANOSECONDS:
+                case data_type::TIME_MICROSECONDS:
+                case data_type::TIME_NANOSECONDS:
+                case data_type::DURATION_SECONDS:
+                case data_type::DURATION_MILLISECONDS:
+                case data_type::DURATION_MICROSECONDS:
+                case data_type::DURATION_NANOSECONDS:
+                case data_type::INTERVAL_DAYS_TIME:
+                    return 8;
+                case data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS:
+                    return 16;
+                case data_type::DECIMAL32:
+                case data_type::DECIMAL64:
+                case data_type::DECIMAL128:
+                case data_type::DECIMAL256:
+                    return num_bytes_for_decimal(fmt.c_str());
+                case data_type::FIXED_WIDTH_BINARY:
+                    return num_bytes_for_fixed_sized_binary(fmt);
+                default:
+                    return 0;
+            }
+        }
+
+        // Throws if \p buffer cannot hold \p count elements of \p width bytes
+        void check_size(std::span<const std::uint8_t> buffer, std::size_t count, std::size_t width)
+        {
+            if (count != 0 && width != 0 && buffer.size() / width < count)
+            {
+                throw ipc_error("IPC buffer too small for the length of its array");
+            }
+        }
+
+        // Throws if the \p count offsets of \p buffer are not monotonic or exceed \p limit
+        template <class OT>
+        void check_offsets(std::span<const std::uint8_t> buffer, std::size_t count, std::size_t limit)
+        {
+            const auto* offsets = reinterpret_cast<const OT*>(buffer.data());
+            if (offsets[0] < 0)
+            {
+                throw ipc_error("Negative offset in IPC buffer");
+            }
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                if (offsets[i] < offsets[i - 1])
+                {
+                    throw ipc_error("Non monotonic offsets in IPC buffer");
+                }
+            }
+            if (static_cast<std::uint64_t>(offsets[count - 1]) > limit)
+            {
+                throw ipc_error("IPC offsets out of the bounds of the referenced data");
+            }
+        }
+
+        // Storage of empty buffers: the consumers may read the first offset of an
+        // empty array, it must not be a null pointer
+        alignas(64) constexpr std::array<std::uint8_t, 64> empty_buffer{};
+
+        // Decompressions and offsets checks of the arrays made by a batch_cursor. They
+        // are run once the arrays of the batch are made, or on first access to a lazy
+        // column, so that the buffers of the columns never accessed are never read.
+        struct pending_buffers
+        {
+            /**
+             * Decompresses the buffers, then checks their offsets. The buffers are
+             * decompressed in parallel when they are large enough.
+             */
+            void run()
+            {
+                decompress();
+                for (const auto& check : offsets_checks)
+                {
+                    if (check.large)
+                    {
+                        check_offsets<std::int64_t>(check.offsets, check.count, check.limit);
+                    }
+                    else
+                    {
+                        check_offsets<std::int32_t>(check.offsets, check.count, check.limit);
+                    }
+                }
+                offsets_checks.clear();
+            }
+
+            std::optional<compression_codec> codec;
+            std::vector<compressed_buffer> compressed;
+            std::vector<offsets_check> offsets_checks;
+
+        private:
+
+            void decompress()
+            {
+                constexpr std::size_t min_bytes_per_task = std::size_t(1) << 20;
+                std::size_t total_size = 0;
+                for (const auto& buffer : compressed)
+                {
+                    total_size += buffer.destination.size();
+                }
+                parallel_for(
+                    compressed.size(),
+                    [this](std::size_t i)
+                    {
+                        ipc::decompress(*codec, compressed[i].source, compressed[i].destination);
+                    },
+                    parallel_task_count(total_size, min_bytes_per_task)
+                );
+                compressed.clear();
+            }
+        };
+
+        class batch_cursor
+        {
+        public:
+
+            batch_cursor(
+                const flatbuffer_table& batch,
+                std::span<const std::uint8_t> body,
+                const std::shared_ptr<const void>& owner,
+                const std::map<std::int64_t, std::shared_ptr<const ArrowArray>>& dictionaries
+            )
+                : m_batch(batch)
+                , m_nodes(batch.vector(format::record_batch::nodes, sizeof(format::field_node)))
+                , m_buffers(batch.vector(format::record_batch::buffers, sizeof(format::buffer)))
+                , m_variadic_counts(batch.vector(format::record_batch::variadic_buffer_counts, sizeof(std::int64_t)))
+                , m_body(body)
+                , m_owner(owner)
+                , m_dictionaries(dictionaries)
+            {
+                const auto compression = batch.table(format::record_batch::compression);
+                if (compression.has_value())
+                {
+                    const auto codec = compression->get<std::int8_t>(format::body_compression::codec);
+                    if (compression->get<std::int8_t>(format::body_compression::method) != format::compression_method_buffer
+                        || (codec != static_cast<std::int8_t>(compression_codec::lz4_frame)
+                            && codec != static_cast<std::int8_t>(compression_codec::zstd)))
+                    {
+                        throw ipc_error("Unsupported IPC body compression");
+                    }
+                    m_pending.codec = static_cast<compression_codec>(codec);
+                    if (!is_codec_available(*m_pending.codec))
+                    {
+                        throw ipc_error("The compression codec of the IPC body is not available in this build of sparrow");
+                    }
+                }
+            }
+
+            /**
+             * Decompresses the buffers of the arrays made so far, then checks their
+             * offsets.
+             */
+            void finish()
+            {
+                m_pending.run();
+            }
+
+            /**
+             * Returns the decompressions and offsets checks of the arrays made so far,
+             * to be run later instead of by finish().
+             */
+            pending_buffers take_pending()
+            {
+                pending_buffers res{.codec = m_pending.codec};
+                std::swap(res.compressed, m_pending.compressed);
+                std::swap(res.offsets_checks, m_pending.offsets_checks);
+                return res;
+            }
+
+            ArrowArray make_array(const field_description& field, bool as_values)
+            {
+                const bool encoded = field.dictionary.has_value() && !as_values;
+                const std::string& fmt = encoded ? field.dictionary->index_format : field.format;
+                const data_type dt = format_to_data_type(fmt);
+                const auto node = m_batch.element<format::field_node>(m_nodes, m_node_index++);
+                if (node.length < 0 || node.null_count < 0 || node.null_count > node.length)
+                {
+                    throw ipc_error("Invalid field node in IPC record batch");
+                }
+
+                ArrowArray array = make_ipc_array(m_owner);
+                try
+                {
+                    auto& private_data = private_data_of(array);
+                    const bool is_view = dt == data_type::STRING_VIEW || dt == data_type::BINARY_VIEW;
+                    std::size_t count = buffer_count(dt);
+                    if (is_view)
+                    {
+                        const auto variadic_count = m_batch.element<std::int64_t>(m_variadic_counts, m_variadic_index++);
+                        if (variadic_count < 0)
+                        {
+                            throw ipc_error("Invalid variadic buffer count in IPC record batch");
+                        }
+                        count += static_cast<std::size_t>(variadic_count);
+                    }
+                    std::vector<std::int64_t> variadic_sizes;
+                    std::vector<std::span<const std::uint8_t>> buffers;
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        const auto buffer = m_batch.element<format::buffer>(m_buffers, m_buffer_index++);
+                        buffers.push_back(resolve(buffer, i == 0 && has_validity(dt), private_data));
+                        private_data.buffers.push_back(buffers.back().data());
+                        if (is_view && i >= 2)
+                        {
+                            variadic_sizes.push_back(buffer.length);
+                        }
+                    }
+                    if (is_view)
+                    {
+                        // The C data interface expects the sizes of the variadic buffers last
+                        private_data.buffers.push_back(copy(variadic_sizes.data(), variadic_sizes.size() * sizeof(std::int64_t), private_data));
+                    }
+
+                    if (!encoded)
+                    {
+                        for (const auto& child : field.children)
+                        {
+                            private_data.children.push_back(new ArrowArray(make_array(child, false)));
+                        }
+                    }
+                    else
+                    {
+                        const auto it = m_dictionaries.find(field.dictionary->id);
+                        if (it == m_dictionaries.end())
+                        {
+                            throw ipc_error("Missing dictionary in IPC stream");
+                        }
+                        array.dictionary = new ArrowArray(share_array(*it->second, it->second));
+                    }
+                    check_buffers(dt, fmt, node, buffers, private_data.children);
+                }
+                catch (...)
+                {
+                    array.release(&array);
+                    throw;
+                }
+                array.length = node.length;
+                array.null_count = node.null_count;
+                array.offset = 0;
+                finalize(array);
+                return array;
+            }
+
+        private:
+
+            /**
+             * Checks the sizes of the \p buffers of an array against the length of
+             * its node and its layout. The offsets are checked by finish(), once the
+             * buffers are decompressed.
+             */
+            void check_buffers(
+                data_type dt,
+                const std::string& fmt,
+                const format::field_node& node,
+                const std::vector<std::span<const std::uint8_t>>& buffers,
+                const std::vector<ArrowArray*>& children
+            )
+            {
+                const auto length = static_cast<std::size_t>(node.length);
+                std::size_t first = 0;
+                if (has_validity(dt))
+                {
+                    if (buffers[0].data() == nullptr && node.null_count != 0)
+                    {
+                        throw ipc_error("Missing validity bitmap in IPC record batch");
+                    }
+                    if (buffers[0].data() != nullptr)
+                    {
+                        check_size(buffers[0], (length + 7) / 8, 1);
+                    }
+                    first = 1;
+                }
+
+                auto child_length = [&](std::size_t i)
+                {
+                    if (children.size() <= i)
+                    {
+                        throw ipc_error("Missing child array in IPC record batch");
+                    }
+                    return static_cast<std::size_t>(children[i]->length);
+                };
+                auto check_offsets_buffer = [&](bool large, std::size_t limit)
+                {
+                    // An empty array may omit its offsets
+                    if (length == 0 && buffers[first].empty())
+                    {
+                        return;
+                    }
+                    const std::size_t width = large ? sizeof(std::int64_t) : sizeof(std::int32_t);
+                    check_size(buffers[first], length + 1, width);
+                    m_pending.offsets_checks.push_back({buffers[first], length + 1, large, limit});
+                };
+
+                switch (dt)
+                {
+                    case data_type::BOOL:
+                        check_size(buffers[first], (length + 7) / 8, 1);
+                        break;
+                    case data_type::STRING:
+                    case data_type::BINARY:
+                        check_offsets_buffer(false, buffers[first + 1].size());
+                        break;
+                    case data_type::LARGE_STRING:
+                    case data_type::LARGE_BINARY:
+                        check_offsets_buffer(true, buffers[first + 1].size());
+                        break;
+                    case data_type::LIST:
+                    case data_type::MAP:
+                        check_offsets_buffer(false, child_length(0));
+                        break;
+                    case data_type::LARGE_LIST:
+                        check_offsets_buffer(true, child_length(0));
+                        break;
+                    case data_type::LIST_VIEW:
+                        check_size(buffers[first], length, sizeof(std::int32_t));
+                        check_size(buffers[first + 1], length, sizeof(std::int32_t));
+                        break;
+                    case data_type::LARGE_LIST_VIEW:
+                        check_size(buffers[first], length, sizeof(std::int64_t));
+                        check_size(buffers[first + 1], length, sizeof(std::int64_t));
+                        break;
+                    case data_type::STRING_VIEW:
+                    case data_type::BINARY_VIEW:
+                        check_size(buffers[first], length, 16);
+                        break;
+                    case data_type::SPARSE_UNION:
+                        check_size(buffers[0], length, sizeof(std::int8_t));
+                        break;
+                    case data_type::DENSE_UNION:
+                        check_size(buffers[0], length, sizeof(std::int8_t));
+                        check_size(buffers[1], length, sizeof(std::int32_t));
+                        break;
+                    default:
+                        if (buffers.size() > first)
+                        {
+                            check_size(buffers[first], length, fixed_width(dt, fmt));
+                        }
+                        break;
+                }
+            }
+
+            // Resolves a buffer of the message body, returns its data with its
+            // decompressed size
+            std::span<const std::uint8_t> resolve(const format::buffer& buffer, bool is_validity, ipc_array_private_data& private_data)
+            {
+                if (buffer.offset < 0 || buffer.length < 0
+                    || static_cast<std::size_t>(buffer.offset) > m_body.size()
+                    || static_cast<std::size_t>(buffer.length) > m_body.size() - static_cast<std::size_t>(buffer.offset))
+                {
+                    throw ipc_error("IPC buffer out of the message body");
+                }
+                if (buffer.length == 0)
+                {
+                    return empty_data(is_validity);
+                }
+                const std::uint8_t* data = m_body.data() + buffer.offset;
+                auto size = static_cast<std::size_t>(buffer.length);
+                if (m_pending.codec.has_value())
+                {
+                    std::int64_t uncompressed_size = 0;
+                    if (size < sizeof(uncompressed_size))
+                    {
+                        throw ipc_error("Invalid compressed IPC buffer");
+                    }
+                    std::memcpy(&uncompressed_size, data, sizeof(uncompressed_size));
+                    data += sizeof(uncompressed_size);
+                    size -= sizeof(uncompressed_size);
+                    if (uncompressed_size != format::uncompressed_buffer_marker)
+                    {
+                        if (uncompressed_size < 0)
+                        {
+                            throw ipc_error("Invalid compressed IPC buffer");
+                        }
+                        if (uncompressed_size == 0)
+                        {
+                            return empty_data(is_validity);
+                        }
+                        // Decompressed later, with the other buffers of the batch
+                        auto& storage = allocate(static_cast<std::size_t>(uncompressed_size), private_data);
+                        m_pending.compressed.push_back({{data, size}, {storage.data(), storage.size()}});
+                        return {storage.data(), storage.size()};
+                    }
+                }
+                if (reinterpret_cast<std::uintptr_t>(data) % sizeof(std::uint64_t) != 0)
+                {
+                    return {static_cast<const std::uint8_t*>(copy(data, size, private_data)), size};
+                }
+                return {data, size};
+            }
+
+            static std::span<const std::uint8_t> empty_data(bool is_validity)
+            {
+                return {is_validity ? nullptr : empty_buffer.data(), std::size_t(0)};
+            }
+
+            // Allocates a buffer owned by the array, with the default allocator
+            static buffer<std::uint8_t>& allocate(std::size_t size, ipc_array_private_data& private_data)
+            {
+                return private_data.copies.emplace_back(size, buffer<std::uint8_t>::default_allocator());
+            }
+
+            static const void* copy(const void* data, std::size_t size, ipc_array_private_data& private_data)
+            {
+                if (size == 0)
+                {
+                    return empty_buffer.data();
+                }
+                auto& storage = allocate(size, private_data);
+                std::memcpy(storage.data(), data, size);
+                return storage.data();
+            }
+
+            const flatbuffer_table& m_batch;
+            flatbuffer_table::vector_view m_nodes;
+            flatbuffer_table::vector_view m_buffers;
+            flatbuffer_table::vector_view m_variadic_counts;
+            std::span<const std::uint8_t> m_body;
+            const std::shared_ptr<const void>& m_owner;
+            const std::map<std::int64_t, std::shared_ptr<const ArrowArray>>& m_dictionaries;
+            std::size_t m_node_index = 0;
+            std::size_t m_buffer_index = 0;
+            std::size_t m_variadic_index = 0;
+            pending_buffers m_pending;
+        };
+
+        // Schema of a record batch column: the columns of a record batch must be named
+        ArrowSchema make_column_schema(const field_description& field)
+        {
+            if (field.name.has_value())
+            {
+                return make_schema(field);
+            }
+            field_description named = field;
+            named.name = std::string();
+            return make_schema(named);
+        }
+
+        // Decoded column of a record batch read with lazy columns, shared by the
+        // arrays created from it. Its buffers are decompressed and its offsets are
+        // checked when the first array is created.
+        struct lazy_column_data
+        {
+            lazy_column_data(ArrowArray&& array, ArrowSchema&& schema, pending_buffers&& pending)
+                : array(std::move(array))
+                , schema(std::move(schema))
+                , pending(std::move(pending))
+            {
+            }
+
+            ~lazy_column_data()
+            {
+                array.release(&array);
+                schema.release(&schema);
+            }
+
+            lazy_column_data(const lazy_column_data&) = delete;
+            lazy_column_data& operator=(const lazy_column_data&) = delete;
+
+            // The copies of a record batch share the column, and can access it
+            // from several threads
+            void finish() const
+            {
+                std::call_once(
+                    finished,
+                    [this]()
+                    {
+                        pending.run();
+                    }
+                );
+            }
+
+            ArrowArray array;
+            ArrowSchema schema;
+            mutable pending_buffers pending;
+            mutable std::once_flag finished;
+        };
+
+        flatbuffer_table read_header(std::span<const std::uint8_t> metadata, format::message_header& type)
+        {
+            const auto message = flatbuffer_table::root(metadata);
+            type = static_cast<format::message_header>(message.get<std::uint8_t>(format::message::header_type));
+            auto header = message.table(format::message::header);
+            if (!header.has_value())
+            {
+                throw ipc_error("IPC message without header");
+            }
+            return *header;
+        }
+
+        struct framed_message
+        {
+            std::span<const std::uint8_t> metadata;
+            std::span<const std::uint8_t> body;
+        };
+
+        // Reads the message starting at \p position, or returns std::nullopt at the
+        // end-of-stream marker
+        std::optional<framed_message> read_message(std::span<const std::uint8_t> data, std::size_t& position)
+        {
+            auto read_u32 = [&]()
+            {
+                if (data.size() - position < sizeof(std::uint32_t))
+                {
+                    throw ipc_error("Truncated IPC message");
+                }
+                std::uint32_t value = 0;
+                std::memcpy(&value, data.data() + position, sizeof(value));
+                position += sizeof(value);
+                // The lengths of the IPC format are little-endian
+                return to_native_endian<std::endian::little>(value);
+            };
+
+            std::uint32_t metadata_length = read_u32();
+            if (metadata_length == format::continuation_marker)
+            {
+                metadata_length = read_u32();
+            }
+            if (metadata_length == 0)
+            {
+                return std::nullopt;
+            }
+            if (data.size() - position < metadata_length)
+            {
+                throw ipc_error("Truncated IPC message");
+            }
+            framed_message res;
+            res.metadata = data.subspan(position, metadata_length);
+            position += metadata_length;
+            const std::size_t body_length = message_decoder::body_length(res.metadata);
+            if (data.size() - position < body_length)
+            {
+                throw ipc_error("Truncated IPC message body");
+            }
+            res.body = data.subspan(position, body_length);
+            position += body_length;
+            return res;
+        }
+    }
+
+    /**********************************
+     * message_decoder implementation *
+     **********************************/
+
+    message_decoder::message_decoder(read_options options)
+        : m_options(options)
+    {
+    }
+
+    std::size_t message_decoder::body_length(std::span<const std::uint8_t> metadata)
+    {
+        const auto length = flatbuffer_table::root(metadata).get<std::int64_t>(format::message::body_length);
+        if (length < 0)
+        {
+            throw ipc_error("Invalid IPC message body length");
+        }
+        return static_cast<std::size_t>(length);
+    }
+
+    std::optional<record_batch> message_decoder::decode(
+        std::span<const std::uint8_t> metadata,
+        std::span<const std::uint8_t> body,
+        const std::shared_ptr<const void>& owner
+    )
+    {
+        const auto header = decode_header(metadata, body, owner);
+        if (!header.has_value())
+        {
+            return std::nullopt;
+        }
+        return make_record_batch(*header, body, owner);
+    }
+
+    std::optional<ArrowArray> message_decoder::decode_array(
+        std::span<const std::uint8_t> metadata,
+        std::span<const std::uint8_t> body,
+        const std::shared_ptr<const void>& owner
+    )
+    {
+        const auto header = decode_header(metadata, body, owner);
+        if (!header.has_value())
+        {
+            return std::nullopt;
+        }
+        return make_struct_array(*header, body, owner);
+    }
+
+    record_batch message_decoder::decode_record_batch(
+        std::span<const std::uint8_t> metadata,
+        std::span<const std::uint8_t> body,
+        const std::shared_ptr<const void>& owner
+    ) const
+    {
+        format::message_header type{};
+        const auto header = read_header(metadata, type);
+        if (type != format::message_header::record_batch)
+        {
+            throw ipc_error("Expected an IPC record batch message");
+        }
+        return make_record_batch(header, body, owner);
+    }
+
+    bool message_decoder::has_schema() const noexcept
+    {
+        return m_fields.has_value();
+    }
+
+    const std::vector<field_description>& message_decoder::fields() const
+    {
+        SPARROW_ASSERT_TRUE(has_schema());
+        return *m_fields;
+    }
+
+    ArrowSchema message_decoder::arrow_schema() const
+    {
+        const auto& fields = this->fields();
+        const std::size_t children_count = fields.size();
+        ArrowSchema** children = children_count == 0 ? nullptr : new ArrowSchema*[children_count];
+        for (std::size_t i = 0; i < children_count; ++i)
+        {
+            children[i] = new ArrowSchema(make_column_schema(fields[i]));
+        }
+        return make_arrow_schema(
+            std::string("+s"),
+            std::optional<std::string>{},
+            m_metadata,
+            std::optional<std::unordered_set<ArrowFlag>>{},
+            children,
+            repeat_view<bool>(true, children_count),
+            nullptr,
+            false
+        );
+    }
+
+    std::optional<flatbuffer_table> message_decoder::decode_header(
+        std::span<const std::uint8_t> metadata,
+        std::span<const std::uint8_t> body,
+        const std::shared_ptr<const void>& owner
+    )
+    {
+        format::message_header type{};
+        const auto header = read_header(metadata, type);
+        switch (type)
+        {
+            case format::message_header::schema:
+                decode_schema(header);
+                return std::nullopt;
+            case format::message_header::dictionary_batch:
+                decode_dictionary_batch(header, body, owner);
+                return std::nullopt;
+            case format::message_header::record_batch:
+                return header;
+            case format::message_header::none:
+                break;
+        }
+        throw ipc_error("Unsupported IPC message");
+    }
+
+    void message_decoder::decode_schema(const flatbuffer_table& schema)
+    {
+        std::vector<field_description> fields;
+        for (const auto& field : schema.tables(format::schema::fields))
+        {
+            fields.push_back(decode_field(field));
+        }
+        m_fields = std::move(fields);
+        m_metadata = decode_metadata(schema, format::schema::custom_metadata);
+        m_dictionaries.clear();
+    }
+
+    void message_decoder::decode_dictionary_batch(
+        const flatbuffer_table& dictionary_batch,
+        std::span<const std::uint8_t> body,
+        const std::shared_ptr<const void>& owner
+    )
+    {
+        if (!has_schema())
+        {
+            throw ipc_error("IPC dictionary batch before the schema");
+        }
+        if (dictionary_batch.get<bool>(format::dictionary_batch::is_delta))
+        {
+            throw ipc_error("IPC delta dictionaries are not supported");
+        }
+        const auto id = dictionary_batch.get<std::int64_t>(format::dictionary_batch::id);
+        const field_description* field = find_dictionary_field(*m_fields, id);
+        if (field == nullptr)
+        {
+            throw ipc_error("IPC dictionary batch with an unknown id");
+        }
+        const auto data = dictionary_batch.table(format::dictionary_batch::data);
+        if (!data.has_value())
+        {
+            throw ipc_error("IPC dictionary batch without data");
+        }
+        batch_cursor cursor(*data, body, owner, m_dictionaries);
+        auto* dictionary = new ArrowArray(cursor.make_array(*field, true));
+        std::shared_ptr<const ArrowArray> shared_dictionary(
+            dictionary,
+            [](const ArrowArray* ptr)
+            {
+                auto* array = const_cast<ArrowArray*>(ptr);
+                array->release(array);
+                delete array;
+            }
+        );
+        cursor.finish();
+        m_dictionaries[id] = std::move(shared_dictionary);
+    }
+
+    record_batch message_decoder::make_record_batch(
+        const flatbuffer_table& batch,
+        std::span<const std::uint8_t> body,
+        const std::shared_ptr<const void>& owner
+    ) const
+    {
+        if (!m_options.lazy_columns)
+        {
+            return record_batch(make_struct_array(batch, body, owner), arrow_schema());
+        }
+        if (!has_schema())
+        {
+            throw ipc_error("IPC record batch before the schema");
+        }
+
+        // Only the metadata of the columns is decoded here: their buffers are
+        // read, decompressed and checked when the arrays are created on first access
+        batch_cursor cursor(batch, body, owner, m_dictionaries);
+        record_batch res(std::vector<std::string>{}, std::vector<array>{}, std::nullopt, m_metadata);
+        for (const auto& field : *m_fields)
+        {
+            ArrowArray column = cursor.make_array(field, false);
+            const auto length = static_cast<std::size_t>(column.length);
+            auto data = std::make_shared<const lazy_column_data>(
+                std::move(column),
+                make_column_schema(field),
+                cursor.take_pending()
+            );
+            res.add_lazy_column(
+                data->schema.name,
+                length,
+                [data]()
+                {
+                    data->finish();
+                    return array(share_array(data->array, data), copy_schema(data->schema));
+                }
+            );
+        }
+        return res;
+    }
+
+    ArrowArray message_decoder::make_struct_array(
+        const flatbuffer_table& batch,
+        std::span<const std::uint8_t> body,
+        const std::shared_ptr<const void>& owner
+    ) const
+    {
+        if (!has_schema())
+        {
+            throw ipc_error("IPC record batch before the schema");
+        }
+        batch_cursor cursor(batch, body, owner, m_dictionaries);
+        ArrowArray array = make_ipc_array(nullptr);
+        try
+        {
+            auto& private_data = private_data_of(array);
+            private_data.buffers.push_back(nullptr);
+            for (const auto& field : *m_fields)
+            {
+                private_data.children.push_back(new ArrowArray(cursor.make_array(field, false)));
+            }
+            cursor.finish();
+        }
+        catch (...)
+        {
+            array.release(&array);
+            throw;
+        }
+        array.length = batch.get<std::int64_t>(format::record_batch::length);
+        finalize(array);
+        return array;
+    }
+
+    /********************************
+     * stream_reader implementation *
+     ********************************/
+
+    stream_reader::stream_reader(
+        std::span<const std::uint8_t> data,
+        std::shared_ptr<const void> owner,
+        read_options options
+    )
+        : m_data(data)
+        , p_owner(std::move(owner))
+        , m_decoder(options)
+    {
+    }
+
+    std::optional<record_batch> stream_reader::next()
+    {
+        while (!m_finished && m_position < m_data.size())
+        {
+            const auto message = read_message(m_data, m_position);
+            if (!message.has_value())
+            {
+                m_finished = true;
+                break;
+            }
+            auto batch = m_decoder.decode(message->metadata, message->body, p_owner);
+            if (batch.has_value())
+            {
+                return batch;
+            }
+        }
+        return std::nullopt;
+    }
+
+    const message_decoder& stream_reader::decoder() const noexcept
+    {
+        return m_decoder;
+    }
+
+    /******************************
+     * file_reader implementation *
+     ******************************/
+
+    file_reader::file_reader(std::span<const std::uint8_t> data, std::shared_ptr<const void> owner, read_options options)
+        : m_data(data)
+        , p_owner(std::move(owner))
+        , m_decoder(options)
+    {
+        constexpr std::size_t magic_size = format::file_magic.size();
+        constexpr std::size_t trailer_size = sizeof(std::int32_t) + magic_size;
+        if (data.size() < format::file_header_size + trailer_size
+            || std::memcmp(data.data(), format::file_magic.data(), magic_size) != 0
+            || std::memcmp(data.data() + data.size() - magic_size, format::file_magic.data(), magic_size) != 0)
+        {
+            throw ipc_error("Not an Arrow IPC file");
+        }
+        std::int32_t footer_length = 0;
+        std::memcpy(&footer_length, data.data() + data.size() - trailer_size, sizeof(footer_length));
+        if (footer_length <= 0
+            || static_cast<std::size_t>(footer_length) > data.size() - format::file_header_size - trailer_size)
+        {
+            throw ipc_error("Invalid Arrow IPC file footer");
+        }
+        const auto footer = flatbuffer_table::root(
+            data.subspan(data.size() - trailer_size - static_cast<std::size_t>(footer_length), static_cast<std::size_t>(footer_length))
+        );
+
+        // The schema is the first message of the embedded stream
+        std::size_t position = format::file_header_size;
+        const auto schema_message = read_message(data, position);
+        if (!schema_message.has_value() || m_decoder.decode(schema_message->metadata, schema_message->body, p_owner).has_value()
+            || !m_decoder.has_schema())
+        {
+            throw ipc_error("Arrow IPC file without schema");
+        }
+
+        auto read_blocks = [&](std::uint16_t id)
+        {
+            const auto blocks = footer.vector(id, sizeof(format::block));
+            std::vector<format::block> res;
+            res.reserve(blocks.size);
+            for (std::size_t i = 0; i < blocks.size; ++i)
+            {
+                const auto block = footer.element<format::block>(blocks, i);
+                if (block.offset < 0 || static_cast<std::size_t>(block.offset) >= data.size())
+                {
+                    throw ipc_error("Invalid block in Arrow IPC file footer");
+                }
+                res.push_back(block);
+            }
+            return res;
+        };
+
+        for (const auto& block : read_blocks(format::footer::dictionaries))
+        {
+            auto block_position = static_cast<std::size_t>(block.offset);
+            const auto message = read_message(data, block_position);
+            if (!message.has_value() || m_decoder.decode(message->metadata, message->body, p_owner).has_value())
+            {
+                throw ipc_error("Invalid dictionary block in Arrow IPC file");
+            }
+        }
+        m_record_batch_blocks = read_blocks(format::footer::record_batches);
+    }
+
+    std::size_t file_reader::num_record_batches() const noexcept
+    {
+        return m_record_batch_blocks.size();
+    }
+
+    record_batch file_reader::get_record_batch(std::size_t index) const
+    {
+        if (index >= m_record_batch_blocks.size())
+        {
+            throw std::out_of_range("Record batch index out of range");
+        }
+        auto position = static_cast<std::size_t>(m_record_batch_blocks[index].offset);
+        const auto message = read_message(m_data, position);
+        if (!message.has_value())
+        {
+            throw ipc_error("Invalid record batch block in Arrow IPC file");
+        }
+        return m_decoder.decode_record_batch(message->metadata, message->body, p_owner);
+    }
+
+    const message_decoder& file_reader::decoder() const noexcept
+    {
+        return m_decoder;
+    }
+}
@@ -0,0 +1,947 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/ipc/writer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/buffer/dynamic_bitset/null_count_policy.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/bit.hpp"
+#include "sparrow/utils/metadata.hpp"
+#include "sparrow/utils/parallel.hpp"
+
+namespace sparrow::ipc
+{
+    namespace
+    {
+        using ref = flatbuffer_builder::ref;
+        using table = flatbuffer_builder::table;
+
+        std::size_t align_up(std::size_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        std::int32_t parse_int(std::string_view str, std::string_view format)
+        {
+            std::int32_t value = 0;
+            const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+            if (ec != std::errc{} || ptr != str.data() + str.size())
+            {
+                throw std::invalid_argument("Invalid format string for IPC: " + std::string(format));
+            }
+            return value;
+        }
+
+        // Splits a comma-separated list of integers
+        std::vector<std::int32_t> parse_int_list(std::string_view str, std::string_view format)
+        {
+            std::vector<std::int32_t> res;
+            while (!str.empty())
+            {
+                const auto comma = str.find(',');
+                res.push_back(parse_int(str.substr(0, comma), format));
+                str = comma == std::string_view::npos ? std::string_view{} : str.substr(comma + 1);
+            }
+            return res;
+        }
+
+        bool has_flag(const ArrowSchema& schema, ArrowFlag flag)
+        {
+            return (schema.flags & static_cast<std::int64_t>(flag)) != 0;
+        }
+
+        /***************
+         * Schema      *
+         ***************/
+
+        std::pair<format::type_id, ref> encode_type(flatbuffer_builder& builder, const ArrowSchema& schema)
+        {
+            using format::type_id;
+            const std::string_view fmt = schema.format;
+
+            auto make = [&](type_id id, table&& t = table{})
+            {
+                return std::make_pair(id, builder.create_table(std::move(t)));
+            };
+            auto integer = [&](std::int32_t bit_width, bool is_signed)
+            {
+                return make(type_id::integer, std::move(table{}.add(0, bit_width).add(1, is_signed)));
+            };
+            auto floating_point = [&](format::precision p)
+            {
+                return make(type_id::floating_point, std::move(table{}.add(0, static_cast<std::int16_t>(p))));
+            };
+            auto with_unit = [&](type_id id, auto unit)
+            {
+                return make(id, std::move(table{}.add(0, static_cast<std::int16_t>(unit))));
+            };
+            auto time = [&](format::time_unit unit, std::int32_t bit_width)
+            {
+                return make(type_id::time, std::move(table{}.add(0, static_cast<std::int16_t>(unit)).add(1, bit_width)));
+            };
+            auto timestamp = [&](format::time_unit unit)
+            {
+                table t;
+                t.add(0, static_cast<std::int16_t>(unit));
+                const std::string_view timezone = fmt.substr(4);
+                if (!timezone.empty())
+                {
+                    t.add_offset(1, builder.create_string(timezone));
+                }
+                return make(type_id::timestamp, std::move(t));
+            };
+            auto union_type = [&](format::union_mode mode)
+            {
+                const auto type_ids = parse_int_list(fmt.substr(4), fmt);
+                table t;
+                t.add(0, static_cast<std::int16_t>(mode));
+                t.add_offset(1, builder.create_vector(std::span<const std::int32_t>(type_ids)));
+                return make(type_id::union_, std::move(t));
+            };
+            auto decimal = [&](std::size_t byte_width)
+            {
+                // d:precision,scale[,bit_width]
+                const auto params = parse_int_list(fmt.substr(2), fmt);
+                if (params.size() < 2)
+                {
+                    throw std::invalid_argument("Invalid format string for IPC: " + std::string(fmt));
+                }
+                table t;
+                t.add(0, params[0]).add(1, params[1]).add(2, static_cast<std::int32_t>(byte_width * 8));
+                return make(type_id::decimal, std::move(t));
+            };
+
+            switch (format_to_data_type(fmt))
+            {
+                case data_type::NA:
+                    if (fmt != "n")
+                    {
+                        throw std::invalid_argument("Unsupported format for IPC: " + std::string(fmt));
+                    }
+                    return make(type_id::null);
+                case data_type::BOOL:
+                    return make(type_id::boolean);
+                case data_type::UINT8:
+                    return integer(8, false);
+                case data_type::INT8:
+                    return integer(8, true);
+                case data_type::UINT16:
+                    return integer(16, false);
+                case data_type::INT16:
+                    return integer(16, true);
+                case data_type::UINT32:
+                    return integer(32, false);
+                case data_type::INT32:
+                    return integer(32, true);
+                case data_type::UINT64:
+                    return integer(64, false);
+                case data_type::INT64:
+                    return integer(64, true);
+                case data_type::HALF_FLOAT:
+                    return floating_point(format::precision::half);
+                case data_type::FLOAT:
+                    return floating_point(format::precision::single);
+                case data_type::DOUBLE:
+                    return floating_point(format::precision::double_);
+                case data_type::STRING:
+                    return make(type_id::utf8);
+                case data_type::LARGE_STRING:
+                    return make(type_id::large_utf8);
+                case data_type::BINARY:
+                    return make(type_id::binary);
+                case data_type::LARGE_BINARY:
+                    return make(type_id::large_binary);
+                case data_type::LIST:
+                    return make(type_id::list);
+                case data_type::LARGE_LIST:
+                    return make(type_id::large_list);
+                case data_type::LIST_VIEW:
+                    return make(type_id::list_view);
+                case data_type::LARGE_LIST_VIEW:
+                    return make(type_id::large_list_view);
+                case data_type::FIXED_SIZED_LIST:
+                    return make(type_id::fixed_size_list, std::move(table{}.add(0, parse_int(fmt.substr(3), fmt))));
+                case data_type::STRUCT:
+                    return make(type_id::struct_);
+                case data_type::MAP:
+                    return make(type_id::map, std::move(table{}.add(0, has_flag(schema, ArrowFlag::MAP_KEYS_SORTED))));
+                case data_type::STRING_VIEW:
+                    return make(type_id::utf8_view);
+                case data_type::BINARY_VIEW:
+                    return make(type_id::binary_view);
+                case data_type::DENSE_UNION:
+                    return union_type(format::union_mode::dense);
+                case data_type::SPARSE_UNION:
+                    return union_type(format::union_mode::sparse);
+                case data_type::RUN_ENCODED:
+                    return make(type_id::run_end_encoded);
+                case data_type::DECIMAL32:
+                    return decimal(4);
+                case data_type::DECIMAL64:
+                    return decimal(8);
+                case data_type::DECIMAL128:
+                    return decimal(16);
+                case data_type::DECIMAL256:
+                    return decimal(32);
+                case data_type::FIXED_WIDTH_BINARY:
+                    return make(type_id::fixed_size_binary, std::move(table{}.add(0, parse_int(fmt.substr(2), fmt))));
+                case data_type::DATE_DAYS:
+                    return with_unit(type_id::date, format::date_unit::day);
+                case data_type::DATE_MILLISECONDS:
+                    return with_unit(type_id::date, format::date_unit::millisecond);
+                case data_type::TIMESTAMP_SECONDS:
+                    return timestamp(format::time_unit::second);
+                case data_type::TIMESTAMP_MILLISECONDS:
+                    return timestamp(format::time_unit::millisecond);
+                case data_type::TIMESTAMP_MICROSECONDS:
+                    return timestamp(format::time_unit::microsecond);
+                case data_type::TIMESTAMP_NANOSECONDS:
+                    return timestamp(format::time_unit::nanosecond);
+                case data_type::TIME_SECONDS:
+                    return time(format::time_unit::second, 32);
+                case data_type::TIME_MILLISECONDS:
+                    return time(format::time_unit::millisecond, 32);
+                case data_type::TIME_MICROSECONDS:
+                    return time(format::time_unit::microsecond, 64);
+                case data_type::TIME_NANOSECONDS:
+                    return time(format::time_unit::nanosecond, 64);
+                case data_type::DURATION_SECONDS:
+                    return with_unit(type_id::duration, format::time_unit::second);
+                case data_type::DURATION_MILLISECONDS:
+                    return with_unit(type_id::duration, format::time_unit::millisecond);
+                case data_type::DURATION_MICROSECONDS:
+                    return with_unit(type_id::duration, format::time_unit::microsecond);
+                case data_type::DURATION_NANOSECONDS:
+                    return with_unit(type_id::duration, format::time_unit::nanosecond);
+                case data_type::INTERVAL_MONTHS:
+                    return with_unit(type_id::interval, format::interval_unit::year_month);
+                case data_type::INTERVAL_DAYS_TIME:
+                    return with_unit(type_id::interval, format::interval_unit::day_time);
+                case data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS:
+                    return with_unit(type_id::interval, format::interval_unit::month_day_nano);
+            }
+            throw std::invalid_argument("Unsupported format for IPC: " + std::string(fmt));
+        }
+
+        template <class R>
+        ref encode_metadata(flatbuffer_builder& builder, const R& metadata)
+        {
+            std::vector<ref> pairs;
+            for (const auto& [key, value] : metadata)
+            {
+                table kv;
+                kv.add_offset(format::key_value::key, builder.create_string(key));
+                kv.add_offset(format::key_value::value, builder.create_string(value));
+                pairs.push_back(builder.create_table(std::move(kv)));
+            }
+            return builder.create_vector_of_tables(std::move(pairs));
+        }
+
+        // Dictionary ids are assigned in the pre-order of the schema tree
+        ref encode_field(
+            flatbuffer_builder& builder,
+            const ArrowSchema& schema,
+            std::optional<std::string_view> name,
+            std::int64_t& next_dictionary_id
+        )
+        {
+            table field;
+            const ArrowSchema& value_schema = schema.dictionary != nullptr ? *schema.dictionary : schema;
+            if (schema.dictionary != nullptr)
+            {
+                const auto [index_type_id, index_type] = encode_type(builder, schema);
+                if (index_type_id != format::type_id::integer)
+                {
+                    throw std::invalid_argument("Dictionary indices must be integers");
+                }
+                table encoding;
+                encoding.add(format::dictionary_encoding::id, next_dictionary_id++);
+                encoding.add_offset(format::dictionary_encoding::index_type, index_type);
+                encoding.add(
+                    format::dictionary_encoding::is_ordered,
+                    has_flag(schema, ArrowFlag::DICTIONARY_ORDERED)
+                );
+                field.add_offset(format::field::dictionary, builder.create_table(std::move(encoding)));
+            }
+
+            const auto [type_id, type] = encode_type(builder, value_schema);
+            field.add(format::field::type_type, static_cast<std::uint8_t>(type_id));
+            field.add_offset(format::field::type, type);
+            field.add(format::field::nullable, has_flag(schema, ArrowFlag::NULLABLE));
+
+            if (name.has_value())
+            {
+                field.add_offset(format::field::name, builder.create_string(*name));
+            }
+            else if (schema.name != nullptr)
+            {
+                field.add_offset(format::field::name, builder.create_string(schema.name));
+            }
+            if (schema.metadata != nullptr)
+            {
+                field.add_offset(
+                    format::field::custom_metadata,
+                    encode_metadata(builder, key_value_view(schema.metadata))
+                );
+            }
+
+            std::vector<ref> children;
+            children.reserve(static_cast<std::size_t>(value_schema.n_children));
+            for (std::int64_t i = 0; i < value_schema.n_children; ++i)
+            {
+                children.push_back(encode_field(builder, *value_schema.children[i], std::nullopt, next_dictionary_id));
+            }
+            field.add_offset(format::field::children, builder.create_vector_of_tables(std::move(children)));
+            return builder.create_table(std::move(field));
+        }
+
+        ref encode_schema(flatbuffer_builder& builder, const record_batch& batch)
+        {
+            std::vector<ref> fields;
+            fields.reserve(batch.nb_columns());
+            std::int64_t next_dictionary_id = 0;
+            for (std::size_t i = 0; i < batch.nb_columns(); ++i)
+            {
+                const auto& proxy = sparrow::detail::array_access::get_arrow_proxy(batch.get_column(i));
+                fields.push_back(
+                    encode_field(builder, proxy.schema(), batch.get_column_name(i), next_dictionary_id)
+                );
+            }
+            table schema;
+            schema.add_offset(format::schema::fields, builder.create_vector_of_tables(std::move(fields)));
+            if (batch.metadata().has_value())
+            {
+                schema.add_offset(format::schema::custom_metadata, encode_metadata(builder, *batch.metadata()));
+            }
+            return builder.create_table(std::move(schema));
+        }
+
+        std::vector<std::uint8_t> finish_message(
+            flatbuffer_builder& builder,
+            format::message_header header_type,
+            ref header,
+            std::size_t body_length
+        )
+        {
+            table message;
+            message.add(format::message::version, format::metadata_version);
+            message.add(format::message::header_type, static_cast<std::uint8_t>(header_type));
+            message.add_offset(format::message::header, header);
+            message.add(format::message::body_length, static_cast<std::int64_t>(body_length));
+            return builder.finish(builder.create_table(std::move(message)));
+        }
+
+        /***************
+         * Body        *
+         ***************/
+
+        bool has_validity(data_type dt)
+        {
+            switch (dt)
+            {
+                case data_type::NA:
+                case data_type::RUN_ENCODED:
+                case data_type::DENSE_UNION:
+                case data_type::SPARSE_UNION:
+                    return false;
+                default:
+                    return true;
+            }
+        }
+
+        // The IPC format has no offset: arrays with a non-zero offset anywhere in their
+        // tree (dictionaries excepted, they are written in their own messages) are compacted.
+        bool has_offset(const ArrowArray& array)
+        {
+            if (array.offset != 0)
+            {
+                return true;
+            }
+            for (std::int64_t i = 0; i < array.n_children; ++i)
+            {
+                if (has_offset(*array.children[i]))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        class prepared_array
+        {
+        public:
+
+            prepared_array(const ArrowArray& array, const ArrowSchema& schema)
+                : p_array(&array)
+                , p_schema(&schema)
+            {
+                if (has_offset(array))
+                {
+                    m_compacted = compact_array(array, schema);
+                    p_array = &m_compacted;
+                }
+            }
+
+            ~prepared_array()
+            {
+                if (m_compacted.release != nullptr)
+                {
+                    m_compacted.release(&m_compacted);
+                }
+            }
+
+            prepared_array(const prepared_array&) = delete;
+            prepared_array& operator=(const prepared_array&) = delete;
+
+            [[nodiscard]] const ArrowArray& array() const
+            {
+                return *p_array;
+            }
+
+            [[nodiscard]] const ArrowSchema& schema() const
+            {
+                return *p_schema;
+            }
+
+        private:
+
+            const ArrowArray* p_array;
+            const ArrowSchema* p_schema;
+            ArrowArray m_compacted{};
+        };
+
+        struct body_builder
+        {
+            explicit body_builder(std::size_t buffer_alignment)
+                : alignment(buffer_alignment)
+            {
+            }
+
+            std::size_t alignment;
+            std::vector<format::field_node> nodes;
+            std::vector<format::buffer> buffers;
+            std::vector<std::int64_t> variadic_buffer_counts;
+            std::vector<std::span<const std::uint8_t>> data;
+            std::size_t length = 0;
+            std::optional<compression_codec> codec;
+            // Storage of the compressed buffers
+            std::vector<std::vector<std::uint8_t>> compressed;
+
+            void add_buffer(const std::uint8_t* ptr, std::size_t size)
+            {
+                buffers.push_back({static_cast<std::int64_t>(length), static_cast<std::int64_t>(size)});
+                data.emplace_back(ptr, size);
+                length = align_up(length + size, alignment);
+            }
+
+            void add_array(const ArrowArray& array, const ArrowSchema& schema)
+            {
+                const data_type dt = format_to_data_type(schema.format);
+                const std::int64_t null_count = compute_null_count(array, dt);
+                nodes.push_back({array.length, null_count});
+
+                auto views = get_arrow_array_buffers(array, schema);
+                if (dt == data_type::STRING_VIEW || dt == data_type::BINARY_VIEW)
+                {
+                    // The sizes of the variadic buffers are recorded in the metadata
+                    views.pop_back();
+                    variadic_buffer_counts.push_back(static_cast<std::int64_t>(views.size() - 2));
+                }
+                for (std::size_t i = 0; i < views.size(); ++i)
+                {
+                    if (i == 0 && has_validity(dt) && null_count == 0)
+                    {
+                        add_buffer(nullptr, 0);
+                    }
+                    else
+                    {
+                        add_buffer(views[i].data(), views[i].size());
+                    }
+                }
+                for (std::int64_t i = 0; i < array.n_children; ++i)
+                {
+                    add_array(*array.children[i], *schema.children[i]);
+                }
+            }
+
+            static std::int64_t compute_null_count(const ArrowArray& array, data_type dt)
+            {
+                if (dt == data_type::NA)
+                {
+                    return array.length;
+                }
+                if (!has_validity(dt) || array.buffers[0] == nullptr)
+                {
+                    return 0;
+                }
+                if (array.null_count >= 0)
+                {
+                    return array.null_count;
+                }
+                const auto set_bits = count_set_bits(
+                    static_cast<const std::uint8_t*>(array.buffers[0]),
+                    static_cast<std::size_t>(array.offset),
+                    static_cast<std::size_t>(array.length)
+                );
+                return array.length - static_cast<std::int64_t>(set_bits);
+            }
+
+            // Replaces the buffers with their compressed version, prefixed with their length
+            void compress(compression_codec compression)
+            {
+                constexpr std::size_t min_bytes_per_task = std::size_t(1) << 20;
+                std::size_t total_size = 0;
+                for (const auto& d : data)
+                {
+                    total_size += d.size();
+                }
+                compressed.assign(data.size(), {});
+                parallel_for(
+                    data.size(),
+                    [&](std::size_t i)
+                    {
+                        const auto& d = data[i];
+                        if (d.empty())
+                        {
+                            return;
+                        }
+                        auto& out = compressed[i];
+                        auto prefix = static_cast<std::int64_t>(d.size());
+                        out.resize(sizeof(prefix));
+                        ipc::compress(compression, d, out);
+                        if (out.size() >= sizeof(prefix) + d.size())
+                        {
+                            prefix = format::uncompressed_buffer_marker;
+                            out.resize(sizeof(prefix));
+                            out.insert(out.end(), d.begin(), d.end());
+                        }
+                        std::memcpy(out.data(), &prefix, sizeof(prefix));
+                    },
+                    parallel_task_count(total_size, min_bytes_per_task)
+                );
+
+                length = 0;
+                for (std::size_t i = 0; i < data.size(); ++i)
+                {
+                    buffers[i] = {static_cast<std::int64_t>(length), static_cast<std::int64_t>(compressed[i].size())};
+                    data[i] = compressed[i];
+                    length = align_up(length + compressed[i].size(), alignment);
+                }
+                codec = compression;
+            }
+
+            ref encode(flatbuffer_builder& builder, std::int64_t batch_length) const
+            {
+                std::optional<ref> compression;
+                if (codec.has_value())
+                {
+                    table body_compression;
+                    body_compression.add(format::body_compression::codec, static_cast<std::int8_t>(*codec));
+                    body_compression.add(format::body_compression::method, format::compression_method_buffer);
+                    compression = builder.create_table(std::move(body_compression));
+                }
+                table t;
+                t.add(format::record_batch::length, batch_length);
+                t.add_offset(format::record_batch::nodes, builder.create_vector(std::span<const format::field_node>(nodes)));
+                t.add_offset(format::record_batch::buffers, builder.create_vector(std::span<const format::buffer>(buffers)));
+                if (!variadic_buffer_counts.empty())
+                {
+                    t.add_offset(
+                        format::record_batch::variadic_buffer_counts,
+                        builder.create_vector(std::span<const std::int64_t>(variadic_buffer_counts))
+                    );
+                }
+                if (compression.has_value())
+                {
+                    t.add_offset(format::record_batch::compression, *compression);
+                }
+                return builder.create_table(std::move(t));
+            }
+
+            // Bytes identifying the content of a dictionary
+            std::vector<std::uint8_t> content() const
+            {
+                std::vector<std::uint8_t> res;
+                const auto* node_bytes = reinterpret_cast<const std::uint8_t*>(nodes.data());
+                res.insert(res.end(), node_bytes, node_bytes + nodes.size() * sizeof(format::field_node));
+                for (const auto& d : data)
+                {
+                    res.insert(res.end(), d.begin(), d.end());
+                }
+                return res;
+            }
+        };
+
+        struct dictionary_entry
+        {
+            std::int64_t id;
+            const ArrowArray* array;
+            const ArrowSchema* schema;
+        };
+
+        // Follows the same order as encode_field
+        void collect_dictionaries(
+            const ArrowArray& array,
+            const ArrowSchema& schema,
+            std::int64_t& next_dictionary_id,
+            std::vector<dictionary_entry>& dictionaries
+        )
+        {
+            if (schema.dictionary != nullptr)
+            {
+                if (array.dictionary == nullptr)
+                {
+                    throw std::invalid_argument("Dictionary-encoded array without dictionary");
+                }
+                dictionaries.push_back({next_dictionary_id++, array.dictionary, schema.dictionary});
+                for (std::int64_t i = 0; i < schema.dictionary->n_children; ++i)
+                {
+                    collect_dictionaries(
+                        *array.dictionary->children[i],
+                        *schema.dictionary->children[i],
+                        next_dictionary_id,
+                        dictionaries
+                    );
+                }
+            }
+            else
+            {
+                for (std::int64_t i = 0; i < schema.n_children; ++i)
+                {
+                    collect_dictionaries(*array.children[i], *schema.children[i], next_dictionary_id, dictionaries);
+                }
+            }
+        }
+
+        std::vector<const void*> buffer_pointers(const ArrowArray& array)
+        {
+            std::vector<const void*> res(array.buffers, array.buffers + array.n_buffers);
+            res.push_back(reinterpret_cast<const void*>(static_cast<std::uintptr_t>(array.length)));
+            res.push_back(reinterpret_cast<const void*>(static_cast<std::uintptr_t>(array.offset)));
+            return res;
+        }
+    }
+
+    namespace detail
+    {
+        writer_base::writer_base(std::ostream& stream, write_options options, bool file_format)
+            : p_stream(&stream)
+            , m_options(options)
+            , m_file_format(file_format)
+        {
+            if (options.alignment < 8 || !std::has_single_bit(options.alignment))
+            {
+                throw std::invalid_argument("The IPC alignment must be a power of two, at least 8");
+            }
+            if (options.compression.has_value() && !is_codec_available(*options.compression))
+            {
+                throw std::invalid_argument("The IPC compression codec is not available in this build of sparrow");
+            }
+        }
+
+        void writer_base::check_not_closed() const
+        {
+            if (m_closed)
+            {
+                throw std::logic_error("The IPC writer is closed");
+            }
+        }
+
+        void writer_base::write_padding(std::size_t size)
+        {
+            static constexpr std::array<char, 64> zeros{};
+            while (size != 0)
+            {
+                const std::size_t n = std::min(size, zeros.size());
+                p_stream->write(zeros.data(), static_cast<std::streamsize>(n));
+                size -= n;
+                m_position += n;
+            }
+        }
+
+        format::block writer_base::write_message(
+            std::span<const std::uint8_t> metadata,
+            std::span<const std::span<const std::uint8_t>> body
+        )
+        {
+            const std::size_t start = m_position;
+            constexpr std::size_t prefix_size = 2 * sizeof(std::uint32_t);
+            // The metadata is padded so that the body starts aligned
+            const std::size_t metadata_size = align_up(start + prefix_size + metadata.size(), m_options.alignment)
+                                              - start - prefix_size;
+            const std::uint32_t continuation = format::continuation_marker;
+            // The lengths of the IPC format are little-endian
+            const auto length = to_native_endian<std::endian::little>(static_cast<std::int32_t>(metadata_size));
+            p_stream->write(reinterpret_cast<const char*>(&continuation), sizeof(continuation));
+            p_stream->write(reinterpret_cast<const char*>(&length), sizeof(length));
+            p_stream->write(reinterpret_cast<const char*>(metadata.data()), static_cast<std::streamsize>(metadata.size()));
+            m_position += prefix_size + metadata.size();
+            write_padding(metadata_size - metadata.size());
+
+            const std::size_t body_start = m_position;
+            for (const auto& buf : body)
+            {
+                if (!buf.empty())
+                {
+                    p_stream->write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+                    m_position += buf.size();
+                }
+                write_padding(align_up(m_position, m_options.alignment) - m_position);
+            }
+            if (!*p_stream)
+            {
+                throw std::runtime_error("Failed to write the IPC message");
+            }
+            return {
+                static_cast<std::int64_t>(start),
+                static_cast<std::int32_t>(prefix_size + metadata_size),
+                0,
+                static_cast<std::int64_t>(m_position - body_start)
+            };
+        }
+
+        void writer_base::set_schema(const record_batch& batch)
+        {
+            flatbuffer_builder schema_builder;
+            auto schema_message = finish_message(
+                schema_builder,
+                format::message_header::schema,
+                encode_schema(schema_builder, batch),
+                0
+            );
+            if (m_schema_message.has_value())
+            {
+                if (*m_schema_message != schema_message)
+                {
+                    throw std::invalid_argument("The schema of the record batch differs from the one of the IPC stream");
+                }
+                return;
+            }
+            m_schema_message = std::move(schema_message);
+            if (m_file_format)
+            {
+                m_footer_schema = encode_schema(m_footer, batch);
+            }
+        }
+
+        void writer_base::write_schema_message()
+        {
+            if (!m_schema_written)
+            {
+                write_message(*m_schema_message, {});
+                m_schema_written = true;
+            }
+        }
+
+        void writer_base::write_batch(const record_batch& batch)
+        {
+            check_not_closed();
+            set_schema(batch);
+            const bool first_batch = !m_schema_written;
+
+            std::vector<std::unique_ptr<prepared_array>> columns;
+            columns.reserve(batch.nb_columns());
+            std::vector<dictionary_entry> dictionaries;
+            std::int64_t next_dictionary_id = 0;
+            for (const auto& column : batch.columns())
+            {
+                const auto& proxy = sparrow::detail::array_access::get_arrow_proxy(column);
+                columns.push_back(std::make_unique<prepared_array>(proxy.array(), proxy.schema()));
+                collect_dictionaries(columns.back()->array(), proxy.schema(), next_dictionary_id, dictionaries);
+            }
+            m_dictionaries.resize(dictionaries.size());
+
+            // Dictionaries referenced by other dictionaries have larger ids, and must be
+            // known by the reader first. The content is checked before anything is written.
+            std::vector<std::pair<dictionary_entry, std::vector<std::uint8_t>>> to_write;
+            for (auto it = dictionaries.rbegin(); it != dictionaries.rend(); ++it)
+            {
+                auto& written = m_dictionaries[static_cast<std::size_t>(it->id)];
+                auto pointers = buffer_pointers(*it->array);
+                if (!first_batch && written.buffers == pointers)
+                {
+                    continue;
+                }
+                prepared_array dictionary(*it->array, *it->schema);
+                body_builder body(m_options.alignment);
+                body.add_array(dictionary.array(), dictionary.schema());
+                auto content = body.content();
+                if (!first_batch && written.content == content)
+                {
+                    written.buffers = std::move(pointers);
+                    continue;
+                }
+                if (m_file_format && !first_batch)
+                {
+                    throw std::invalid_argument("The IPC file format does not support dictionary replacement");
+                }
+                written.buffers = std::move(pointers);
+                written.content = content;
+                to_write.emplace_back(*it, std::move(content));
+            }
+
+            write_schema_message();
+
+            for (const auto& [entry, content] : to_write)
+            {
+                prepared_array dictionary(*entry.array, *entry.schema);
+                body_builder body(m_options.alignment);
+                body.add_array(dictionary.array(), dictionary.schema());
+                if (m_options.compression.has_value())
+                {
+                    body.compress(*m_options.compression);
+                }
+                flatbuffer_builder builder;
+                table dictionary_batch;
+                dictionary_batch.add(format::dictionary_batch::id, entry.id);
+                dictionary_batch.add_offset(format::dictionary_batch::data, body.encode(builder, entry.array->length));
+                const auto metadata = finish_message(
+                    builder,
+                    format::message_header::dictionary_batch,
+                    builder.create_table(std::move(dictionary_batch)),
+                    body.length
+                );
+                m_dictionary_blocks.push_back(write_message(metadata, body.data));
+            }
+
+            body_builder body(m_options.alignment);
+            for (const auto& column : columns)
+            {
+                body.add_array(column->array(), column->schema());
+            }
+            if (m_options.compression.has_value())
+            {
+                body.compress(*m_options.compression);
+            }
+            flatbuffer_builder builder;
+            const auto metadata = finish_message(
+                builder,
+                format::message_header::record_batch,
+                body.encode(builder, static_cast<std::int64_t>(batch.nb_rows())),
+                body.length
+            );
+            m_record_batch_blocks.push_back(write_message(metadata, body.data));
+        }
+
+        void writer_base::write_end_of_stream()
+        {
+            const std::array<std::uint32_t, 2> end_of_stream = {format::continuation_marker, 0};
+            p_stream->write(reinterpret_cast<const char*>(end_of_stream.data()), sizeof(end_of_stream));
+            m_position += sizeof(end_of_stream);
+        }
+    }
+
+    /********************************
+     * stream_writer implementation *
+     ********************************/
+
+    stream_writer::stream_writer(std::ostream& stream, write_options options)
+        : writer_base(stream, options, false)
+    {
+    }
+
+    void stream_writer::write(const record_batch& batch)
+    {
+        write_batch(batch);
+    }
+
+    void stream_writer::write_schema(const record_batch& batch)
+    {
+        check_not_closed();
+        set_schema(batch);
+    }
+
+    void stream_writer::close()
+    {
+        check_not_closed();
+        if (m_schema_message.has_value())
+        {
+            write_schema_message();
+        }
+        write_end_of_stream();
+        p_stream->flush();
+        m_closed = true;
+    }
+
+    /******************************
+     * file_writer implementation *
+     ******************************/
+
+    file_writer::file_writer(std::ostream& stream, write_options options)
+        : writer_base(stream, options, true)
+    {
+        p_stream->write(format::file_magic.data(), format::file_magic.size());
+        m_position += format::file_magic.size();
+        write_padding(format::file_header_size - format::file_magic.size());
+    }
+
+    void file_writer::write(const record_batch& batch)
+    {
+        write_batch(batch);
+    }
+
+    void file_writer::write_schema(const record_batch& batch)
+    {
+        check_not_closed();
+        set_schema(batch);
+    }
+
+    void file_writer::close()
+    {
+        check_not_closed();
+        if (!m_footer_schema.has_value())
+        {
+            throw std::logic_error("Cannot close an IPC file without schema");
+        }
+        write_schema_message();
+        write_end_of_stream();
+
+        table footer;
+        footer.add(format::footer::version, format::metadata_version);
+        footer.add_offset(format::footer::schema, *m_footer_schema);
+        footer.add_offset(
+            format::footer::dictionaries,
+            m_footer.create_vector(std::span<const format::block>(m_dictionary_blocks))
+        );
+        footer.add_offset(
+            format::footer::record_batches,
+            m_footer.create_vector(std::span<const format::block>(m_record_batch_blocks))
+        );
+        const auto bytes = m_footer.finish(m_footer.create_table(std::move(footer)));
+        const auto footer_length = static_cast<std::int32_t>(bytes.size());
+        p_stream->write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        p_stream->write(reinterpret_cast<const char*>(&footer_length), sizeof(footer_length));
+        p_stream->write(format::file_magic.data(), format::file_magic.size());
+        m_position += bytes.size() + sizeof(footer_length) + format::file_magic.size();
+        p_stream->flush();
+        if (!*p_stream)
+        {
+            throw std::runtime_error("Failed to write the IPC file footer");
+        }
+        m_closed = true;
+    }
+}
@@ -14,7 +14,11 @@
 
 #include "sparrow/layout/array_registry.hpp"
 
+#include <memory>
+#include <mutex>
+#include <span>
 #include <stdexcept>
+#include <string>
 
 namespace sparrow
 {
@@ -39,14 +43,41 @@ namespace sparrow
             }
         }
 
+        // Helper to build the factory of a single type using compile-time type information
+        template <data_type DT>
+        array_registry::factory_func make_base_factory()
+        {
+            if constexpr (DT == data_type::TIMESTAMP_SECONDS || DT == data_type::TIMESTAMP_MILLISECONDS
+                          || DT == data_type::TIMESTAMP_MICROSECONDS || DT == data_type::TIMESTAMP_NANOSECONDS)
+            {
+                // Special handling for timestamp types with timezone check
+                using types = timestamp_type_map<DT>;
+                return [](arrow_proxy proxy)
+                {
+                    return make_timestamp_wrapper<typename types::with_tz, typename types::without_tz>(
+                        std::move(proxy)
+                    );
+                };
+            }
+            else
+            {
+                // Standard type registration
+                using array_t = array_type_t<DT>;
+                return [](arrow_proxy proxy)
+                {
+                    return make_wrapper_ptr<array_t>(std::move(proxy));
+                };
+            }
+        }
+
         // Recursive helper to register all types from all_data_types array
         template <std::size_t I = 0>
-        void register_all_types(array_registry& registry)
+        void register_all_types(std::span<array_registry::factory_func, all_data_types.size()> factories)
         {
             if constexpr (I < all_data_types.size())
             {
-                register_type<all_data_types[I]>(registry);
-                register_all_types<I + 1>(registry);
+                factories[I] = make_base_factory<all_data_types[I]>();
+                register_all_types<I + 1>(factories);
             }
         }
     }
@@ -54,8 +85,12 @@ namespace sparrow
     array_registry::array_registry()
     {
         // ===== Register all base types using template metaprogramming =====
-        // This iterates over all_data_types array and registers each type automatically
-        detail::register_all_types(*this);
+        // This iterates over all_data_types array and fills the initial snapshot, which
+        // is published before the registry can be accessed by other threads
+        auto initial = std::make_unique<snapshot>();
+        detail::register_all_types(initial->base_factories);
+        m_current.store(initial.get(), std::memory_order_release);
+        m_snapshots.push_back(std::move(initial));
     }
 
     array_registry& array_registry::instance()
@@ -64,9 +99,36 @@ namespace sparrow
         return reg;
     }
 
+    std::size_t array_registry::table_index(data_type dt)
+    {
+        const auto index = static_cast<std::size_t>(dt);
+        if (index >= all_data_types.size())
+        {
+            throw std::invalid_argument("Unknown data type");
+        }
+        return index;
+    }
+
+    template <class F>
+    void array_registry::update_snapshot(F&& func)
+    {
+        std::lock_guard<std::mutex> lock(m_write_mutex);
+        auto next = std::make_unique<snapshot>(*m_current.load(std::memory_order_relaxed));
+        std::forward<F>(func)(*next);
+        m_snapshots.reserve(m_snapshots.size() + 1);
+        m_current.store(next.get(), std::memory_order_release);
+        m_snapshots.push_back(std::move(next));
+    }
+
     void array_registry::register_base_type(data_type dt, factory_func factory)
     {
-        m_base_factories[dt] = std::move(factory);
+        const std::size_t index = table_index(dt);
+        update_snapshot(
+            [index, &factory](snapshot& next)
+            {
+                next.base_factories[index] = std::move(factory);
+            }
+        );
     }
 
     void
@@ -74,9 +136,9 @@ namespace sparrow
     {
         register_extension(
             base_type,
-            [extension_name](const arrow_proxy& proxy)
+            [name = std::string(extension_name)](const arrow_proxy& proxy)
             {
-                return has_extension_name(proxy, extension_name);
+                return has_extension_name(proxy, name);
             },
             std::move(factory)
         );
@@ -85,7 +147,13 @@ namespace sparrow
     void
     array_registry::register_extension(data_type base_type, extension_predicate predicate, factory_func factory)
     {
-        m_extensions[base_type].emplace_back(std::move(predicate), std::move(factory));
+        const std::size_t index = table_index(base_type);
+        update_snapshot(
+            [index, &predicate, &factory](snapshot& next)
+            {
+                next.extensions[index].emplace_back(std::move(predicate), std::move(factory));
+            }
+        );
     }
 
     bool array_registry::extension_entry::matches(const array_wrapper& wrapper) const
@@ -123,24 +191,25 @@ namespace sparrow
             }
         }
 
-        // Check for extensions first
-        auto ext_it = m_extensions.find(dt);
-        if (ext_it != m_extensions.end())
+        const auto index = static_cast<std::size_t>(dt);
+        if (index < all_data_types.size())
         {
-            for (const auto& entry : ext_it->second)
+            const snapshot& current = *m_current.load(std::memory_order_acquire);
+
+            // Check for extensions first
+            for (const auto& entry : current.extensions[index])
             {
                 if (entry.predicate(proxy))
                 {
                     return entry.factory(std::move(proxy));
                 }
             }
-        }
 
-        // Fall back to base type
-        auto base_it = m_base_factories.find(dt);
-        if (base_it != m_base_factories.end())
-        {
-            return base_it->second(std::move(proxy));
+            // Fall back to base type
+            if (const auto& factory = current.base_factories[index])
+            {
+                return factory(std::move(proxy));
+            }
         }
 
         throw std::runtime_error("Unsupported data type");
@@ -148,45 +217,7 @@ namespace sparrow
 
     bool array_registry::has_extension_name(const arrow_proxy& proxy, std::string_view extension_name)
     {
-        const std::optional<key_value_view> metadata = proxy.metadata();
-        if (metadata.has_value())
-        {
-            const auto it = metadata->find("ARROW:extension:name");
-            return it != metadata->end() && (*it).second == extension_name;
-        }
-        return false;
-    }
-
-    // Helper to register a single type using compile-time type information
-    template <data_type DT>
-    void register_type(array_registry& registry)
-    {
-        if constexpr (DT == data_type::TIMESTAMP_SECONDS || DT == data_type::TIMESTAMP_MILLISECONDS
-                      || DT == data_type::TIMESTAMP_MICROSECONDS || DT == data_type::TIMESTAMP_NANOSECONDS)
-        {
-            // Special handling for timestamp types with timezone check
-            using types = timestamp_type_map<DT>;
-            registry.register_base_type(
-                DT,
-                [](arrow_proxy proxy)
-                {
-                    return detail::make_timestamp_wrapper<typename types::with_tz, typename types::without_tz>(
-                        std::move(proxy)
-                    );
-                }
-            );
-        }
-        else
-        {
-            // Standard type registration
-            using array_t = array_type_t<DT>;
-            registry.register_base_type(
-                DT,
-                [](arrow_proxy proxy)
-                {
-                    return detail::make_wrapper_ptr<array_t>(std::move(proxy));
-                }
-            );
-        }
+        const std::optional<std::string_view> name = proxy.extension_name();
+        return name.has_value() && *name == extension_name;
     }
 }
@@ -13,18 +13,59 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
 
 #include "sparrow/layout/array_helper.hpp"
 #include "sparrow/layout/nested_value_types.hpp"
 
 namespace sparrow
 {
+    struct_field_index::struct_field_index(const std::vector<cloning_ptr<array_wrapper>>& children)
+    {
+        m_positions.reserve(children.size());
+        for (std::size_t i = 0; i < children.size(); ++i)
+        {
+            insert(children[i]->get_arrow_proxy().name(), i);
+        }
+    }
+
+    void struct_field_index::insert(std::optional<std::string_view> name, std::size_t position)
+    {
+        if (name.has_value())
+        {
+            m_positions.try_emplace(std::string(*name), position);
+        }
+    }
+
+    std::optional<struct_field_handle> struct_field_index::find(std::string_view name) const
+    {
+        const auto it = m_positions.find(name);
+        if (it == m_positions.end())
+        {
+            return std::nullopt;
+        }
+        return struct_field_handle(it->second);
+    }
+
     struct_value::struct_value(const std::vector<child_ptr>& children, size_type index)
         : p_children(&children)
         , m_index(index)
     {
     }
 
+    struct_value::struct_value(
+        const std::vector<child_ptr>& children,
+        const struct_field_index& field_index,
+        size_type index
+    )
+        : p_children(&children)
+        , p_field_index(&field_index)
+        , m_index(index)
+    {
+    }
+
     auto struct_value::size() const -> size_type
     {
         return p_children->size();
@@ -48,18 +89,53 @@ namespace sparrow
 
     auto struct_value::at(std::string_view name) const -> const_reference
     {
-        auto it = std::ranges::find_if(
+        return (*this)[field_handle(name)];
+    }
+
+    auto struct_value::operator[](struct_field_handle field) const -> const_reference
+    {
+        return (*this)[field.index()];
+    }
+
+    auto struct_value::at(struct_field_handle field) const -> const_reference
+    {
+        return at(field.index());
+    }
+
+    auto struct_value::field_handle(std::string_view name) const -> struct_field_handle
+    {
+        const std::optional<struct_field_handle> field = find_field(name);
+        if (!field.has_value())
+        {
+            throw std::out_of_range("Child not found");
+        }
+        return *field;
+    }
+
+    auto struct_value::find_field(std::string_view name) const -> std::optional<struct_field_handle>
+    {
+        if (p_field_index != nullptr)
+        {
+            return p_field_index->find(name);
+        }
+        // struct_value built without the index of its struct_array
+        const auto it = std::ranges::find_if(
             *p_children,
             [&name](const auto& child)
             {
                 return child->get_arrow_proxy().name() == name;
             }
         );
-        if (it != p_children->end())
+        if (it == p_children->end())
         {
-            return array_element(*((*it).get()), m_index);
+            return std::nullopt;
         }
-        throw std::out_of_range("Child not found");
+        return struct_field_handle(static_cast<std::size_t>(std::distance(p_children->begin(), it)));
+    }
+
+    auto struct_value::index() const -> size_type
+    {
+        return m_index;
     }
 
     auto struct_value::front() const -> const_reference
@@ -14,6 +14,9 @@
 
 #include "sparrow/record_batch.hpp"
 
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <unordered_set>
 
 #include "sparrow/debug/copy_tracker.hpp"
@@ -30,6 +33,86 @@ namespace sparrow
         }
     }
 
+    record_batch::lazy_column::lazy_column(size_type length_, std::function<array()> factory_)
+        : length(length_)
+        , factory(std::move(factory_))
+        , once(std::make_unique<std::once_flag>())
+    {
+    }
+
+    record_batch::lazy_column::lazy_column(const lazy_column& rhs)
+        : length(rhs.length)
+        , factory(rhs.factory)
+        , once(std::make_unique<std::once_flag>())
+    {
+        if (rhs.is_materialized())
+        {
+            value = rhs.value;
+            mark_materialized();
+        }
+    }
+
+    record_batch::lazy_column::lazy_column(lazy_column&& rhs) noexcept
+        : length(rhs.length)
+        , factory(std::move(rhs.factory))
+        , value(std::move(rhs.value))
+        , once(std::move(rhs.once))
+        , materialized(rhs.materialized.load(std::memory_order_relaxed))
+    {
+    }
+
+    auto record_batch::lazy_column::operator=(const lazy_column& rhs) -> lazy_column&
+    {
+        if (this != &rhs)
+        {
+            *this = lazy_column(rhs);
+        }
+        return *this;
+    }
+
+    auto record_batch::lazy_column::operator=(lazy_column&& rhs) noexcept -> lazy_column&
+    {
+        length = rhs.length;
+        factory = std::move(rhs.factory);
+        value = std::move(rhs.value);
+        once = std::move(rhs.once);
+        materialized.store(rhs.materialized.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    array& record_batch::lazy_column::get() const
+    {
+        std::call_once(
+            *once,
+            [this]()
+            {
+                value.emplace(factory());
+                SPARROW_ASSERT(
+                    value->size() == length,
+                    "The array created by a lazy column must have the length of the column"
+                );
+                materialized.store(true, std::memory_order_release);
+            }
+        );
+        return *value;
+    }
+
+    bool record_batch::lazy_column::is_materialized() const noexcept
+    {
+        return materialized.load(std::memory_order_acquire);
+    }
+
+    void record_batch::lazy_column::mark_materialized() const
+    {
+        std::call_once(
+            *once,
+            []()
+            {
+            }
+        );
+        materialized.store(true, std::memory_order_release);
+    }
+
     array* record_batch::get_array_ptr(array_storage_type& storage)
     {
         return std::visit(
@@ -44,6 +127,10 @@ namespace sparrow
                 {
                     return &arg.get();
                 }
+                else
+                {
+                    return &arg.get();
+                }
             },
             storage
         );
@@ -63,11 +150,24 @@ namespace sparrow
                 {
                     return &arg.get();
                 }
+                else
+                {
+                    return &arg.get();
+                }
             },
             storage
         );
     }
 
+    auto record_batch::get_array_size(const array_storage_type& storage) -> size_type
+    {
+        if (const auto* column = std::get_if<lazy_column>(&storage))
+        {
+            return column->length;
+        }
+        return get_array_ptr(storage)->size();
+    }
+
     record_batch::record_batch(initializer_type init)
     {
         m_name_list.reserve(init.size());
@@ -141,15 +241,36 @@ namespace sparrow
     }
 
     record_batch::record_batch(const record_batch& rhs)
-        : m_name_list(rhs.m_name_list)
+        : m_name(rhs.m_name)
+        , m_metadata(rhs.m_metadata)
+        , m_name_list(rhs.m_name_list)
         , m_array_list(rhs.m_array_list)
     {
         update_array_map_cache();
         copy_tracker::increase(copy_tracker::key<record_batch>());
     }
 
+    record_batch::record_batch(const record_batch& rhs, std::pmr::memory_resource& resource)
+        : m_name(rhs.m_name)
+        , m_metadata(rhs.m_metadata)
+        , m_name_list(rhs.m_name_list)
+    {
+        m_array_list.reserve(rhs.nb_columns());
+        for (size_type i = 0; i < rhs.nb_columns(); ++i)
+        {
+            const arrow_proxy& proxy = detail::array_access::get_arrow_proxy(rhs.get_column(i));
+            m_array_list.emplace_back(
+                array(copy_array(proxy.array(), proxy.schema(), resource), copy_schema(proxy.schema()))
+            );
+        }
+        update_array_map_cache();
+        copy_tracker::increase(copy_tracker::key<record_batch>());
+    }
+
     record_batch& record_batch::operator=(const record_batch& rhs)
     {
+        m_name = rhs.m_name;
+        m_metadata = rhs.m_metadata;
         m_name_list = rhs.m_name_list;
         m_array_list = rhs.m_array_list;
         update_array_map_cache();
@@ -163,7 +284,7 @@ namespace sparrow
 
     auto record_batch::nb_rows() const -> size_type
     {
-        return m_array_list.empty() ? size_type(0) : get_array_ptr(m_array_list.front())->size();
+        return m_array_list.empty() ? size_type(0) : get_array_size(m_array_list.front());
     }
 
     bool record_batch::contains_column(const name_type& name) const
@@ -191,7 +312,7 @@ namespace sparrow
         {
             throw std::out_of_range("Column's name not found in record batch");
         }
-        return *(iter->second);
+        return *get_array_ptr(m_array_list[iter->second]);
     }
 
     array& record_batch::get_column(size_type index)
@@ -211,6 +332,11 @@ namespace sparrow
         return m_name;
     }
 
+    const std::optional<std::vector<metadata_pair>>& record_batch::metadata() const
+    {
+        return m_metadata;
+    }
+
     auto record_batch::names() const -> name_range
     {
         return std::ranges::ref_view(m_name_list);
@@ -226,15 +352,15 @@ namespace sparrow
             array* arr_ptr = get_array_ptr(m_array_list[i]);
 
             // Check if this is an owned array or a reference
-            if (std::holds_alternative<array>(m_array_list[i]))
+            if (std::holds_alternative<std::reference_wrapper<array>>(m_array_list[i]))
             {
-                // Move owned array
-                owned_arrays.push_back(std::move(std::get<array>(m_array_list[i])));
+                // Copy referenced array (cannot move from a reference)
+                owned_arrays.push_back(*arr_ptr);
             }
             else
             {
-                // Copy referenced array (cannot move from a reference)
-                owned_arrays.push_back(*arr_ptr);
+                // Move owned array, lazy columns have been created by get_array_ptr
+                owned_arrays.push_back(std::move(*arr_ptr));
             }
             owned_arrays.back().set_name(m_name_list[i]);
         }
@@ -246,6 +372,53 @@ namespace sparrow
         return struct_array(std::move(owned_arrays), false, m_name, std::move(m_metadata));
     }
 
+    record_batch record_batch::compact() const
+    {
+        record_batch res;
+        res.m_name = m_name;
+        res.m_metadata = m_metadata;
+        for (std::size_t i = 0; i < m_name_list.size(); ++i)
+        {
+            res.add_column(m_name_list[i], get_array_ptr(m_array_list[i])->compact());
+        }
+        res.update_array_map_cache();
+        return res;
+    }
+
+    record_batch record_batch::concatenate(std::span<const record_batch> batches)
+    {
+        if (batches.empty())
+        {
+            throw std::invalid_argument("Cannot concatenate an empty range of record batches");
+        }
+        const record_batch& first = batches.front();
+        for (const auto& batch : batches)
+        {
+            if (!std::ranges::equal(batch.m_name_list, first.m_name_list))
+            {
+                throw std::invalid_argument("Cannot concatenate record batches with different columns");
+            }
+        }
+        record_batch res;
+        res.m_name = first.m_name;
+        res.m_metadata = first.m_metadata;
+        std::vector<const array*> columns(batches.size());
+        for (std::size_t i = 0; i < first.m_name_list.size(); ++i)
+        {
+            std::ranges::transform(
+                batches,
+                columns.begin(),
+                [i](const record_batch& batch)
+                {
+                    return batch.get_array_ptr(batch.m_array_list[i]);
+                }
+            );
+            res.add_column(first.m_name_list[i], sparrow::concatenate(columns));
+        }
+        res.update_array_map_cache();
+        return res;
+    }
+
     void record_batch::add_column(name_type name, array column)
     {
         m_name_list.push_back(std::move(name));
@@ -276,6 +449,21 @@ namespace sparrow
         add_column_reference(std::move(name), column);
     }
 
+    void record_batch::add_lazy_column(name_type name, size_type length, std::function<array()> factory)
+    {
+        SPARROW_ASSERT_TRUE(factory);
+        m_name_list.push_back(std::move(name));
+        m_array_list.emplace_back(lazy_column(length, std::move(factory)));
+        m_dirty_map = true;
+    }
+
+    bool record_batch::is_column_materialized(size_type index) const
+    {
+        SPARROW_ASSERT_TRUE(index < nb_columns());
+        const auto* column = std::get_if<lazy_column>(&m_array_list[index]);
+        return column == nullptr || column->is_materialized();
+    }
+
     void record_batch::partial_init_from_schema(const ArrowSchema& sch)
     {
         if (sch.name)
@@ -307,8 +495,7 @@ namespace sparrow
         for (std::size_t i = m_name_list.size(); i != 0; --i)
         {
             const auto& name = m_name_list[i - 1];
-            array* ar = const_cast<array*>(get_array_ptr(m_array_list[i - 1]));
-            if (!m_array_map.try_emplace(name, ar).second)
+            if (!m_array_map.try_emplace(name, i - 1).second)
             {
                 break;
             }
@@ -329,10 +516,10 @@ namespace sparrow
 
         if (!m_array_list.empty())
         {
-            const size_type size = get_array_ptr(m_array_list[0])->size();
+            const size_type size = get_array_size(m_array_list[0]);
             for (size_type i = 1u; i < m_array_list.size(); ++i)
             {
-                const size_type current_size = get_array_ptr(m_array_list[i])->size();
+                const size_type current_size = get_array_size(m_array_list[i]);
                 const bool same_size = current_size == size;
 
                 if (!same_size)
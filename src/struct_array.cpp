@@ -14,6 +14,8 @@
 
 #include "sparrow/struct_array.hpp"
 
+#include <stdexcept>
+
 #include "sparrow/layout/array_factory.hpp"
 
 namespace sparrow
@@ -21,12 +23,14 @@ namespace sparrow
     struct_array::struct_array(arrow_proxy proxy)
         : base_type(std::move(proxy))
         , m_children(make_children())
+        , m_field_index(m_children)
     {
     }
 
     struct_array::struct_array(const struct_array& rhs)
         : base_type(rhs)
         , m_children(make_children())
+        , m_field_index(m_children)
     {
     }
 
@@ -36,6 +40,7 @@ namespace sparrow
         {
             base_type::operator=(rhs);
             m_children = make_children();
+            m_field_index = struct_field_index(m_children);
         }
         return *this;
     }
@@ -57,6 +62,21 @@ namespace sparrow
         return m_children[i].get();
     }
 
+    auto struct_array::find_field(std::string_view name) const -> std::optional<struct_field_handle>
+    {
+        return m_field_index.find(name);
+    }
+
+    auto struct_array::field_handle(std::string_view name) const -> struct_field_handle
+    {
+        const std::optional<struct_field_handle> field = find_field(name);
+        if (!field.has_value())
+        {
+            throw std::out_of_range("Child not found");
+        }
+        return *field;
+    }
+
     auto struct_array::value_begin() -> value_iterator
     {
         return value_iterator{detail::layout_value_functor<self_type, inner_value_type>{this}, 0};
@@ -82,12 +102,12 @@ namespace sparrow
 
     auto struct_array::value(size_type i) -> inner_reference
     {
-        return struct_value{m_children, i};
+        return struct_value{m_children, m_field_index, i};
     }
 
     auto struct_array::value(size_type i) const -> inner_const_reference
     {
-        return struct_value{m_children, i};
+        return struct_value{m_children, m_field_index, i};
     }
 
     auto struct_array::make_children() -> children_type
@@ -105,6 +125,7 @@ namespace sparrow
     {
         get_arrow_proxy().pop_children(n);
         m_children = make_children();
+        m_field_index = struct_field_index(m_children);
     }
 
 }
@@ -14,6 +14,8 @@
 
 #include "sparrow/utils/metadata.hpp"
 
+#include <algorithm>
+
 namespace sparrow
 {
     bool operator==(const sparrow::key_value_view& lhs, const sparrow::key_value_view& rhs)
@@ -35,6 +37,12 @@ namespace sparrow
     {
     }
 
+    key_value_view::key_value_view(const char* ptr, const key_value_index* index)
+        : key_value_view(ptr)
+    {
+        m_index = index;
+    }
+
     [[nodiscard]] key_value_view_iterator key_value_view::cbegin() const
     {
         return {*this, 0};
@@ -67,6 +75,11 @@ namespace sparrow
 
     [[nodiscard]] key_value_view_iterator key_value_view::find(std::string_view key) const
     {
+        if (m_index != nullptr)
+        {
+            const key_value_index::entry* found = m_index->find(key);
+            return found == nullptr ? end() : key_value_view_iterator(*this, found->index, found->position);
+        }
         for (auto it = begin(); it != end(); ++it)
         {
             if ((*it).first == key)
@@ -90,6 +103,20 @@ namespace sparrow
         }
     }
 
+    key_value_view_iterator::key_value_view_iterator(
+        const key_value_view& parent,
+        int32_t index,
+        const char* position
+    )
+        : m_parent(&parent)
+        , m_index(index)
+        , m_current(position)
+    {
+        SPARROW_ASSERT_TRUE(m_index >= 0);
+        SPARROW_ASSERT_TRUE(m_index < m_parent->m_num_pairs);
+        extract_key_value();
+    }
+
     key_value_view_iterator::value_type key_value_view_iterator::operator*() const
     {
         return std::pair(m_key, m_value);
@@ -131,4 +158,38 @@ namespace sparrow
             m_value = extract_string_view();
         }
     }
+
+    key_value_index::key_value_index(const char* ptr)
+    {
+        const int32_t num_pairs = extract_int32(ptr);
+        SPARROW_ASSERT_TRUE(num_pairs >= 0);
+        m_entries.reserve(static_cast<size_t>(num_pairs));
+        const auto extract_string_view = [&ptr]()
+        {
+            const int32_t length = extract_int32(ptr);
+            std::string_view str_view(ptr, static_cast<size_t>(length));
+            std::advance(ptr, length);
+            return str_view;
+        };
+        for (int32_t i = 0; i < num_pairs; ++i)
+        {
+            const char* position = ptr;
+            const std::string_view key = extract_string_view();
+            const std::string_view value = extract_string_view();
+            m_entries.push_back({key, value, i, position});
+        }
+        // The stable sort keeps the pairs with the same key in the order of the buffer,
+        // so that find returns the same pair as a linear scan.
+        std::ranges::stable_sort(m_entries, {}, &entry::key);
+        if (const entry* extension = find(extension_name_metadata_key); extension != nullptr)
+        {
+            m_extension_name = extension->value;
+        }
+    }
+
+    const key_value_index::entry* key_value_index::find(std::string_view key) const
+    {
+        const auto it = std::ranges::lower_bound(m_entries, key, {}, &entry::key);
+        return it != m_entries.end() && it->key == key ? &*it : nullptr;
+    }
 }
@@ -0,0 +1,191 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sparrow/utils/parallel.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sparrow::detail
+{
+    namespace
+    {
+        class thread_pool
+        {
+        public:
+
+            explicit thread_pool(std::size_t thread_count)
+            {
+                m_threads.reserve(thread_count);
+                for (std::size_t i = 0; i < thread_count; ++i)
+                {
+                    m_threads.emplace_back(
+                        [this]()
+                        {
+                            run();
+                        }
+                    );
+                    m_threads.back().detach();
+                }
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return m_threads.size();
+            }
+
+            void submit(std::function<void()> task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_tasks.push_back(std::move(task));
+                }
+                m_condition.notify_one();
+            }
+
+        private:
+
+            void run()
+            {
+                while (true)
+                {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_condition.wait(
+                            lock,
+                            [this]()
+                            {
+                                return !m_tasks.empty();
+                            }
+                        );
+                        task = std::move(m_tasks.front());
+                        m_tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<std::function<void()>> m_tasks;
+            std::vector<std::thread> m_threads;
+        };
+
+        // The pool is never destroyed: its threads wait for tasks until the process
+        // exits, joining them from a static destructor could deadlock when the library
+        // is unloaded.
+        thread_pool& shared_pool()
+        {
+            static thread_pool* pool = new thread_pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+            return *pool;
+        }
+
+        // State of a parallel_for call, shared with the tasks of the pool, which can
+        // start after the call has returned
+        struct loop_state
+        {
+            loop_state(std::size_t count, const std::function<void(std::size_t)>& func)
+                : count(count)
+                , func(&func)
+            {
+            }
+
+            // Runs the indices that are not taken yet
+            void work()
+            {
+                for (std::size_t i = next++; i < count && !failed; i = next++)
+                {
+                    try
+                    {
+                        (*func)(i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error)
+                        {
+                            error = std::current_exception();
+                        }
+                        failed = true;
+                    }
+                }
+            }
+
+            const std::size_t count;
+            // Only called by the tasks that have started before the call is closed
+            const std::function<void(std::size_t)>* func;
+            std::atomic<std::size_t> next{0};
+            std::atomic<bool> failed{false};
+            std::mutex mutex;
+            std::condition_variable done;
+            std::size_t active = 0;
+            bool closed = false;
+            std::exception_ptr error;
+        };
+    }
+
+    void parallel_for_impl(std::size_t count, const std::function<void(std::size_t)>& func, std::size_t max_tasks)
+    {
+        auto state = std::make_shared<loop_state>(count, func);
+        auto helper = [state]()
+        {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->closed)
+                {
+                    return;
+                }
+                ++state->active;
+            }
+            state->work();
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                --state->active;
+            }
+            state->done.notify_all();
+        };
+
+        thread_pool& pool = shared_pool();
+        const std::size_t helper_count = std::min(max_tasks - 1, pool.size());
+        for (std::size_t i = 0; i < helper_count; ++i)
+        {
+            pool.submit(helper);
+        }
+        state->work();
+
+        // The calling thread does not wait for the tasks that have not started yet,
+        // so that a parallel_for called from a task of the pool cannot deadlock
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->closed = true;
+            state->done.wait(
+                lock,
+                [&state]()
+                {
+                    return state->active == 0;
+                }
+            );
+        }
+        if (state->error)
+        {
+            std::rethrow_exception(state->error);
+        }
+    }
+}
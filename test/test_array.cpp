@@ -15,9 +15,12 @@
 #include "sparrow/array.hpp"
 #include "sparrow/layout/array_factory.hpp"
 #include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/list_array.hpp"
 #include "sparrow/primitive_array.hpp"
 #include "sparrow/struct_array.hpp"
 #include "sparrow/utils/nullable.hpp"
+#include "sparrow/variable_size_binary_array.hpp"
+#include "sparrow/variable_size_binary_view_array.hpp"
 
 #include "../test/external_array_data_creation.hpp"
 #include "doctest/doctest.h"
@@ -465,6 +468,46 @@ namespace sparrow
         }
         TEST_CASE_TEMPLATE_APPLY(slice_view_id, testing_types);
 
+        TEST_CASE_TEMPLATE_DEFINE("compact", AR, compact_id)
+        {
+            using scalar_value_type = typename AR::inner_value_type;
+
+            constexpr size_t size = 10;
+            array ar = test::make_array<scalar_value_type>(size);
+            const auto sliced = ar.slice(3, 9);
+            const auto compacted = sliced.compact();
+
+            REQUIRE_EQ(compacted.size(), sliced.size());
+            CHECK_EQ(compacted.offset(), 0);
+            CHECK_EQ(compacted.null_count(), sliced.null_count());
+            CHECK(compacted == sliced);
+            CHECK_EQ(compacted.metadata(), ar.metadata());
+        }
+        TEST_CASE_TEMPLATE_APPLY(compact_id, testing_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("concatenate", AR, concatenate_id)
+        {
+            using scalar_value_type = typename AR::inner_value_type;
+
+            constexpr size_t size = 10;
+            const array ar = test::make_array<scalar_value_type>(size);
+            const std::vector<array> parts{ar.slice(0, 3), ar.slice(3, 10)};
+            const array concatenated = concatenate(parts);
+
+            REQUIRE_EQ(concatenated.size(), size);
+            CHECK_EQ(concatenated.offset(), 0);
+            CHECK_EQ(concatenated.null_count(), ar.null_count());
+            CHECK(concatenated == ar);
+
+            // Unaligned slices, out of order
+            const std::vector<array> shuffled{ar.slice(5, 10), ar.slice(1, 4), ar.slice(0, 0)};
+            const array res = concatenate(shuffled);
+            REQUIRE_EQ(res.size(), 8);
+            CHECK(res.slice(0, 5) == ar.slice(5, 10));
+            CHECK(res.slice(5, 8) == ar.slice(1, 4));
+        }
+        TEST_CASE_TEMPLATE_APPLY(concatenate_id, testing_types);
+
         TEST_CASE_TEMPLATE_DEFINE("name", AR, name_id)
         {
             constexpr size_t size = 10;
@@ -589,6 +632,222 @@ namespace sparrow
             CHECK_FALSE(arr.dictionary().has_value());
         }
 
+        TEST_CASE("compact")
+        {
+            SUBCASE("string array")
+            {
+                const std::vector<std::string> words{"zero", "one", "two", "three", "four", "five"};
+                string_array strings(words, std::vector<std::size_t>{2});
+                const array sliced = array(std::move(strings)).slice(1, 4);
+                const array compacted = sliced.compact();
+
+                REQUIRE_EQ(compacted.size(), 3);
+                CHECK_EQ(compacted.offset(), 0);
+                CHECK_EQ(compacted.null_count(), 1);
+                CHECK(compacted == sliced);
+
+                const ArrowArray* arrow_array = get_arrow_array(compacted);
+                const auto* offsets = static_cast<const std::int32_t*>(arrow_array->buffers[1]);
+                CHECK_EQ(offsets[0], 0);
+                // "one" + "two" + "three"
+                CHECK_EQ(offsets[3], 11);
+            }
+
+            SUBCASE("string view array")
+            {
+                const std::vector<std::string> words{
+                    "short",
+                    "a string that does not fit in the view",
+                    "tiny",
+                    "another string stored out of line",
+                    "one more long string at the end"
+                };
+                string_view_array strings(words, false);
+                const array sliced = array(std::move(strings)).slice(1, 4);
+                const array compacted = sliced.compact();
+
+                REQUIRE_EQ(compacted.size(), 3);
+                CHECK_EQ(compacted.offset(), 0);
+                CHECK(compacted == sliced);
+
+                // validity, views, a single variadic buffer and its size
+                const ArrowArray* arrow_array = get_arrow_array(compacted);
+                REQUIRE_EQ(arrow_array->n_buffers, 4);
+                const auto* sizes = static_cast<const std::int64_t*>(arrow_array->buffers[3]);
+                CHECK_EQ(static_cast<std::size_t>(sizes[0]), words[1].size() + words[3].size());
+            }
+
+            SUBCASE("list array")
+            {
+                primitive_array<std::int32_t> flat_values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+                const std::vector<std::size_t> sizes{2, 3, 1, 4};
+                list_array lists(array(std::move(flat_values)), list_array::offset_from_sizes(sizes), false);
+                const array sliced = array(std::move(lists)).slice(1, 3);
+                const array compacted = sliced.compact();
+
+                REQUIRE_EQ(compacted.size(), 2);
+                CHECK_EQ(compacted.offset(), 0);
+                CHECK(compacted == sliced);
+                CHECK_EQ(get_arrow_array(compacted)->children[0]->length, 4);
+            }
+
+            SUBCASE("dictionary")
+            {
+                using array_type = dictionary_encoded_array<int32_t>;
+                using keys_buffer_type = typename array_type::keys_buffer_type;
+
+                const std::vector<std::string> words{"zero", "one", "two", "three"};
+                array_type dict(keys_buffer_type{0, 1, 2, 3, 0, 3, 2, 3}, array(string_array(words)));
+                const array sliced = array(std::move(dict)).slice(5, 8);
+                const array compacted = sliced.compact();
+
+                REQUIRE_EQ(compacted.size(), 3);
+                CHECK_EQ(compacted.offset(), 0);
+                CHECK(compacted == sliced);
+                REQUIRE(compacted.dictionary().has_value());
+                // Only "two" and "three" are referenced
+                CHECK_EQ(compacted.dictionary()->size(), 2);
+            }
+        }
+
+        TEST_CASE("concatenate")
+        {
+            SUBCASE("string array")
+            {
+                const std::vector<std::string> words{"zero", "one", "two", "three", "four", "five"};
+                const array strings(string_array(words, std::vector<std::size_t>{2}));
+                const std::vector<array> parts{strings.slice(4, 6), strings.slice(1, 3)};
+                const array concatenated = concatenate(parts);
+
+                REQUIRE_EQ(concatenated.size(), 4);
+                CHECK_EQ(concatenated.null_count(), 1);
+                CHECK(concatenated.slice(0, 2) == strings.slice(4, 6));
+                CHECK(concatenated.slice(2, 4) == strings.slice(1, 3));
+
+                const ArrowArray* arrow_array = get_arrow_array(concatenated);
+                const auto* offsets = static_cast<const std::int32_t*>(arrow_array->buffers[1]);
+                CHECK_EQ(offsets[0], 0);
+                // "four" + "five" + "one" + "two"
+                CHECK_EQ(offsets[4], 14);
+            }
+
+            SUBCASE("string view array")
+            {
+                const std::vector<std::string> first_words{"short", "a string that does not fit in the view"};
+                const std::vector<std::string> second_words{"another string stored out of line", "tiny"};
+                const std::vector<array> parts{
+                    array(string_view_array(first_words, false)),
+                    array(string_view_array(second_words, false))
+                };
+                const array concatenated = concatenate(parts);
+
+                REQUIRE_EQ(concatenated.size(), 4);
+                CHECK(concatenated.slice(0, 2) == parts[0]);
+                CHECK(concatenated.slice(2, 4) == parts[1]);
+
+                // validity, views, a single variadic buffer and its size
+                const ArrowArray* arrow_array = get_arrow_array(concatenated);
+                REQUIRE_EQ(arrow_array->n_buffers, 4);
+                const auto* sizes = static_cast<const std::int64_t*>(arrow_array->buffers[3]);
+                CHECK_EQ(static_cast<std::size_t>(sizes[0]), first_words[1].size() + second_words[0].size());
+            }
+
+            SUBCASE("list array")
+            {
+                primitive_array<std::int32_t> flat_values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+                const std::vector<std::size_t> sizes{2, 3, 1, 4};
+                const array lists(list_array(array(std::move(flat_values)), list_array::offset_from_sizes(sizes), false));
+                const std::vector<array> parts{lists.slice(2, 4), lists.slice(1, 2)};
+                const array concatenated = concatenate(parts);
+
+                REQUIRE_EQ(concatenated.size(), 3);
+                CHECK(concatenated.slice(0, 2) == lists.slice(2, 4));
+                CHECK(concatenated.slice(2, 3) == lists.slice(1, 2));
+                CHECK_EQ(get_arrow_array(concatenated)->children[0]->length, 8);
+            }
+
+            SUBCASE("struct array")
+            {
+                primitive_array<std::int16_t> ints({std::int16_t(0), std::int16_t(1), std::int16_t(2)});
+                primitive_array<float32_t> floats({3.0f, 4.0f, 5.0f});
+                std::vector<array> children;
+                children.emplace_back(std::move(ints));
+                children.emplace_back(std::move(floats));
+                const array structs(struct_array(std::move(children), false));
+                const std::vector<array> parts{structs.slice(1, 3), structs};
+                const array concatenated = concatenate(parts);
+
+                REQUIRE_EQ(concatenated.size(), 5);
+                std::vector<array> concatenated_children;
+                for (const auto& child : concatenated.children())
+                {
+                    concatenated_children.push_back(child);
+                }
+                REQUIRE_EQ(concatenated_children.size(), 2);
+                const primitive_array<std::int16_t> expected_ints(
+                    {std::int16_t(1), std::int16_t(2), std::int16_t(0), std::int16_t(1), std::int16_t(2)}
+                );
+                const primitive_array<float32_t> expected_floats({4.0f, 5.0f, 3.0f, 4.0f, 5.0f});
+                CHECK(concatenated_children[0] == array(expected_ints));
+                CHECK(concatenated_children[1] == array(expected_floats));
+            }
+
+            SUBCASE("dictionary")
+            {
+                using array_type = dictionary_encoded_array<int32_t>;
+                using keys_buffer_type = typename array_type::keys_buffer_type;
+
+                const array first(array_type(
+                    keys_buffer_type{0, 1, 1, 0},
+                    array(string_array(std::vector<std::string>{"zero", "one"}))
+                ));
+                const array second(array_type(
+                    keys_buffer_type{2, 0, 1},
+                    array(string_array(std::vector<std::string>{"one", "two", "three"}))
+                ));
+                const std::vector<array> parts{first, second, first.slice(1, 3)};
+                const array concatenated = concatenate(parts);
+
+                REQUIRE_EQ(concatenated.size(), 9);
+                CHECK(concatenated.slice(0, 4) == first);
+                CHECK(concatenated.slice(4, 7) == second);
+                CHECK(concatenated.slice(7, 9) == first.slice(1, 3));
+                REQUIRE(concatenated.dictionary().has_value());
+                // The duplicate entries of the dictionaries are merged
+                CHECK_EQ(concatenated.dictionary()->size(), 4);
+            }
+
+            SUBCASE("shared dictionary")
+            {
+                using array_type = dictionary_encoded_array<int32_t>;
+                using keys_buffer_type = typename array_type::keys_buffer_type;
+
+                const std::vector<std::string> words{"zero", "one", "two", "three"};
+                const array dict(array_type(keys_buffer_type{0, 1, 2, 3, 0, 3, 2, 3}, array(string_array(words))));
+                const std::vector<array> parts{dict.slice(5, 8), dict.slice(2, 4)};
+                const array concatenated = concatenate(parts);
+
+                REQUIRE_EQ(concatenated.size(), 5);
+                CHECK(concatenated.slice(0, 3) == dict.slice(5, 8));
+                CHECK(concatenated.slice(3, 5) == dict.slice(2, 4));
+                REQUIRE(concatenated.dictionary().has_value());
+                // Only "two" and "three" are referenced by the pieces
+                CHECK_EQ(concatenated.dictionary()->size(), 2);
+            }
+
+            SUBCASE("errors")
+            {
+                const std::vector<array> empty;
+                CHECK_THROWS_AS(std::ignore = concatenate(empty), std::invalid_argument);
+
+                const std::vector<array> mixed{
+                    array(primitive_array<std::int32_t>{0, 1}),
+                    array(primitive_array<std::int64_t>{2, 3})
+                };
+                CHECK_THROWS_AS(std::ignore = concatenate(mixed), std::invalid_argument);
+            }
+        }
+
         TEST_CASE("children")
         {
             SUBCASE("array with no children")
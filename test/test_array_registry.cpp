@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "sparrow/layout/array_factory.hpp"
 #include "sparrow/layout/array_registry.hpp"
 #include "sparrow/utils/extension.hpp"
@@ -298,6 +303,88 @@ namespace sparrow
             CHECK(wrapper != nullptr);
         }
 
+        TEST_CASE("concurrent_create_and_registration")
+        {
+            // create() reads a published snapshot of the factories, extensions can be
+            // registered while other threads create arrays. The registry is global: the
+            // extensions are registered on a data type that no other test creates, under a
+            // name that no array carries, so that they do not affect the other tests.
+            auto& registry = array_registry::instance();
+            constexpr std::size_t reader_count = 4;
+            constexpr std::size_t iteration_count = 200;
+            constexpr std::size_t extension_count = 4;
+
+            std::vector<std::size_t> created_counts(reader_count, 0);
+            std::vector<std::thread> readers;
+            readers.reserve(reader_count);
+            for (std::size_t i = 0; i < reader_count; ++i)
+            {
+                readers.emplace_back(
+                    [&registry, &created_counts, i]()
+                    {
+                        for (std::size_t j = 0; j < iteration_count; ++j)
+                        {
+                            const auto wrapper = registry.create(make_arrow_proxy<std::int32_t>());
+                            if (wrapper->data_type() == data_type::INT32)
+                            {
+                                ++created_counts[i];
+                            }
+                        }
+                    }
+                );
+            }
+
+            std::thread writer(
+                [&registry]()
+                {
+                    for (std::size_t j = 0; j < extension_count; ++j)
+                    {
+                        registry.register_extension(
+                            data_type::INTERVAL_MONTHS_DAYS_NANOSECONDS,
+                            "test.concurrent_registration",
+                            [](arrow_proxy proxy)
+                            {
+                                return cloning_ptr<array_wrapper>{
+                                    new array_wrapper_impl<month_day_nanoseconds_interval_array>(
+                                        month_day_nanoseconds_interval_array(std::move(proxy))
+                                    )
+                                };
+                            }
+                        );
+                    }
+                }
+            );
+
+            writer.join();
+            for (auto& reader : readers)
+            {
+                reader.join();
+            }
+            for (const std::size_t count : created_counts)
+            {
+                CHECK_EQ(count, iteration_count);
+            }
+            CHECK_EQ(array_factory(make_arrow_proxy<std::int32_t>())->data_type(), data_type::INT32);
+        }
+
+        TEST_CASE("register_unknown_data_type")
+        {
+            auto& registry = array_registry::instance();
+            const auto unknown = static_cast<data_type>(all_data_types.size());
+            CHECK_THROWS_AS(
+                registry.register_base_type(
+                    unknown,
+                    [](arrow_proxy proxy)
+                    {
+                        return cloning_ptr<array_wrapper>{
+                            new array_wrapper_impl<null_array>(null_array(std::move(proxy)))
+                        };
+                    }
+                ),
+                std::invalid_argument
+            );
+        }
+
         TEST_CASE("all_primitive_types_registered")
         {
             // Comprehensive test that all primitive types work
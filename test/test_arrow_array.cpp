@@ -12,14 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <ranges>
+#include <vector>
 
+#include "sparrow/array.hpp"
 #include "sparrow/arrow_interface/arrow_array.hpp"
 #include "sparrow/arrow_interface/arrow_array_schema_info_utils.hpp"
 #include "sparrow/arrow_interface/arrow_schema.hpp"
 #include "sparrow/c_interface.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/struct_array.hpp"
 
 #include "arrow_array_schema_creation.hpp"
 #include "doctest/doctest.h"
@@ -46,6 +51,29 @@ void check_equal(const ArrowArray& lhs, const ArrowArray& rhs)
     }
 }
 
+// Checks that the buffers of the arrays and of their children hold the same bytes
+void check_same_contents(const ArrowArray& lhs, const ArrowArray& rhs, const ArrowSchema& schema)
+{
+    const auto lhs_buffers = sparrow::get_arrow_array_buffers(lhs, schema);
+    const auto rhs_buffers = sparrow::get_arrow_array_buffers(rhs, schema);
+    REQUIRE_EQ(lhs_buffers.size(), rhs_buffers.size());
+    for (size_t i = 0; i < lhs_buffers.size(); ++i)
+    {
+        REQUIRE_EQ(lhs_buffers[i].size(), rhs_buffers[i].size());
+        CHECK(std::ranges::equal(lhs_buffers[i], rhs_buffers[i]));
+    }
+    REQUIRE_EQ(lhs.n_children, rhs.n_children);
+    for (size_t i = 0; i < static_cast<size_t>(lhs.n_children); ++i)
+    {
+        check_same_contents(*lhs.children[i], *rhs.children[i], *schema.children[i]);
+    }
+    REQUIRE_EQ(lhs.dictionary == nullptr, rhs.dictionary == nullptr);
+    if (lhs.dictionary != nullptr)
+    {
+        check_same_contents(*lhs.dictionary, *rhs.dictionary, *schema.dictionary);
+    }
+}
+
 void check_empty(const ArrowArray& arr)
 {
     CHECK_EQ(arr.length, 0);
@@ -94,6 +122,49 @@ TEST_SUITE("C Data Interface")
             schema.release(&schema);
         }
 
+        SUBCASE("parallel_deep_copy")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(true);
+            auto array_copy = sparrow::parallel_copy_array(array, schema, 4);
+            check_equal(array, array_copy);
+            check_same_contents(array, array_copy, schema);
+            array.release(&array);
+            array_copy.release(&array_copy);
+            schema.release(&schema);
+        }
+
+        SUBCASE("parallel_deep_copy without validity buffer")
+        {
+            auto [array, schema] = sparrow::extract_arrow_structures(
+                sparrow::primitive_array<std::int32_t>({1, 2, 3, 4}, false)
+            );
+            REQUIRE_EQ(array.buffers[0], nullptr);
+            auto array_copy = sparrow::parallel_copy_array(array, schema, 4);
+            CHECK_EQ(array_copy.buffers[0], nullptr);
+            check_same_contents(array, array_copy, schema);
+            array.release(&array);
+            array_copy.release(&array_copy);
+            schema.release(&schema);
+        }
+
+        SUBCASE("parallel_deep_copy of a wide struct")
+        {
+            // Large enough for the buffers to be split into several chunks
+            constexpr std::size_t row_count = 300000;
+            std::vector<sparrow::array> children;
+            for (std::int64_t i = 0; i < 16; ++i)
+            {
+                std::vector<std::int64_t> values(row_count, i);
+                children.emplace_back(sparrow::primitive_array<std::int64_t>(std::move(values)));
+            }
+            auto [array, schema] = sparrow::extract_arrow_structures(sparrow::struct_array(std::move(children)));
+            auto array_copy = sparrow::parallel_copy_array(array, schema);
+            check_same_contents(array, array_copy, schema);
+            array.release(&array);
+            array_copy.release(&array_copy);
+            schema.release(&schema);
+        }
+
         SUBCASE("swap")
         {
             auto [array0, schema0] = test::make_arrow_schema_and_array(true);
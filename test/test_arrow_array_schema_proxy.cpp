@@ -13,7 +13,11 @@
 // limitations under the License.
 
 
+#include <algorithm>
+#include <optional>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include "sparrow/arrow_interface/arrow_array_schema_proxy.hpp"
 #include "sparrow/buffer/dynamic_bitset.hpp"
@@ -149,6 +153,63 @@ TEST_SUITE("ArrowArrowSchemaProxy")
             proxy2.set_format("L");
             CHECK_EQ(proxy.format(), "c");
         }
+
+        SUBCASE("copy shares buffers")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(false);
+            const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            sparrow::arrow_proxy proxy2(proxy);
+            REQUIRE_EQ(proxy2.buffers().size(), proxy.buffers().size());
+            for (std::size_t i = 0; i < proxy.buffers().size(); ++i)
+            {
+                CHECK_EQ(proxy2.buffers()[i].data(), proxy.buffers()[i].data());
+            }
+            CHECK(proxy2.unshare_buffers());
+            CHECK_FALSE(proxy2.unshare_buffers());
+            for (std::size_t i = 0; i < proxy.buffers().size(); ++i)
+            {
+                CHECK_NE(proxy2.buffers()[i].data(), proxy.buffers()[i].data());
+                CHECK(std::ranges::equal(proxy2.buffers()[i], proxy.buffers()[i]));
+            }
+        }
+
+        SUBCASE("copy shares buffers after unshare")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(true);
+            sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            CHECK_FALSE(proxy.unshare_buffers());
+            CHECK_FALSE(proxy.unshare_buffers());
+
+            // Copying the proxy shares the buffers of the whole tree again
+            const sparrow::arrow_proxy proxy2(proxy);
+            REQUIRE_GT(proxy.children().size(), 0);
+            const auto* child_data_ptr = proxy.children()[0].buffers()[1].data();
+            CHECK_EQ(proxy2.children()[0].buffers()[1].data(), child_data_ptr);
+            CHECK(proxy.unshare_buffers());
+            CHECK_NE(proxy.children()[0].buffers()[1].data(), child_data_ptr);
+            CHECK_EQ(proxy2.children()[0].buffers()[1].data(), child_data_ptr);
+            CHECK_FALSE(proxy.unshare_buffers());
+        }
+
+        SUBCASE("copy on write")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(false);
+            const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            const auto* data_ptr = proxy.buffers()[1].data();
+            const auto null_count = proxy.null_count();
+            sparrow::arrow_proxy proxy2(proxy);
+            proxy2.resize_bitmap(20, false);
+            CHECK_EQ(proxy.null_count(), null_count);
+            CHECK_EQ(proxy2.null_count(), null_count + 20 - static_cast<int64_t>(proxy.length()));
+            CHECK_EQ(proxy.buffers()[1].data(), data_ptr);
+            CHECK_NE(proxy2.buffers()[0].data(), proxy.buffers()[0].data());
+
+            sparrow::arrow_proxy proxy3(proxy);
+            auto buffer = sparrow::buffer<uint8_t>(10, sparrow::buffer<uint8_t>::default_allocator());
+            proxy3.set_buffer(1, std::move(buffer));
+            CHECK_EQ(proxy3.buffers()[1].size(), 10);
+            CHECK_EQ(proxy.buffers()[1].data(), data_ptr);
+        }
     }
 
     TEST_CASE("format")
@@ -271,6 +332,39 @@ TEST_SUITE("ArrowArrowSchemaProxy")
         CHECK_EQ(kv2.second, "val2");
     }
 
+    TEST_CASE("extension_name")
+    {
+        const std::optional<std::vector<sparrow::metadata_pair>> metadata = std::vector<sparrow::metadata_pair>{
+            {"key", "value"},
+            {std::string(sparrow::extension_name_metadata_key), "my.extension"}
+        };
+
+        SUBCASE("on sparrow c structure")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(false);
+            sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            CHECK_FALSE(proxy.extension_name().has_value());
+            proxy.set_metadata(metadata);
+            CHECK_EQ(proxy.extension_name(), "my.extension");
+            const auto key_values = proxy.metadata();
+            REQUIRE(key_values.has_value());
+            const auto it = key_values->find("key");
+            REQUIRE(it != key_values->end());
+            CHECK_EQ((*it).second, "value");
+            proxy.set_metadata(std::optional<std::vector<sparrow::metadata_pair>>{});
+            CHECK_FALSE(proxy.extension_name().has_value());
+        }
+
+        SUBCASE("on external c structure")
+        {
+            auto [array, schema] = make_external_arrow_schema_and_array();
+            const auto buffer = sparrow::get_metadata_from_key_values(*metadata);
+            schema.metadata = buffer.data();
+            const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            CHECK_EQ(proxy.extension_name(), "my.extension");
+        }
+    }
+
     TEST_CASE("set_metadata")
     {
         const std::optional<std::vector<sparrow::metadata_pair>> metadata = std::vector<sparrow::metadata_pair>{
@@ -566,6 +660,82 @@ TEST_SUITE("ArrowArrowSchemaProxy")
         const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
         const auto children = proxy.children();
         CHECK_EQ(children.size(), 0);
+
+        SUBCASE("on const view")
+        {
+            const auto [const_array, const_schema] = test::make_arrow_schema_and_array(true);
+            const sparrow::arrow_proxy const_proxy(&const_array, &const_schema);
+            REQUIRE_EQ(const_proxy.children().size(), const_proxy.n_children());
+            for (const auto& child : const_proxy.children())
+            {
+                CHECK(child.is_array_const());
+                CHECK(child.is_schema_const());
+                CHECK_EQ(child.buffers().size(), child.n_buffers());
+            }
+            CHECK_EQ(&const_proxy.children()[1].array(), const_array.children[1]);
+            const_array.release(const_cast<ArrowArray*>(&const_array));
+            const_schema.release(const_cast<ArrowSchema*>(&const_schema));
+        }
+
+        SUBCASE("concurrent first access")
+        {
+            // The children and the buffer views of a const proxy are built once, even
+            // when several threads request them at the same time
+            auto [parent_array, parent_schema] = test::make_arrow_schema_and_array(true);
+            const sparrow::arrow_proxy parent(std::move(parent_array), std::move(parent_schema));
+            constexpr std::size_t thread_count = 8;
+            std::vector<const sparrow::arrow_proxy*> children(thread_count, nullptr);
+            std::vector<const sparrow::buffer_view<uint8_t>*> buffers(thread_count, nullptr);
+            std::vector<std::size_t> sizes(thread_count, 0);
+            std::vector<std::thread> threads;
+            for (std::size_t t = 0; t < thread_count; ++t)
+            {
+                threads.emplace_back(
+                    [&, t]()
+                    {
+                        children[t] = parent.children().data();
+                        buffers[t] = parent.buffers().data();
+                        sizes[t] = parent.children()[0].buffers().size();
+                    }
+                );
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            for (std::size_t t = 0; t < thread_count; ++t)
+            {
+                CHECK_EQ(children[t], parent.children().data());
+                CHECK_EQ(buffers[t], parent.buffers().data());
+                CHECK_EQ(sizes[t], parent.children()[0].n_buffers());
+            }
+        }
+
+        SUBCASE("after set_child")
+        {
+            // The children are only built by children(), after set_child in the first case
+            // and before it in the second one
+            for (const bool access_before : {false, true})
+            {
+                auto [parent_array, parent_schema] = test::make_arrow_schema_and_array(true);
+                sparrow::arrow_proxy parent(std::move(parent_array), std::move(parent_schema));
+                if (access_before)
+                {
+                    CHECK_FALSE(parent.children()[0].is_array_const());
+                }
+                const auto [child_array, child_schema] = test::make_arrow_schema_and_array(false);
+                parent.set_child(0, &child_array, &child_schema);
+                CHECK(parent.children()[0].is_array_const());
+                CHECK(parent.children()[0].is_schema_const());
+                CHECK_FALSE(parent.children()[1].is_array_const());
+                CHECK_FALSE(parent.children()[1].is_schema_const());
+
+                const sparrow::arrow_proxy copy(parent);
+                CHECK_FALSE(copy.children()[0].is_array_const());
+                child_array.release(const_cast<ArrowArray*>(&child_array));
+                child_schema.release(const_cast<ArrowSchema*>(&child_schema));
+            }
+        }
     }
 
     TEST_CASE("add_children")
@@ -1097,6 +1267,93 @@ TEST_SUITE("ArrowArrowSchemaProxy")
         }
     }
 
+    TEST_CASE("slice")
+    {
+        SUBCASE("byte aligned start trims the buffers")
+        {
+            std::optional<sparrow::arrow_proxy> slice;
+            const uint8_t* parent_data = nullptr;
+            {
+                auto [array, schema] = test::make_arrow_schema_and_array(false);
+                const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+                parent_data = proxy.buffers()[1].data();
+                slice = proxy.slice(8, 10);
+            }
+            CHECK_EQ(slice->offset(), 0);
+            CHECK_EQ(slice->length(), 2);
+            CHECK_EQ(slice->null_count(), 0);
+            const auto& buffers = slice->buffers();
+            CHECK_EQ(buffers[1].data(), parent_data + 8);
+            CHECK_EQ(buffers[1].size(), 2);
+            CHECK_EQ(buffers[1][0], 8);
+            CHECK_EQ(buffers[1][1], 9);
+            CHECK_EQ(slice->array().buffers[1], static_cast<const void*>(parent_data + 8));
+
+            const auto slice2 = slice->slice(1, 2);
+            CHECK_EQ(slice2.length(), 1);
+            CHECK_EQ(slice2.offset(), 1);
+            CHECK_EQ(slice2.buffers()[1][1], 9);
+        }
+
+        SUBCASE("unaligned start keeps the offset")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(false);
+            const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            const auto slice = proxy.slice(2, 6);
+            CHECK_EQ(slice.offset(), 2);
+            CHECK_EQ(slice.length(), 4);
+            CHECK_EQ(slice.null_count(), 2);
+            CHECK_EQ(slice.buffers()[1].data(), proxy.buffers()[1].data());
+        }
+
+        SUBCASE("mutating a trimmed slice")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(false);
+            const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            auto slice = proxy.slice(8, 10);
+            slice.push_back_bitmap(false);
+            CHECK_EQ(slice.offset(), 0);
+            CHECK_EQ(slice.null_count(), 1);
+            CHECK_NE(slice.buffers()[1].data(), proxy.buffers()[1].data() + 8);
+            CHECK_EQ(slice.buffers()[1][0], 8);
+            CHECK_EQ(proxy.null_count(), 2);
+        }
+
+        SUBCASE("null count is computed on demand")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(false);
+            const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            const auto slice = proxy.slice(2, 6);
+            CHECK_EQ(slice.array().null_count, -1);
+            CHECK_EQ(slice.null_count(), 2);
+            CHECK_EQ(slice.array().null_count, -1);
+
+            const auto view = proxy.slice_view(2, 6);
+            CHECK_EQ(view.array().null_count, -1);
+            CHECK_EQ(view.null_count(), 2);
+        }
+
+        SUBCASE("slicing a slice")
+        {
+            auto [array, schema] = test::make_arrow_schema_and_array(false);
+            const sparrow::arrow_proxy proxy(std::move(array), std::move(schema));
+            const auto slice = proxy.slice(2, 6);
+            const auto sliced = slice.slice(1, 3);
+            const auto viewed = slice.slice_view(1, 3);
+            CHECK_EQ(sliced.offset(), 3);
+            CHECK_EQ(viewed.offset(), 3);
+            CHECK_EQ(sliced.length(), 2);
+            CHECK_EQ(viewed.length(), 2);
+            CHECK_EQ(sliced.null_count(), viewed.null_count());
+            for (std::size_t i = 0; i < 2; ++i)
+            {
+                const auto expected = static_cast<std::uint8_t>(3 + i);
+                CHECK_EQ(sliced.buffers()[1][sliced.offset() + i], expected);
+                CHECK_EQ(viewed.buffers()[1][viewed.offset() + i], expected);
+            }
+        }
+    }
+
     TEST_CASE("view")
     {
         auto [array, schema] = test::make_arrow_schema_and_array(false);
@@ -12,8 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <cerrno>
 #include <cstdint>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include "sparrow/arrow_interface/arrow_array_stream.hpp"
@@ -350,6 +354,51 @@ namespace sparrow
             delete stream;
         }
 
+        TEST_CASE("stream callbacks - get_last_error from several threads")
+        {
+            ArrowArrayStream stream{};
+            fill_arrow_array_stream(stream);
+            ArrowSchema out_schema{};
+            REQUIRE_NE(stream.get_schema(&stream, &out_schema), 0);
+            const char* error = stream.get_last_error(&stream);
+            REQUIRE_NE(error, nullptr);
+            const std::string expected(error);
+
+            constexpr std::size_t n_threads = 4;
+            std::atomic<std::size_t> mismatches{0};
+            std::vector<std::thread> threads;
+            threads.reserve(n_threads);
+            for (std::size_t i = 0; i < n_threads; ++i)
+            {
+                threads.emplace_back(
+                    [&]
+                    {
+                        for (int j = 0; j < 100; ++j)
+                        {
+                            ArrowSchema schema{};
+                            if (stream.get_schema(&stream, &schema) == 0)
+                            {
+                                schema.release(&schema);
+                            }
+                            const char* msg = stream.get_last_error(&stream);
+                            if (msg == nullptr || expected != msg)
+                            {
+                                ++mismatches;
+                            }
+                        }
+                    }
+                );
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            CHECK_EQ(mismatches.load(), 0);
+            // The message read by this thread is not overwritten by the other threads
+            CHECK_EQ(expected, error);
+            stream.release(&stream);
+        }
+
         TEST_CASE("RAII - automatic cleanup")
         {
             // This test verifies that the proxy properly cleans up resources
@@ -503,5 +552,115 @@ namespace sparrow
             stream->release(stream);
             delete stream;
         }
+
+        TEST_CASE("concurrent stream")
+        {
+            SUBCASE("try_push on a full stream")
+            {
+                arrow_array_stream_proxy proxy(concurrent_stream_options{2});
+                CHECK(proxy.try_push(make_test_primitive_array<int32_t>(1)));
+                CHECK(proxy.try_push(make_test_primitive_array<int32_t>(2)));
+
+                auto array = make_test_primitive_array<int32_t>(3);
+                CHECK_FALSE(proxy.try_push(array));
+                // The array is left untouched when the stream is full
+                CHECK_EQ(array.size(), 3);
+
+                auto result = proxy.pop();
+                REQUIRE(result.has_value());
+                CHECK_EQ(result->size(), 1);
+                CHECK(proxy.try_push(array));
+            }
+
+            SUBCASE("close")
+            {
+                arrow_array_stream_proxy proxy(concurrent_stream_options{});
+                proxy.push(make_test_primitive_array<int32_t>(5));
+                proxy.close();
+                CHECK_THROWS_AS(proxy.push(make_test_primitive_array<int32_t>(5)), std::runtime_error);
+
+                auto result = proxy.pop();
+                REQUIRE(result.has_value());
+                CHECK_EQ(result->size(), 5);
+                CHECK_FALSE(proxy.pop().has_value());
+            }
+
+            SUBCASE("producers and consumers")
+            {
+                constexpr std::size_t n_producers = 3;
+                constexpr std::size_t n_arrays = 20;
+                arrow_array_stream_proxy proxy(concurrent_stream_options{4});
+
+                std::vector<std::thread> producers;
+                for (std::size_t p = 0; p < n_producers; ++p)
+                {
+                    producers.emplace_back(
+                        [&proxy]()
+                        {
+                            for (std::size_t i = 1; i <= n_arrays; ++i)
+                            {
+                                proxy.push(make_test_primitive_array<int32_t>(i));
+                            }
+                        }
+                    );
+                }
+
+                std::atomic<std::size_t> total_size = 0;
+                std::atomic<std::size_t> n_popped = 0;
+                std::vector<std::thread> consumers;
+                for (std::size_t c = 0; c < 2; ++c)
+                {
+                    consumers.emplace_back(
+                        [&]()
+                        {
+                            while (auto result = proxy.pop())
+                            {
+                                total_size += result->size();
+                                ++n_popped;
+                            }
+                        }
+                    );
+                }
+
+                for (auto& producer : producers)
+                {
+                    producer.join();
+                }
+                proxy.close();
+                for (auto& consumer : consumers)
+                {
+                    consumer.join();
+                }
+
+                CHECK_EQ(n_popped.load(), n_producers * n_arrays);
+                CHECK_EQ(total_size.load(), n_producers * n_arrays * (n_arrays + 1) / 2);
+            }
+
+            SUBCASE("cancel wakes up a blocked consumer")
+            {
+                arrow_array_stream_proxy proxy(concurrent_stream_options{1});
+                proxy.push(make_test_primitive_array<int32_t>(5));
+                ArrowArrayStream* stream = proxy.export_stream();
+
+                ArrowArray first{};
+                REQUIRE_EQ(stream->get_next(stream, &first), 0);
+                first.release(&first);
+
+                int err = 0;
+                std::thread consumer(
+                    [&]()
+                    {
+                        ArrowArray array{};
+                        err = stream->get_next(stream, &array);
+                    }
+                );
+                static_cast<arrow_array_stream_private_data*>(stream->private_data)->cancel();
+                consumer.join();
+                CHECK_EQ(err, ECANCELED);
+
+                stream->release(stream);
+                delete stream;
+            }
+        }
     }
 }
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 #include "sparrow/utils/bit.hpp"
@@ -103,5 +106,79 @@ namespace sparrow
                 }
             }
         }
+
+        TEST_CASE("load_bits")
+        {
+            const std::array<std::uint8_t, 10> bitmap{0xF0, 0x0F, 0xAA, 0x55, 0xFF, 0x00, 0x81, 0x18, 0x3C, 0xC3};
+            CHECK_EQ(load_bits(bitmap.data(), 0, 8), 0xF0u);
+            CHECK_EQ(load_bits(bitmap.data(), 4, 8), 0xFFu);
+            CHECK_EQ(load_bits(bitmap.data(), 12, 4), 0x0u);
+            CHECK_EQ(load_bits(bitmap.data(), 8, 64), 0x3C188100FF55AA0Full);
+            CHECK_EQ(load_bits(bitmap.data(), 4, 64), 0xC188100FF55AA0FFull);
+            CHECK_EQ(load_bits(bitmap.data(), 0, 0), 0u);
+        }
+
+        TEST_CASE("store_bits")
+        {
+            SUBCASE("unaligned")
+            {
+                std::array<std::uint8_t, 3> bitmap{0x0F, 0x00, 0xFF};
+                store_bits(bitmap.data(), 4, 0xFABCull, 12);
+                CHECK_EQ(bitmap[0], 0xCF);
+                CHECK_EQ(bitmap[1], 0xAB);
+                CHECK_EQ(bitmap[2], 0xFF);
+            }
+
+            SUBCASE("full word")
+            {
+                std::array<std::uint8_t, 10> bitmap{};
+                store_bits(bitmap.data(), 3, ~std::uint64_t{0}, 64);
+                CHECK_EQ(bitmap[0], 0xF8);
+                for (std::size_t i = 1; i < 8; ++i)
+                {
+                    CHECK_EQ(bitmap[i], 0xFF);
+                }
+                CHECK_EQ(bitmap[8], 0x07);
+                CHECK_EQ(bitmap[9], 0x00);
+            }
+
+            SUBCASE("aligned")
+            {
+                std::array<std::uint8_t, 3> bitmap{0x00, 0x00, 0xFF};
+                store_bits(bitmap.data(), 0, 0xFFFF1234ull, 16);
+                CHECK_EQ(bitmap[0], 0x34);
+                CHECK_EQ(bitmap[1], 0x12);
+                CHECK_EQ(bitmap[2], 0xFF);
+            }
+        }
+
+        TEST_CASE("move_bits")
+        {
+            constexpr std::size_t n_bytes = 40;
+            std::array<std::uint8_t, n_bytes> original{};
+            for (std::size_t i = 0; i < n_bytes; ++i)
+            {
+                original[i] = static_cast<std::uint8_t>(i * 37 + 11);
+            }
+            const auto get = [](const std::array<std::uint8_t, n_bytes>& b, std::size_t i)
+            {
+                return ((b[i / 8] >> (i % 8)) & 1u) != 0;
+            };
+
+            for (const std::size_t src : {std::size_t{0}, std::size_t{3}, std::size_t{8}, std::size_t{70}})
+            {
+                for (const std::size_t dst : {std::size_t{0}, std::size_t{5}, std::size_t{16}, std::size_t{71}})
+                {
+                    const std::size_t n_bits = n_bytes * 8 - std::max(src, dst);
+                    auto bitmap = original;
+                    move_bits(bitmap.data(), dst, src, n_bits);
+                    for (std::size_t i = 0; i < n_bytes * 8; ++i)
+                    {
+                        const bool moved = i >= dst && i < dst + n_bits;
+                        CHECK_EQ(get(bitmap, i), moved ? get(original, i - dst + src) : get(original, i));
+                    }
+                }
+            }
+        }
     }
-}
\ No newline at end of file
+}
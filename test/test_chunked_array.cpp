@@ -0,0 +1,219 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "sparrow/chunked_array.hpp"
+#include "sparrow/chunked_record_batch.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/variable_size_binary_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        std::optional<std::int32_t> int32_value(const array::const_reference& ref)
+        {
+            const auto& value = std::get<nullable<const std::int32_t&>>(ref);
+            return value.has_value() ? std::make_optional(value.get()) : std::nullopt;
+        }
+
+        // Chunks {0, 1, 2}, {}, {3, null}, {5}
+        chunked_array make_int32_chunks()
+        {
+            std::vector<array> chunks;
+            chunks.emplace_back(primitive_array<std::int32_t>{0, 1, 2});
+            chunks.emplace_back(primitive_array<std::int32_t>(std::vector<std::int32_t>{}));
+            chunks.emplace_back(primitive_array<std::int32_t>(
+                std::vector<nullable<std::int32_t>>{nullable<std::int32_t>(3), nullable<std::int32_t>(4, false)}
+            ));
+            chunks.emplace_back(primitive_array<std::int32_t>{5});
+            return chunked_array(std::move(chunks));
+        }
+
+        record_batch make_batch(std::vector<std::int32_t> ids, std::vector<std::string> names)
+        {
+            std::vector<array> columns;
+            columns.emplace_back(primitive_array<std::int32_t>(std::move(ids)));
+            columns.emplace_back(string_array(std::move(names)));
+            return record_batch(std::vector<std::string>{"id", "name"}, std::move(columns), "batch");
+        }
+    }
+
+    TEST_SUITE("chunked_array")
+    {
+        TEST_CASE("constructor")
+        {
+            const chunked_array empty;
+            CHECK_EQ(empty.size(), 0);
+            CHECK_EQ(empty.chunk_count(), 0);
+            CHECK_EQ(empty.data_type(), data_type::NA);
+            CHECK_EQ(empty.begin(), empty.end());
+
+            const auto column = make_int32_chunks();
+            CHECK_EQ(column.size(), 6);
+            CHECK_EQ(column.chunk_count(), 4);
+            CHECK_EQ(column.data_type(), data_type::INT32);
+            CHECK_EQ(column.null_count(), 1);
+            CHECK_EQ(column.chunk_offset(2), 3);
+            CHECK_EQ(column.chunk_offset(4), 6);
+
+            std::vector<array> mixed;
+            mixed.emplace_back(primitive_array<std::int32_t>{0});
+            mixed.emplace_back(primitive_array<std::int64_t>{1});
+            CHECK_THROWS_AS(chunked_array(std::move(mixed)), std::invalid_argument);
+        }
+
+        TEST_CASE("element access")
+        {
+            const auto column = make_int32_chunks();
+            // The empty chunk is skipped
+            using location = std::pair<std::size_t, std::size_t>;
+            CHECK_EQ(column.locate(3), location{2, 0});
+            CHECK_EQ(column.locate(5), location{3, 0});
+            CHECK_EQ(int32_value(column[0]), 0);
+            CHECK_EQ(int32_value(column[3]), 3);
+            CHECK_EQ(int32_value(column[4]), std::nullopt);
+            CHECK_EQ(int32_value(column.at(5)), 5);
+            CHECK_THROWS_AS(std::ignore = column.at(6), std::out_of_range);
+        }
+
+        TEST_CASE("iterator")
+        {
+            const auto column = make_int32_chunks();
+            std::vector<std::optional<std::int32_t>> values;
+            for (const auto& value : column)
+            {
+                values.push_back(int32_value(value));
+            }
+            const std::vector<std::optional<std::int32_t>> expected = {0, 1, 2, 3, std::nullopt, 5};
+            CHECK_EQ(values, expected);
+            CHECK_EQ(std::distance(column.begin(), column.end()), 6);
+
+            auto iter = column.begin() + 3;
+            CHECK_EQ(iter.chunk_index(), 2);
+            CHECK_EQ(iter.index_in_chunk(), 0);
+            CHECK_EQ(int32_value(*iter), 3);
+            --iter;
+            CHECK_EQ(iter.chunk_index(), 0);
+            CHECK_EQ(int32_value(*iter), 2);
+            CHECK_EQ(int32_value(*(column.end() - 1)), 5);
+            CHECK_EQ(int32_value(column.begin()[4]), std::nullopt);
+            CHECK(column.begin() < column.end());
+        }
+
+        TEST_CASE("visit")
+        {
+            const auto column = make_int32_chunks();
+            std::size_t visited = 0;
+            column.visit(
+                [&visited](const auto& typed_chunk)
+                {
+                    visited += typed_chunk.size();
+                }
+            );
+            CHECK_EQ(visited, column.size());
+
+            const auto sizes = column.visit(
+                [](const auto& typed_chunk)
+                {
+                    return typed_chunk.size();
+                }
+            );
+            CHECK_EQ(sizes, std::vector<std::size_t>{3, 0, 2, 1});
+        }
+
+        TEST_CASE("add_chunk and combine_chunks")
+        {
+            auto column = make_int32_chunks();
+            column.add_chunk(array(primitive_array<std::int32_t>{6, 7}));
+            CHECK_EQ(column.size(), 8);
+            CHECK_EQ(int32_value(column[7]), 7);
+            CHECK_THROWS_AS(column.add_chunk(array(primitive_array<double>{1.})), std::invalid_argument);
+
+            const array combined = column.combine_chunks();
+            REQUIRE_EQ(combined.size(), column.size());
+            for (std::size_t i = 0; i < combined.size(); ++i)
+            {
+                CHECK_EQ(int32_value(combined[i]), int32_value(column[i]));
+            }
+
+            std::vector<array> single;
+            single.push_back(combined);
+            CHECK(chunked_array(std::move(single)) == column);
+            CHECK_FALSE(make_int32_chunks() == column);
+        }
+    }
+
+    TEST_SUITE("chunked_record_batch")
+    {
+        TEST_CASE("constructor")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch({1, 2}, {"a", "b"}));
+            batches.push_back(make_batch({3}, {"c"}));
+            const chunked_record_batch table(batches);
+            CHECK_EQ(table.nb_columns(), 2);
+            CHECK_EQ(table.nb_rows(), 3);
+            CHECK_EQ(table.name(), "batch");
+            CHECK(std::ranges::equal(table.names(), std::vector<std::string>{"id", "name"}));
+            CHECK(table.contains_column("name"));
+            CHECK_FALSE(table.contains_column("other"));
+            CHECK_EQ(table.get_column("id").chunk_count(), 2);
+            CHECK_EQ(int32_value(table.get_column("id")[2]), 3);
+            CHECK_THROWS_AS(std::ignore = table.get_column("other"), std::out_of_range);
+
+            std::vector<chunked_array> columns;
+            columns.push_back(make_int32_chunks());
+            columns.push_back(chunked_array(std::vector<array>{array(primitive_array<std::int32_t>{1})}));
+            CHECK_THROWS_AS(
+                chunked_record_batch({"a", "b"}, std::move(columns)),
+                std::invalid_argument
+            );
+        }
+
+        TEST_CASE("add_batch")
+        {
+            chunked_record_batch table;
+            table.add_batch(make_batch({1, 2}, {"a", "b"}));
+            table.add_batch(make_batch({3}, {"c"}));
+            CHECK_EQ(table.nb_rows(), 3);
+
+            std::vector<array> columns;
+            columns.emplace_back(primitive_array<std::int32_t>{4});
+            record_batch other(std::vector<std::string>{"id"}, std::move(columns));
+            CHECK_THROWS_AS(table.add_batch(other), std::invalid_argument);
+            CHECK_EQ(table.nb_rows(), 3);
+        }
+
+        TEST_CASE("combine_chunks")
+        {
+            std::vector<record_batch> batches;
+            batches.push_back(make_batch({1, 2}, {"a", "b"}));
+            batches.push_back(make_batch({3}, {"c"}));
+            const auto combined = chunked_record_batch(batches).combine_chunks();
+            CHECK_EQ(combined.nb_rows(), 3);
+            CHECK_EQ(combined.name(), "batch");
+            CHECK(combined.get_column("name") == array(string_array(std::vector<std::string>{"a", "b", "c"})));
+        }
+    }
+}
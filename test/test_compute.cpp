@@ -0,0 +1,273 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include "sparrow/compute/aggregate.hpp"
+#include "sparrow/compute/arithmetic.hpp"
+#include "sparrow/compute/comparison.hpp"
+#include "sparrow/primitive_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Spans several 64-element blocks, with a partial last block.
+        constexpr std::size_t test_size = 150;
+
+        template <class T>
+        T make_value(std::size_t i)
+        {
+            if constexpr (std::same_as<T, bool>)
+            {
+                return i % 3 == 0;
+            }
+            else
+            {
+                return static_cast<T>(i % 50 + 1);
+            }
+        }
+
+        template <class T>
+        primitive_array<T> make_test_array(std::size_t size, std::size_t null_period, std::size_t shift = 0)
+        {
+            std::vector<nullable<T>> values;
+            values.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (null_period != 0 && i % null_period == 0)
+                {
+                    values.emplace_back();
+                }
+                else
+                {
+                    values.emplace_back(make_value<T>(i + shift));
+                }
+            }
+            return primitive_array<T>(values);
+        }
+
+        // Sliced arrays keep a non-zero offset that is not a multiple of 8.
+        template <class T>
+        primitive_array<T> make_sliced_test_array(std::size_t null_period, std::size_t shift = 0)
+        {
+            return make_test_array<T>(test_size + 10, null_period, shift).slice(3, test_size + 3);
+        }
+
+        template <class T>
+        std::vector<std::optional<T>> to_optionals(const primitive_array<T>& arr)
+        {
+            std::vector<std::optional<T>> res;
+            for (const auto& v : arr)
+            {
+                res.push_back(v.has_value() ? std::make_optional<T>(v.value()) : std::nullopt);
+            }
+            return res;
+        }
+
+        template <class T, class F>
+        void check_binary_result(const primitive_array<T>& lhs, const primitive_array<T>& rhs, const auto& res, F&& f)
+        {
+            REQUIRE_EQ(res.size(), lhs.size());
+            std::size_t null_count = 0;
+            for (std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                const bool valid = lhs[i].has_value() && rhs[i].has_value();
+                REQUIRE_EQ(res[i].has_value(), valid);
+                if (valid)
+                {
+                    CHECK_EQ(res[i].value(), f(lhs[i].value(), rhs[i].value()));
+                }
+                else
+                {
+                    ++null_count;
+                }
+            }
+            CHECK_EQ(static_cast<std::size_t>(res.null_count()), null_count);
+        }
+    }
+
+    using compute_types = std::tuple<
+        bool,
+        std::int8_t,
+        std::uint8_t,
+        std::int16_t,
+        std::uint16_t,
+        std::int32_t,
+        std::uint32_t,
+        std::int64_t,
+        std::uint64_t,
+        float16_t,
+        float32_t,
+        float64_t>;
+
+    TEST_SUITE("compute")
+    {
+        TEST_CASE_TEMPLATE_DEFINE("aggregate", T, compute_aggregate_id)
+        {
+            for (const std::size_t null_period : {std::size_t{0}, std::size_t{7}})
+            {
+                for (const auto& arr : {make_test_array<T>(test_size, null_period), make_sliced_test_array<T>(null_period)})
+                {
+                    std::size_t count = 0;
+                    compute::sum_type_t<T> sum{};
+                    std::optional<T> min;
+                    std::optional<T> max;
+                    for (const auto& v : to_optionals(arr))
+                    {
+                        if (v.has_value())
+                        {
+                            ++count;
+                            sum += static_cast<compute::sum_type_t<T>>(*v);
+                            min = !min.has_value() || *v < *min ? v : min;
+                            max = !max.has_value() || *max < *v ? v : max;
+                        }
+                    }
+
+                    CHECK_EQ(compute::count(arr), count);
+                    CHECK_EQ(compute::sum(arr), sum);
+                    CHECK_EQ(compute::min(arr), min);
+                    CHECK_EQ(compute::max(arr), max);
+                    REQUIRE(compute::mean(arr).has_value());
+                    CHECK_EQ(*compute::mean(arr), doctest::Approx(static_cast<double>(sum) / static_cast<double>(count)));
+                }
+            }
+
+            SUBCASE("only nulls")
+            {
+                const auto arr = make_test_array<T>(test_size, 1);
+                CHECK_EQ(compute::count(arr), 0);
+                CHECK_EQ(compute::sum(arr), compute::sum_type_t<T>{});
+                CHECK_FALSE(compute::min(arr).has_value());
+                CHECK_FALSE(compute::max(arr).has_value());
+                CHECK_FALSE(compute::mean(arr).has_value());
+            }
+
+            SUBCASE("empty")
+            {
+                const primitive_array<T> arr(std::vector<T>{});
+                CHECK_EQ(compute::count(arr), 0);
+                CHECK_EQ(compute::sum(arr), compute::sum_type_t<T>{});
+                CHECK_FALSE(compute::min(arr).has_value());
+                CHECK_FALSE(compute::mean(arr).has_value());
+            }
+        }
+        TEST_CASE_TEMPLATE_APPLY(compute_aggregate_id, compute_types);
+
+        TEST_CASE("sum wraps on overflow")
+        {
+            const primitive_array<std::int64_t> arr(
+                std::vector<std::int64_t>{std::numeric_limits<std::int64_t>::max(), 1}
+            );
+            CHECK_EQ(compute::sum(arr), std::numeric_limits<std::int64_t>::min());
+        }
+
+        TEST_CASE_TEMPLATE_DEFINE("comparison", T, compute_comparison_id)
+        {
+            const auto lhs = make_sliced_test_array<T>(7);
+            const auto rhs = make_test_array<T>(test_size, 11, 5);
+
+            check_binary_result(lhs, rhs, compute::equal(lhs, rhs), [](T l, T r) { return l == r; });
+            check_binary_result(lhs, rhs, compute::not_equal(lhs, rhs), [](T l, T r) { return l != r; });
+            check_binary_result(lhs, rhs, compute::less(lhs, rhs), [](T l, T r) { return l < r; });
+            check_binary_result(lhs, rhs, compute::less_equal(lhs, rhs), [](T l, T r) { return l <= r; });
+            check_binary_result(lhs, rhs, compute::greater(lhs, rhs), [](T l, T r) { return l > r; });
+            check_binary_result(lhs, rhs, compute::greater_equal(lhs, rhs), [](T l, T r) { return l >= r; });
+
+            SUBCASE("without nulls")
+            {
+                const auto dense_lhs = make_sliced_test_array<T>(0);
+                const auto dense_rhs = make_test_array<T>(test_size, 0, 5);
+                const auto res = compute::less(dense_lhs, dense_rhs);
+                CHECK_EQ(res.null_count(), 0);
+                check_binary_result(dense_lhs, dense_rhs, res, [](T l, T r) { return l < r; });
+            }
+
+            SUBCASE("size mismatch")
+            {
+                CHECK_THROWS_AS(std::ignore = compute::equal(lhs, make_test_array<T>(test_size - 1, 0)), std::invalid_argument);
+            }
+        }
+        TEST_CASE_TEMPLATE_APPLY(compute_comparison_id, compute_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("arithmetic", T, compute_arithmetic_id)
+        {
+            const auto lhs = make_sliced_test_array<T>(7);
+            const auto rhs = make_test_array<T>(test_size, 11, 5);
+
+            check_binary_result(lhs, rhs, compute::add(lhs, rhs), [](T l, T r) { return static_cast<T>(l + r); });
+            check_binary_result(lhs, rhs, compute::subtract(lhs, rhs), [](T l, T r) { return static_cast<T>(l - r); });
+            check_binary_result(lhs, rhs, compute::multiply(lhs, rhs), [](T l, T r) { return static_cast<T>(l * r); });
+            check_binary_result(lhs, rhs, compute::divide(lhs, rhs), [](T l, T r) { return static_cast<T>(l / r); });
+
+            SUBCASE("size mismatch")
+            {
+                CHECK_THROWS_AS(std::ignore = compute::add(lhs, make_test_array<T>(test_size - 1, 0)), std::invalid_argument);
+            }
+        }
+        TEST_CASE_TEMPLATE_APPLY(
+            compute_arithmetic_id,
+            std::tuple<
+                std::int8_t,
+                std::uint8_t,
+                std::int16_t,
+                std::uint16_t,
+                std::int32_t,
+                std::uint32_t,
+                std::int64_t,
+                std::uint64_t,
+                float16_t,
+                float32_t,
+                float64_t>
+        );
+
+        TEST_CASE("integer division")
+        {
+            SUBCASE("by zero")
+            {
+                const primitive_array<std::int32_t> lhs(std::vector<std::int32_t>{1, 2, 3});
+                const primitive_array<std::int32_t> rhs(std::vector<std::int32_t>{1, 0, 3});
+                CHECK_THROWS_AS(std::ignore = compute::divide(lhs, rhs), std::domain_error);
+            }
+
+            SUBCASE("by zero in a null slot")
+            {
+                const primitive_array<std::int32_t> lhs(std::vector<std::int32_t>{1, 2, 3});
+                const primitive_array<std::int32_t> rhs(
+                    std::vector<nullable<std::int32_t>>{nullable<std::int32_t>(1), nullable<std::int32_t>(), nullable<std::int32_t>(3)}
+                );
+                const auto res = compute::divide(lhs, rhs);
+                CHECK_EQ(res[0].value(), 1);
+                CHECK_FALSE(res[1].has_value());
+                CHECK_EQ(res[2].value(), 1);
+            }
+
+            SUBCASE("overflow")
+            {
+                constexpr std::int8_t min = std::numeric_limits<std::int8_t>::min();
+                const primitive_array<std::int8_t> lhs(std::vector<std::int8_t>{min});
+                const primitive_array<std::int8_t> rhs(std::vector<std::int8_t>{-1});
+                const auto res = compute::divide(lhs, rhs);
+                CHECK_EQ(res[0].value(), min);
+            }
+        }
+    }
+}
@@ -0,0 +1,281 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "sparrow/csv/reader.hpp"
+#include "sparrow/date_array.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/timestamp_array.hpp"
+#include "sparrow/variable_size_binary_array.hpp"
+#include "sparrow/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Returns the values of a column of type A, converted by \p convert
+        template <class A, class F>
+        auto column_values(const array& column, F convert)
+        {
+            using value_type = std::decay_t<decltype(convert(std::declval<typename A::inner_value_type>()))>;
+            return column.visit(
+                [&](const auto& typed_column)
+                {
+                    std::vector<std::optional<value_type>> values;
+                    if constexpr (std::is_same_v<std::decay_t<decltype(typed_column)>, A>)
+                    {
+                        for (const auto& value : typed_column)
+                        {
+                            values.push_back(
+                                value.has_value() ? std::make_optional(convert(value.get())) : std::nullopt
+                            );
+                        }
+                    }
+                    else
+                    {
+                        FAIL("Unexpected column type");
+                    }
+                    return values;
+                }
+            );
+        }
+
+        template <class A>
+        auto column_values(const array& column)
+        {
+            return column_values<A>(
+                column,
+                [](const auto& value)
+                {
+                    return value;
+                }
+            );
+        }
+
+        std::vector<std::optional<std::string>> string_values(const array& column)
+        {
+            return column_values<string_array>(
+                column,
+                [](std::string_view value)
+                {
+                    return std::string(value);
+                }
+            );
+        }
+
+        const std::string events = "id,price,name,day,at,ok\n"
+                                   "1,0.5,ann,2024-03-01,2024-03-01T12:30:00.250Z,true\n"
+                                   "\r\n"
+                                   "2,3,\"bob, \"\"the\"\"\nbuilder\",2024-02-29,2024-03-01 13:30:00+01:00,FALSE\r\n"
+                                   "NA,,\"\",,,\n"
+                                   "4,-1.25,,1970-01-01,1970-01-01,True\n";
+    }
+
+    TEST_SUITE("csv")
+    {
+        TEST_CASE("infer_schema")
+        {
+            const std::vector<csv::column_spec> expected = {
+                {"id", csv::column_type::int64},
+                {"price", csv::column_type::float64},
+                {"name", csv::column_type::string},
+                {"day", csv::column_type::date},
+                {"at", csv::column_type::timestamp},
+                {"ok", csv::column_type::boolean}
+            };
+            CHECK_EQ(csv::infer_schema(events), expected);
+
+            SUBCASE("sample")
+            {
+                const auto schema = csv::infer_schema(events, {.inference_rows = 1});
+                CHECK_EQ(schema[1].type, csv::column_type::float64);
+                CHECK_EQ(schema[4].type, csv::column_type::timestamp);
+            }
+
+            SUBCASE("without header")
+            {
+                const auto schema = csv::infer_schema("1,x\n2,\n", {.header = false, .string_views = true});
+                const std::vector<csv::column_spec> expected_schema = {
+                    {"f0", csv::column_type::int64},
+                    {"f1", csv::column_type::string_view}
+                };
+                CHECK_EQ(schema, expected_schema);
+            }
+
+            SUBCASE("conflicts and empty columns")
+            {
+                const auto schema = csv::infer_schema("a,b,c\n1,true,\n2020-01-01,2,\n");
+                CHECK_EQ(schema[0].type, csv::column_type::string);
+                CHECK_EQ(schema[1].type, csv::column_type::string);
+                CHECK_EQ(schema[2].type, csv::column_type::string);
+            }
+        }
+
+        TEST_CASE("read_csv")
+        {
+            for (const std::size_t block_size : {1, 2, 16384})
+            {
+                SUBCASE(("block_size " + std::to_string(block_size)).c_str())
+                {
+                    const auto batches = csv::read_csv(events, {.batch_size = 3, .block_size = block_size});
+                    REQUIRE_EQ(batches.size(), 2);
+                    CHECK_EQ(batches[0].nb_rows(), 3);
+                    CHECK_EQ(batches[1].nb_rows(), 1);
+
+                    const std::vector<std::optional<std::int64_t>> expected_ids = {1, 2, std::nullopt};
+                    CHECK_EQ(column_values<primitive_array<std::int64_t>>(batches[0].get_column("id")), expected_ids);
+                    const std::vector<std::optional<double>> expected_prices = {0.5, 3., std::nullopt};
+                    CHECK_EQ(column_values<primitive_array<double>>(batches[0].get_column("price")), expected_prices);
+                    const std::vector<std::optional<std::string>> expected_names = {
+                        "ann",
+                        "bob, \"the\"\nbuilder",
+                        ""
+                    };
+                    CHECK_EQ(string_values(batches[0].get_column("name")), expected_names);
+                    const std::vector<std::optional<bool>> expected_oks = {true, false, std::nullopt};
+                    CHECK_EQ(column_values<primitive_array<bool>>(batches[0].get_column("ok")), expected_oks);
+
+                    const auto days = column_values<date_days_array>(
+                        batches[0].get_column("day"),
+                        [](const date_days& value)
+                        {
+                            return value.time_since_epoch().count();
+                        }
+                    );
+                    const std::vector<std::optional<std::int32_t>> expected_days = {19783, 19782, std::nullopt};
+                    CHECK_EQ(days, expected_days);
+
+                    const auto timestamps = column_values<timestamp_microseconds_array>(
+                        batches[0].get_column("at"),
+                        [](const auto& value)
+                        {
+                            return value.get_sys_time().time_since_epoch().count();
+                        }
+                    );
+                    const std::vector<std::optional<std::int64_t>> expected_timestamps = {
+                        1709296200250000,
+                        1709296200000000,
+                        std::nullopt
+                    };
+                    CHECK_EQ(timestamps, expected_timestamps);
+
+                    // Dates are promoted to timestamps at midnight
+                    const auto last = column_values<timestamp_microseconds_array>(
+                        batches[1].get_column("at"),
+                        [](const auto& value)
+                        {
+                            return value.get_sys_time().time_since_epoch().count();
+                        }
+                    );
+                    REQUIRE_EQ(last.size(), 1);
+                    CHECK_EQ(last[0], std::optional<std::int64_t>(0));
+                    CHECK_EQ(string_values(batches[1].get_column("name")), std::vector<std::optional<std::string>>{std::nullopt});
+                }
+            }
+        }
+
+        TEST_CASE("string views")
+        {
+            const std::string csv = "s\nshort\na string longer than twelve bytes\n\nanother string longer than twelve\n";
+            const auto batches = csv::read_csv(csv, {.block_size = 1, .string_views = true});
+            REQUIRE_EQ(batches.size(), 1);
+            const auto values = column_values<string_view_array>(
+                batches[0].get_column("s"),
+                [](std::string_view value)
+                {
+                    return std::string(value);
+                }
+            );
+            const std::vector<std::optional<std::string>> expected = {
+                "short",
+                "a string longer than twelve bytes",
+                "another string longer than twelve"
+            };
+            CHECK_EQ(values, expected);
+        }
+
+        TEST_CASE("quote in the middle of a field")
+        {
+            // The quote does not open a quoted field, so the newline still ends the row
+            const std::string csv = "id,name\n1,5\" screen\n2,\"a \"\"quoted\"\"\nname\"\n3,it's\"\n";
+            for (const std::size_t block_size : {1, 16384})
+            {
+                SUBCASE(("block_size " + std::to_string(block_size)).c_str())
+                {
+                    const auto batches = csv::read_csv(csv, {.block_size = block_size});
+                    REQUIRE_EQ(batches.size(), 1);
+                    REQUIRE_EQ(batches[0].nb_rows(), 3);
+                    const std::vector<std::optional<std::string>> expected = {
+                        "5\" screen",
+                        "a \"quoted\"\nname",
+                        "it's\""
+                    };
+                    CHECK_EQ(string_values(batches[0].get_column("name")), expected);
+                }
+            }
+        }
+
+        TEST_CASE("schema and errors")
+        {
+            const std::vector<csv::column_spec> schema = {
+                {"id", csv::column_type::string},
+                {"value", csv::column_type::int64}
+            };
+            const auto batches = csv::read_csv("1;2\n3;\n", {.delimiter = ';', .header = false, .schema = schema});
+            REQUIRE_EQ(batches.size(), 1);
+            CHECK_EQ(string_values(batches[0].get_column("id")), std::vector<std::optional<std::string>>{"1", "3"});
+            const std::vector<std::optional<std::int64_t>> expected_values = {2, std::nullopt};
+            CHECK_EQ(column_values<primitive_array<std::int64_t>>(batches[0].get_column("value")), expected_values);
+
+            CHECK_THROWS_WITH_AS(
+                std::ignore = csv::read_csv("a,b\n1,2\n3,x\n", {.schema = schema}),
+                doctest::Contains("CSV line 3"),
+                csv::csv_error
+            );
+            CHECK_THROWS_WITH_AS(
+                std::ignore = csv::read_csv("a,b\n1,2\n3\n"),
+                doctest::Contains("CSV line 3: Expected 2 fields, got 1"),
+                csv::csv_error
+            );
+            CHECK_THROWS_AS(std::ignore = csv::read_csv("a,b\n\"1\"x,2\n"), csv::csv_error);
+            CHECK_THROWS_AS(std::ignore = csv::read_csv("a\n1\n", {.schema = schema}), csv::csv_error);
+            CHECK_THROWS_AS(std::ignore = csv::read_csv("a\n1\n", {.batch_size = 0}), std::invalid_argument);
+            CHECK(csv::read_csv("").empty());
+            CHECK(csv::read_csv("a,b\n").empty());
+        }
+
+        TEST_CASE("read_csv_file")
+        {
+            const auto path = std::filesystem::temp_directory_path() / "sparrow_test_csv.csv";
+            {
+                std::ofstream out(path, std::ios::binary);
+                out << events;
+            }
+            const auto batches = csv::read_csv_file(path);
+            REQUIRE_EQ(batches.size(), 1);
+            CHECK_EQ(batches[0].nb_rows(), 4);
+            std::filesystem::remove(path);
+        }
+    }
+}
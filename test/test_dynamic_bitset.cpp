@@ -12,10 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <ranges>
+#include <thread>
+#include <vector>
 
 #include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
 #include "sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp"
@@ -1444,6 +1447,44 @@ namespace sparrow
             }
         }
 
+        TEST_CASE("count_set_bits")
+        {
+            std::vector<std::uint8_t> bytes(300);
+            for (std::size_t i = 0; i < bytes.size(); ++i)
+            {
+                bytes[i] = static_cast<std::uint8_t>(i * 73 + 19);
+            }
+            const auto naive_count = [&bytes](std::size_t offset, std::size_t bit_size)
+            {
+                std::size_t res = 0;
+                for (std::size_t i = offset; i < offset + bit_size; ++i)
+                {
+                    res += (bytes[i / 8] >> (i % 8)) & 1u;
+                }
+                return res;
+            };
+
+            constexpr std::array<std::size_t, 7> offsets = {0, 1, 7, 8, 13, 64, 67};
+            constexpr std::array<std::size_t, 10> bit_sizes = {0, 1, 5, 8, 63, 64, 65, 130, 1000, 2000};
+            for (const std::size_t offset : offsets)
+            {
+                for (const std::size_t bit_size : bit_sizes)
+                {
+                    // The range is copied to a buffer of the exact size, so that reading
+                    // past its last byte would be caught by the sanitizers.
+                    const std::size_t first_byte = offset / 8;
+                    const std::size_t byte_count = (offset % 8 + bit_size + 7) / 8;
+                    const std::vector<std::uint8_t> range(
+                        bytes.begin() + static_cast<std::ptrdiff_t>(first_byte),
+                        bytes.begin() + static_cast<std::ptrdiff_t>(first_byte + byte_count)
+                    );
+                    const std::size_t expected = naive_count(offset, bit_size);
+                    CHECK_EQ(count_set_bits(range.data(), offset % 8, bit_size), expected);
+                    CHECK_EQ(count_set_bits(bytes.data(), offset, bit_size), expected);
+                }
+            }
+        }
+
         TEST_CASE("non_tracking_null_count")
         {
             SUBCASE("operations are no-ops")
@@ -1472,15 +1513,98 @@ namespace sparrow
             }
         }
 
+        TEST_CASE("lazy_null_count")
+        {
+            std::array<std::uint8_t, 4> buffer_data = {0b00100110, 0b01010101, 0b00110101, 0b00000111};
+
+            SUBCASE("policy")
+            {
+                lazy_null_count<> policy;
+                CHECK(policy.has_null_count());
+                policy.initialize_null_count(buffer_data.data(), 16, 4);
+                CHECK_FALSE(policy.has_null_count());
+                policy.update_null_count(false, true);
+                CHECK_FALSE(policy.has_null_count());
+                CHECK_EQ(policy.null_count(buffer_data.data(), 16, 4), 9);
+                CHECK(policy.has_null_count());
+                policy.update_null_count(true, false);
+                CHECK_EQ(policy.null_count(), 10);
+                policy.recompute_null_count(buffer_data.data(), 16, 4);
+                CHECK_FALSE(policy.has_null_count());
+                policy.set_null_count(3);
+                CHECK_EQ(policy.null_count(buffer_data.data(), 16, 4), 3);
+
+                // The count and its unknown state share a single atomic
+                static_assert(sizeof(lazy_null_count<>) == sizeof(std::int64_t));
+                lazy_null_count<> copy(policy);
+                CHECK_EQ(copy.null_count(), 3);
+                policy.invalidate_null_count();
+                copy = policy;
+                CHECK_FALSE(copy.has_null_count());
+            }
+
+            SUBCASE("concurrent queries")
+            {
+                const dynamic_bitset_view<std::uint8_t, lazy_null_count<>> view(buffer_data.data(), 29, 1);
+                std::vector<std::size_t> counts(8, 0);
+                std::vector<std::thread> threads;
+                for (std::size_t t = 0; t < counts.size(); ++t)
+                {
+                    threads.emplace_back(
+                        [&view, &counts, t]()
+                        {
+                            counts[t] = view.null_count();
+                        }
+                    );
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                for (const std::size_t count : counts)
+                {
+                    CHECK_EQ(count, 15);
+                }
+            }
+
+            SUBCASE("view")
+            {
+                const dynamic_bitset_view<std::uint8_t, lazy_null_count<>> view(buffer_data.data(), 29, 1);
+                CHECK_EQ(view.null_count(), 15);
+                const auto slice = view.slice_view(3, 10);
+                CHECK_EQ(slice.null_count(), 6);
+            }
+
+            SUBCASE("non_owning_dynamic_bitset")
+            {
+                buffer<std::uint8_t> buf(buffer_data, buffer<std::uint8_t>::default_allocator{});
+                non_owning_dynamic_bitset<std::uint8_t, lazy_null_count<>> bitset(&buf, 29);
+                bitset.set(0, true);
+                CHECK_EQ(bitset.null_count(), 14);
+                bitset.set(1, false);
+                CHECK_EQ(bitset.null_count(), 15);
+                bitset.resize(32, false);
+                CHECK_EQ(bitset.null_count(), 18);
+                bitset.erase(bitset.cbegin(), bitset.cbegin() + 8);
+                CHECK_EQ(bitset.null_count(), 13);
+                bitset.insert(bitset.cbegin() + 2, 4, false);
+                CHECK_EQ(bitset.null_count(), 17);
+            }
+        }
+
         TEST_CASE("null_count_policy concept")
         {
             // Verify both policies satisfy the concept
             static_assert(null_count_policy<tracking_null_count<>>);
             static_assert(null_count_policy<non_tracking_null_count<>>);
+            static_assert(null_count_policy<lazy_null_count<>>);
 
             // Verify with different size types
             static_assert(null_count_policy<tracking_null_count<std::uint32_t>>);
             static_assert(null_count_policy<non_tracking_null_count<std::uint32_t>>);
+
+            static_assert(lazy_null_count_policy<lazy_null_count<>>);
+            static_assert(!lazy_null_count_policy<tracking_null_count<>>);
         }
 
         TEST_CASE("non_owning_dynamic_bitset with non_tracking_null_count")
@@ -1995,5 +2119,204 @@ namespace sparrow
                 CHECK_THROWS_AS(bm.slice(21), std::out_of_range);
             }
         }
+
+        TEST_CASE("bitwise operations")
+        {
+            constexpr std::size_t size = 150;
+            constexpr std::size_t lhs_offset = 5;
+            constexpr std::size_t rhs_offset = 11;
+
+            const auto lhs_value = [](std::size_t i)
+            {
+                return i % 3 == 0 || i % 7 == 0;
+            };
+            const auto rhs_value = [](std::size_t i)
+            {
+                return i % 2 == 0;
+            };
+
+            // One more block than needed, to check that the bits past the bitset are left untouched
+            std::vector<std::uint8_t> lhs_blocks((size + lhs_offset + 7) / 8 + 1, 0xFF);
+            std::vector<std::uint8_t> rhs_blocks((size + rhs_offset + 7) / 8, 0xFF);
+            dynamic_bitset_view<std::uint8_t> lhs_init(lhs_blocks.data(), size, lhs_offset);
+            dynamic_bitset_view<std::uint8_t> rhs(rhs_blocks.data(), size, rhs_offset);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                lhs_init.set(i, lhs_value(i));
+                rhs.set(i, rhs_value(i));
+            }
+            const std::vector<std::uint8_t> lhs_blocks_init = lhs_blocks;
+
+            const auto check_result = [&](const auto& res, auto op)
+            {
+                std::size_t null_count = 0;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    const bool expected = op(lhs_value(i), rhs_value(i));
+                    CHECK_EQ(res.test(i), expected);
+                    null_count += expected ? 0 : 1;
+                }
+                CHECK_EQ(res.null_count(), null_count);
+                // The bits outside of the bitset are left untouched
+                CHECK_EQ(lhs_blocks.front() & 0x1F, lhs_blocks_init.front() & 0x1F);
+                CHECK_EQ(lhs_blocks.back(), lhs_blocks_init.back());
+            };
+
+            SUBCASE("bitwise_and")
+            {
+                dynamic_bitset_view<std::uint8_t> lhs(lhs_blocks.data(), size, lhs_offset);
+                lhs.bitwise_and(rhs);
+                check_result(
+                    lhs,
+                    [](bool l, bool r)
+                    {
+                        return l && r;
+                    }
+                );
+            }
+
+            SUBCASE("bitwise_or")
+            {
+                dynamic_bitset_view<std::uint8_t> lhs(lhs_blocks.data(), size, lhs_offset);
+                lhs.bitwise_or(rhs);
+                check_result(
+                    lhs,
+                    [](bool l, bool r)
+                    {
+                        return l || r;
+                    }
+                );
+            }
+
+            SUBCASE("bitwise_xor")
+            {
+                dynamic_bitset_view<std::uint8_t> lhs(lhs_blocks.data(), size, lhs_offset);
+                lhs.bitwise_xor(rhs);
+                check_result(
+                    lhs,
+                    [](bool l, bool r)
+                    {
+                        return l != r;
+                    }
+                );
+            }
+
+            SUBCASE("bitwise_and_not")
+            {
+                dynamic_bitset_view<std::uint8_t> lhs(lhs_blocks.data(), size, lhs_offset);
+                lhs.bitwise_and_not(rhs);
+                check_result(
+                    lhs,
+                    [](bool l, bool r)
+                    {
+                        return l && !r;
+                    }
+                );
+            }
+
+            SUBCASE("dynamic_bitset with a view")
+            {
+                dynamic_bitset<std::uint8_t> lhs(size, false, std::allocator<std::uint8_t>());
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    lhs.set(i, lhs_value(i));
+                }
+                lhs.bitwise_xor(rhs).bitwise_or(rhs);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    CHECK_EQ(lhs.test(i), lhs_value(i) || rhs_value(i));
+                }
+                CHECK_EQ(lhs.null_count(), static_cast<std::size_t>(std::ranges::count(lhs, false)));
+            }
+
+            SUBCASE("non_tracking_null_count")
+            {
+                dynamic_bitset_view<std::uint8_t, non_tracking_null_count<>> lhs(
+                    lhs_blocks.data(),
+                    size,
+                    lhs_offset
+                );
+                lhs.bitwise_xor(rhs);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    CHECK_EQ(lhs.test(i), lhs_value(i) != rhs_value(i));
+                }
+            }
+
+            SUBCASE("null buffer")
+            {
+                dynamic_bitset_view<std::uint8_t> all_set(nullptr, size);
+                all_set.bitwise_or(rhs);
+                CHECK_EQ(all_set.null_count(), 0);
+                CHECK_THROWS_AS(all_set.bitwise_and(rhs), std::runtime_error);
+
+                dynamic_bitset<std::uint8_t> lhs(size, false, std::allocator<std::uint8_t>());
+                lhs.bitwise_or(all_set);
+                CHECK_EQ(lhs.null_count(), 0);
+                lhs.bitwise_and_not(all_set);
+                CHECK_EQ(lhs.null_count(), size);
+            }
+        }
+
+        TEST_CASE("insert and erase across words")
+        {
+            constexpr std::size_t size = 300;
+            const auto value = [](std::size_t i)
+            {
+                return i % 3 != 0 && i % 11 != 0;
+            };
+
+            for (const std::size_t offset : {std::size_t{0}, std::size_t{5}})
+            {
+                dynamic_bitset<std::uint8_t> init(size + offset, false, std::allocator<std::uint8_t>());
+                std::vector<bool> expected;
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    init.set(i + offset, value(i));
+                    expected.push_back(value(i));
+                }
+                dynamic_bitset<std::uint8_t> bm(init.extract_storage(), size, offset);
+
+                const auto check = [&]()
+                {
+                    REQUIRE_EQ(bm.size(), expected.size());
+                    for (std::size_t i = 0; i < expected.size(); ++i)
+                    {
+                        CHECK_EQ(bm.test(i), expected[i]);
+                    }
+                    CHECK_EQ(bm.null_count(), static_cast<std::size_t>(std::ranges::count(expected, false)));
+                };
+
+                // Insertions and erasures with displacements that are not multiples of 8
+                bm.insert(std::next(bm.cbegin(), 17), 77, false);
+                expected.insert(std::next(expected.begin(), 17), 77, false);
+                check();
+
+                bm.insert(std::next(bm.cbegin(), 130), 3, true);
+                expected.insert(std::next(expected.begin(), 130), 3, true);
+                check();
+
+                std::vector<bool> values(150);
+                for (std::size_t i = 0; i < values.size(); ++i)
+                {
+                    values[i] = i % 4 == 1;
+                }
+                bm.insert(std::next(bm.cbegin(), 9), values.cbegin(), values.cend());
+                expected.insert(std::next(expected.begin(), 9), values.cbegin(), values.cend());
+                check();
+
+                bm.erase(std::next(bm.cbegin(), 3), std::next(bm.cbegin(), 204));
+                expected.erase(std::next(expected.begin(), 3), std::next(expected.begin(), 204));
+                check();
+
+                bm.erase(std::next(bm.cbegin(), 100));
+                expected.erase(std::next(expected.begin(), 100));
+                check();
+
+                bm.erase(std::next(bm.cbegin(), 250), bm.cend());
+                expected.erase(std::next(expected.begin(), 250), expected.end());
+                check();
+            }
+        }
     }
 }
@@ -0,0 +1,646 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#if !defined(_WIN32)
+#    include <unistd.h>
+#endif
+
+#include "sparrow/arrow_interface/arrow_array_stream_proxy.hpp"
+#include "sparrow/builder.hpp"
+#include "sparrow/ipc/array_stream.hpp"
+#include "sparrow/ipc/memory_mapped_file.hpp"
+#include "sparrow/ipc/reader.hpp"
+#include "sparrow/ipc/writer.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/record_batch.hpp"
+#include "sparrow/variable_size_binary_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        using bytes_type = std::vector<std::uint8_t>;
+
+        std::shared_ptr<const bytes_type> to_bytes(const std::ostringstream& out)
+        {
+            const std::string str = out.str();
+            return std::make_shared<const bytes_type>(str.begin(), str.end());
+        }
+
+        record_batch make_batch(int first)
+        {
+            std::vector<nullable<int>> ints = {first, nullval, first + 2, first + 3};
+            std::vector<std::string> strings = {"a", "bb", "a string longer than twelve bytes", ""};
+            std::vector<std::vector<std::tuple<double, std::string>>> nested = {
+                {{1.5, "x"}},
+                {},
+                {{2.5, "y"}, {3.5, "z"}},
+                {{4.5, ""}}
+            };
+            return record_batch(
+                std::vector<std::string>{"ints", "strings", "nested"},
+                std::vector<array>{array(build(ints)), array(build(strings)), array(build(nested))}
+            );
+        }
+
+        // Writes and reads back compressible columns, a dictionary encoded column and
+        // the small buffers of make_batch, which are stored uncompressed
+        void check_compressed_round_trip(ipc::compression_codec codec)
+        {
+            if (!ipc::is_codec_available(codec))
+            {
+                std::ostringstream out;
+                CHECK_THROWS_AS(ipc::stream_writer(out, ipc::write_options{.compression = codec}), std::invalid_argument);
+                return;
+            }
+
+            const record_batch large(
+                std::vector<std::string>{"ints", "strings"},
+                std::vector<array>{
+                    array(build(std::vector<std::int64_t>(10000, 42))),
+                    array(build(std::vector<std::string>(10000, "sparrow")))
+                }
+            );
+            std::vector<nullable<std::string>> dict_values = {"foo", "bar", nullval, "foo"};
+            const record_batch dict(
+                std::vector<std::string>{"dict"},
+                std::vector<array>{array(build(dict_encode<std::vector<nullable<std::string>>>{dict_values}))}
+            );
+
+            auto write = [&](const std::optional<ipc::compression_codec>& compression)
+            {
+                std::ostringstream out;
+                ipc::file_writer writer(out, ipc::write_options{.compression = compression});
+                writer.write(large);
+                writer.close();
+                return to_bytes(out);
+            };
+            const auto compressed = write(codec);
+            CHECK_LT(compressed->size(), write(std::nullopt)->size() / 4);
+            const ipc::file_reader file(*compressed, compressed);
+            CHECK_EQ(file.get_record_batch(0), large);
+
+            // The lazy columns are decompressed on first access
+            const ipc::file_reader lazy_file(*compressed, compressed, ipc::read_options{.lazy_columns = true});
+            const auto lazy = lazy_file.get_record_batch(0);
+            CHECK_FALSE(lazy.is_column_materialized(0));
+            CHECK_EQ(lazy.get_column("strings"), large.get_column(1));
+            CHECK_FALSE(lazy.is_column_materialized(0));
+            CHECK_EQ(lazy, large);
+
+            for (const auto& batch : {make_batch(0), dict})
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out, ipc::write_options{.compression = codec});
+                writer.write(batch);
+                writer.close();
+                auto bytes = to_bytes(out);
+                auto read = ipc::stream_reader(*bytes, bytes).next();
+                REQUIRE(read.has_value());
+                CHECK_EQ(*read, batch);
+            }
+        }
+
+        // Checks that the data buffer of the column points into the serialized bytes,
+        // at an offset aligned on 64 bytes
+        void check_zero_copy(const array& column, const bytes_type& bytes)
+        {
+            const auto& proxy = detail::array_access::get_arrow_proxy(column);
+            const auto* data = static_cast<const std::uint8_t*>(proxy.array().buffers[1]);
+            REQUIRE(data >= bytes.data());
+            REQUIRE(data < bytes.data() + bytes.size());
+            CHECK_EQ((data - bytes.data()) % 64, 0);
+        }
+    }
+
+    TEST_SUITE("ipc")
+    {
+        TEST_CASE("stream round trip")
+        {
+            std::ostringstream out;
+            ipc::stream_writer writer(out);
+            const record_batch batch0 = make_batch(0);
+            const record_batch batch1 = make_batch(10);
+            writer.write(batch0);
+            writer.write(batch1);
+            writer.close();
+            CHECK_THROWS_AS(writer.write(batch0), std::logic_error);
+
+            auto bytes = to_bytes(out);
+            ipc::stream_reader reader(*bytes, bytes);
+            auto read0 = reader.next();
+            auto read1 = reader.next();
+            REQUIRE(read0.has_value());
+            REQUIRE(read1.has_value());
+            CHECK_FALSE(reader.next().has_value());
+
+            CHECK_EQ(*read0, batch0);
+            CHECK_EQ(*read1, batch1);
+            CHECK_EQ(read0->get_column("ints").null_count(), 1);
+            check_zero_copy(read1->get_column("ints"), *bytes);
+            check_zero_copy(read1->get_column("strings"), *bytes);
+
+            SUBCASE("the batches keep the bytes alive")
+            {
+                const bytes_type* raw = bytes.get();
+                reader = ipc::stream_reader(*raw);
+                bytes.reset();
+                CHECK_EQ(*read1, batch1);
+            }
+        }
+
+        TEST_CASE("metadata and nullability")
+        {
+            const std::vector<metadata_pair> metadata = {{"key", "value"}, {"other", ""}};
+            primitive_array<std::int64_t> values(
+                std::vector<std::int64_t>{1, 2, 3},
+                false,
+                "values",
+                std::make_optional(metadata)
+            );
+            record_batch batch(
+                std::vector<std::string>{"values"},
+                std::vector<array>{array(std::move(values))},
+                std::nullopt,
+                std::make_optional(metadata)
+            );
+
+            std::ostringstream out;
+            ipc::stream_writer writer(out);
+            writer.write(batch);
+            writer.close();
+            auto bytes = to_bytes(out);
+            auto read = ipc::stream_reader(*bytes, bytes).next();
+            REQUIRE(read.has_value());
+            CHECK_EQ(*read, batch);
+            REQUIRE(read->metadata().has_value());
+            CHECK_EQ(*read->metadata(), metadata);
+
+            const auto& schema = detail::array_access::get_arrow_proxy(read->get_column(0)).schema();
+            CHECK_EQ(schema.flags & static_cast<std::int64_t>(ArrowFlag::NULLABLE), 0);
+            const auto column_metadata = detail::array_access::get_arrow_proxy(read->get_column(0)).metadata();
+            REQUIRE(column_metadata.has_value());
+            CHECK_EQ(column_metadata->size(), 2);
+        }
+
+        TEST_CASE("dictionary")
+        {
+            auto make_dict_batch = [](std::vector<nullable<std::string>> values)
+            {
+                return record_batch(
+                    std::vector<std::string>{"dict"},
+                    std::vector<array>{array(build(dict_encode<std::vector<nullable<std::string>>>{std::move(values)}))}
+                );
+            };
+            const record_batch batch0 = make_dict_batch({"foo", "bar", nullval, "foo"});
+            const record_batch batch1 = make_dict_batch({"baz", "baz"});
+
+            SUBCASE("stream")
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out);
+                writer.write(batch0);
+                writer.write(batch1);
+                writer.close();
+                auto bytes = to_bytes(out);
+                ipc::stream_reader reader(*bytes, bytes);
+                auto read0 = reader.next();
+                auto read1 = reader.next();
+                REQUIRE(read0.has_value());
+                REQUIRE(read1.has_value());
+                CHECK_EQ(*read0, batch0);
+                CHECK_EQ(*read1, batch1);
+            }
+
+            SUBCASE("file")
+            {
+                std::ostringstream out;
+                ipc::file_writer writer(out);
+                writer.write(batch0);
+                // The same dictionary can be written again
+                writer.write(record_batch(batch0));
+                CHECK_THROWS_AS(writer.write(batch1), std::invalid_argument);
+                writer.close();
+                auto bytes = to_bytes(out);
+                ipc::file_reader reader(*bytes, bytes);
+                REQUIRE_EQ(reader.num_record_batches(), 2);
+                CHECK_EQ(reader.get_record_batch(1), batch0);
+            }
+        }
+
+        TEST_CASE("sliced arrays are compacted")
+        {
+            std::vector<nullable<int>> ints = {0, 1, nullval, 3, 4, 5};
+            std::vector<std::string> strings = {"zero", "one", "two", "three", "four", "five"};
+            const array ints_array(build(ints));
+            const array strings_array(build(strings));
+            const record_batch batch(
+                std::vector<std::string>{"ints", "strings"},
+                std::vector<array>{ints_array.slice_view(1, 4), strings_array.slice_view(2, 5)}
+            );
+
+            std::ostringstream out;
+            ipc::stream_writer writer(out);
+            writer.write(batch);
+            writer.close();
+            auto bytes = to_bytes(out);
+            auto read = ipc::stream_reader(*bytes, bytes).next();
+            REQUIRE(read.has_value());
+            CHECK_EQ(*read, batch);
+            CHECK_EQ(read->get_column(0).null_count(), 1);
+        }
+
+        TEST_CASE("file round trip")
+        {
+            std::ostringstream out;
+            ipc::file_writer writer(out, ipc::write_options{128});
+            std::vector<record_batch> batches;
+            for (int i = 0; i < 3; ++i)
+            {
+                batches.push_back(make_batch(i * 100));
+                writer.write(batches.back());
+            }
+            writer.close();
+
+            auto bytes = to_bytes(out);
+            ipc::file_reader reader(*bytes, bytes);
+            REQUIRE_EQ(reader.num_record_batches(), 3);
+            for (std::size_t i = 3; i-- > 0;)
+            {
+                const auto batch = reader.get_record_batch(i);
+                CHECK_EQ(batch, batches[i]);
+                check_zero_copy(batch.get_column(0), *bytes);
+            }
+            CHECK_THROWS_AS(std::ignore = reader.get_record_batch(3), std::out_of_range);
+
+            // The embedded stream can be read by the stream reader
+            ipc::stream_reader stream(std::span<const std::uint8_t>(*bytes).subspan(8), bytes);
+            auto first = stream.next();
+            REQUIRE(first.has_value());
+            CHECK_EQ(*first, batches[0]);
+        }
+
+        TEST_CASE("memory mapped file")
+        {
+            constexpr std::size_t column_count = 50;
+            std::vector<std::string> names;
+            std::vector<array> columns;
+            for (std::size_t i = 0; i < column_count; ++i)
+            {
+                names.push_back("c" + std::to_string(i));
+                columns.emplace_back(build(std::vector<std::int64_t>(1000, static_cast<std::int64_t>(i))));
+            }
+            const record_batch batch(names, std::move(columns));
+
+            const auto path = std::filesystem::temp_directory_path() / "sparrow_test_memory_mapped_file.arrow";
+            {
+                std::ofstream out(path, std::ios::binary);
+                ipc::file_writer writer(out);
+                writer.write(batch);
+                writer.write(batch);
+                writer.close();
+            }
+
+            std::optional<record_batch> read;
+            {
+                auto reader = ipc::open_mapped_file(path);
+                REQUIRE_EQ(reader.num_record_batches(), 2);
+                read = reader.get_record_batch(1);
+            }
+            // The batch keeps the mapping alive
+            REQUIRE_EQ(read->nb_columns(), column_count);
+            CHECK_EQ(read->nb_rows(), 1000);
+            for (std::size_t i = 0; i < column_count; ++i)
+            {
+                CHECK_FALSE(read->is_column_materialized(i));
+            }
+
+            CHECK_EQ(read->get_column("c7"), batch.get_column(7));
+            CHECK_EQ(read->get_column(42), batch.get_column(42));
+            for (std::size_t i = 0; i < column_count; ++i)
+            {
+                CHECK_EQ(read->is_column_materialized(i), i == 7 || i == 42);
+            }
+
+            CHECK_EQ(*read, batch);
+
+            SUBCASE("eager columns")
+            {
+                auto reader = ipc::open_mapped_file(path, {});
+                const auto eager = reader.get_record_batch(0);
+                CHECK(eager.is_column_materialized(0));
+                CHECK_EQ(eager, batch);
+            }
+
+            read.reset();
+            std::filesystem::remove(path);
+            CHECK_THROWS_AS(std::ignore = ipc::open_mapped_file(path), std::system_error);
+        }
+
+        TEST_CASE("lz4 compression")
+        {
+#if defined(SPARROW_WITH_LZ4)
+            REQUIRE(ipc::is_codec_available(ipc::compression_codec::lz4_frame));
+#endif
+            check_compressed_round_trip(ipc::compression_codec::lz4_frame);
+        }
+
+        TEST_CASE("zstd compression")
+        {
+#if defined(SPARROW_WITH_ZSTD)
+            REQUIRE(ipc::is_codec_available(ipc::compression_codec::zstd));
+#endif
+            check_compressed_round_trip(ipc::compression_codec::zstd);
+        }
+
+#if !defined(_WIN32)
+        TEST_CASE("array stream from a file descriptor")
+        {
+            std::ostringstream out;
+            ipc::stream_writer writer(out);
+            std::vector<record_batch> batches;
+            for (int i = 0; i < 4; ++i)
+            {
+                batches.push_back(make_batch(i * 10));
+                writer.write(batches.back());
+            }
+            writer.close();
+            const std::string bytes = out.str();
+
+            int fds[2];
+            REQUIRE_EQ(::pipe(fds), 0);
+            std::thread producer(
+                [&]()
+                {
+                    // Small writes, so that the messages are split across reads
+                    for (std::size_t position = 0; position < bytes.size(); position += 100)
+                    {
+                        const std::size_t size = std::min<std::size_t>(100, bytes.size() - position);
+                        REQUIRE_EQ(::write(fds[1], bytes.data() + position, size), static_cast<ssize_t>(size));
+                    }
+                    ::close(fds[1]);
+                }
+            );
+
+            {
+                arrow_array_stream_proxy stream(ipc::make_arrow_array_stream(fds[0]));
+                for (const auto& batch : batches)
+                {
+                    auto read = stream.pop();
+                    REQUIRE(read.has_value());
+                    auto [array, schema] = extract_arrow_structures(std::move(*read));
+                    CHECK_EQ(record_batch(std::move(array), std::move(schema)), batch);
+                }
+                CHECK_FALSE(stream.pop().has_value());
+                CHECK_FALSE(stream.pop().has_value());
+                CHECK_THROWS_AS(stream.push(array(build(std::vector<int>{1}))), std::runtime_error);
+            }
+            producer.join();
+            ::close(fds[0]);
+
+            SUBCASE("empty input")
+            {
+                REQUIRE_EQ(::pipe(fds), 0);
+                ::close(fds[1]);
+                CHECK_THROWS_AS(std::ignore = ipc::make_arrow_array_stream(fds[0]), ipc::ipc_error);
+                ::close(fds[0]);
+            }
+
+            SUBCASE("body larger than the maximum")
+            {
+                REQUIRE_EQ(::pipe(fds), 0);
+                std::thread writer_thread(
+                    [&]()
+                    {
+                        std::ignore = ::write(fds[1], bytes.data(), bytes.size());
+                        ::close(fds[1]);
+                    }
+                );
+                {
+                    arrow_array_stream_proxy stream(ipc::make_arrow_array_stream(fds[0], {.max_body_length = 16}));
+                    CHECK_THROWS_AS(std::ignore = stream.pop(), std::system_error);
+                }
+                // Drain the pipe so that the writer is not blocked
+                std::array<char, 4096> buffer;
+                while (::read(fds[0], buffer.data(), buffer.size()) > 0)
+                {
+                }
+                writer_thread.join();
+                ::close(fds[0]);
+            }
+        }
+
+        TEST_CASE("array stream prefetch")
+        {
+            // The input holds the schema and a single batch, and the writer keeps the pipe
+            // open: reading the next batch blocks until the pipe is closed
+            std::ostringstream out;
+            ipc::stream_writer writer(out);
+            const record_batch batch = make_batch(0);
+            writer.write(batch);
+            const std::string bytes = out.str();
+
+            int fds[2];
+            REQUIRE_EQ(::pipe(fds), 0);
+            REQUIRE_EQ(::write(fds[1], bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+
+            SUBCASE("disabled by default")
+            {
+                // The stream does not read ahead, so releasing it does not wait for the input
+                arrow_array_stream_proxy stream(ipc::make_arrow_array_stream(fds[0]));
+                auto read = stream.pop();
+                REQUIRE(read.has_value());
+                auto [array, schema] = extract_arrow_structures(std::move(*read));
+                CHECK_EQ(record_batch(std::move(array), std::move(schema)), batch);
+            }
+
+            SUBCASE("cancelled on release")
+            {
+                // The prefetch of the second batch is blocked on the pipe, releasing the
+                // stream interrupts it
+                arrow_array_stream_proxy stream(ipc::make_arrow_array_stream(fds[0], {.prefetch = true}));
+                auto read = stream.pop();
+                REQUIRE(read.has_value());
+                auto [array, schema] = extract_arrow_structures(std::move(*read));
+                CHECK_EQ(record_batch(std::move(array), std::move(schema)), batch);
+            }
+
+            SUBCASE("end of the input reached by the prefetch")
+            {
+                arrow_array_stream_proxy stream(ipc::make_arrow_array_stream(fds[0], {.prefetch = true}));
+                REQUIRE(stream.pop().has_value());
+                ::close(fds[1]);
+                fds[1] = -1;
+                CHECK_FALSE(stream.pop().has_value());
+            }
+
+            if (fds[1] != -1)
+            {
+                ::close(fds[1]);
+            }
+            ::close(fds[0]);
+        }
+#endif
+
+        TEST_CASE("empty result set")
+        {
+            const record_batch batch = make_batch(0);
+            const std::vector<std::string> names = {"ints", "strings", "nested"};
+            auto check_fields = [&](const ipc::message_decoder& decoder)
+            {
+                REQUIRE(decoder.has_schema());
+                REQUIRE_EQ(decoder.fields().size(), names.size());
+                for (std::size_t i = 0; i < names.size(); ++i)
+                {
+                    CHECK_EQ(decoder.fields()[i].name.value_or(""), names[i]);
+                }
+            };
+
+            SUBCASE("stream")
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out);
+                writer.write_schema(batch);
+                writer.close();
+
+                auto bytes = to_bytes(out);
+                ipc::stream_reader reader(*bytes, bytes);
+                CHECK_FALSE(reader.next().has_value());
+                check_fields(reader.decoder());
+            }
+
+            SUBCASE("file")
+            {
+                std::ostringstream out;
+                ipc::file_writer writer(out);
+                writer.write_schema(batch);
+                writer.close();
+
+                auto bytes = to_bytes(out);
+                const ipc::file_reader reader(*bytes, bytes);
+                CHECK_EQ(reader.num_record_batches(), 0);
+                check_fields(reader.decoder());
+            }
+
+            SUBCASE("schema set up front, then batches")
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out);
+                writer.write_schema(batch);
+                writer.write(batch);
+                writer.close();
+
+                auto bytes = to_bytes(out);
+                ipc::stream_reader reader(*bytes, bytes);
+                const auto read = reader.next();
+                REQUIRE(read.has_value());
+                CHECK_EQ(*read, batch);
+                CHECK_FALSE(reader.next().has_value());
+            }
+        }
+
+        TEST_CASE("errors")
+        {
+            SUBCASE("schema mismatch")
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out);
+                writer.write(make_batch(0));
+                const record_batch other(
+                    std::vector<std::string>{"ints"},
+                    std::vector<array>{array(build(std::vector<int>{1, 2}))}
+                );
+                CHECK_THROWS_AS(writer.write(other), std::invalid_argument);
+            }
+
+            SUBCASE("empty file")
+            {
+                std::ostringstream out;
+                ipc::file_writer writer(out);
+                CHECK_THROWS_AS(writer.close(), std::logic_error);
+            }
+
+            SUBCASE("schema mismatch with the schema set up front")
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out);
+                writer.write_schema(make_batch(0));
+                const record_batch other(
+                    std::vector<std::string>{"ints"},
+                    std::vector<array>{array(build(std::vector<int>{1, 2}))}
+                );
+                CHECK_THROWS_AS(writer.write_schema(other), std::invalid_argument);
+                CHECK_THROWS_AS(writer.write(other), std::invalid_argument);
+            }
+
+            SUBCASE("truncated input")
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out);
+                writer.write(make_batch(0));
+                writer.close();
+                auto bytes = to_bytes(out);
+                const auto truncated = std::span<const std::uint8_t>(*bytes).first(bytes->size() / 2);
+                ipc::stream_reader reader(truncated);
+                CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+
+                CHECK_THROWS_AS(ipc::file_reader(*bytes), ipc::ipc_error);
+            }
+
+            SUBCASE("corrupted offsets")
+            {
+                std::ostringstream out;
+                ipc::stream_writer writer(out);
+                writer.write(make_batch(0));
+                writer.close();
+                const auto bytes = to_bytes(out);
+                std::ptrdiff_t position = 0;
+                {
+                    ipc::stream_reader reader(*bytes, bytes);
+                    const auto batch = reader.next();
+                    REQUIRE(batch.has_value());
+                    const auto& proxy = detail::array_access::get_arrow_proxy(batch->get_column("strings"));
+                    position = static_cast<const std::uint8_t*>(proxy.array().buffers[1]) - bytes->data();
+                }
+
+                // The offsets of the strings column are {0, 1, 3, 36, 36}
+                auto check_corrupted = [&](std::size_t index, std::int32_t offset)
+                {
+                    bytes_type corrupted = *bytes;
+                    std::memcpy(corrupted.data() + position + index * sizeof(offset), &offset, sizeof(offset));
+                    ipc::stream_reader reader(corrupted);
+                    CHECK_THROWS_AS(std::ignore = reader.next(), ipc::ipc_error);
+                };
+                check_corrupted(2, 0);
+                check_corrupted(4, 1 << 20);
+            }
+        }
+    }
+}
@@ -0,0 +1,318 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/buffer/allocator.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/memory_resource.hpp"
+#include "sparrow/builder.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/record_batch.hpp"
+#include "sparrow/u8_buffer.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Upstream resource counting the live allocations
+        class counting_resource final : public std::pmr::memory_resource
+        {
+        public:
+
+            std::size_t allocation_count = 0;
+            std::size_t live_count = 0;
+
+        private:
+
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                ++allocation_count;
+                ++live_count;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+            {
+                --live_count;
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+
+            [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+        };
+
+        [[nodiscard]] bool is_aligned(const void* p)
+        {
+            return reinterpret_cast<std::uintptr_t>(p) % buffer_alignment == 0;
+        }
+    }
+
+    TEST_SUITE("memory_resource")
+    {
+        TEST_CASE("arena_memory_resource")
+        {
+            counting_resource upstream;
+            arena_memory_resource arena(1024, &upstream);
+
+            SUBCASE("allocate")
+            {
+                std::vector<void*> blocks;
+                for (std::size_t i = 1; i < 100; ++i)
+                {
+                    void* p = arena.allocate(i * 3, 1);
+                    CHECK(is_aligned(p));
+                    blocks.push_back(p);
+                }
+                CHECK_GE(arena.bytes_allocated(), 99 * 3);
+                // Chunks grow geometrically
+                CHECK_LT(upstream.allocation_count, 10);
+
+                // Blocks do not overlap
+                auto* first = static_cast<std::uint8_t*>(blocks[0]);
+                first[0] = 42;
+                auto* last = static_cast<std::uint8_t*>(blocks.back());
+                std::fill(last, last + 99 * 3, std::uint8_t(0));
+                CHECK_EQ(first[0], 42);
+
+                for (std::size_t i = 1; i < 100; ++i)
+                {
+                    arena.deallocate(blocks[i - 1], i * 3, 1);
+                }
+            }
+
+            SUBCASE("large block")
+            {
+                void* p = arena.allocate(1 << 20, 8);
+                CHECK(is_aligned(p));
+                CHECK_EQ(upstream.allocation_count, 1);
+                arena.deallocate(p, 1 << 20, 8);
+            }
+
+            SUBCASE("release")
+            {
+                std::ignore = arena.allocate(100, 1);
+                std::ignore = arena.allocate(10000, 1);
+                arena.deallocate(arena.allocate(10, 1), 10, 1);
+                CHECK_GT(upstream.live_count, 0);
+                arena.release();
+                CHECK_EQ(upstream.live_count, 0);
+                CHECK_EQ(arena.bytes_allocated(), 0);
+
+                // The arena can be reused after release
+                void* p = arena.allocate(100, 1);
+                CHECK(is_aligned(p));
+                arena.deallocate(p, 100, 1);
+            }
+
+            SUBCASE("reset")
+            {
+                std::ignore = arena.allocate(100, 1);
+                std::ignore = arena.allocate(10000, 1);
+                CHECK_EQ(upstream.live_count, 2);
+                arena.reset();
+                CHECK_EQ(upstream.live_count, 1);
+                CHECK_EQ(arena.bytes_allocated(), 0);
+
+                // The largest chunk is reused
+                const std::size_t count = upstream.allocation_count;
+                arena.deallocate(arena.allocate(10000, 1), 10000, 1);
+                CHECK_EQ(upstream.allocation_count, count);
+            }
+
+            SUBCASE("destructor")
+            {
+                {
+                    arena_memory_resource other(1024, &upstream);
+                    // Deallocating is a no-op: the chunk is given back by the destructor
+                    other.deallocate(other.allocate(5000, 1), 5000, 1);
+                }
+                CHECK_EQ(upstream.live_count, 0);
+            }
+
+            SUBCASE("is_equal")
+            {
+                arena_memory_resource other;
+                CHECK(arena.is_equal(arena));
+                CHECK_FALSE(arena.is_equal(other));
+                CHECK_EQ(arena.upstream_resource(), &upstream);
+            }
+        }
+
+        TEST_CASE("pool_memory_resource")
+        {
+            counting_resource upstream;
+            pool_memory_resource pool(4096, &upstream);
+            CHECK_EQ(pool.max_block_size(), 4096);
+
+            SUBCASE("allocate")
+            {
+                void* p1 = pool.allocate(10, 1);
+                void* p2 = pool.allocate(100, 8);
+                void* p3 = pool.allocate(4000, 1);
+                CHECK(is_aligned(p1));
+                CHECK(is_aligned(p2));
+                CHECK(is_aligned(p3));
+                CHECK_NE(p1, p2);
+                // One chunk per size class
+                CHECK_EQ(upstream.allocation_count, 3);
+                pool.deallocate(p1, 10, 1);
+                pool.deallocate(p2, 100, 8);
+                pool.deallocate(p3, 4000, 1);
+                // Empty buffers give back a null pointer
+                pool.deallocate(nullptr, 0, 1);
+            }
+
+            SUBCASE("reuse")
+            {
+                void* p = pool.allocate(100, 1);
+                pool.deallocate(p, 100, 1);
+                CHECK_EQ(pool.allocate(120, 1), p);
+                pool.deallocate(p, 120, 1);
+                const std::size_t count = upstream.allocation_count;
+                for (std::size_t i = 0; i < 100; ++i)
+                {
+                    pool.deallocate(pool.allocate(65, 1), 65, 1);
+                }
+                CHECK_EQ(upstream.allocation_count, count);
+            }
+
+            SUBCASE("large block")
+            {
+                void* p = pool.allocate(10000, 1);
+                CHECK(is_aligned(p));
+                CHECK_EQ(upstream.live_count, 1);
+                pool.deallocate(p, 10000, 1);
+                CHECK_EQ(upstream.live_count, 0);
+            }
+
+            SUBCASE("release")
+            {
+                std::ignore = pool.allocate(10, 1);
+                std::ignore = pool.allocate(1000, 1);
+                pool.release();
+                CHECK_EQ(upstream.live_count, 0);
+            }
+        }
+
+        TEST_CASE("u8_buffer with a memory resource")
+        {
+            arena_memory_resource arena;
+            const std::vector<int> values = {1, 2, 3, 4};
+            u8_buffer<int> b(values, std::pmr::polymorphic_allocator<std::uint8_t>(&arena));
+            CHECK_GE(arena.bytes_allocated(), values.size() * sizeof(int));
+            REQUIRE_EQ(b.size(), values.size());
+            CHECK(std::ranges::equal(b, values));
+
+            // The buffer keeps allocating from the arena when it grows
+            const std::size_t bytes = arena.bytes_allocated();
+            b.resize(1000, 2);
+            CHECK_GT(arena.bytes_allocated(), bytes);
+            CHECK_EQ(b[0], 1);
+            CHECK_EQ(b[999], 2);
+        }
+
+        TEST_CASE("build with a memory resource")
+        {
+            counting_resource upstream;
+            arena_memory_resource arena(1024, &upstream);
+
+            SUBCASE("primitive")
+            {
+                std::vector<nullable<int>> values = {1, nullval, 3, 4};
+                auto arr = build(arena, values);
+                CHECK_GT(arena.bytes_allocated(), 0);
+                REQUIRE_EQ(arr.size(), 4);
+                CHECK_EQ(arr[0].value(), 1);
+                CHECK_FALSE(arr[1].has_value());
+                CHECK_EQ(arr[3].value(), 4);
+                CHECK_EQ(arr.null_count(), 1);
+            }
+
+            SUBCASE("initializer list")
+            {
+                auto arr = build(arena, {1.5, 2.5});
+                CHECK_GT(arena.bytes_allocated(), 0);
+                CHECK_EQ(arr[1].value(), 2.5);
+            }
+
+            SUBCASE("nested")
+            {
+                std::vector<std::tuple<int, std::string>> values = {{1, "one"}, {2, "two"}};
+                std::vector<std::vector<std::tuple<int, std::string>>> nested = {values, {}, values};
+                {
+                    auto arr = build(arena, nested);
+                    CHECK_EQ(arr.size(), 3);
+                    CHECK_EQ(arr[2].value().size(), 2);
+                }
+                // Validity bitmaps, offsets and data buffers of all the children
+                const std::size_t bytes = arena.bytes_allocated();
+                CHECK_GE(bytes, 5 * buffer_alignment);
+                CHECK_LT(upstream.allocation_count, 4);
+                arena.release();
+                CHECK_EQ(upstream.live_count, 0);
+            }
+
+            SUBCASE("record_batch")
+            {
+                std::optional<record_batch> rb;
+                {
+                    std::vector<int> col0 = {1, 2, 3};
+                    std::vector<double> col1 = {1., 2., 3.};
+                    rb.emplace(
+                        std::vector<std::string>{"a", "b"},
+                        std::vector<array>{build(arena, col0), build(arena, col1)}
+                    );
+                }
+                CHECK_GT(arena.bytes_allocated(), 0);
+                CHECK_EQ(rb->nb_rows(), 3);
+                CHECK_EQ(rb->get_column("b").size(), 3);
+                rb.reset();
+                arena.release();
+                CHECK_EQ(upstream.live_count, 0);
+            }
+
+            SUBCASE("record_batch copy")
+            {
+                primitive_array<int> col0(std::vector<int>{1, 2, 3});
+                primitive_array<double> col1(std::vector<double>{1., 2., 3.});
+                const record_batch source(
+                    std::vector<std::string>{"a", "b"},
+                    std::vector<array>{array(std::move(col0)), array(std::move(col1))}
+                );
+                CHECK_EQ(arena.bytes_allocated(), 0);
+                {
+                    const record_batch rb(source, arena);
+                    CHECK_GE(arena.bytes_allocated(), 3 * (sizeof(int) + sizeof(double)));
+                    CHECK_EQ(rb, source);
+                    CHECK(std::ranges::equal(rb.names(), source.names()));
+                }
+                arena.release();
+                CHECK_EQ(upstream.live_count, 0);
+            }
+        }
+    }
+}
@@ -112,4 +112,55 @@ TEST_SUITE("metadata")
             CHECK_EQ(it, empty_key_values.end());
         }
     }
+
+    TEST_CASE("key_value_index")
+    {
+        const std::vector<sparrow::metadata_pair> pairs = {
+            {"zeta", "1"},
+            {sparrow::metadata_pair{std::string(sparrow::extension_name_metadata_key), "my.extension"}},
+            {"alpha", "2"},
+            {"zeta", "3"}
+        };
+        const auto buffer = sparrow::get_metadata_from_key_values(pairs);
+        const sparrow::key_value_index index(buffer.data());
+        CHECK_EQ(index.size(), 4);
+        CHECK_EQ(index.extension_name(), "my.extension");
+
+        SUBCASE("find")
+        {
+            const auto* alpha = index.find("alpha");
+            REQUIRE(alpha != nullptr);
+            CHECK_EQ(alpha->value, "2");
+            CHECK_EQ(alpha->index, 2);
+            // The first pair of the buffer is found when a key is repeated
+            const auto* zeta = index.find("zeta");
+            REQUIRE(zeta != nullptr);
+            CHECK_EQ(zeta->value, "1");
+            CHECK(index.find("beta") == nullptr);
+            CHECK(index.find("") == nullptr);
+        }
+
+        SUBCASE("indexed key_value_view")
+        {
+            const sparrow::key_value_view key_values(buffer.data(), &index);
+            CHECK_EQ(key_values, sparrow::key_value_view(buffer.data()));
+            for (const auto& [key, value] : pairs)
+            {
+                CHECK_EQ(key_values.find(key), sparrow::key_value_view(buffer.data()).find(key));
+            }
+            auto it = key_values.find("alpha");
+            REQUIRE(it != key_values.end());
+            CHECK_EQ((*it).second, "2");
+            ++it;
+            CHECK_EQ((*it).first, "zeta");
+            CHECK_EQ((*it).second, "3");
+            CHECK_EQ(key_values.find("beta"), key_values.end());
+        }
+
+        SUBCASE("without extension name")
+        {
+            const sparrow::key_value_index other(sparrow::metadata_buffer.data());
+            CHECK_FALSE(other.extension_name().has_value());
+        }
+    }
 }
@@ -0,0 +1,116 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "sparrow/utils/parallel.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    TEST_SUITE("parallel")
+    {
+        TEST_CASE("parallel_task_count")
+        {
+            CHECK_EQ(parallel_task_count(0, 10), 1);
+            CHECK_EQ(parallel_task_count(15, 10), 1);
+            CHECK_GE(parallel_task_count(1000, 1), 1);
+            CHECK_LE(parallel_task_count(1000, 1), std::max(std::thread::hardware_concurrency(), 1u));
+        }
+
+        TEST_CASE("parallel_for")
+        {
+            constexpr std::size_t count = 1000;
+
+            SUBCASE("every index once")
+            {
+                std::vector<std::atomic<int>> calls(count);
+                parallel_for(
+                    count,
+                    [&](std::size_t i)
+                    {
+                        ++calls[i];
+                    },
+                    4
+                );
+                for (const auto& c : calls)
+                {
+                    CHECK_EQ(c.load(), 1);
+                }
+            }
+
+            SUBCASE("repeated calls reuse the pool")
+            {
+                std::atomic<std::size_t> total = 0;
+                for (std::size_t n = 0; n < 100; ++n)
+                {
+                    parallel_for(
+                        10,
+                        [&](std::size_t i)
+                        {
+                            total += i;
+                        },
+                        4
+                    );
+                }
+                CHECK_EQ(total.load(), 100 * 45);
+            }
+
+            SUBCASE("nested")
+            {
+                std::atomic<std::size_t> total = 0;
+                parallel_for(
+                    16,
+                    [&](std::size_t)
+                    {
+                        parallel_for(
+                            16,
+                            [&](std::size_t)
+                            {
+                                ++total;
+                            },
+                            16
+                        );
+                    },
+                    16
+                );
+                CHECK_EQ(total.load(), 256);
+            }
+
+            SUBCASE("exception")
+            {
+                CHECK_THROWS_AS(
+                    parallel_for(
+                        count,
+                        [](std::size_t i)
+                        {
+                            if (i == 500)
+                            {
+                                throw std::runtime_error("failure");
+                            }
+                        },
+                        4
+                    ),
+                    std::runtime_error
+                );
+            }
+        }
+    }
+}
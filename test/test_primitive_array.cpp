@@ -22,6 +22,7 @@
 #if defined(__GNUC__)
 #    pragma GCC diagnostic pop
 #endif
+#include <algorithm>
 #include <vector>
 
 #include "sparrow/array.hpp"
@@ -233,6 +234,45 @@ namespace sparrow
                 CHECK_EQ(ar.null_count(), 45);
             }
 
+            SUBCASE("copy on write")
+            {
+                const auto data_ptr = [](const array_test_type& a)
+                {
+                    return detail::array_access::get_arrow_proxy(a).buffers()[1].data();
+                };
+                const array_test_type ar2(ar);
+                CHECK_EQ(data_ptr(ar2), data_ptr(ar));
+
+                array_test_type ar3(ar2);
+                ar3[0] = make_test_nullable(99);
+                CHECK_NE(data_ptr(ar3), data_ptr(ar2));
+                CHECK_EQ(ar2, ar);
+                CHECK_EQ(ar3[0], make_test_nullable(99));
+
+                array_test_type ar4(ar2);
+                ar4.push_back(make_test_nullable(7));
+                CHECK_EQ(ar4.size(), ar2.size() + 1);
+                CHECK_EQ(ar2, ar);
+
+                // begin() and end() may be evaluated in any order, both must
+                // refer to the unshared buffers
+                array_test_type ar5(ar2);
+                std::fill(ar5.begin(), ar5.end(), make_test_nullable(42));
+                CHECK_NE(data_ptr(ar5), data_ptr(ar2));
+                CHECK_EQ(ar2, ar);
+                for (const auto& value : ar5)
+                {
+                    CHECK_EQ(value, make_test_nullable(42));
+                }
+
+                array_test_type ar6(ar2);
+                const auto last = ar6.end();
+                const auto first = ar6.begin();
+                std::fill(first, last, make_test_nullable(43));
+                CHECK_EQ(ar2, ar);
+                CHECK_EQ(ar6[ar6.size() - 1], make_test_nullable(43));
+            }
+
             SUBCASE("move")
             {
                 array_test_type ar2(ar);
@@ -894,8 +934,11 @@ namespace sparrow
                 primitive_array<int32_t> arr{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
 
                 auto sliced = arr.slice(slice_start, slice_end);
-                CHECK_EQ(sliced.offset(), slice_start);
+                // Without validity bitmap, the exported buffers are trimmed
+                // and the offset is absorbed into them.
+                CHECK_EQ(sliced.offset(), 0);
                 CHECK_EQ(sliced.size(), slice_end - slice_start);
+                CHECK_EQ(sliced[0].value(), 4);
             }
 
             SUBCASE("null_count with nulls")
@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include "sparrow/debug/copy_tracker.hpp"
 #include "sparrow/fixed_width_binary_array.hpp"
@@ -221,6 +224,15 @@ namespace sparrow
 
             record3 = record2;
             CHECK_EQ(record1, record3);
+
+            const std::vector<metadata_pair> metadata{{"key", "value"}};
+            const record_batch named(make_name_list(), make_array_list(col_size), "batch", std::optional(metadata));
+            const record_batch named_copy(named);
+            CHECK_EQ(named_copy.name(), named.name());
+            CHECK_EQ(named_copy.metadata(), named.metadata());
+            record3 = named;
+            CHECK_EQ(record3.name(), named.name());
+            CHECK_EQ(record3.metadata(), named.metadata());
         }
 
         TEST_CASE("move semantic")
@@ -314,6 +326,52 @@ namespace sparrow
             CHECK_EQ(extr, control);
         }
 
+        TEST_CASE("compact")
+        {
+            std::vector<array> sliced_columns;
+            for (const auto& column : make_array_list(col_size))
+            {
+                sliced_columns.push_back(column.slice(3, 9));
+            }
+            record_batch record(make_name_list(), std::move(sliced_columns), "record");
+            const auto compacted = record.compact();
+
+            REQUIRE_EQ(compacted.nb_columns(), record.nb_columns());
+            CHECK_EQ(compacted.nb_rows(), 6);
+            CHECK(compacted.name() == record.name());
+            CHECK(std::ranges::equal(compacted.names(), record.names()));
+            for (std::size_t i = 0; i < compacted.nb_columns(); ++i)
+            {
+                CHECK_EQ(compacted.get_column(i).offset(), 0);
+                CHECK(compacted.get_column(i) == record.get_column(i));
+            }
+        }
+
+        TEST_CASE("concatenate")
+        {
+            const auto record = make_record_batch(col_size);
+            const std::vector<record_batch> batches{record, record};
+            const auto concatenated = record_batch::concatenate(batches);
+
+            REQUIRE_EQ(concatenated.nb_columns(), record.nb_columns());
+            CHECK_EQ(concatenated.nb_rows(), 2 * col_size);
+            CHECK(concatenated.name() == record.name());
+            CHECK(std::ranges::equal(concatenated.names(), record.names()));
+            for (std::size_t i = 0; i < concatenated.nb_columns(); ++i)
+            {
+                CHECK(concatenated.get_column(i).slice(0, col_size) == record.get_column(i));
+                CHECK(concatenated.get_column(i).slice(col_size, 2 * col_size) == record.get_column(i));
+            }
+
+            const std::vector<record_batch> empty;
+            CHECK_THROWS_AS(std::ignore = record_batch::concatenate(empty), std::invalid_argument);
+
+            auto renamed = make_record_batch(col_size);
+            renamed.add_column("extra", array(primitive_array<std::int32_t>(std::vector<std::int32_t>(col_size, 1))));
+            const std::vector<record_batch> mismatched{record, renamed};
+            CHECK_THROWS_AS(std::ignore = record_batch::concatenate(mismatched), std::invalid_argument);
+        }
+
         TEST_CASE("add_column")
         {
             auto record = make_record_batch(col_size);
@@ -508,6 +566,84 @@ namespace sparrow
             }
         }
 
+        TEST_CASE("add_lazy_column")
+        {
+            auto record = make_record_batch(col_size);
+            const auto array_list = make_array_list(col_size);
+            std::size_t calls = 0;
+            record.add_lazy_column(
+                "lazy",
+                col_size,
+                [&]()
+                {
+                    ++calls;
+                    return array_list[1];
+                }
+            );
+
+            CHECK_EQ(record.nb_columns(), 4);
+            CHECK_EQ(record.nb_rows(), col_size);
+            CHECK(record.contains_column("lazy"));
+            CHECK(record.is_column_materialized(0));
+            CHECK_FALSE(record.is_column_materialized(3));
+
+            const auto copy = record;
+            CHECK_EQ(record.get_column("lazy"), array_list[1]);
+            CHECK(record.is_column_materialized(3));
+            CHECK_FALSE(copy.is_column_materialized(3));
+            CHECK_EQ(record.get_column(3), array_list[1]);
+            CHECK_EQ(calls, 1);
+
+            CHECK_EQ(copy, record);
+            CHECK_EQ(calls, 2);
+
+            // A copy made after the creation of the array does not create it again
+            const auto materialized_copy = record;
+            CHECK(materialized_copy.is_column_materialized(3));
+            CHECK_EQ(materialized_copy.get_column(3), array_list[1]);
+            CHECK_EQ(calls, 2);
+
+            auto extracted = record.extract_struct_array();
+            CHECK_EQ(extracted.size(), col_size);
+            CHECK_EQ(calls, 2);
+
+            SUBCASE("concurrent first access")
+            {
+                std::atomic<std::size_t> concurrent_calls = 0;
+                record_batch lazy_record;
+                lazy_record.add_lazy_column(
+                    "lazy",
+                    col_size,
+                    [&]()
+                    {
+                        ++concurrent_calls;
+                        return array_list[1];
+                    }
+                );
+                const record_batch& const_record = lazy_record;
+                std::vector<const array*> columns(8, nullptr);
+                std::vector<std::thread> threads;
+                for (std::size_t t = 0; t < columns.size(); ++t)
+                {
+                    threads.emplace_back(
+                        [&const_record, &columns, t]()
+                        {
+                            columns[t] = &const_record.get_column(0);
+                        }
+                    );
+                }
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                CHECK_EQ(concurrent_calls.load(), 1);
+                for (const array* column : columns)
+                {
+                    CHECK_EQ(column, &const_record.get_column(0));
+                }
+            }
+        }
+
 #if defined(__cpp_lib_format)
         TEST_CASE("formatter")
         {
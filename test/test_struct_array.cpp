@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <optional>
+#include <stdexcept>
 #include <string_view>
+#include <tuple>
 
 #include "sparrow/array.hpp"
 #include "sparrow/primitive_array.hpp"
@@ -333,6 +336,34 @@ namespace sparrow
             CHECK_THROWS_AS(struct_val.at(100), std::out_of_range);
         }
 
+        SUBCASE("at by name")
+        {
+            const auto struct_val = struct_arr[1].value();
+            CHECK_NULLABLE_VARIANT_EQ(struct_val.at("item 0"), static_cast<inner_scalar_type>(1));
+            CHECK_NULLABLE_VARIANT_EQ(struct_val.at("item 1"), static_cast<std::uint8_t>(1));
+            CHECK_THROWS_AS(std::ignore = struct_val.at("item 2"), std::out_of_range);
+        }
+
+        SUBCASE("field handles")
+        {
+            const struct_field_handle item0 = struct_arr.field_handle("item 0");
+            const struct_field_handle item1 = struct_arr.field_handle("item 1");
+            CHECK_EQ(item0.index(), 0);
+            CHECK_EQ(item1.index(), 1);
+            CHECK_EQ(struct_arr.find_field("item 1"), std::make_optional(item1));
+            CHECK_FALSE(struct_arr.find_field("item 2").has_value());
+            CHECK_THROWS_AS(std::ignore = struct_arr.field_handle("item 2"), std::out_of_range);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const auto struct_val = struct_arr[i].value();
+                CHECK_EQ(struct_val.field_handle("item 1"), item1);
+                CHECK_NULLABLE_VARIANT_EQ(struct_val[item0], static_cast<inner_scalar_type>(i));
+                CHECK_NULLABLE_VARIANT_EQ(struct_val.at(item1), static_cast<std::uint8_t>(i));
+            }
+            CHECK_THROWS_AS(std::ignore = struct_arr[0].value().at(struct_field_handle(2)), std::out_of_range);
+        }
+
         SUBCASE("operator==(struct_value, struct_value)")
         {
             CHECK(struct_arr[0] == struct_arr[0]);
@@ -353,6 +384,8 @@ namespace sparrow
             CHECK_EQ(struct_arr.children_count(), 3);
             CHECK_EQ(struct_arr.names().back(), "new_child");
             CHECK_NULLABLE_VARIANT_EQ(struct_arr[0].value().at(2), std::int16_t(90));
+            CHECK_EQ(struct_arr.field_handle("new_child").index(), 2);
+            CHECK_NULLABLE_VARIANT_EQ(struct_arr[1].value().at("new_child"), std::int16_t(91));
         }
 
         SUBCASE("set_child")
@@ -364,12 +397,15 @@ namespace sparrow
             CHECK_EQ(struct_arr.children_count(), 2);
             CHECK_EQ(struct_arr.names().back(), "new_child");
             CHECK_NULLABLE_VARIANT_EQ(struct_arr[0].value().at(1), std::int16_t(90));
+            CHECK_EQ(struct_arr.field_handle("new_child").index(), 1);
+            CHECK_FALSE(struct_arr.find_field("item 1").has_value());
         }
 
         SUBCASE("pop_children")
         {
             struct_arr.pop_children(1);
             CHECK_EQ(struct_arr.children_count(), 1);
+            CHECK_FALSE(struct_arr.find_field("item 1").has_value());
         }
 
 #if defined(__cpp_lib_format)
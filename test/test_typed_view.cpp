@@ -0,0 +1,147 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/dictionary_encoded_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/list_array.hpp"
+#include "sparrow/primitive_array.hpp"
+#include "sparrow/struct_array.hpp"
+#include "sparrow/variable_size_binary_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    TEST_SUITE("typed_view")
+    {
+        TEST_CASE("array")
+        {
+            const array ar(primitive_array<std::int32_t>(
+                std::vector<nullable<std::int32_t>>{
+                    nullable<std::int32_t>(1),
+                    nullable<std::int32_t>(2, false),
+                    nullable<std::int32_t>(3)
+                }
+            ));
+            REQUIRE(holds_layout<primitive_array<std::int32_t>>(ar));
+            CHECK_FALSE(holds_layout<primitive_array<std::int64_t>>(ar));
+
+            const auto view = make_typed_view<primitive_array<std::int32_t>>(ar);
+            REQUIRE_EQ(view.size(), 3);
+            CHECK_FALSE(view.empty());
+            CHECK_EQ(view[0].get(), 1);
+            CHECK_FALSE(view[1].has_value());
+            CHECK_EQ(view.back().get(), 3);
+            CHECK_EQ(view.at(2).get(), 3);
+            CHECK_THROWS_AS(std::ignore = view.at(3), std::out_of_range);
+
+            std::int32_t sum = 0;
+            for (const auto& value : view)
+            {
+                if (value.has_value())
+                {
+                    sum += value.get();
+                }
+            }
+            CHECK_EQ(sum, 4);
+            CHECK_EQ(std::distance(view.rbegin(), view.rend()), 3);
+            CHECK_EQ((*view.rbegin()).get(), 3);
+
+            CHECK_THROWS_AS(std::ignore = make_typed_view<primitive_array<std::int64_t>>(ar), std::invalid_argument);
+            CHECK_THROWS_AS(std::ignore = make_typed_view<primitive_array<std::int32_t>>(array{}), std::invalid_argument);
+        }
+
+        TEST_CASE("sub range")
+        {
+            const primitive_array<std::int32_t> values{0, 1, 2, 3, 4};
+            const typed_view<primitive_array<std::int32_t>> view(values, 1, 4);
+            REQUIRE_EQ(view.size(), 3);
+            CHECK_EQ(view.front().get(), 1);
+            CHECK_EQ(view.back().get(), 3);
+            CHECK_EQ(std::distance(view.begin(), view.end()), 3);
+            CHECK_EQ(&view.layout(), &values);
+        }
+
+        TEST_CASE("list_value")
+        {
+            const list_array lists(
+                array(primitive_array<std::int32_t>{0, 1, 2, 3, 4, 5}),
+                list_array::offset_from_sizes(std::vector<std::size_t>{2, 0, 4}),
+                false
+            );
+            const auto list = lists[2].value();
+            const auto view = list.child_view<primitive_array<std::int32_t>>();
+            REQUIRE_EQ(view.size(), 4);
+            for (std::size_t i = 0; i < view.size(); ++i)
+            {
+                CHECK_EQ(view[i].get(), static_cast<std::int32_t>(i + 2));
+            }
+            CHECK(lists[1].value().child_view<primitive_array<std::int32_t>>().empty());
+            CHECK_THROWS_AS(
+                std::ignore = list.child_view<primitive_array<std::int64_t>>(),
+                std::invalid_argument
+            );
+        }
+
+        TEST_CASE("struct_value")
+        {
+            std::vector<array> children;
+            children.emplace_back(primitive_array<std::int16_t>({std::int16_t(0), std::int16_t(1), std::int16_t(2)}));
+            children.emplace_back(string_array(std::vector<std::string>{"zero", "one", "two"}));
+            const struct_array structs(std::move(children), false);
+
+            const auto first = structs[0].value();
+            const auto ints = first.child_view<primitive_array<std::int16_t>>(0);
+            const auto strings = first.child_view<string_array>(1);
+            REQUIRE_EQ(ints.size(), 3);
+            for (std::size_t i = 0; i < structs.size(); ++i)
+            {
+                const auto value = structs[i].value();
+                CHECK_EQ(value.index(), i);
+                CHECK_EQ(ints[value.index()].get(), static_cast<std::int16_t>(i));
+            }
+            CHECK_EQ(strings[2].get(), "two");
+            CHECK_THROWS_AS(std::ignore = first.child_view<string_array>(0), std::invalid_argument);
+            CHECK_THROWS_AS(std::ignore = first.child_view<string_array>(2), std::out_of_range);
+        }
+
+        TEST_CASE("dictionary_encoded_array")
+        {
+            using array_type = dictionary_encoded_array<std::int32_t>;
+            using keys_buffer_type = typename array_type::keys_buffer_type;
+            const array_type dict(
+                keys_buffer_type{1, 0, 1},
+                array(string_array(std::vector<std::string>{"zero", "one"}))
+            );
+
+            const auto keys = dict.keys_view();
+            const auto values = dict.values_view<string_array>();
+            REQUIRE_EQ(keys.size(), 3);
+            REQUIRE_EQ(values.size(), 2);
+            CHECK_EQ(values[static_cast<std::size_t>(keys[0].get())].get(), "one");
+            CHECK_EQ(values[static_cast<std::size_t>(keys[1].get())].get(), "zero");
+            CHECK_THROWS_AS(std::ignore = dict.values_view<primitive_array<std::int32_t>>(), std::invalid_argument);
+        }
+    }
+}